@@ -0,0 +1,603 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/assign.hpp
+ *
+ * \brief Assignment of element-wise expressions to dense containers through
+ *  their storage arrays.
+ *
+ * An element-wise expression whose leaves are dense containers stored with the
+ * same layout as the destination container can be evaluated at the linear
+ * storage position of each element, without mapping it to a (row, column)
+ * pair: the expression tree is turned into a tree of flat evaluators, which
+ * only hold pointers to the storage arrays of the leaves, the scalar operands
+ * and the functors, and the assignment becomes a single loop over the storage
+ * array of the destination (which the compiler can vectorize).
+ * Long loops are split among threads (see \c parallel.hpp).
+ *
+ * Other expressions can still be assigned to dense containers by several
+ * threads, each assigning a block of consecutive rows (columns) of a row-major
+ * (column-major) matrix, or of consecutive elements of a vector.
+ *
+ * The following expressions have a flat evaluator: \c vector and \c matrix
+ * containers (and references to them), the ublasx functor expressions, and
+ * the uBLAS \c vector_unary, \c matrix_unary1 and \c matrix_binary
+ * expressions (e.g., <code>-A</code>, <code>conj(A)</code> or
+ * <code>A+B</code>).
+ * The other uBLAS expressions (among which \c vector_binary and the products
+ * by a scalar) do not expose their operands.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_ASSIGN_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_ASSIGN_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/fwd.hpp>
+#include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublasx/detail/parallel.hpp>
+#include <boost/numeric/ublasx/expression/matrix_binary_functor.hpp>
+#include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
+#include <boost/numeric/ublasx/expression/vector_binary_functor.hpp>
+#include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <algorithm>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+using namespace ::boost::numeric::ublas;
+
+
+/// Return a pointer to the first element of a storage array (or null if it is empty).
+template <typename ArrayT>
+BOOST_UBLAS_INLINE
+typename ArrayT::value_type const* flat_storage(ArrayT const& a)
+{
+    return a.size() > 0 ? &a[0] : 0;
+}
+
+
+template <typename ArrayT>
+BOOST_UBLAS_INLINE
+typename ArrayT::value_type* flat_storage(ArrayT& a)
+{
+    return a.size() > 0 ? &a[0] : 0;
+}
+
+
+/// Return the expression referred by a container reference.
+template <typename ExprT>
+BOOST_UBLAS_INLINE
+ExprT const& flat_operand(ExprT const& e)
+{
+    return e;
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+MatrixT const& flat_operand(matrix_reference<MatrixT> const& e)
+{
+    return e.expression();
+}
+
+
+template <typename VectorT>
+BOOST_UBLAS_INLINE
+VectorT const& flat_operand(vector_reference<VectorT> const& e)
+{
+    return e.expression();
+}
+
+
+/**
+ * \brief Evaluator of the element of an expression at a given position of the
+ *  storage array of a dense container.
+ * \tparam ExprT The type of the expression.
+ * \tparam OrientationT The orientation of the dense container (for matrix
+ *  expressions).
+ *
+ * The \c value member tells if the expression can be evaluated in such a way;
+ * if so, the evaluator is constructed from the expression and provides the
+ * element at storage position \c k by means of <code>operator[](k)</code>.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ExprT, typename OrientationT>
+struct flat_evaluator
+{
+    static const bool value = false;
+};
+
+
+/// Flat evaluator of an expression applying a unary operation to an operand.
+template <typename SubEvaluatorT, typename ValueT, typename FunctorT>
+struct flat_unary_evaluator
+{
+    static const bool value = SubEvaluatorT::value;
+
+    template <typename ExprT>
+    flat_unary_evaluator(ExprT const& e, FunctorT const& f)
+    : e_(flat_operand(e)),
+      f_(f)
+    {
+    }
+
+    ValueT operator[](::std::size_t k) const
+    {
+        return f_(e_[k]);
+    }
+
+    SubEvaluatorT e_;
+    mutable FunctorT f_;
+};
+
+
+/// Flat evaluator of an expression applying a binary operation to two operands.
+template <typename SubEvaluator1T, typename SubEvaluator2T, typename ValueT, typename FunctorT>
+struct flat_binary_evaluator
+{
+    static const bool value = SubEvaluator1T::value && SubEvaluator2T::value;
+
+    template <typename Expr1T, typename Expr2T>
+    flat_binary_evaluator(Expr1T const& e1, Expr2T const& e2, FunctorT const& f)
+    : e1_(flat_operand(e1)),
+      e2_(flat_operand(e2)),
+      f_(f)
+    {
+    }
+
+    ValueT operator[](::std::size_t k) const
+    {
+        return f_(e1_[k], e2_[k]);
+    }
+
+    SubEvaluator1T e1_;
+    SubEvaluator2T e2_;
+    mutable FunctorT f_;
+};
+
+
+/// Flat evaluator of a scalar operand.
+template <typename ValueT>
+struct flat_scalar_evaluator
+{
+    static const bool value = true;
+
+    explicit flat_scalar_evaluator(ValueT const& v)
+    : v_(v)
+    {
+    }
+
+    ValueT const& operator[](::std::size_t /*k*/) const
+    {
+        return v_;
+    }
+
+    ValueT v_;
+};
+
+
+/// Call the static \c apply member function of a uBLAS scalar functor.
+template <typename FunctorT>
+struct ublas_functor_caller
+{
+    template <typename ArgT>
+    typename FunctorT::result_type operator()(ArgT const& x) const
+    {
+        return FunctorT::apply(x);
+    }
+
+    template <typename Arg1T, typename Arg2T>
+    typename FunctorT::result_type operator()(Arg1T const& x, Arg2T const& y) const
+    {
+        return FunctorT::apply(x, y);
+    }
+};
+
+
+// Dense containers
+
+
+template <typename T, typename L, typename A, typename OrientationT>
+struct flat_evaluator<matrix<T,L,A>, OrientationT>
+{
+    static const bool value = ::boost::is_same<typename L::orientation_category, OrientationT>::value;
+
+    explicit flat_evaluator(matrix<T,L,A> const& m)
+    : p_(flat_storage(m.data()))
+    {
+    }
+
+    T const& operator[](::std::size_t k) const
+    {
+        return p_[k];
+    }
+
+    T const* p_;
+};
+
+
+template <typename T, typename A, typename OrientationT>
+struct flat_evaluator<vector<T,A>, OrientationT>
+{
+    static const bool value = true;
+
+    explicit flat_evaluator(vector<T,A> const& v)
+    : p_(flat_storage(v.data()))
+    {
+    }
+
+    T const& operator[](::std::size_t k) const
+    {
+        return p_[k];
+    }
+
+    T const* p_;
+};
+
+
+template <typename MatrixT, typename OrientationT>
+struct flat_evaluator<matrix_reference<MatrixT>, OrientationT>: flat_evaluator<typename ::boost::remove_const<MatrixT>::type, OrientationT>
+{
+    typedef flat_evaluator<typename ::boost::remove_const<MatrixT>::type, OrientationT> base_type;
+
+    explicit flat_evaluator(MatrixT const& m)
+    : base_type(m)
+    {
+    }
+};
+
+
+template <typename VectorT, typename OrientationT>
+struct flat_evaluator<vector_reference<VectorT>, OrientationT>: flat_evaluator<typename ::boost::remove_const<VectorT>::type, OrientationT>
+{
+    typedef flat_evaluator<typename ::boost::remove_const<VectorT>::type, OrientationT> base_type;
+
+    explicit flat_evaluator(VectorT const& v)
+    : base_type(v)
+    {
+    }
+};
+
+
+// ublasx functor expressions
+
+
+template <typename ExprT, typename SignatureT, typename OrientationT>
+struct flat_evaluator<matrix_unary_functor<ExprT,SignatureT>, OrientationT>
+: flat_unary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    typename matrix_unary_functor<ExprT,SignatureT>::value_type,
+    typename matrix_unary_functor<ExprT,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_unary_evaluator base_type;
+
+    explicit flat_evaluator(matrix_unary_functor<ExprT,SignatureT> const& e)
+    : base_type(e.expression(), e.functor())
+    {
+    }
+};
+
+
+template <typename ExprT, typename SignatureT, typename OrientationT>
+struct flat_evaluator<vector_unary_functor<ExprT,SignatureT>, OrientationT>
+: flat_unary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    typename vector_unary_functor<ExprT,SignatureT>::value_type,
+    typename vector_unary_functor<ExprT,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_unary_evaluator base_type;
+
+    explicit flat_evaluator(vector_unary_functor<ExprT,SignatureT> const& e)
+    : base_type(e.expression(), e.functor())
+    {
+    }
+};
+
+
+template <typename ExprT, typename Arg2T, typename SignatureT, typename OrientationT>
+struct flat_evaluator<matrix_binary_functor1<ExprT,Arg2T,SignatureT>, OrientationT>
+: flat_binary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    flat_scalar_evaluator<Arg2T>,
+    typename matrix_binary_functor1<ExprT,Arg2T,SignatureT>::value_type,
+    typename matrix_binary_functor1<ExprT,Arg2T,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_binary_evaluator base_type;
+
+    explicit flat_evaluator(matrix_binary_functor1<ExprT,Arg2T,SignatureT> const& e)
+    : base_type(e.expression(), e.argument2(), e.functor())
+    {
+    }
+};
+
+
+template <typename Arg1T, typename ExprT, typename SignatureT, typename OrientationT>
+struct flat_evaluator<matrix_binary_functor2<Arg1T,ExprT,SignatureT>, OrientationT>
+: flat_binary_evaluator<
+    flat_scalar_evaluator<Arg1T>,
+    flat_evaluator<ExprT, OrientationT>,
+    typename matrix_binary_functor2<Arg1T,ExprT,SignatureT>::value_type,
+    typename matrix_binary_functor2<Arg1T,ExprT,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_binary_evaluator base_type;
+
+    explicit flat_evaluator(matrix_binary_functor2<Arg1T,ExprT,SignatureT> const& e)
+    : base_type(e.argument1(), e.expression(), e.functor())
+    {
+    }
+};
+
+
+template <typename ExprT, typename Arg2T, typename SignatureT, typename OrientationT>
+struct flat_evaluator<vector_binary_functor1<ExprT,Arg2T,SignatureT>, OrientationT>
+: flat_binary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    flat_scalar_evaluator<Arg2T>,
+    typename vector_binary_functor1<ExprT,Arg2T,SignatureT>::value_type,
+    typename vector_binary_functor1<ExprT,Arg2T,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_binary_evaluator base_type;
+
+    explicit flat_evaluator(vector_binary_functor1<ExprT,Arg2T,SignatureT> const& e)
+    : base_type(e.expression(), e.argument2(), e.functor())
+    {
+    }
+};
+
+
+template <typename Arg1T, typename ExprT, typename SignatureT, typename OrientationT>
+struct flat_evaluator<vector_binary_functor2<Arg1T,ExprT,SignatureT>, OrientationT>
+: flat_binary_evaluator<
+    flat_scalar_evaluator<Arg1T>,
+    flat_evaluator<ExprT, OrientationT>,
+    typename vector_binary_functor2<Arg1T,ExprT,SignatureT>::value_type,
+    typename vector_binary_functor2<Arg1T,ExprT,SignatureT>::functor_type
+  >
+{
+    typedef typename flat_evaluator::flat_binary_evaluator base_type;
+
+    explicit flat_evaluator(vector_binary_functor2<Arg1T,ExprT,SignatureT> const& e)
+    : base_type(e.argument1(), e.expression(), e.functor())
+    {
+    }
+};
+
+
+// uBLAS element-wise expressions
+
+
+template <typename ExprT, typename FunctorT, typename OrientationT>
+struct flat_evaluator<matrix_unary1<ExprT,FunctorT>, OrientationT>
+: flat_unary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    typename FunctorT::result_type,
+    ublas_functor_caller<FunctorT>
+  >
+{
+    typedef typename flat_evaluator::flat_unary_evaluator base_type;
+
+    explicit flat_evaluator(matrix_unary1<ExprT,FunctorT> const& e)
+    : base_type(e.expression(), ublas_functor_caller<FunctorT>())
+    {
+    }
+};
+
+
+template <typename ExprT, typename FunctorT, typename OrientationT>
+struct flat_evaluator<vector_unary<ExprT,FunctorT>, OrientationT>
+: flat_unary_evaluator<
+    flat_evaluator<ExprT, OrientationT>,
+    typename FunctorT::result_type,
+    ublas_functor_caller<FunctorT>
+  >
+{
+    typedef typename flat_evaluator::flat_unary_evaluator base_type;
+
+    explicit flat_evaluator(vector_unary<ExprT,FunctorT> const& e)
+    : base_type(e.expression(), ublas_functor_caller<FunctorT>())
+    {
+    }
+};
+
+
+template <typename Expr1T, typename Expr2T, typename FunctorT, typename OrientationT>
+struct flat_evaluator<matrix_binary<Expr1T,Expr2T,FunctorT>, OrientationT>
+: flat_binary_evaluator<
+    flat_evaluator<Expr1T, OrientationT>,
+    flat_evaluator<Expr2T, OrientationT>,
+    typename FunctorT::result_type,
+    ublas_functor_caller<FunctorT>
+  >
+{
+    typedef typename flat_evaluator::flat_binary_evaluator base_type;
+
+    explicit flat_evaluator(matrix_binary<Expr1T,Expr2T,FunctorT> const& e)
+    : base_type(e.expression1(), e.expression2(), ublas_functor_caller<FunctorT>())
+    {
+    }
+};
+
+
+/// Assign the elements of a chunk of storage positions.
+template <typename ValueT, typename EvaluatorT>
+struct flat_assign_chunk
+{
+    flat_assign_chunk(ValueT* p, EvaluatorT const& ev)
+    : p_(p),
+      ev_(ev)
+    {
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        // Work on local copies, so that threads do not share functors and
+        // the compiler can keep the pointers in registers
+        ValueT* p(p_);
+        EvaluatorT ev(ev_);
+
+        for (::std::size_t i = lo; i < hi; ++i)
+        {
+            p[i] = ev[i];
+        }
+    }
+
+    ValueT* p_;
+    EvaluatorT ev_;
+};
+
+
+/**
+ * \brief Assign the \a n elements given by a flat evaluator to the storage
+ *  array starting at \a p, splitting long arrays among threads.
+ */
+template <typename ValueT, typename EvaluatorT>
+void flat_assign(ValueT* p, ::std::size_t n, EvaluatorT const& ev)
+{
+    parallel_for_chunks(parallel_num_chunks(n), n, flat_assign_chunk<ValueT,EvaluatorT>(p, ev));
+}
+
+
+/// Assign the elements of a chunk of rows (columns) of a row-major (column-major) dense matrix.
+template <typename MatrixT, typename ExprT>
+struct line_assign_chunk
+{
+    typedef typename MatrixT::size_type size_type;
+
+    line_assign_chunk(MatrixT& m, ExprT const& e)
+    : m_(&m),
+      e_(&e)
+    {
+    }
+
+    size_type num_lines() const
+    {
+        return num_lines(typename MatrixT::orientation_category());
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        apply(lo, hi, typename MatrixT::orientation_category());
+    }
+
+    size_type num_lines(row_major_tag) const
+    {
+        return m_->size1();
+    }
+
+    size_type num_lines(column_major_tag) const
+    {
+        return m_->size2();
+    }
+
+    void apply(size_type lo, size_type hi, row_major_tag) const
+    {
+        const size_type nc(m_->size2());
+
+        for (size_type r = lo; r < hi; ++r)
+        {
+            for (size_type c = 0; c < nc; ++c)
+            {
+                (*m_)(r,c) = (*e_)(r,c);
+            }
+        }
+    }
+
+    void apply(size_type lo, size_type hi, column_major_tag) const
+    {
+        const size_type nr(m_->size1());
+
+        for (size_type c = lo; c < hi; ++c)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+                (*m_)(r,c) = (*e_)(r,c);
+            }
+        }
+    }
+
+    MatrixT* m_;
+    ExprT const* e_;
+};
+
+
+/// Assign the elements of a chunk of a dense vector.
+template <typename VectorT, typename ExprT>
+struct element_assign_chunk
+{
+    element_assign_chunk(VectorT& v, ExprT const& e)
+    : v_(&v),
+      e_(&e)
+    {
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        for (::std::size_t i = lo; i < hi; ++i)
+        {
+            (*v_)(i) = (*e_)(i);
+        }
+    }
+
+    VectorT* v_;
+    ExprT const* e_;
+};
+
+
+/**
+ * \brief Assign a matrix expression to a dense matrix, splitting the rows
+ *  (columns) of a row-major (column-major) matrix into blocks of consecutive
+ *  lines assigned by different threads.
+ *
+ * The elements of the expression are accessed by their (row, column) pair,
+ * so that any expression can be assigned.
+ */
+template <typename MatrixT, typename ExprT>
+void line_assign(MatrixT& m, ExprT const& e)
+{
+    typedef line_assign_chunk<MatrixT,ExprT> chunk_type;
+
+    chunk_type chunk(m, e);
+    ::std::size_t nlines(chunk.num_lines());
+    ::std::size_t nchunks(::std::min(parallel_num_chunks(m.size1()*m.size2()), nlines));
+
+    parallel_for_chunks(nchunks, nlines, chunk);
+}
+
+
+/**
+ * \brief Assign a vector expression to a dense vector, splitting it into
+ *  blocks of consecutive elements assigned by different threads.
+ */
+template <typename VectorT, typename ExprT>
+void element_assign(VectorT& v, ExprT const& e)
+{
+    ::std::size_t n(v.size());
+
+    parallel_for_chunks(parallel_num_chunks(n), n, element_assign_chunk<VectorT,ExprT>(v, e));
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_ASSIGN_HPP
@@ -0,0 +1,67 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/functor.hpp
+ *
+ * \brief Support for functor expressions.
+ *
+ * The functor expressions (e.g., \c vector_unary_functor) accept as functor
+ * template parameter either a function signature (e.g., \c double(double)) or
+ * a functor type (i.e., a class type exposing a \c result_type typedef).
+ * In the former case the functor is stored into a \c boost::function (i.e.,
+ * it is type-erased and called through an indirect call), while in the latter
+ * case the functor is stored and called as-is, so that the compiler is able
+ * to inline it.
+ * Either way, the expressions (and the flat evaluators of \c assign_fast) keep
+ * the functor in a \c mutable member, so that functors with a non-const call
+ * operator (e.g., with a state updated at every call) are allowed, as they
+ * were through \c boost::function; such functors are only called in order by
+ * a sequential evaluation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_FUNCTOR_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_FUNCTOR_HPP
+
+
+#include <boost/function.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+/// Functor type for a functor class: the functor is used as-is.
+template <typename SignatureT>
+struct functor_type_traits
+{
+    typedef SignatureT type;
+};
+
+
+/// Functor type for a unary function signature: the functor is type-erased.
+template <typename R, typename A>
+struct functor_type_traits<R (A)>
+{
+    typedef ::boost::function<R (A)> type;
+};
+
+
+/// Functor type for a binary function signature: the functor is type-erased.
+template <typename R, typename A1, typename A2>
+struct functor_type_traits<R (A1, A2)>
+{
+    typedef ::boost::function<R (A1, A2)> type;
+};
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_FUNCTOR_HPP
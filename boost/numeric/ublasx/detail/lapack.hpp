@@ -20,6 +20,11 @@
 #define BOOST_NUMERIC_UBLASX_DETAIL_LAPACK_HPP
 
 
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <complex>
 #include <cstddef>
 
 
@@ -28,6 +33,90 @@ namespace boost { namespace numeric { namespace ublasx { namespace detail { name
 /// The minimum dimension we can assign to LAPACK arrays.
 static const std::size_t min_array_size = 1;
 
+
+/**
+ * \brief Tell if the operations having their own implementation (e.g., the LU
+ *  factorization) can dispatch to LAPACK.
+ *
+ * It is enabled by defining the \c BOOST_UBLASX_USE_LAPACK macro (before
+ * including any ublasx header), in which case LAPACK must be linked.
+ */
+#ifdef BOOST_UBLASX_USE_LAPACK
+static const bool enabled = true;
+#else
+static const bool enabled = false;
+#endif // BOOST_UBLASX_USE_LAPACK
+
+
+/// Tell if LAPACK provides routines for the given value type.
+template <typename T>
+struct is_supported_value_type: ::boost::false_type
+{
+};
+
+template <>
+struct is_supported_value_type<float>: ::boost::true_type
+{
+};
+
+template <>
+struct is_supported_value_type<double>: ::boost::true_type
+{
+};
+
+template <>
+struct is_supported_value_type< ::std::complex<float> >: ::boost::true_type
+{
+};
+
+template <>
+struct is_supported_value_type< ::std::complex<double> >: ::boost::true_type
+{
+};
+
+
+/**
+ * \brief Tell if the given matrix type can be passed as-is to LAPACK, that is
+ *  if it is a dense column-major container whose value type is supported by
+ *  LAPACK.
+ */
+template <typename MatrixT>
+struct is_supported_matrix: ::boost::integral_constant<
+                                bool,
+                                ::boost::is_same<
+                                    typename ::boost::numeric::ublas::matrix_traits<MatrixT>::orientation_category,
+                                    ::boost::numeric::ublas::column_major_tag
+                                >::value
+                                && ::boost::is_same<
+                                    typename ::boost::numeric::ublas::matrix_traits<MatrixT>::storage_category,
+                                    ::boost::numeric::ublas::dense_tag
+                                >::value
+                                && is_supported_value_type<
+                                    typename ::boost::numeric::ublas::matrix_traits<MatrixT>::value_type
+                                >::value
+                            >
+{
+};
+
+
+/**
+ * \brief Tell if the given vector type can be passed as-is to LAPACK, that is
+ *  if it is a dense container whose value type is supported by LAPACK.
+ */
+template <typename VectorT>
+struct is_supported_vector: ::boost::integral_constant<
+                                bool,
+                                ::boost::is_same<
+                                    typename ::boost::numeric::ublas::vector_traits<VectorT>::storage_category,
+                                    ::boost::numeric::ublas::dense_tag
+                                >::value
+                                && is_supported_value_type<
+                                    typename ::boost::numeric::ublas::vector_traits<VectorT>::value_type
+                                >::value
+                            >
+{
+};
+
 }}}}} // Namespace boost::numeric::ublasx::detail::lapack
 
 
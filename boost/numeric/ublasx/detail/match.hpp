@@ -0,0 +1,383 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/match.hpp
+ *
+ * \brief Visit the elements of a vector or matrix expression which satisfy a
+ *  given unary predicate.
+ *
+ * Elements of dense expressions are visited in storage order.
+ * For sparse and packed expressions only the stored elements are visited
+ * (through the expression iterators), unless the predicate is satisfied by
+ * zero, in which case every element must be checked.
+ *
+ * The matching elements of a matrix expression are reported in column-major
+ * order (as linear indices are in MATLAB), whatever the storage layout.
+ * The matches of a matrix expression which is not column-major are collected
+ * in storage order and then sorted by column with a (stable) counting sort,
+ * which takes linear time.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_MATCH_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_MATCH_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <cstddef>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+using namespace ::boost::numeric::ublas;
+
+
+/// Predicate telling if its argument is different from zero.
+template <typename ValueT>
+struct nonzero_predicate
+{
+    typedef ValueT argument_type;
+    typedef bool result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return x != argument_type(0);
+    }
+};
+
+
+/// Call \c f(r,c,x) only for the elements \c x satisfying a predicate.
+template <typename UnaryPredicateT, typename FunctorT>
+struct match_filter
+{
+    match_filter(UnaryPredicateT const& p, FunctorT& f)
+    : p_(p),
+      f_(f)
+    {
+    }
+
+    template <typename SizeT, typename ValueT>
+    void operator()(SizeT r, SizeT c, ValueT const& x)
+    {
+        if (p_(x))
+        {
+            f_(r, c, x);
+        }
+    }
+
+    UnaryPredicateT p_;
+    FunctorT& f_;
+};
+
+
+/**
+ * \brief Auxiliary class for visiting the matching elements of a vector or
+ *  matrix expression.
+ * \tparam Dense Tells if the expression has a dense storage category.
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag);
+ *  \c void for vector expressions.
+ */
+template <bool Dense, typename OrientationT>
+struct for_each_match_impl;
+
+
+template <>
+struct for_each_match_impl<true, void>
+{
+    template <typename VectorExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p, FunctorT& f)
+    {
+        typedef typename vector_traits<VectorExprT>::size_type size_type;
+        typedef typename vector_traits<VectorExprT>::value_type value_type;
+
+        size_type n = size(ve);
+        for (size_type i = 0; i < n; ++i)
+        {
+            value_type x = ve()(i);
+            if (p(x))
+            {
+                f(i, x);
+            }
+        }
+    }
+};
+
+
+template <>
+struct for_each_match_impl<false, void>
+{
+    template <typename VectorExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p, FunctorT& f)
+    {
+        typedef typename vector_traits<VectorExprT>::value_type value_type;
+        typedef typename VectorExprT::const_iterator iterator_type;
+
+        if (p(value_type(0)))
+        {
+            // Elements which are not stored satisfy the predicate too
+            for_each_match_impl<true, void>::apply(ve, p, f);
+            return;
+        }
+
+        iterator_type it_end = ve().end();
+        for (iterator_type it = ve().begin(); it != it_end; ++it)
+        {
+            if (p(*it))
+            {
+                f(it.index(), *it);
+            }
+        }
+    }
+};
+
+
+template <typename OrientationT>
+struct for_each_match_impl<true, OrientationT>
+{
+    template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+    {
+        match_filter<UnaryPredicateT,FunctorT> filter(p, f);
+
+        for_each_in_storage_order(me, filter);
+    }
+};
+
+
+template <>
+struct for_each_match_impl<false, row_major_tag>
+{
+    template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename MatrixExprT::const_iterator1 row_iterator_type;
+        typedef typename MatrixExprT::const_iterator2 col_iterator_type;
+
+        if (p(value_type(0)))
+        {
+            for_each_match_impl<true, row_major_tag>::apply(me, p, f);
+            return;
+        }
+
+        row_iterator_type row_it_end = me().end1();
+        for (row_iterator_type row_it = me().begin1(); row_it != row_it_end; ++row_it)
+        {
+            col_iterator_type col_it_end = row_it.end();
+            for (col_iterator_type col_it = row_it.begin(); col_it != col_it_end; ++col_it)
+            {
+                if (p(*col_it))
+                {
+                    f(col_it.index1(), col_it.index2(), *col_it);
+                }
+            }
+        }
+    }
+};
+
+
+template <>
+struct for_each_match_impl<false, column_major_tag>
+{
+    template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename MatrixExprT::const_iterator2 col_iterator_type;
+        typedef typename MatrixExprT::const_iterator1 row_iterator_type;
+
+        if (p(value_type(0)))
+        {
+            for_each_match_impl<true, column_major_tag>::apply(me, p, f);
+            return;
+        }
+
+        col_iterator_type col_it_end = me().end2();
+        for (col_iterator_type col_it = me().begin2(); col_it != col_it_end; ++col_it)
+        {
+            row_iterator_type row_it_end = col_it.end();
+            for (row_iterator_type row_it = col_it.begin(); row_it != row_it_end; ++row_it)
+            {
+                if (p(*row_it))
+                {
+                    f(row_it.index1(), row_it.index2(), *row_it);
+                }
+            }
+        }
+    }
+};
+
+
+template <>
+struct for_each_match_impl<false, unknown_orientation_tag>: for_each_match_impl<false, row_major_tag>
+{
+    // Empty
+};
+
+
+/// Buffer the visited elements and then replay them in column-major order.
+template <typename SizeT, typename ValueT>
+class column_order_buffer
+{
+    private: struct element_type
+    {
+        SizeT row;
+        SizeT column;
+        ValueT value;
+    };
+
+
+    public: explicit column_order_buffer(SizeT nc)
+    : counts_(nc+1, 0)
+    {
+    }
+
+
+    public: void operator()(SizeT r, SizeT c, ValueT const& x)
+    {
+        element_type elem = {r, c, x};
+
+        elems_.push_back(elem);
+        ++counts_[c+1];
+    }
+
+
+    /// Call \c f(r,c,x) for every buffered element, column by column; within
+    /// a column, the elements keep the order they have been visited in.
+    public: template <typename FunctorT>
+    void replay(FunctorT& f)
+    {
+        ::std::size_t ne = elems_.size();
+        SizeT nc = counts_.size()-1;
+
+        // counts_[c] becomes the position of the first element of column c
+        for (SizeT c = 0; c < nc; ++c)
+        {
+            counts_[c+1] += counts_[c];
+        }
+
+        ::std::vector< ::std::size_t> order(ne);
+        for (::std::size_t k = 0; k < ne; ++k)
+        {
+            order[counts_[elems_[k].column]++] = k;
+        }
+
+        for (::std::size_t k = 0; k < ne; ++k)
+        {
+            element_type const& elem = elems_[order[k]];
+
+            f(elem.row, elem.column, elem.value);
+        }
+    }
+
+
+    private: ::std::vector<element_type> elems_;
+    private: ::std::vector<SizeT> counts_;
+};
+
+
+/**
+ * \brief Auxiliary class for visiting the matching elements of a matrix
+ *  expression in column-major order.
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ */
+template <typename OrientationT>
+struct for_each_match_column_major_impl
+{
+    template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+        column_order_buffer<size_type,value_type> buffer(num_columns(me));
+
+        for_each_match_impl<
+            ::boost::is_convertible<typename MatrixExprT::storage_category, dense_proxy_tag>::value,
+            OrientationT
+        >::apply(me, p, buffer);
+
+        buffer.replay(f);
+    }
+};
+
+
+template <>
+struct for_each_match_column_major_impl<column_major_tag>
+{
+    template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+    {
+        // The storage order is already the column-major order
+        for_each_match_impl<
+            ::boost::is_convertible<typename MatrixExprT::storage_category, dense_proxy_tag>::value,
+            column_major_tag
+        >::apply(me, p, f);
+    }
+};
+
+
+/**
+ * \brief Call \c f(i,x) for every element \c x at position \c i of the given
+ *  vector expression which satisfies the given unary predicate, by increasing
+ *  position.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT, typename UnaryPredicateT, typename FunctorT>
+BOOST_UBLAS_INLINE
+void for_each_match(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p, FunctorT& f)
+{
+    for_each_match_impl<
+        ::boost::is_convertible<typename VectorExprT::storage_category, dense_proxy_tag>::value,
+        void
+    >::apply(ve, p, f);
+}
+
+
+/**
+ * \brief Call \c f(r,c,x) for every element \c x at row \c r and column \c c
+ *  of the given matrix expression which satisfies the given unary predicate,
+ *  in column-major order (i.e., column by column and, within a column, by
+ *  increasing row), whatever the storage layout of the matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename UnaryPredicateT, typename FunctorT>
+BOOST_UBLAS_INLINE
+void for_each_match(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p, FunctorT& f)
+{
+    for_each_match_column_major_impl<
+        typename matrix_traits<MatrixExprT>::orientation_category
+    >::apply(me, p, f);
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_MATCH_HPP
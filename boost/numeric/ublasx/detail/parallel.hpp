@@ -0,0 +1,139 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/parallel.hpp
+ *
+ * \brief Split a range of work items into chunks processed by concurrent
+ *  threads.
+ *
+ * The number of threads is the number of hardware threads, unless the
+ * \c BOOST_UBLASX_NUM_THREADS macro is defined to a positive number.
+ * Defining the \c BOOST_UBLASX_DISABLE_THREADS macro makes every chunk be
+ * processed by the calling thread.
+ * The threads are taken from a pool created on first use (see
+ * \c thread_pool.hpp), so that short parallel operations do not pay for
+ * starting new threads.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_PARALLEL_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_PARALLEL_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <algorithm>
+#include <cstddef>
+#ifndef BOOST_UBLASX_DISABLE_THREADS
+# include <boost/numeric/ublasx/detail/thread_pool.hpp>
+# include <thread>
+#endif // BOOST_UBLASX_DISABLE_THREADS
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+/// The minimum number of elements worth to be processed by a separate thread.
+static const ::std::size_t parallel_grain_size = 1 << 16;
+
+
+/// Return the maximum number of threads used to process a range.
+BOOST_UBLAS_INLINE
+::std::size_t parallel_max_threads()
+{
+#if defined(BOOST_UBLASX_DISABLE_THREADS)
+    return 1;
+#elif defined(BOOST_UBLASX_NUM_THREADS)
+    return BOOST_UBLASX_NUM_THREADS;
+#else
+    static const ::std::size_t nt = ::std::max(::std::thread::hardware_concurrency(), 1U);
+    return nt;
+#endif
+}
+
+
+/**
+ * \brief Return the number of chunks a range of \a n elements should be split
+ *  into, so that each chunk has at least \a grain elements.
+ */
+template <typename SizeT>
+BOOST_UBLAS_INLINE
+SizeT parallel_num_chunks(SizeT n, SizeT grain = parallel_grain_size)
+{
+    return ::std::max(::std::min(static_cast<SizeT>(parallel_max_threads()), n/grain), SizeT(1));
+}
+
+
+#ifndef BOOST_UBLASX_DISABLE_THREADS
+
+/// Call a chunk functor on the bounds of the k-th chunk.
+template <typename SizeT, typename FunctorT>
+struct parallel_chunk_runner
+{
+    parallel_chunk_runner(FunctorT const& f, SizeT nchunks, SizeT n)
+    : f_(&f),
+      nchunks_(nchunks),
+      n_(n)
+    {
+    }
+
+    void operator()(::std::size_t k) const
+    {
+        (*f_)(SizeT(k), SizeT(k)*n_/nchunks_, SizeT(k+1)*n_/nchunks_);
+    }
+
+    FunctorT const* f_;
+    SizeT nchunks_;
+    SizeT n_;
+};
+
+#endif // BOOST_UBLASX_DISABLE_THREADS
+
+
+/**
+ * \brief Split the range <code>[0,n)</code> into \a nchunks chunks of about
+ *  the same size and call \c f(k,first,last) for each chunk \c k in a separate
+ *  thread.
+ * \tparam SizeT The size type.
+ * \tparam FunctorT The type of the functor.
+ * \param nchunks The number of chunks.
+ * \param n The number of elements of the range.
+ * \param f The functor to call on each chunk <code>[first,last)</code>.
+ *
+ * The chunks are processed by the calling thread and by the worker threads of
+ * a shared pool (see \c thread_pool.hpp), and the calling thread returns once
+ * every chunk has been processed.
+ * If some call to \a f throws, one of the exceptions is rethrown.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename SizeT, typename FunctorT>
+void parallel_for_chunks(SizeT nchunks, SizeT n, FunctorT const& f)
+{
+#ifdef BOOST_UBLASX_DISABLE_THREADS
+    for (SizeT k = 0; k < nchunks; ++k)
+    {
+        f(k, k*n/nchunks, (k+1)*n/nchunks);
+    }
+#else // BOOST_UBLASX_DISABLE_THREADS
+    if (nchunks < 2)
+    {
+        f(SizeT(0), SizeT(0), n);
+        return;
+    }
+
+    thread_pool::instance(parallel_max_threads()).run(nchunks, parallel_chunk_runner<SizeT,FunctorT>(f, nchunks, n));
+#endif // BOOST_UBLASX_DISABLE_THREADS
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_PARALLEL_HPP
@@ -0,0 +1,631 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/predicate.hpp
+ *
+ * \brief Block-wise kernels for testing a predicate over a range of elements,
+ *  with early exit.
+ *
+ * Testing the elements one at a time and leaving the loop at the first one
+ * which decides the result puts a branch in every iteration, which prevents
+ * the compiler from vectorizing the loop.
+ * The kernels below test the elements by blocks of fixed size instead: the
+ * predicate results of a block are combined without branches (so that the
+ * inner loop can be vectorized), and the early exit is checked only once per
+ * block.
+ * Results are combined as unsigned integers rather than as \c bool, which
+ * compilers do not vectorize reductions of.
+ * As a consequence, the predicate may be called on some elements following
+ * the one which decides the result; predicates must not have side effects.
+ *
+ * Elements are accessed through an indexed predicate, that is a functor \c p
+ * such that \c p(i) tells if the \c i-th element of the range satisfies the
+ * predicate.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_PREDICATE_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_PREDICATE_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+using namespace ::boost::numeric::ublas;
+
+
+/// The number of elements tested between two checks for early exit.
+static const ::std::size_t predicate_block_size = 64;
+
+
+/**
+ * \brief Tell if at least one of the \a n elements of a range satisfies the
+ *  given indexed predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename SizeT, typename IndexedPredicateT>
+BOOST_UBLAS_INLINE
+bool block_any(SizeT n, IndexedPredicateT const& p)
+{
+    SizeT i = 0;
+    for (; (i+predicate_block_size) <= n; i += predicate_block_size)
+    {
+        unsigned int found = 0;
+        for (SizeT k = 0; k < predicate_block_size; ++k)
+        {
+            found |= static_cast<unsigned int>(static_cast<bool>(p(i+k)));
+        }
+        if (found)
+        {
+            return true;
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if (p(i))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**
+ * \brief Tell if all the \a n elements of a range satisfy the given indexed
+ *  predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename SizeT, typename IndexedPredicateT>
+BOOST_UBLAS_INLINE
+bool block_all(SizeT n, IndexedPredicateT const& p)
+{
+    SizeT i = 0;
+    for (; (i+predicate_block_size) <= n; i += predicate_block_size)
+    {
+        unsigned int satisfied = 1;
+        for (SizeT k = 0; k < predicate_block_size; ++k)
+        {
+            satisfied &= static_cast<unsigned int>(static_cast<bool>(p(i+k)));
+        }
+        if (!satisfied)
+        {
+            return false;
+        }
+    }
+    for (; i < n; ++i)
+    {
+        if (!p(i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/// Test a unary predicate on the elements of an array.
+template <typename RandomAccessIteratorT, typename UnaryPredicateT>
+struct array_indexed_predicate
+{
+    array_indexed_predicate(RandomAccessIteratorT first, UnaryPredicateT const& p)
+    : first_(first),
+      p_(p)
+    {
+    }
+
+    template <typename SizeT>
+    bool operator()(SizeT i) const
+    {
+        return p_(first_[i]);
+    }
+
+    RandomAccessIteratorT first_;
+    UnaryPredicateT p_;
+};
+
+
+/// Test a binary predicate on the pairs of elements of two arrays.
+template <typename RandomAccessIterator1T, typename RandomAccessIterator2T, typename BinaryPredicateT>
+struct array_indexed_binary_predicate
+{
+    array_indexed_binary_predicate(RandomAccessIterator1T first1, RandomAccessIterator2T first2, BinaryPredicateT const& p)
+    : first1_(first1),
+      first2_(first2),
+      p_(p)
+    {
+    }
+
+    template <typename SizeT>
+    bool operator()(SizeT i) const
+    {
+        return p_(first1_[i], first2_[i]);
+    }
+
+    RandomAccessIterator1T first1_;
+    RandomAccessIterator2T first2_;
+    BinaryPredicateT p_;
+};
+
+
+/// Test a unary predicate on the elements of a vector expression.
+template <typename VectorExprT, typename UnaryPredicateT>
+struct vector_indexed_predicate
+{
+    vector_indexed_predicate(VectorExprT const& ve, UnaryPredicateT const& p)
+    : ve_(ve),
+      p_(p)
+    {
+    }
+
+    template <typename SizeT>
+    bool operator()(SizeT i) const
+    {
+        return p_(ve_(i));
+    }
+
+    VectorExprT const& ve_;
+    UnaryPredicateT p_;
+};
+
+
+/// Test a binary predicate on the pairs of elements of two vector expressions.
+template <typename VectorExpr1T, typename VectorExpr2T, typename BinaryPredicateT>
+struct vector_indexed_binary_predicate
+{
+    vector_indexed_binary_predicate(VectorExpr1T const& ve1, VectorExpr2T const& ve2, BinaryPredicateT const& p)
+    : ve1_(ve1),
+      ve2_(ve2),
+      p_(p)
+    {
+    }
+
+    template <typename SizeT>
+    bool operator()(SizeT i) const
+    {
+        return p_(ve1_(i), ve2_(i));
+    }
+
+    VectorExpr1T const& ve1_;
+    VectorExpr2T const& ve2_;
+    BinaryPredicateT p_;
+};
+
+
+/**
+ * \brief Access the elements of a line (i.e., a row or a column) of a matrix
+ *  expression.
+ * \tparam OrientationT The orientation category type: the lines are rows for
+ *  \c row_major_tag and columns for \c column_major_tag.
+ */
+template <typename OrientationT>
+struct matrix_line_traits;
+
+
+template <>
+struct matrix_line_traits<row_major_tag>
+{
+    template <typename MatrixExprT>
+    static typename matrix_traits<MatrixExprT>::size_type num_lines(MatrixExprT const& me)
+    {
+        return me.size1();
+    }
+
+    template <typename MatrixExprT>
+    static typename matrix_traits<MatrixExprT>::size_type line_size(MatrixExprT const& me)
+    {
+        return me.size2();
+    }
+
+    template <typename MatrixExprT, typename SizeT>
+    static typename MatrixExprT::const_reference element(MatrixExprT const& me, SizeT line, SizeT i)
+    {
+        return me(line, i);
+    }
+};
+
+
+template <>
+struct matrix_line_traits<column_major_tag>
+{
+    template <typename MatrixExprT>
+    static typename matrix_traits<MatrixExprT>::size_type num_lines(MatrixExprT const& me)
+    {
+        return me.size2();
+    }
+
+    template <typename MatrixExprT>
+    static typename matrix_traits<MatrixExprT>::size_type line_size(MatrixExprT const& me)
+    {
+        return me.size1();
+    }
+
+    template <typename MatrixExprT, typename SizeT>
+    static typename MatrixExprT::const_reference element(MatrixExprT const& me, SizeT line, SizeT i)
+    {
+        return me(i, line);
+    }
+};
+
+
+template <>
+struct matrix_line_traits<unknown_orientation_tag>: matrix_line_traits<row_major_tag>
+{
+    // Empty
+};
+
+
+/// Test a unary predicate on the elements of a line of a matrix expression.
+template <typename MatrixExprT, typename UnaryPredicateT, typename OrientationT>
+struct matrix_line_indexed_predicate
+{
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+
+    matrix_line_indexed_predicate(MatrixExprT const& me, size_type line, UnaryPredicateT const& p)
+    : me_(me),
+      line_(line),
+      p_(p)
+    {
+    }
+
+    bool operator()(size_type i) const
+    {
+        return p_(matrix_line_traits<OrientationT>::element(me_, line_, i));
+    }
+
+    MatrixExprT const& me_;
+    size_type line_;
+    UnaryPredicateT p_;
+};
+
+
+/**
+ * \brief Test a binary predicate on the pairs of elements of a line of two
+ *  matrix expressions.
+ */
+template <typename MatrixExpr1T, typename MatrixExpr2T, typename BinaryPredicateT, typename OrientationT>
+struct matrix_line_indexed_binary_predicate
+{
+    typedef typename matrix_traits<MatrixExpr1T>::size_type size_type;
+
+    matrix_line_indexed_binary_predicate(MatrixExpr1T const& me1, MatrixExpr2T const& me2, size_type line, BinaryPredicateT const& p)
+    : me1_(me1),
+      me2_(me2),
+      line_(line),
+      p_(p)
+    {
+    }
+
+    bool operator()(size_type i) const
+    {
+        return p_(matrix_line_traits<OrientationT>::element(me1_, line_, i),
+                  matrix_line_traits<OrientationT>::element(me2_, line_, i));
+    }
+
+    MatrixExpr1T const& me1_;
+    MatrixExpr2T const& me2_;
+    size_type line_;
+    BinaryPredicateT p_;
+};
+
+
+/**
+ * \brief Auxiliary class for testing a predicate over all the elements of a
+ *  vector or matrix expression.
+ * \tparam Contiguous Tells if the expression is a dense container whose
+ *  elements can be accessed through its storage array.
+ *
+ * Each \c apply function returns \c true if there is an element for which the
+ * predicate is equal to \a Expect, that is if \c any(p) holds when \a Expect
+ * is \c true and if \c all(p) does not hold when \a Expect is \c false.
+ */
+template <bool Contiguous>
+struct predicate_search_impl;
+
+
+template <>
+struct predicate_search_impl<true>
+{
+    template <bool Expect, typename VectorExprT, typename UnaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p)
+    {
+        return search<Expect>(size(ve), ve().data().begin(), p);
+    }
+
+    template <bool Expect, typename MatrixExprT, typename UnaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p)
+    {
+        return search<Expect>(num_rows(me)*num_columns(me), me().data().begin(), p);
+    }
+
+    template <bool Expect, typename SizeT, typename RandomAccessIteratorT, typename UnaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool search(SizeT n, RandomAccessIteratorT first, UnaryPredicateT const& p)
+    {
+        array_indexed_predicate<RandomAccessIteratorT,UnaryPredicateT> ip(first, p);
+
+        return Expect ? block_any(n, ip) : !block_all(n, ip);
+    }
+};
+
+
+template <>
+struct predicate_search_impl<false>
+{
+    template <bool Expect, typename VectorExprT, typename UnaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p)
+    {
+        vector_indexed_predicate<VectorExprT,UnaryPredicateT> ip(ve(), p);
+
+        return Expect ? block_any(size(ve), ip) : !block_all(size(ve), ip);
+    }
+
+    template <bool Expect, typename MatrixExprT, typename UnaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
+        typedef matrix_line_traits<orientation_category> line_traits;
+        typedef matrix_line_indexed_predicate<MatrixExprT,UnaryPredicateT,orientation_category> indexed_predicate_type;
+
+        size_type nl = line_traits::num_lines(me());
+        size_type n = line_traits::line_size(me());
+        for (size_type l = 0; l < nl; ++l)
+        {
+            indexed_predicate_type ip(me(), l, p);
+
+            if (Expect ? block_any(n, ip) : !block_all(n, ip))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+
+/**
+ * \brief Tell if at least one element of the given vector expression satisfies
+ *  the given unary predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+bool any_of(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p)
+{
+    return predicate_search_impl<has_contiguous_storage<VectorExprT>::value>::template apply<true>(ve, p);
+}
+
+
+/**
+ * \brief Tell if all the elements of the given vector expression satisfy the
+ *  given unary predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+bool all_of(vector_expression<VectorExprT> const& ve, UnaryPredicateT const& p)
+{
+    return !predicate_search_impl<has_contiguous_storage<VectorExprT>::value>::template apply<false>(ve, p);
+}
+
+
+/**
+ * \brief Tell if at least one element of the given matrix expression satisfies
+ *  the given unary predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+bool any_of(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p)
+{
+    return predicate_search_impl<has_contiguous_storage<MatrixExprT>::value>::template apply<true>(me, p);
+}
+
+
+/**
+ * \brief Tell if all the elements of the given matrix expression satisfy the
+ *  given unary predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+bool all_of(matrix_expression<MatrixExprT> const& me, UnaryPredicateT const& p)
+{
+    return !predicate_search_impl<has_contiguous_storage<MatrixExprT>::value>::template apply<false>(me, p);
+}
+
+
+/**
+ * \brief Tell if the \a n elements of two arrays of the same integral type are
+ *  equal, by comparing their object representations.
+ */
+template <typename ValueT, typename SizeT>
+BOOST_UBLAS_INLINE
+bool array_all_of_pairs(SizeT n, ValueT const* first1, ValueT const* first2, ::std::equal_to<ValueT> const&, ::boost::true_type)
+{
+    return n == 0 || ::std::memcmp(first1, first2, n*sizeof(ValueT)) == 0;
+}
+
+
+/// Tell if all the pairs of elements of two arrays satisfy a binary predicate.
+template <typename RandomAccessIterator1T, typename RandomAccessIterator2T, typename SizeT, typename BinaryPredicateT>
+BOOST_UBLAS_INLINE
+bool array_all_of_pairs(SizeT n, RandomAccessIterator1T first1, RandomAccessIterator2T first2, BinaryPredicateT const& p, ::boost::false_type)
+{
+    return block_all(n, array_indexed_binary_predicate<RandomAccessIterator1T,RandomAccessIterator2T,BinaryPredicateT>(first1, first2, p));
+}
+
+
+/**
+ * \brief Tell if all the pairs of elements of two arrays satisfy a binary
+ *  predicate, comparing the object representations when the predicate is the
+ *  exact equality of integral values of the same type.
+ *
+ * Floating-point values cannot be compared this way, since positive and
+ * negative zeros compare equal while NaNs do not.
+ */
+template <typename RandomAccessIterator1T, typename RandomAccessIterator2T, typename SizeT, typename BinaryPredicateT>
+BOOST_UBLAS_INLINE
+bool array_all_of_pairs(SizeT n, RandomAccessIterator1T first1, RandomAccessIterator2T first2, BinaryPredicateT const& p)
+{
+    typedef typename ::std::iterator_traits<RandomAccessIterator1T>::value_type value1_type;
+    typedef typename ::std::iterator_traits<RandomAccessIterator2T>::value_type value2_type;
+
+    return array_all_of_pairs(n, first1, first2, p,
+                              ::boost::integral_constant<bool,
+                                    ::boost::is_integral<value1_type>::value
+                                    && ::boost::is_same<value1_type,value2_type>::value
+                                    && ::boost::is_same<BinaryPredicateT, ::std::equal_to<value1_type> >::value
+                                    && ::boost::is_pointer<RandomAccessIterator1T>::value
+                                    && ::boost::is_pointer<RandomAccessIterator2T>::value>());
+}
+
+
+/**
+ * \brief Auxiliary class for testing a binary predicate over all the pairs of
+ *  elements of two vector or matrix expressions of the same size.
+ * \tparam Contiguous Tells if both expressions are dense containers whose
+ *  elements are stored in the same order and can be accessed through their
+ *  storage arrays.
+ */
+template <bool Contiguous>
+struct all_of_pairs_impl;
+
+
+template <>
+struct all_of_pairs_impl<true>
+{
+    template <typename VectorExpr1T, typename VectorExpr2T, typename BinaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(vector_expression<VectorExpr1T> const& ve1, vector_expression<VectorExpr2T> const& ve2, BinaryPredicateT const& p)
+    {
+        return array_all_of_pairs(size(ve1), ve1().data().begin(), ve2().data().begin(), p);
+    }
+
+    template <typename MatrixExpr1T, typename MatrixExpr2T, typename BinaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(matrix_expression<MatrixExpr1T> const& me1, matrix_expression<MatrixExpr2T> const& me2, BinaryPredicateT const& p)
+    {
+        return array_all_of_pairs(num_rows(me1)*num_columns(me1), me1().data().begin(), me2().data().begin(), p);
+    }
+};
+
+
+template <>
+struct all_of_pairs_impl<false>
+{
+    template <typename VectorExpr1T, typename VectorExpr2T, typename BinaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(vector_expression<VectorExpr1T> const& ve1, vector_expression<VectorExpr2T> const& ve2, BinaryPredicateT const& p)
+    {
+        return block_all(size(ve1), vector_indexed_binary_predicate<VectorExpr1T,VectorExpr2T,BinaryPredicateT>(ve1(), ve2(), p));
+    }
+
+    template <typename MatrixExpr1T, typename MatrixExpr2T, typename BinaryPredicateT>
+    BOOST_UBLAS_INLINE
+    static bool apply(matrix_expression<MatrixExpr1T> const& me1, matrix_expression<MatrixExpr2T> const& me2, BinaryPredicateT const& p)
+    {
+        typedef typename matrix_traits<MatrixExpr1T>::size_type size_type;
+        typedef typename matrix_traits<MatrixExpr1T>::orientation_category orientation_category;
+        typedef matrix_line_traits<orientation_category> line_traits;
+        typedef matrix_line_indexed_binary_predicate<MatrixExpr1T,MatrixExpr2T,BinaryPredicateT,orientation_category> indexed_predicate_type;
+
+        size_type nl = line_traits::num_lines(me1());
+        size_type n = line_traits::line_size(me1());
+        for (size_type l = 0; l < nl; ++l)
+        {
+            if (!block_all(n, indexed_predicate_type(me1(), me2(), l, p)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+
+/**
+ * \brief Tell if all the pairs of elements at the same position of two vector
+ *  expressions of the same size satisfy the given binary predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExpr1T, typename VectorExpr2T, typename BinaryPredicateT>
+BOOST_UBLAS_INLINE
+bool all_of_pairs(vector_expression<VectorExpr1T> const& ve1, vector_expression<VectorExpr2T> const& ve2, BinaryPredicateT const& p)
+{
+    return all_of_pairs_impl<
+                has_contiguous_storage<VectorExpr1T>::value
+                && has_contiguous_storage<VectorExpr2T>::value
+            >::apply(ve1, ve2, p);
+}
+
+
+/**
+ * \brief Tell if all the pairs of elements at the same position of two matrix
+ *  expressions of the same size satisfy the given binary predicate.
+ *
+ * The elements are visited in the storage order of the first matrix
+ * expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExpr1T, typename MatrixExpr2T, typename BinaryPredicateT>
+BOOST_UBLAS_INLINE
+bool all_of_pairs(matrix_expression<MatrixExpr1T> const& me1, matrix_expression<MatrixExpr2T> const& me2, BinaryPredicateT const& p)
+{
+    return all_of_pairs_impl<
+                has_contiguous_storage<MatrixExpr1T>::value
+                && has_contiguous_storage<MatrixExpr2T>::value
+                && ::boost::is_same<
+                        typename matrix_traits<MatrixExpr1T>::orientation_category,
+                        typename matrix_traits<MatrixExpr2T>::orientation_category
+                    >::value
+            >::apply(me1, me2, p);
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_PREDICATE_HPP
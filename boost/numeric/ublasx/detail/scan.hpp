@@ -0,0 +1,307 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/scan.hpp
+ *
+ * \brief Inclusive scan (prefix reduction) kernels for elements stored in an
+ *  array.
+ *
+ * A long range is scanned in two passes over chunks processed by concurrent
+ * threads: the first pass reduces each chunk to its total, and the second one
+ * scans each chunk starting from the combined totals of the chunks preceding
+ * it.
+ * Independent sequences stored in the same array (e.g., the columns of a
+ * matrix) are instead scanned concurrently in a single pass; when the elements
+ * of the sequences are interleaved, the innermost loop runs across sequences,
+ * so that it does not carry any dependency and can be vectorized.
+ * The binary operation must be associative; it is always applied with the
+ * preceding elements as its left operand.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_SCAN_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_SCAN_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublasx/detail/parallel.hpp>
+#include <boost/numeric/ublasx/detail/summation.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+/**
+ * \brief Reduce the \a n elements starting at \a first by means of the given
+ *  associative binary operation.
+ */
+template <typename ValueT, typename RandomAccessIteratorT, typename SizeT, typename BinaryOpT>
+BOOST_UBLAS_INLINE
+ValueT scan_block_reduce(RandomAccessIteratorT first, SizeT n, BinaryOpT const& op)
+{
+    ValueT r = first[0];
+    for (SizeT i = 1; i < n; ++i)
+    {
+        r = op(r, first[i]);
+    }
+    return r;
+}
+
+
+/// Sums are reduced by the (vectorizable) pairwise summation kernel.
+template <typename ValueT, typename RandomAccessIteratorT, typename SizeT>
+BOOST_UBLAS_INLINE
+ValueT scan_block_reduce(RandomAccessIteratorT first, SizeT n, ::std::plus<ValueT> const&)
+{
+    return pairwise_sum<ValueT>(first, n);
+}
+
+
+/**
+ * \brief Scan in place the \a n elements starting at \a first and separated by
+ *  \a stride positions, by means of the given associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename RandomAccessIteratorT, typename SizeT, typename BinaryOpT>
+BOOST_UBLAS_INLINE
+void sequential_scan(RandomAccessIteratorT first, SizeT n, SizeT stride, BinaryOpT const& op)
+{
+    if (n == 0)
+    {
+        return;
+    }
+
+    ValueT acc = first[0];
+    for (SizeT i = 1; i < n; ++i)
+    {
+        acc = op(acc, first[i*stride]);
+        first[i*stride] = acc;
+    }
+}
+
+
+/// First pass of the two-pass scan: reduce each chunk but the last one.
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+struct scan_reduce_chunk
+{
+    scan_reduce_chunk(RandomAccessIteratorT first, ValueT* totals, ::std::size_t nchunks, BinaryOpT const& op)
+    : first_(first),
+      totals_(totals),
+      nchunks_(nchunks),
+      op_(op)
+    {
+    }
+
+    void operator()(::std::size_t k, ::std::size_t lo, ::std::size_t hi) const
+    {
+        if ((k+1) < nchunks_)
+        {
+            totals_[k] = scan_block_reduce<ValueT>(first_+lo, hi-lo, op_);
+        }
+    }
+
+    RandomAccessIteratorT first_;
+    ValueT* totals_;
+    ::std::size_t nchunks_;
+    BinaryOpT op_;
+};
+
+
+/// Second pass of the two-pass scan: scan each chunk from its offset.
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+struct scan_offset_chunk
+{
+    scan_offset_chunk(RandomAccessIteratorT first, ValueT const* offsets, BinaryOpT const& op)
+    : first_(first),
+      offsets_(offsets),
+      op_(op)
+    {
+    }
+
+    void operator()(::std::size_t k, ::std::size_t lo, ::std::size_t hi) const
+    {
+        if (k > 0)
+        {
+            first_[lo] = op_(offsets_[k-1], first_[lo]);
+        }
+        sequential_scan<ValueT>(first_+lo, hi-lo, ::std::size_t(1), op_);
+    }
+
+    RandomAccessIteratorT first_;
+    ValueT const* offsets_;
+    BinaryOpT op_;
+};
+
+
+/**
+ * \brief Scan in place the \a n consecutive elements starting at \a first by
+ *  means of the given associative binary operation, splitting the range among
+ *  concurrent threads when it is long enough.
+ * \tparam ValueT The type of the elements.
+ * \tparam RandomAccessIteratorT The type of the iterator.
+ * \tparam BinaryOpT The type of the binary operation.
+ * \param first The iterator to the first element.
+ * \param n The number of elements.
+ * \param op The associative binary operation.
+ *
+ * When the range is split, the result may differ by rounding from the one of
+ * \c sequential_scan for floating-point operations, since the elements are
+ * combined in a different order.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+void parallel_scan(RandomAccessIteratorT first, ::std::size_t n, BinaryOpT const& op)
+{
+    ::std::size_t nchunks = parallel_num_chunks(n);
+
+    if (nchunks < 2)
+    {
+        sequential_scan<ValueT>(first, n, ::std::size_t(1), op);
+        return;
+    }
+
+    ::std::vector<ValueT> totals(nchunks);
+
+    parallel_for_chunks(nchunks, n, scan_reduce_chunk<ValueT,RandomAccessIteratorT,BinaryOpT>(first, &totals[0], nchunks, op));
+    for (::std::size_t k = 1; k < (nchunks-1); ++k)
+    {
+        totals[k] = op(totals[k-1], totals[k]);
+    }
+    parallel_for_chunks(nchunks, n, scan_offset_chunk<ValueT,RandomAccessIteratorT,BinaryOpT>(first, &totals[0], op));
+}
+
+
+/// Scan whole sequences whose elements are consecutive.
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+struct scan_contiguous_lines_chunk
+{
+    scan_contiguous_lines_chunk(RandomAccessIteratorT first, ::std::size_t len, ::std::size_t line_stride, BinaryOpT const& op)
+    : first_(first),
+      len_(len),
+      line_stride_(line_stride),
+      op_(op)
+    {
+    }
+
+    void operator()(::std::size_t, ::std::size_t lo, ::std::size_t hi) const
+    {
+        for (::std::size_t l = lo; l < hi; ++l)
+        {
+            sequential_scan<ValueT>(first_+l*line_stride_, len_, ::std::size_t(1), op_);
+        }
+    }
+
+    RandomAccessIteratorT first_;
+    ::std::size_t len_;
+    ::std::size_t line_stride_;
+    BinaryOpT op_;
+};
+
+
+/// Scan sequences whose elements are interleaved, one element at a time.
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+struct scan_interleaved_lines_chunk
+{
+    scan_interleaved_lines_chunk(RandomAccessIteratorT first, ::std::size_t len, ::std::size_t line_stride, ::std::size_t elem_stride, BinaryOpT const& op)
+    : first_(first),
+      len_(len),
+      line_stride_(line_stride),
+      elem_stride_(elem_stride),
+      op_(op)
+    {
+    }
+
+    void operator()(::std::size_t, ::std::size_t lo, ::std::size_t hi) const
+    {
+        for (::std::size_t i = 1; i < len_; ++i)
+        {
+            RandomAccessIteratorT prev = first_+(i-1)*elem_stride_;
+            RandomAccessIteratorT cur = first_+i*elem_stride_;
+
+            if (line_stride_ == 1)
+            {
+                for (::std::size_t l = lo; l < hi; ++l)
+                {
+                    cur[l] = op_(prev[l], cur[l]);
+                }
+            }
+            else
+            {
+                for (::std::size_t l = lo; l < hi; ++l)
+                {
+                    cur[l*line_stride_] = op_(prev[l*line_stride_], cur[l*line_stride_]);
+                }
+            }
+        }
+    }
+
+    RandomAccessIteratorT first_;
+    ::std::size_t len_;
+    ::std::size_t line_stride_;
+    ::std::size_t elem_stride_;
+    BinaryOpT op_;
+};
+
+
+/**
+ * \brief Scan in place \a nlines independent sequences of \a len elements
+ *  stored in the same array, by means of the given associative binary
+ *  operation.
+ * \tparam ValueT The type of the elements.
+ * \tparam RandomAccessIteratorT The type of the iterator.
+ * \tparam BinaryOpT The type of the binary operation.
+ * \param first The iterator to the first element of the first sequence.
+ * \param nlines The number of sequences.
+ * \param len The number of elements of each sequence.
+ * \param line_stride The distance between the first elements of two
+ *  consecutive sequences.
+ * \param elem_stride The distance between two consecutive elements of the
+ *  same sequence.
+ * \param op The associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename RandomAccessIteratorT, typename BinaryOpT>
+void parallel_scan_lines(RandomAccessIteratorT first, ::std::size_t nlines, ::std::size_t len, ::std::size_t line_stride, ::std::size_t elem_stride, BinaryOpT const& op)
+{
+    if (nlines == 0 || len == 0)
+    {
+        return;
+    }
+
+    if (elem_stride == 1 && nlines == 1)
+    {
+        parallel_scan<ValueT>(first, len, op);
+        return;
+    }
+
+    ::std::size_t nchunks = ::std::min(parallel_num_chunks(nlines*len), nlines);
+
+    if (elem_stride == 1)
+    {
+        parallel_for_chunks(nchunks, nlines, scan_contiguous_lines_chunk<ValueT,RandomAccessIteratorT,BinaryOpT>(first, len, line_stride, op));
+    }
+    else
+    {
+        parallel_for_chunks(nchunks, nlines, scan_interleaved_lines_chunk<ValueT,RandomAccessIteratorT,BinaryOpT>(first, len, line_stride, elem_stride, op));
+    }
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_SCAN_HPP
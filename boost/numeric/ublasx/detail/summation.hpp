@@ -0,0 +1,165 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/summation.hpp
+ *
+ * \brief Summation kernels for elements stored in an array.
+ *
+ * The kernels compute sums by pairwise (cascade) summation: the range is split
+ * in halves until it is short enough, and each short block is summed by
+ * several independent accumulators, which are combined at the end.
+ * Independent accumulators break the dependency chain of a single running sum,
+ * so that the compiler can keep them into SIMD registers, while pairwise
+ * summation makes the rounding error grow as O(log n) instead of O(n).
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_SUMMATION_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_SUMMATION_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+/// The number of independent accumulators used to sum a block.
+static const ::std::size_t summation_num_accumulators = 8;
+
+/// The number of elements below which a range is not split anymore.
+static const ::std::size_t summation_block_size = 128;
+
+
+/**
+ * \brief Sum the \a n elements starting at \a first and separated by
+ *  \a stride positions, by means of pairwise summation.
+ * \tparam ValueT The type of the sum.
+ * \tparam RandomAccessIteratorT The type of the iterator.
+ * \tparam SizeT The size type.
+ * \param first The iterator to the first element.
+ * \param n The number of elements.
+ * \param stride The distance between two consecutive elements.
+ * \return The sum of the elements.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename RandomAccessIteratorT, typename SizeT>
+ValueT pairwise_sum(RandomAccessIteratorT first, SizeT n, SizeT stride = 1)
+{
+    const SizeT na = summation_num_accumulators;
+
+    if (n > summation_block_size)
+    {
+        // Split at a multiple of the number of accumulators, so that only the
+        // last block has a remainder.
+        SizeT m = (n/2/na)*na;
+
+        return pairwise_sum<ValueT>(first, m, stride)
+               + pairwise_sum<ValueT>(first+m*stride, n-m, stride);
+    }
+
+    ValueT acc[summation_num_accumulators];
+    for (SizeT k = 0; k < na; ++k)
+    {
+        acc[k] = ValueT(0);
+    }
+
+    SizeT nb = (n/na)*na;
+    if (stride == 1)
+    {
+        for (SizeT i = 0; i < nb; i += na)
+        {
+            for (SizeT k = 0; k < na; ++k)
+            {
+                acc[k] += first[i+k];
+            }
+        }
+    }
+    else
+    {
+        for (SizeT i = 0; i < nb; i += na)
+        {
+            for (SizeT k = 0; k < na; ++k)
+            {
+                acc[k] += first[(i+k)*stride];
+            }
+        }
+    }
+
+    ValueT s = ((acc[0]+acc[1])+(acc[2]+acc[3]))
+               + ((acc[4]+acc[5])+(acc[6]+acc[7]));
+    for (SizeT i = nb; i < n; ++i)
+    {
+        s += first[i*stride];
+    }
+
+    return s;
+}
+
+
+/**
+ * \brief Sum the products of the \a n pairs of elements starting at \a first1
+ *  and \a first2, by means of pairwise summation.
+ * \tparam ValueT The type of the sum.
+ * \tparam RandomAccessIterator1T The type of the first iterator.
+ * \tparam RandomAccessIterator2T The type of the second iterator.
+ * \tparam SizeT The size type.
+ * \param first1 The iterator to the first element of the first range.
+ * \param first2 The iterator to the first element of the second range.
+ * \param n The number of elements of each range.
+ * \return The sum of the products of the elements (not conjugated).
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename RandomAccessIterator1T, typename RandomAccessIterator2T, typename SizeT>
+ValueT pairwise_dot(RandomAccessIterator1T first1, RandomAccessIterator2T first2, SizeT n)
+{
+    const SizeT na = summation_num_accumulators;
+
+    if (n > summation_block_size)
+    {
+        SizeT m = (n/2/na)*na;
+
+        return pairwise_dot<ValueT>(first1, first2, m)
+               + pairwise_dot<ValueT>(first1+m, first2+m, n-m);
+    }
+
+    ValueT acc[summation_num_accumulators];
+    for (SizeT k = 0; k < na; ++k)
+    {
+        acc[k] = ValueT(0);
+    }
+
+    SizeT nb = (n/na)*na;
+    for (SizeT i = 0; i < nb; i += na)
+    {
+        for (SizeT k = 0; k < na; ++k)
+        {
+            acc[k] += ValueT(first1[i+k])*ValueT(first2[i+k]);
+        }
+    }
+
+    ValueT s = ((acc[0]+acc[1])+(acc[2]+acc[3]))
+               + ((acc[4]+acc[5])+(acc[6]+acc[7]));
+    for (SizeT i = nb; i < n; ++i)
+    {
+        s += ValueT(first1[i])*ValueT(first2[i]);
+    }
+
+    return s;
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_SUMMATION_HPP
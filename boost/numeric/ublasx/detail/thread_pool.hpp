@@ -0,0 +1,327 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/thread_pool.hpp
+ *
+ * \brief A lightweight pool of worker threads processing chunks of work.
+ *
+ * The pool is created on its first use with one worker thread less than the
+ * maximum number of threads (see \c parallel_max_threads), since the calling
+ * thread processes chunks too, and lives until the end of the program.
+ * Chunks are assigned to threads statically: chunk \c k is processed by the
+ * calling thread if \c k is a multiple of the number \c nt of threads, and by
+ * the worker thread <code>(k % nt)-1</code> otherwise, so that the same thread
+ * processes the same part of the work in successive runs.
+ *
+ * Only one run at a time uses the worker threads.
+ * A run started while the pool is busy (by another thread, or from inside a
+ * chunk of the current run) is processed by its calling thread alone.
+ *
+ * Only the C++11 standard library is used.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_THREAD_POOL_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_THREAD_POOL_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+/// A pool of worker threads processing the chunks of a run.
+class thread_pool
+{
+    /// Interface of the work of a run, which is called once per chunk.
+    private: struct job_base
+    {
+        virtual ~job_base() {}
+
+        virtual void run(::std::size_t k) const = 0;
+    };
+
+
+    /// Call a chunk functor.
+    private: template <typename FunctorT>
+             struct job: job_base
+    {
+        explicit job(FunctorT const& f)
+        : f_(f)
+        {
+        }
+
+        void run(::std::size_t k) const
+        {
+            f_(k);
+        }
+
+        FunctorT const& f_;
+    };
+
+
+    /**
+     * \brief Create a pool with the given number of worker threads.
+     *
+     * If some worker thread cannot be started, the pool has less workers.
+     */
+    public: explicit thread_pool(::std::size_t nworkers)
+    : job_(0),
+      nchunks_(0),
+      generation_(0),
+      pending_(0),
+      stop_(false)
+    {
+        workers_.reserve(nworkers);
+        for (::std::size_t w = 0; w < nworkers; ++w)
+        {
+            try
+            {
+                workers_.push_back(::std::thread(worker(this, w)));
+            }
+            catch (...)
+            {
+                break;
+            }
+        }
+    }
+
+
+    /// Stop and join the worker threads.
+    public: ~thread_pool()
+    {
+        {
+            ::std::lock_guard< ::std::mutex > lock(mutex_);
+            stop_ = true;
+        }
+        start_cond_.notify_all();
+        for (::std::size_t w = 0; w < workers_.size(); ++w)
+        {
+            workers_[w].join();
+        }
+    }
+
+
+    /// Return the number of threads processing the chunks of a run.
+    public: ::std::size_t num_threads() const
+    {
+        return workers_.size()+1;
+    }
+
+
+    /**
+     * \brief Call \c f(k) for each chunk \c k in <code>[0,nchunks)</code> and
+     *  wait until every call has returned.
+     *
+     * If some call throws, one of the exceptions is rethrown after every
+     * call has returned.
+     */
+    public: template <typename FunctorT>
+            void run(::std::size_t nchunks, FunctorT const& f)
+    {
+        ::std::unique_lock< ::std::mutex > run_lock(run_mutex_, ::std::try_to_lock);
+
+        if (!run_lock.owns_lock() || in_pool() || workers_.empty() || nchunks < 2)
+        {
+            for (::std::size_t k = 0; k < nchunks; ++k)
+            {
+                f(k);
+            }
+            return;
+        }
+
+        job<FunctorT> j(f);
+
+        {
+            ::std::lock_guard< ::std::mutex > lock(mutex_);
+            job_ = &j;
+            nchunks_ = nchunks;
+            error_ = ::std::exception_ptr();
+            pending_ = ::std::min(nchunks-1, workers_.size());
+            ++generation_;
+        }
+        start_cond_.notify_all();
+
+        // Nested runs started by the chunks of the calling thread are
+        // processed sequentially
+        in_pool() = true;
+        process(0);
+        in_pool() = false;
+
+        ::std::unique_lock< ::std::mutex > lock(mutex_);
+        done_cond_.wait(lock, pending_zero(this));
+        job_ = 0;
+        if (error_)
+        {
+            ::std::exception_ptr error(error_);
+            error_ = ::std::exception_ptr();
+            ::std::rethrow_exception(error);
+        }
+    }
+
+
+    /// Return the pool shared by every parallel operation.
+    public: static thread_pool& instance(::std::size_t nthreads)
+    {
+        static thread_pool pool(nthreads > 0 ? nthreads-1 : 0);
+
+        return pool;
+    }
+
+
+    /// Tell if the current thread is processing a chunk of a run.
+    private: static bool& in_pool()
+    {
+        static thread_local bool in(false);
+
+        return in;
+    }
+
+
+    /// Process the chunks statically assigned to the given thread of the pool.
+    private: void process(::std::size_t t)
+    {
+        const ::std::size_t nt(num_threads());
+
+        for (::std::size_t k = t; k < nchunks_; k += nt)
+        {
+            try
+            {
+                job_->run(k);
+            }
+            catch (...)
+            {
+                ::std::lock_guard< ::std::mutex > lock(mutex_);
+                if (!error_)
+                {
+                    error_ = ::std::current_exception();
+                }
+            }
+        }
+    }
+
+
+    /// The main loop of the given worker thread.
+    private: void work(::std::size_t w)
+    {
+        in_pool() = true;
+
+        ::std::size_t seen(0);
+        ::std::unique_lock< ::std::mutex > lock(mutex_);
+        while (true)
+        {
+            start_cond_.wait(lock, new_run(this, seen));
+            if (stop_)
+            {
+                return;
+            }
+            seen = generation_;
+            if (w+1 < nchunks_)
+            {
+                lock.unlock();
+                process(w+1);
+                lock.lock();
+                if (--pending_ == 0)
+                {
+                    done_cond_.notify_one();
+                }
+            }
+        }
+    }
+
+
+    /// Body of a worker thread.
+    private: struct worker
+    {
+        worker(thread_pool* pool, ::std::size_t w)
+        : pool_(pool),
+          w_(w)
+        {
+        }
+
+        void operator()() const
+        {
+            pool_->work(w_);
+        }
+
+        thread_pool* pool_;
+        ::std::size_t w_;
+    };
+
+
+    /// Predicate telling a worker thread that a run has started or that the pool is stopping.
+    private: struct new_run
+    {
+        new_run(thread_pool const* pool, ::std::size_t const& seen)
+        : pool_(pool),
+          seen_(&seen)
+        {
+        }
+
+        bool operator()() const
+        {
+            return pool_->stop_ || pool_->generation_ != *seen_;
+        }
+
+        thread_pool const* pool_;
+        ::std::size_t const* seen_;
+    };
+
+
+    /// Predicate telling the calling thread that every worker thread has finished the run.
+    private: struct pending_zero
+    {
+        explicit pending_zero(thread_pool const* pool)
+        : pool_(pool)
+        {
+        }
+
+        bool operator()() const
+        {
+            return pool_->pending_ == 0;
+        }
+
+        thread_pool const* pool_;
+    };
+
+
+    private: thread_pool(thread_pool const&);
+    private: thread_pool& operator=(thread_pool const&);
+
+
+    private: ::std::vector< ::std::thread > workers_;
+    /// Serializes the runs using the worker threads.
+    private: ::std::mutex run_mutex_;
+    /// Protects the state of the current run.
+    private: ::std::mutex mutex_;
+    private: ::std::condition_variable start_cond_;
+    private: ::std::condition_variable done_cond_;
+    private: job_base const* job_;
+    private: ::std::size_t nchunks_;
+    private: ::std::size_t generation_;
+    /// The number of worker threads which have not finished the current run.
+    private: ::std::size_t pending_;
+    private: ::std::exception_ptr error_;
+    private: bool stop_;
+};
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_THREAD_POOL_HPP
@@ -0,0 +1,206 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/detail/traversal.hpp
+ *
+ * \brief Traversal of the elements of a matrix expression in storage order.
+ *
+ * Reductions over a matrix dimension (e.g., the sum over each column) can be
+ * computed by visiting the elements in any order, as long as each element is
+ * accumulated into the output element of its row or column.
+ * Visiting them in the order they are stored (i.e., row by row for row-major
+ * matrices, and column by column for column-major ones) makes memory accesses
+ * sequential, independently of the dimension the reduction is performed over.
+ * For each output element, the input elements are still visited by increasing
+ * row (or column) index, so that the result does not depend on the traversal
+ * order.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_DETAIL_TRAVERSAL_HPP
+#define BOOST_NUMERIC_UBLASX_DETAIL_TRAVERSAL_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/fwd.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace detail {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Tell if the elements of the given vector or matrix type are stored in
+ *  a single array (returned by its \c data member function) with no gaps and,
+ *  for matrices, in the order given by its orientation category.
+ */
+template <typename ContainerT>
+struct has_contiguous_storage: ::boost::false_type
+{
+};
+
+template <typename T, typename L, typename A>
+struct has_contiguous_storage< matrix<T,L,A> >: ::boost::true_type
+{
+};
+
+template <typename T, typename A>
+struct has_contiguous_storage< vector<T,A> >: ::boost::true_type
+{
+};
+
+
+/**
+ * \brief Auxiliary class for visiting the elements of a matrix expression in
+ *  storage order.
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ * \tparam Contiguous Tells if the matrix expression is a dense container whose
+ *  elements can be accessed through its storage array.
+ */
+template <typename OrientationT, bool Contiguous>
+struct storage_order_traversal_impl;
+
+
+template <>
+struct storage_order_traversal_impl<row_major_tag, false>
+{
+    template <typename MatrixExprT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        for (size_type r = 0; r < nr; ++r)
+        {
+            for (size_type c = 0; c < nc; ++c)
+            {
+                f(r, c, me()(r,c));
+            }
+        }
+    }
+};
+
+
+template <>
+struct storage_order_traversal_impl<column_major_tag, false>
+{
+    template <typename MatrixExprT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        for (size_type c = 0; c < nc; ++c)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+                f(r, c, me()(r,c));
+            }
+        }
+    }
+};
+
+
+template <>
+struct storage_order_traversal_impl<row_major_tag, true>
+{
+    template <typename MatrixExprT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename MatrixExprT::array_type::const_iterator iterator_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        iterator_type it = me().data().begin();
+        for (size_type r = 0; r < nr; ++r)
+        {
+            for (size_type c = 0; c < nc; ++c, ++it)
+            {
+                f(r, c, *it);
+            }
+        }
+    }
+};
+
+
+template <>
+struct storage_order_traversal_impl<column_major_tag, true>
+{
+    template <typename MatrixExprT, typename FunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_expression<MatrixExprT> const& me, FunctorT& f)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename MatrixExprT::array_type::const_iterator iterator_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        iterator_type it = me().data().begin();
+        for (size_type c = 0; c < nc; ++c)
+        {
+            for (size_type r = 0; r < nr; ++r, ++it)
+            {
+                f(r, c, *it);
+            }
+        }
+    }
+};
+
+
+template <bool Contiguous>
+struct storage_order_traversal_impl<unknown_orientation_tag, Contiguous>: storage_order_traversal_impl<row_major_tag, false>
+{
+    // Empty
+};
+
+
+/**
+ * \brief Call \c f(r,c,x) for every element \c x at row \c r and column \c c
+ *  of the given matrix expression, visiting the elements in storage order.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam FunctorT The type of the functor.
+ * \param me The matrix expression whose elements are visited.
+ * \param f The functor to call on each element.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename FunctorT>
+BOOST_UBLAS_INLINE
+void for_each_in_storage_order(matrix_expression<MatrixExprT> const& me, FunctorT& f)
+{
+    storage_order_traversal_impl<
+        typename matrix_traits<MatrixExprT>::orientation_category,
+        has_contiguous_storage<MatrixExprT>::value
+    >::apply(me, f);
+}
+
+}}}} // Namespace boost::numeric::ublasx::detail
+
+
+#endif // BOOST_NUMERIC_UBLASX_DETAIL_TRAVERSAL_HPP
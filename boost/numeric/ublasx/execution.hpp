@@ -0,0 +1,59 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/execution.hpp
+ *
+ * \brief Execution policies.
+ *
+ * An execution policy, passed as the first argument of an operation, tells
+ * how the operation may process the elements of its operands:
+ * - \c execution::seq: in order, by the calling thread;
+ * - \c execution::par: by several threads, each processing a block of
+ *   consecutive elements (or of consecutive rows or columns) in order;
+ * - \c execution::par_unseq: like \c execution::par, and the elements of a
+ *   block may also be processed in any order (e.g., by vector instructions).
+ *
+ * Under the parallel policies, the functions given to the operation may be
+ * called concurrently on different elements, and the threads are taken from a
+ * pool shared by every operation (see \c detail/thread_pool.hpp).
+ * The policies mirror the ones of C++17 (<code>std::execution</code>), but
+ * only need C++11.
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXECUTION_HPP
+#define BOOST_NUMERIC_UBLASX_EXECUTION_HPP
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace execution {
+
+/// \brief Type of the sequential execution policy.
+struct sequenced_policy {};
+
+/// \brief Type of the parallel execution policy.
+struct parallel_policy {};
+
+/// \brief Type of the parallel and unsequenced execution policy.
+struct parallel_unsequenced_policy {};
+
+
+/// \brief The sequential execution policy.
+static const sequenced_policy seq = sequenced_policy();
+
+/// \brief The parallel execution policy.
+static const parallel_policy par = parallel_policy();
+
+/// \brief The parallel and unsequenced execution policy.
+static const parallel_unsequenced_policy par_unseq = parallel_unsequenced_policy();
+
+}}}} // Namespace boost::numeric::ublasx::execution
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXECUTION_HPP
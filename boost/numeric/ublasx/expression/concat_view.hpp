@@ -0,0 +1,184 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/expression/concat_view.hpp
+ *
+ * \brief Matrix expression viewing the concatenation of two matrix
+ *  expressions.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2011, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXPRESSION_CONCAT_VIEW_HPP
+#define BOOST_NUMERIC_UBLASX_EXPRESSION_CONCAT_VIEW_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/expression/matrix_indexed_view.hpp>
+#include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Matrix expression viewing the concatenation of two matrix
+ *  expressions.
+ * \tparam Expr1T The type of the first matrix expression.
+ * \tparam Expr2T The type of the second matrix expression.
+ * \tparam Dim The concatenation dimension: \c 1 to append the rows of the
+ *  second expression below the first one (like \c cat_columns), \c 2 to append
+ *  the columns of the second expression to the right of the first one (like
+ *  \c cat_rows).
+ *
+ * If the expressions have a different number of columns (for \a Dim equal to
+ * \c 1) or rows (for \a Dim equal to \c 2), the missing elements of the
+ * smaller one are seen as zeros.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename Expr1T, typename Expr2T, ::std::size_t Dim>
+class concat_view: public matrix_indexed_view<
+                            concat_view<Expr1T, Expr2T, Dim>,
+                            matrix<
+                                typename promote_traits<typename Expr1T::value_type, typename Expr2T::value_type>::promote_type,
+                                typename layout_type<Expr1T>::type
+                            >
+                        >
+{
+    private: typedef concat_view<Expr1T, Expr2T, Dim> self_type;
+    private: typedef matrix_indexed_view<
+                        self_type,
+                        matrix<
+                            typename promote_traits<typename Expr1T::value_type, typename Expr2T::value_type>::promote_type,
+                            typename layout_type<Expr1T>::type
+                        >
+                    > base_type;
+    public: typedef Expr1T expression1_type;
+    public: typedef Expr2T expression2_type;
+    public: typedef typename Expr1T::const_closure_type expression1_closure_type;
+    public: typedef typename Expr2T::const_closure_type expression2_closure_type;
+    public: typedef typename base_type::size_type size_type;
+    public: typedef typename base_type::value_type value_type;
+    public: typedef typename base_type::const_reference const_reference;
+
+
+    // Construction and destruction
+
+
+    public: BOOST_UBLAS_INLINE concat_view(expression1_type const& e1, expression2_type const& e2)
+        : e1_(e1),
+          e2_(e2)
+    {
+        // Empty
+    }
+
+
+    // Accessors
+
+
+    public: BOOST_UBLAS_INLINE size_type size1() const
+    {
+        return Dim == 1
+               ? e1_.size1()+e2_.size1()
+               : ::std::max(e1_.size1(), e2_.size1());
+    }
+
+
+    public: BOOST_UBLAS_INLINE size_type size2() const
+    {
+        return Dim == 1
+               ? ::std::max(e1_.size2(), e2_.size2())
+               : e1_.size2()+e2_.size2();
+    }
+
+
+    public: BOOST_UBLAS_INLINE expression1_closure_type const& expression1() const
+    {
+        return e1_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE expression2_closure_type const& expression2() const
+    {
+        return e2_;
+    }
+
+
+    // Element access
+
+
+    public: BOOST_UBLAS_INLINE const_reference operator()(size_type i, size_type j) const
+    {
+        if (Dim == 1)
+        {
+            size_type nr1(e1_.size1());
+
+            if (i < nr1)
+            {
+                return j < e1_.size2() ? value_type(e1_(i, j)) : value_type();
+            }
+            return j < e2_.size2() ? value_type(e2_(i-nr1, j)) : value_type();
+        }
+
+        size_type nc1(e1_.size2());
+
+        if (j < nc1)
+        {
+            return i < e1_.size1() ? value_type(e1_(i, j)) : value_type();
+        }
+        return i < e2_.size1() ? value_type(e2_(i, j-nc1)) : value_type();
+    }
+
+
+    // Evaluation
+
+
+    /// Copy the elements of this view into the given matrix container.
+    public: template <typename MatrixT>
+            BOOST_UBLAS_INLINE void assign_to(MatrixT& m) const
+    {
+        size_type nr1(e1_.size1());
+        size_type nc1(e1_.size2());
+        size_type nr2(e2_.size1());
+        size_type nc2(e2_.size2());
+
+        if (Dim == 1 ? nc1 != nc2 : nr1 != nr2)
+        {
+            m.assign(zero_matrix<value_type>(m.size1(), m.size2()));
+        }
+
+        matrix_range<MatrixT> m1(m, range(0, nr1), range(0, nc1));
+        detail::view_assign(m1, e1_);
+
+        matrix_range<MatrixT> m2(m,
+                                 Dim == 1 ? range(nr1, nr1+nr2) : range(0, nr2),
+                                 Dim == 1 ? range(0, nc2) : range(nc1, nc1+nc2));
+        detail::view_assign(m2, e2_);
+    }
+
+
+    private: expression1_closure_type e1_;
+    private: expression2_closure_type e2_;
+};
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXPRESSION_CONCAT_VIEW_HPP
@@ -21,6 +21,7 @@
 
 
 #include <boost/function.hpp>
+#include <boost/numeric/ublasx/detail/functor.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/numeric/ublas/detail/iterator.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
@@ -56,7 +57,7 @@ class matrix_binary_functor1: public matrix_expression< matrix_binary_functor1<E
 
     private: typedef matrix_binary_functor1<ExprT, Arg2T, SignatureT> self_type;
     //typedef F functor_type;
-    public: typedef ::boost::function<SignatureT> functor_type;
+    public: typedef typename detail::functor_type_traits<SignatureT>::type functor_type;
     public: typedef Arg2T arg2_type;
     //public: typedef ExprT expression_type;
     public: typedef typename ::boost::mpl::if_<
@@ -136,6 +137,18 @@ class matrix_binary_functor1: public matrix_expression< matrix_binary_functor1<E
     }
 
 
+    public: BOOST_UBLAS_INLINE arg2_type const& argument2() const
+    {
+        return a2_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE functor_type const& functor() const
+    {
+        return f_;
+    }
+
+
     // Element access
 
 
@@ -605,7 +618,7 @@ class matrix_binary_functor1: public matrix_expression< matrix_binary_functor1<E
 
     private: expression_closure_type e_;
     private: arg2_type a2_;
-    private: functor_type f_;
+    private: mutable functor_type f_;
 }; // matrix_binary_functor1
 
 template <typename ExprT, typename Arg2T, typename SignatureT>
@@ -639,7 +652,7 @@ class matrix_binary_functor2: public matrix_expression< matrix_binary_functor2<A
 
     private: typedef matrix_binary_functor2<Arg1T, ExprT, SignatureT> self_type;
     //typedef F functor_type;
-    public: typedef ::boost::function<SignatureT> functor_type;
+    public: typedef typename detail::functor_type_traits<SignatureT>::type functor_type;
     public: typedef Arg1T arg1_type;
     //public: typedef ExprT expression_type;
     public: typedef typename ::boost::mpl::if_<
@@ -719,6 +732,18 @@ class matrix_binary_functor2: public matrix_expression< matrix_binary_functor2<A
     }
 
 
+    public: BOOST_UBLAS_INLINE arg1_type const& argument1() const
+    {
+        return a1_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE functor_type const& functor() const
+    {
+        return f_;
+    }
+
+
     // Element access
 
 
@@ -1188,7 +1213,7 @@ class matrix_binary_functor2: public matrix_expression< matrix_binary_functor2<A
 
     private: arg1_type a1_;
     private: expression_closure_type e_;
-    private: functor_type f_;
+    private: mutable functor_type f_;
 }; // matrix_binary_functor2
 
 template <typename Arg1T, typename ExprT, typename SignatureT>
@@ -0,0 +1,220 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/expression/matrix_indexed_view.hpp
+ *
+ * \brief Base class for read-only matrix expressions whose elements are
+ *  computed on access from the elements of other expressions.
+ *
+ * A view only stores its operands (by closure, like any other uBLAS
+ * expression) and the few sizes needed to map each of its positions to the
+ * position of a source element.
+ * Therefore, no element is copied until the view is assigned to a container
+ * or evaluated by means of its \c eval member function, and the operands must
+ * outlive the view.
+ * Views can be nested (e.g., a concatenation of concatenations) without any
+ * intermediate copy, since views are stored by value by the views and the
+ * expressions using them.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2011, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXPRESSION_MATRIX_INDEXED_VIEW_HPP
+#define BOOST_NUMERIC_UBLASX_EXPRESSION_MATRIX_INDEXED_VIEW_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/detail/iterator.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/fwd.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Base class for read-only matrix expressions whose elements are
+ *  computed on access.
+ * \tparam DerivedT The type of the derived view, which must provide the
+ *  \c size1, \c size2 and <code>operator()(i,j)</code> member functions.
+ * \tparam ResultT The type of the matrix container the view is evaluated to.
+ *
+ * The view is iterated through indexed iterators, so that every element
+ * (including zeros) is visited.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename DerivedT, typename ResultT>
+class matrix_indexed_view: public matrix_expression<DerivedT>
+{
+    private: typedef matrix_indexed_view<DerivedT, ResultT> self_type;
+    public: typedef DerivedT derived_type;
+    public: typedef ResultT matrix_temporary_type;
+    public: typedef typename ResultT::size_type size_type;
+    public: typedef typename ResultT::difference_type difference_type;
+    public: typedef typename ResultT::value_type value_type;
+    public: typedef value_type const_reference;
+    public: typedef const_reference reference;
+    public: typedef const derived_type const_closure_type;
+    public: typedef const_closure_type closure_type;
+    // The preferred traversal order is the one of the result type, so that
+    // nested views are evaluated to containers with the same layout.
+    public: typedef typename ResultT::orientation_category orientation_category;
+    public: typedef dense_proxy_tag storage_category;
+    public: typedef indexed_const_iterator1<derived_type, dense_random_access_iterator_tag> const_iterator1;
+    public: typedef const_iterator1 iterator1;
+    public: typedef indexed_const_iterator2<derived_type, dense_random_access_iterator_tag> const_iterator2;
+    public: typedef const_iterator2 iterator2;
+    public: typedef reverse_iterator_base1<const_iterator1> const_reverse_iterator1;
+    public: typedef reverse_iterator_base2<const_iterator2> const_reverse_iterator2;
+
+
+    // Evaluation
+
+
+    /// Copy the elements of this view into a new matrix container.
+    public: BOOST_UBLAS_INLINE matrix_temporary_type eval() const
+    {
+        matrix_temporary_type res(derived().size1(), derived().size2());
+
+        derived().assign_to(res);
+
+        return res;
+    }
+
+
+    /**
+     * \brief Copy the elements of this view into the given matrix (or matrix
+     *  proxy), which must have the same size of this view.
+     *
+     * Derived views can hide this function with a faster one, which copies
+     * blocks of source elements instead of mapping each position separately.
+     */
+    public: template <typename MatrixT>
+            BOOST_UBLAS_INLINE void assign_to(MatrixT& m) const
+    {
+        m.assign(derived());
+    }
+
+
+    // Closure comparison
+
+
+    public: BOOST_UBLAS_INLINE bool same_closure(self_type const& v) const
+    {
+        return this == &v;
+    }
+
+
+    // Element lookup
+
+
+    public: BOOST_UBLAS_INLINE const_iterator1 find1(int /*rank*/, size_type i, size_type j) const
+    {
+        return const_iterator1(derived(), i, j);
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_iterator2 find2(int /*rank*/, size_type i, size_type j) const
+    {
+        return const_iterator2(derived(), i, j);
+    }
+
+
+    // Iterators
+
+
+    public: BOOST_UBLAS_INLINE const_iterator1 begin1() const
+    {
+        return find1(0, 0, 0);
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_iterator1 end1() const
+    {
+        return find1(0, derived().size1(), 0);
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_iterator2 begin2() const
+    {
+        return find2(0, 0, 0);
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_iterator2 end2() const
+    {
+        return find2(0, 0, derived().size2());
+    }
+
+
+    // Reverse iterators
+
+
+    public: BOOST_UBLAS_INLINE const_reverse_iterator1 rbegin1() const
+    {
+        return const_reverse_iterator1(end1());
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_reverse_iterator1 rend1() const
+    {
+        return const_reverse_iterator1(begin1());
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_reverse_iterator2 rbegin2() const
+    {
+        return const_reverse_iterator2(end2());
+    }
+
+
+    public: BOOST_UBLAS_INLINE const_reverse_iterator2 rend2() const
+    {
+        return const_reverse_iterator2(begin2());
+    }
+
+
+    private: BOOST_UBLAS_INLINE derived_type const& derived() const
+    {
+        return *static_cast<derived_type const*>(this);
+    }
+};
+
+
+namespace detail {
+
+/// Assign a matrix expression to (a part of) a matrix.
+template <typename MatrixT, typename ExprT>
+BOOST_UBLAS_INLINE
+void view_assign(MatrixT& m, matrix_expression<ExprT> const& me)
+{
+    m.assign(me);
+}
+
+
+/// Assign a view to (a part of) a matrix by means of its block-wise copy.
+template <typename MatrixT, typename DerivedT, typename ResultT>
+BOOST_UBLAS_INLINE
+void view_assign(MatrixT& m, matrix_indexed_view<DerivedT, ResultT> const& v)
+{
+    static_cast<DerivedT const&>(v).assign_to(m);
+}
+
+} // Namespace detail
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXPRESSION_MATRIX_INDEXED_VIEW_HPP
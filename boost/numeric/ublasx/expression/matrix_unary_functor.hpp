@@ -21,6 +21,7 @@
 
 
 #include <boost/function.hpp>
+#include <boost/numeric/ublasx/detail/functor.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/numeric/ublas/detail/iterator.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
@@ -55,7 +56,7 @@ class matrix_unary_functor: public matrix_expression< matrix_unary_functor<ExprT
 
     private: typedef matrix_unary_functor<ExprT, SignatureT> self_type;
     //typedef F functor_type;
-    public: typedef ::boost::function<SignatureT> functor_type;
+    public: typedef typename detail::functor_type_traits<SignatureT>::type functor_type;
     //public: typedef ExprT expression_type;
     public: typedef typename ::boost::mpl::if_<
                                 ::boost::is_same<
@@ -133,6 +134,12 @@ class matrix_unary_functor: public matrix_expression< matrix_unary_functor<ExprT
     }
 
 
+    public: BOOST_UBLAS_INLINE functor_type const& functor() const
+    {
+        return f_;
+    }
+
+
     // Element access
 
 
@@ -601,7 +608,7 @@ class matrix_unary_functor: public matrix_expression< matrix_unary_functor<ExprT
 
 
     private: expression_closure_type e_;
-    private: functor_type f_;
+    private: mutable functor_type f_;
 };
 
 template <typename ExprT, typename SignatureT>
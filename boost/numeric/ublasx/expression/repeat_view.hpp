@@ -0,0 +1,198 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/expression/repeat_view.hpp
+ *
+ * \brief Matrix expression viewing copies of a vector or a matrix expression
+ *  tiled into a block matrix.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2011, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXPRESSION_REPEAT_VIEW_HPP
+#define BOOST_NUMERIC_UBLASX_EXPRESSION_REPEAT_VIEW_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublasx/expression/matrix_indexed_view.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Matrix expression viewing copies of a vector or a matrix expression
+ *  tiled into a block matrix.
+ * \tparam ExprT The type of the viewed vector or matrix expression; a vector
+ *  expression is seen as a column vector.
+ *
+ * The element at row \c i and column \c j of the view is the element at row
+ * <code>i % m</code> and column <code>j % n</code> of the viewed expression,
+ * where \c m and \c n are its number of rows and columns.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExprT>
+class repeat_view: public matrix_indexed_view< repeat_view<ExprT>, matrix<typename ExprT::value_type> >
+{
+    private: typedef repeat_view<ExprT> self_type;
+    private: typedef matrix_indexed_view<self_type, matrix<typename ExprT::value_type> > base_type;
+    public: typedef ExprT expression_type;
+    public: typedef typename ExprT::const_closure_type expression_closure_type;
+    public: typedef typename base_type::size_type size_type;
+    public: typedef typename base_type::const_reference const_reference;
+
+
+    // Construction and destruction
+
+
+    /**
+     * \brief Create a view of \a nr by \a nc copies of the given expression.
+     * \param e The viewed vector or matrix expression.
+     * \param nr The number of copies along the rows.
+     * \param nc The number of copies along the columns.
+     */
+    public: BOOST_UBLAS_INLINE repeat_view(expression_type const& e, size_type nr, size_type nc)
+        : e_(e),
+          nr_(nr),
+          nc_(nc)
+    {
+        // Empty
+    }
+
+
+    // Accessors
+
+
+    public: BOOST_UBLAS_INLINE size_type size1() const
+    {
+        return e_size1(typename ExprT::type_category())*nr_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE size_type size2() const
+    {
+        return e_size2(typename ExprT::type_category())*nc_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE expression_closure_type const& expression() const
+    {
+        return e_;
+    }
+
+
+    // Element access
+
+
+    public: BOOST_UBLAS_INLINE const_reference operator()(size_type i, size_type j) const
+    {
+        return element(i, j, typename ExprT::type_category());
+    }
+
+
+    // Evaluation
+
+
+    /// Copy the elements of this view into the given matrix container.
+    public: template <typename MatrixT>
+            BOOST_UBLAS_INLINE void assign_to(MatrixT& m) const
+    {
+        assign_to(m, typename ExprT::type_category());
+    }
+
+
+    private: template <typename MatrixT>
+             BOOST_UBLAS_INLINE void assign_to(MatrixT& m, vector_tag) const
+    {
+        size_type n_e(e_.size());
+
+        for (size_type r = 0; r < nr_; ++r)
+        {
+            for (size_type c = 0; c < nc_; ++c)
+            {
+                for (size_type i = 0; i < n_e; ++i)
+                {
+                    m(r*n_e+i, c) = e_(i);
+                }
+            }
+        }
+    }
+
+
+    private: template <typename MatrixT>
+             BOOST_UBLAS_INLINE void assign_to(MatrixT& m, matrix_tag) const
+    {
+        size_type nr_e(e_.size1());
+        size_type nc_e(e_.size2());
+
+        for (size_type r = 0; r < nr_; ++r)
+        {
+            for (size_type c = 0; c < nc_; ++c)
+            {
+                matrix_range<MatrixT> block(m, range(r*nr_e, (r+1)*nr_e), range(c*nc_e, (c+1)*nc_e));
+                detail::view_assign(block, e_);
+            }
+        }
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size1(vector_tag) const
+    {
+        return e_.size();
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size1(matrix_tag) const
+    {
+        return e_.size1();
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size2(vector_tag) const
+    {
+        return 1;
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size2(matrix_tag) const
+    {
+        return e_.size2();
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference element(size_type i, size_type /*j*/, vector_tag) const
+    {
+        return e_(i % e_.size());
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference element(size_type i, size_type j, matrix_tag) const
+    {
+        return e_(i % e_.size1(), j % e_.size2());
+    }
+
+
+    private: expression_closure_type e_;
+    private: size_type nr_;
+    private: size_type nc_;
+};
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXPRESSION_REPEAT_VIEW_HPP
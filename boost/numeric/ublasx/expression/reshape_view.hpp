@@ -0,0 +1,232 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/expression/reshape_view.hpp
+ *
+ * \brief Matrix expression viewing a vector or a matrix expression with a
+ *  different number of rows and columns.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2011, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXPRESSION_RESHAPE_VIEW_HPP
+#define BOOST_NUMERIC_UBLASX_EXPRESSION_RESHAPE_VIEW_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/exception.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublasx/expression/matrix_indexed_view.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Matrix expression viewing a vector or a matrix expression with a
+ *  different number of rows and columns.
+ * \tparam ExprT The type of the viewed vector or matrix expression.
+ *
+ * Like the MATLAB/Octave \c reshape function, the elements of the view are
+ * taken column by column; the elements of a viewed matrix are taken either
+ * column by column (the default) or row by row.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExprT>
+class reshape_view: public matrix_indexed_view< reshape_view<ExprT>, matrix<typename ExprT::value_type> >
+{
+    private: typedef reshape_view<ExprT> self_type;
+    private: typedef matrix_indexed_view<self_type, matrix<typename ExprT::value_type> > base_type;
+    public: typedef ExprT expression_type;
+    public: typedef typename ExprT::const_closure_type expression_closure_type;
+    public: typedef typename base_type::size_type size_type;
+    public: typedef typename base_type::const_reference const_reference;
+
+
+    // Construction and destruction
+
+
+    /**
+     * \brief Create a view of the given expression with \a nr rows and \a nc
+     *  columns.
+     * \param e The viewed vector or matrix expression, which must have
+     *  \a nr*nc elements.
+     * \param nr The number of rows of the view.
+     * \param nc The number of columns of the view.
+     * \param colw Tells if the elements of a viewed matrix are taken either
+     *  column by column (\c true value) or row by row (\c false value).
+     */
+    public: BOOST_UBLAS_INLINE reshape_view(expression_type const& e, size_type nr, size_type nc, bool colw = true)
+        : e_(e),
+          nr_(nr),
+          nc_(nc),
+          colw_(colw)
+    {
+        // pre: to reshape, the number of elements must not change.
+        BOOST_UBLAS_CHECK(nr*nc == num_elements(e_, typename ExprT::type_category()), bad_size());
+    }
+
+
+    // Accessors
+
+
+    public: BOOST_UBLAS_INLINE size_type size1() const
+    {
+        return nr_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE size_type size2() const
+    {
+        return nc_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE expression_closure_type const& expression() const
+    {
+        return e_;
+    }
+
+
+    // Element access
+
+
+    public: BOOST_UBLAS_INLINE const_reference operator()(size_type i, size_type j) const
+    {
+        return element(j*nr_+i, typename ExprT::type_category());
+    }
+
+
+    // Evaluation
+
+
+    /// Copy the elements of this view into the given matrix container.
+    public: template <typename MatrixT>
+            BOOST_UBLAS_INLINE void assign_to(MatrixT& m) const
+    {
+        // Visit the view column by column, and the viewed expression in the
+        // order it is reshaped, without computing the position of each element
+        size_type r(0);
+        size_type c(0);
+        size_type n_e(colw_ ? e_size1() : e_size2());
+
+        for (size_type j = 0; j < nc_; ++j)
+        {
+            for (size_type i = 0; i < nr_; ++i)
+            {
+                m(i,j) = colw_ ? source(r, c) : source(c, r);
+
+                if (++r == n_e)
+                {
+                    r = 0;
+                    ++c;
+                }
+            }
+        }
+    }
+
+
+    private: BOOST_UBLAS_INLINE static size_type num_elements(expression_closure_type const& e, vector_tag)
+    {
+        return e.size();
+    }
+
+
+    private: BOOST_UBLAS_INLINE static size_type num_elements(expression_closure_type const& e, matrix_tag)
+    {
+        return e.size1()*e.size2();
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference element(size_type k, vector_tag) const
+    {
+        return e_(k);
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference element(size_type k, matrix_tag) const
+    {
+        return colw_
+               ? e_(k % e_.size1(), k / e_.size1())
+               : e_(k / e_.size2(), k % e_.size2());
+    }
+
+
+    /// Size of the viewed expression, seen as a column vector if it is a vector.
+    private: BOOST_UBLAS_INLINE size_type e_size1() const
+    {
+        return e_size1(typename ExprT::type_category());
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size1(vector_tag) const
+    {
+        return e_.size();
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size1(matrix_tag) const
+    {
+        return e_.size1();
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size2() const
+    {
+        return e_size2(typename ExprT::type_category());
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size2(vector_tag) const
+    {
+        return 1;
+    }
+
+
+    private: BOOST_UBLAS_INLINE size_type e_size2(matrix_tag) const
+    {
+        return e_.size2();
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference source(size_type r, size_type c) const
+    {
+        return source(r, c, typename ExprT::type_category());
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference source(size_type r, size_type /*c*/, vector_tag) const
+    {
+        return e_(r);
+    }
+
+
+    private: BOOST_UBLAS_INLINE const_reference source(size_type r, size_type c, matrix_tag) const
+    {
+        return e_(r, c);
+    }
+
+
+    private: expression_closure_type e_;
+    private: size_type nr_;
+    private: size_type nc_;
+    private: bool colw_;
+};
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXPRESSION_RESHAPE_VIEW_HPP
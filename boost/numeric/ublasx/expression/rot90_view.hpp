@@ -0,0 +1,163 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/expression/rot90_view.hpp
+ *
+ * \brief Matrix expression viewing a matrix expression rotated
+ *  counterclockwise by (a multiple of) 90 degrees.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2011, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_EXPRESSION_ROT90_VIEW_HPP
+#define BOOST_NUMERIC_UBLASX_EXPRESSION_ROT90_VIEW_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublasx/expression/matrix_indexed_view.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Matrix expression viewing a matrix expression rotated
+ *  counterclockwise by (a multiple of) 90 degrees.
+ * \tparam ExprT The type of the viewed matrix expression.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExprT>
+class rot90_view: public matrix_indexed_view< rot90_view<ExprT>, matrix<typename ExprT::value_type> >
+{
+    private: typedef rot90_view<ExprT> self_type;
+    private: typedef matrix_indexed_view<self_type, matrix<typename ExprT::value_type> > base_type;
+    public: typedef ExprT expression_type;
+    public: typedef typename ExprT::const_closure_type expression_closure_type;
+    public: typedef typename base_type::size_type size_type;
+    public: typedef typename base_type::const_reference const_reference;
+
+
+    // Construction and destruction
+
+
+    /**
+     * \brief Create a view of the given expression rotated by \a k*90 degrees.
+     * \param e The viewed matrix expression.
+     * \param k The number of counterclockwise rotations (a negative value
+     *  means clockwise rotations).
+     */
+    public: BOOST_UBLAS_INLINE rot90_view(expression_type const& e, int k = 1)
+        : e_(e),
+          k_(k % 4)
+    {
+        // Make sure k \in {0, 1, 2, 3}
+        if (k_ < 0)
+        {
+            k_ += 4;
+        }
+    }
+
+
+    // Accessors
+
+
+    public: BOOST_UBLAS_INLINE size_type size1() const
+    {
+        return (k_ % 2) ? e_.size2() : e_.size1();
+    }
+
+
+    public: BOOST_UBLAS_INLINE size_type size2() const
+    {
+        return (k_ % 2) ? e_.size1() : e_.size2();
+    }
+
+
+    public: BOOST_UBLAS_INLINE expression_closure_type const& expression() const
+    {
+        return e_;
+    }
+
+
+    // Element access
+
+
+    public: BOOST_UBLAS_INLINE const_reference operator()(size_type i, size_type j) const
+    {
+        switch (k_)
+        {
+            case 1:
+                return e_(j, e_.size2()-i-1);
+            case 2:
+                return e_(e_.size1()-i-1, e_.size2()-j-1);
+            case 3:
+                return e_(e_.size1()-j-1, i);
+            default:
+                return e_(i, j);
+        }
+    }
+
+
+    // Evaluation
+
+
+    /// Copy the elements of this view into the given matrix container.
+    public: template <typename MatrixT>
+            BOOST_UBLAS_INLINE void assign_to(MatrixT& m) const
+    {
+        size_type nr(e_.size1());
+        size_type nc(e_.size2());
+
+        if (k_ == 1)
+        {
+            for (size_type c = 0; c < nc; ++c)
+            {
+                row(m, nc-c-1) = column(e_, c);
+            }
+        }
+        else if (k_ == 2)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+                for (size_type c = 0; c < nc; ++c)
+                {
+                    m(nr-r-1,nc-c-1) = e_(r,c);
+                }
+            }
+        }
+        else if (k_ == 3)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+                column(m, nr-r-1) = row(e_, r);
+            }
+        }
+        else
+        {
+            detail::view_assign(m, e_);
+        }
+    }
+
+
+    private: expression_closure_type e_;
+    private: int k_;
+};
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_EXPRESSION_ROT90_VIEW_HPP
@@ -21,6 +21,7 @@
 
 
 #include <boost/function.hpp>
+#include <boost/numeric/ublasx/detail/functor.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/numeric/ublas/detail/iterator.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
@@ -52,7 +53,7 @@ class vector_binary_functor1: public vector_expression<vector_binary_functor1<Ex
 #endif
 
     private: typedef vector_binary_functor1<ExprT, Arg2T, SignatureT> self_type;
-    public: typedef ::boost::function<SignatureT> functor_type;
+    public: typedef typename detail::functor_type_traits<SignatureT>::type functor_type;
     public: typedef Arg2T arg2_type;
     //public: typedef ExprT expression_type;
     public: typedef typename ::boost::mpl::if_<
@@ -126,6 +127,18 @@ class vector_binary_functor1: public vector_expression<vector_binary_functor1<Ex
     }
 
 
+    public: BOOST_UBLAS_INLINE arg2_type const& argument2() const
+    {
+        return a2_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE functor_type const& functor() const
+    {
+        return f_;
+    }
+
+
     // Element access
 
 
@@ -341,7 +354,7 @@ class vector_binary_functor1: public vector_expression<vector_binary_functor1<Ex
 
     private: expression_closure_type e_;
     private: arg2_type a2_;
-    private: functor_type f_;
+    private: mutable functor_type f_;
 }; // vector_binary_functor1
 
 
@@ -372,7 +385,7 @@ class vector_binary_functor2: public vector_expression<vector_binary_functor2<Ar
 #endif
 
     private: typedef vector_binary_functor2<Arg1T, ExprT, SignatureT> self_type;
-    public: typedef ::boost::function<SignatureT> functor_type;
+    public: typedef typename detail::functor_type_traits<SignatureT>::type functor_type;
     public: typedef Arg1T arg1_type;
     //public: typedef ExprT expression_type;
     public: typedef typename ::boost::mpl::if_<
@@ -446,6 +459,18 @@ class vector_binary_functor2: public vector_expression<vector_binary_functor2<Ar
     }
 
 
+    public: BOOST_UBLAS_INLINE arg1_type const& argument1() const
+    {
+        return a1_;
+    }
+
+
+    public: BOOST_UBLAS_INLINE functor_type const& functor() const
+    {
+        return f_;
+    }
+
+
     // Element access
 
 
@@ -661,7 +686,7 @@ class vector_binary_functor2: public vector_expression<vector_binary_functor2<Ar
 
     private: arg1_type a1_;
     private: expression_closure_type e_;
-    private: functor_type f_;
+    private: mutable functor_type f_;
 }; // vector_binary_functor2
 
 
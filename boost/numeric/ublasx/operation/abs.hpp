@@ -23,7 +23,10 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
+#include <complex>
+#include <cstdlib>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -32,15 +35,31 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Functor computing the absolute value of its argument.
+template <typename ArgT, typename ResT>
+struct abs_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return ::std::abs(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_abs_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef typename type_traits<signature_argument_type>::real_type signature_result_type;
+    typedef abs_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -53,9 +72,10 @@ struct matrix_abs_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef typename type_traits<signature_argument_type>::real_type signature_result_type;
+    typedef abs_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -80,9 +100,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_abs_functor_traits<VectorExprT>::result_type abs(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_abs_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_abs_functor_traits<VectorExprT>::signature_result_type signature_result_type;
+    typedef typename detail::vector_abs_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), ::std::abs<signature_result_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -102,11 +122,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_abs_functor_traits<MatrixExprT>::result_type abs(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_abs_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_abs_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_abs_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), ::std::abs<signature_result_type>);
+    return expression_type(me(), functor_type());
 }
 
+
+// abs(policy, e), which evaluates abs(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(abs)
+
 }}} // Namespace boost::numeric::ublasx
 
 
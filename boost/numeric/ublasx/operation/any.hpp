@@ -22,6 +22,7 @@
 
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublasx/detail/predicate.hpp>
 //#include <boost/numeric/ublas/operation/begin.hpp>
 //#include <boost/numeric/ublas/operation/end.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
@@ -119,35 +120,7 @@ template <typename VectorExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
 bool any(vector_expression<VectorExprT> const& ve, UnaryPredicateT p)
 {
-    // Implementation Note:
-    //  Currently (06-2010) there are only iterators that skip zero-valued
-    //  elements.
-    //  So the iteration is done through plain indices instead of iterators.
-
-//  typedef typename vector_traits<VectorExprT>::const_iterator iterator_type;
-//
-//  iterator_type it_end = end(ve);
-//  for (iterator_type it = begin(ve); it != it_end; ++it)
-//  {
-//      if (p(*it))
-//      {
-//          return true;
-//      }
-//  }
-//
-
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
-
-    size_type n = size(ve);
-    for (size_type i = 0; i < n; ++i)
-    {
-        if (p(ve()(i)))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return detail::any_of(ve, p);
 }
 
 
@@ -165,43 +138,7 @@ template <typename MatrixExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
 bool any(matrix_expression<MatrixExprT> const& me, UnaryPredicateT p)
 {
-    // Implementation Note:
-    //  Currently (06-2010) there are only iterators that skip zero-valued
-    //  elements.
-    //  So the iteration is done through plain indices instead of iterators.
-
-//  typedef typename const_iterator_type<MatrixExprT,tag::major>::type maj_iterator_type;
-//  typedef typename const_iterator_type<MatrixExprT,tag::minor>::type min_iterator_type;
-//
-//  maj_iterator_type maj_it_end = end<tag::major>(me);
-//  for (maj_iterator_type maj_it = begin<tag::major>(me); maj_it != maj_it_end; ++maj_it)
-//  {
-//      min_iterator_type min_it_end = end(maj_it);
-//      for (min_iterator_type min_it = begin(maj_it); min_it != min_it_end; ++min_it)
-//      {
-//          if (p(*min_it))
-//          {
-//              return true;
-//          }
-//      }
-//  }
-
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-            if (p(me()(r,c)))
-            {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    return detail::any_of(me, p);
 }
 
 
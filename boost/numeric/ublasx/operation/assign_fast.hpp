@@ -0,0 +1,372 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/assign_fast.hpp
+ *
+ * \brief Assign an element-wise expression to a container through the storage
+ *  arrays of the container and of the expression operands.
+ *
+ * When the destination is a dense \c vector or \c matrix container and the
+ * expression is made of element-wise operations (the ublasx functor
+ * expressions and the uBLAS unary and binary element-wise expressions) on
+ * dense containers stored with the same layout as the destination, the
+ * assignment is a single loop over the storage arrays (see
+ * \c boost/numeric/ublasx/detail/assign.hpp), which is split among concurrent
+ * threads for long arrays.
+ * Any other expression is assigned to a dense destination by blocks of rows
+ * (columns) split among concurrent threads, and to other destinations by
+ * uBLAS, like <code>noalias(c) = e</code>.
+ * The threads are only used under a parallel execution policy; without a
+ * policy, the assignment is sequential.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_ASSIGN_FAST_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_ASSIGN_FAST_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/exception.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/assign.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
+#include <boost/numeric/ublasx/traits/is_execution_policy.hpp>
+#include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+namespace detail {
+
+/// Assign an expression to a container by several threads (dense containers).
+template <typename MatrixT, typename ExprT>
+BOOST_UBLAS_INLINE
+void parallel_assign(matrix_container<MatrixT>& mc, ExprT const& e, dense_tag)
+{
+    line_assign(mc(), e);
+}
+
+
+/// Assign an expression to a container by several threads (other containers).
+template <typename MatrixT, typename ExprT, typename StorageT>
+BOOST_UBLAS_INLINE
+void parallel_assign(matrix_container<MatrixT>& mc, ExprT const& e, StorageT)
+{
+    mc().assign(e);
+}
+
+
+template <typename VectorT, typename ExprT>
+BOOST_UBLAS_INLINE
+void parallel_assign(vector_container<VectorT>& vc, ExprT const& e, dense_tag)
+{
+    element_assign(vc(), e);
+}
+
+
+template <typename VectorT, typename ExprT, typename StorageT>
+BOOST_UBLAS_INLINE
+void parallel_assign(vector_container<VectorT>& vc, ExprT const& e, StorageT)
+{
+    vc().assign(e);
+}
+
+
+/// Auxiliary class for the implementation of the \c assign_fast operation.
+template <bool Flat, bool Parallel>
+struct assign_fast_impl;
+
+
+template <>
+struct assign_fast_impl<false, false>
+{
+    template <typename OrientationT, typename ContainerT, typename ExprT>
+    BOOST_UBLAS_INLINE
+    static void apply(ContainerT& c, ExprT const& e, ::std::size_t /*n*/)
+    {
+        c.assign(e);
+    }
+};
+
+
+template <>
+struct assign_fast_impl<false, true>
+{
+    template <typename OrientationT, typename ContainerT, typename ExprT>
+    BOOST_UBLAS_INLINE
+    static void apply(ContainerT& c, ExprT const& e, ::std::size_t /*n*/)
+    {
+        parallel_assign(c, e, typename ContainerT::storage_category());
+    }
+};
+
+
+template <>
+struct assign_fast_impl<true, false>
+{
+    template <typename OrientationT, typename ContainerT, typename ExprT>
+    BOOST_UBLAS_INLINE
+    static void apply(ContainerT& c, ExprT const& e, ::std::size_t n)
+    {
+        typedef typename ContainerT::value_type value_type;
+        typedef flat_evaluator<ExprT, OrientationT> evaluator_type;
+
+        flat_assign_chunk<value_type, evaluator_type>(flat_storage(c.data()), evaluator_type(e))(0, 0, n);
+    }
+};
+
+
+template <>
+struct assign_fast_impl<true, true>
+{
+    template <typename OrientationT, typename ContainerT, typename ExprT>
+    BOOST_UBLAS_INLINE
+    static void apply(ContainerT& c, ExprT const& e, ::std::size_t n)
+    {
+        flat_assign(flat_storage(c.data()), n, flat_evaluator<ExprT, OrientationT>(e));
+    }
+};
+
+
+/// The type of the dense matrix a matrix expression is evaluated to.
+template <typename MatrixExprT>
+struct matrix_eval_traits
+{
+    typedef matrix<
+                typename matrix_traits<MatrixExprT>::value_type,
+                typename layout_type<MatrixExprT>::type
+            > result_type;
+};
+
+
+/// The type of the dense vector a vector expression is evaluated to.
+template <typename VectorExprT>
+struct vector_eval_traits
+{
+    typedef vector<typename vector_traits<VectorExprT>::value_type> result_type;
+};
+
+} // Namespace detail
+
+
+/**
+ * \brief Assign the given matrix expression to the given matrix container,
+ *  without checking for aliases, according to the given execution policy.
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam MatrixT The type of the matrix container.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param mc The matrix container, which must have the same size of the matrix
+ *  expression.
+ * \param me The matrix expression.
+ * \return The matrix container.
+ *
+ * Like <code>noalias(mc) = me</code>, but element-wise expressions on dense
+ * containers with the same orientation as \a mc are evaluated by a single
+ * loop over their storage arrays.
+ * Under a parallel policy, that loop is split among threads and, for any other
+ * expression, the rows (columns) of a row-major (column-major) dense \a mc
+ * are split into blocks assigned by different threads.
+ * As for \c noalias, \a mc can appear in \a me only as an element-wise
+ * operand (e.g., <code>assign_fast(A, abs(A))</code>).
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ExecutionPolicyT, typename MatrixT, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+MatrixT& assign_fast(ExecutionPolicyT const& /*policy*/, matrix_container<MatrixT>& mc, matrix_expression<MatrixExprT> const& me)
+{
+    typedef typename MatrixT::orientation_category orientation_category;
+
+    BOOST_STATIC_ASSERT( is_execution_policy<ExecutionPolicyT>::value );
+
+    BOOST_UBLAS_CHECK(mc().size1() == me().size1(), bad_size());
+    BOOST_UBLAS_CHECK(mc().size2() == me().size2(), bad_size());
+
+    detail::assign_fast_impl<
+            detail::flat_evaluator<MatrixT, orientation_category>::value
+            && detail::flat_evaluator<MatrixExprT, orientation_category>::value,
+            is_parallel_execution_policy<ExecutionPolicyT>::value
+        >::template apply<orientation_category>(mc(), me(), mc().size1()*mc().size2());
+
+    return mc();
+}
+
+
+/**
+ * \brief Assign the given vector expression to the given vector container,
+ *  without checking for aliases, according to the given execution policy.
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam VectorT The type of the vector container.
+ * \tparam VectorExprT The type of the vector expression.
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param vc The vector container, which must have the same size of the vector
+ *  expression.
+ * \param ve The vector expression.
+ * \return The vector container.
+ *
+ * Like <code>noalias(vc) = ve</code>, but element-wise expressions on dense
+ * containers are evaluated by a single loop over their storage arrays.
+ * Under a parallel policy, a dense \a vc is split into blocks assigned by
+ * different threads.
+ * As for \c noalias, \a vc can appear in \a ve only as an element-wise
+ * operand.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ExecutionPolicyT, typename VectorT, typename VectorExprT>
+BOOST_UBLAS_INLINE
+VectorT& assign_fast(ExecutionPolicyT const& /*policy*/, vector_container<VectorT>& vc, vector_expression<VectorExprT> const& ve)
+{
+    BOOST_STATIC_ASSERT( is_execution_policy<ExecutionPolicyT>::value );
+
+    BOOST_UBLAS_CHECK(vc().size() == ve().size(), bad_size());
+
+    detail::assign_fast_impl<
+            detail::flat_evaluator<VectorT, unknown_orientation_tag>::value
+            && detail::flat_evaluator<VectorExprT, unknown_orientation_tag>::value,
+            is_parallel_execution_policy<ExecutionPolicyT>::value
+        >::template apply<unknown_orientation_tag>(vc(), ve(), vc().size());
+
+    return vc();
+}
+
+
+/**
+ * \brief Assign the given matrix expression to the given matrix container,
+ *  without checking for aliases.
+ * \tparam MatrixT The type of the matrix container.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param mc The matrix container, which must have the same size of the matrix
+ *  expression.
+ * \param me The matrix expression.
+ * \return The matrix container.
+ *
+ * Same as <code>assign_fast(execution::seq, mc, me)</code>, so that the
+ * functors used in \a me are called by the calling thread, in storage order.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+MatrixT& assign_fast(matrix_container<MatrixT>& mc, matrix_expression<MatrixExprT> const& me)
+{
+    return assign_fast(execution::seq, mc, me);
+}
+
+
+/**
+ * \brief Assign the given vector expression to the given vector container,
+ *  without checking for aliases.
+ * \tparam VectorT The type of the vector container.
+ * \tparam VectorExprT The type of the vector expression.
+ * \param vc The vector container, which must have the same size of the vector
+ *  expression.
+ * \param ve The vector expression.
+ * \return The vector container.
+ *
+ * Same as <code>assign_fast(execution::seq, vc, ve)</code>, so that the
+ * functors used in \a ve are called by the calling thread, in storage order.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorT, typename VectorExprT>
+BOOST_UBLAS_INLINE
+VectorT& assign_fast(vector_container<VectorT>& vc, vector_expression<VectorExprT> const& ve)
+{
+    return assign_fast(execution::seq, vc, ve);
+}
+
+
+namespace detail {
+
+/// Evaluate a matrix expression to a dense matrix, according to the given execution policy.
+template <typename ExecutionPolicyT, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+typename matrix_eval_traits<MatrixExprT>::result_type evaluate(ExecutionPolicyT const& policy, matrix_expression<MatrixExprT> const& me)
+{
+    typename matrix_eval_traits<MatrixExprT>::result_type res(me().size1(), me().size2());
+
+    assign_fast(policy, res, me);
+
+    return res;
+}
+
+
+/// Evaluate a vector expression to a dense vector, according to the given execution policy.
+template <typename ExecutionPolicyT, typename VectorExprT>
+BOOST_UBLAS_INLINE
+typename vector_eval_traits<VectorExprT>::result_type evaluate(ExecutionPolicyT const& policy, vector_expression<VectorExprT> const& ve)
+{
+    typename vector_eval_traits<VectorExprT>::result_type res(ve().size());
+
+    assign_fast(policy, res, ve);
+
+    return res;
+}
+
+} // Namespace detail
+
+}}} // Namespace boost::numeric::ublasx
+
+
+/**
+ * \brief Define the overloads of the element-wise operation \a name which
+ *  take an execution policy as first argument.
+ *
+ * For a vector (matrix) expression \c e, <code>name(policy, e)</code> returns
+ * the dense vector (matrix) obtained by evaluating <code>name(e)</code>
+ * immediately, by means of \c assign_fast under the given execution policy.
+ * The overloads take part in overload resolution only when the type of
+ * \c policy is an execution policy (see \c is_execution_policy).
+ *
+ * The macro must be expanded in namespace \c boost::numeric::ublasx, where the
+ * operation must provide the \c detail::vector_<name>_functor_traits and
+ * \c detail::matrix_<name>_functor_traits traits classes.
+ */
+#define BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(name) \
+    template <typename ExecutionPolicyT, typename VectorExprT> \
+    BOOST_UBLAS_INLINE \
+    typename ::boost::enable_if< \
+        is_execution_policy<ExecutionPolicyT>, \
+        typename detail::vector_eval_traits< \
+            typename detail::vector_##name##_functor_traits<VectorExprT>::expression_type \
+        >::result_type \
+    >::type name(ExecutionPolicyT const& policy, vector_expression<VectorExprT> const& ve) \
+    { \
+        return detail::evaluate(policy, name(ve)); \
+    } \
+    \
+    template <typename ExecutionPolicyT, typename MatrixExprT> \
+    BOOST_UBLAS_INLINE \
+    typename ::boost::enable_if< \
+        is_execution_policy<ExecutionPolicyT>, \
+        typename detail::matrix_eval_traits< \
+            typename detail::matrix_##name##_functor_traits<MatrixExprT>::expression_type \
+        >::result_type \
+    >::type name(ExecutionPolicyT const& policy, matrix_expression<MatrixExprT> const& me) \
+    { \
+        return detail::evaluate(policy, name(me)); \
+    }
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_ASSIGN_FAST_HPP
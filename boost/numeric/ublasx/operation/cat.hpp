@@ -24,8 +24,7 @@
 #include <boost/numeric/ublas/exception.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/traits.hpp>
-#include <boost/numeric/ublasx/operation/num_columns.hpp>
-#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/expression/concat_view.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
 
 
@@ -81,43 +80,7 @@ struct cat_by_dim_impl<1>
     BOOST_UBLAS_INLINE
     static typename matrix_cat_traits<Expr1T,Expr2T>::result_type apply(matrix_expression<Expr1T> const& A, matrix_expression<Expr2T> const& B)
     {
-        typedef typename matrix_cat_traits<Expr1T,Expr2T>::result_type out_matrix_type;
-        typedef typename matrix_traits<out_matrix_type>::value_type value_type;
-        typedef typename matrix_traits<out_matrix_type>::size_type size_type;
-
-    //  // precondition: num_columns(A) == num_columns(B)
-    //  BOOST_UBLAS_CHECK(
-    //      num_columns(A) == num_columns(B),
-    //      bad_argument()
-    //  );
-
-        size_type A_nr = num_rows(A);
-        size_type A_nc = num_columns(A);
-        size_type B_nr = num_rows(B);
-        size_type B_nc = num_columns(B);
-        size_type nc = ::std::max(A_nc, B_nc);
-
-        out_matrix_type X(A_nr+B_nr, nc, value_type());
-
-        for (size_type c = 0; c < nc; ++c)
-        {
-            if (c < A_nc)
-            {
-                for (size_type r = 0; r < A_nr; ++r)
-                {
-                    X(r,c) = A()(r,c);
-                }
-            }
-            if (c < B_nc)
-            {
-                for (size_type r = 0; r < B_nr; ++r)
-                {
-                    X(r+A_nr,c) = B()(r,c);
-                }
-            }
-        }
-
-        return X;
+        return concat_view<Expr1T,Expr2T,1>(A(), B()).eval();
     }
 };
 
@@ -137,37 +100,7 @@ struct cat_by_dim_impl<2>
     BOOST_UBLAS_INLINE
     static typename matrix_cat_traits<Expr1T,Expr2T>::result_type apply(matrix_expression<Expr1T> const& A, matrix_expression<Expr2T> const& B)
     {
-        typedef typename matrix_cat_traits<Expr1T,Expr2T>::result_type out_matrix_type;
-        typedef typename matrix_traits<out_matrix_type>::value_type value_type;
-        typedef typename matrix_traits<out_matrix_type>::size_type size_type;
-
-        size_type A_nr = num_rows(A);
-        size_type A_nc = num_columns(A);
-        size_type B_nr = num_rows(B);
-        size_type B_nc = num_columns(B);
-        size_type nr = ::std::max(A_nr, B_nr);
-
-        out_matrix_type X(nr, A_nc+B_nc, value_type());
-
-        for (size_type r = 0; r < nr; ++r)
-        {
-            if (r < A_nr)
-            {
-                for (size_type c = 0; c < A_nc; ++c)
-                {
-                    X(r,c) = A()(r,c);
-                }
-            }
-            if (r < B_nr)
-            {
-                for (size_type c = 0; c < B_nc; ++c)
-                {
-                    X(r,c+A_nc) = B()(r,c);
-                }
-            }
-        }
-
-        return X;
+        return concat_view<Expr1T,Expr2T,2>(A(), B()).eval();
     }
 };
 
@@ -298,6 +231,72 @@ typename matrix_cat_traits<InMatrixExpr1T,InMatrixExpr2T>::result_type cat(matri
     return detail::cat_by_dim_impl<Dim>::template apply(A, B);
 }
 
+
+
+/**
+ * \brief Concatenate arrays by columns (i.e., along rows) without copying
+ *  their elements.
+ *
+ * \tparam InMatrixExpr1T The type of the first input matrix expression.
+ * \tparam InMatrixExpr2T The type of the second input matrix expression.
+ *
+ * \param A The first input matrix expression.
+ * \param B The second input matrix expression.
+ * \return A view of the matrix returned by \c cat_columns(A,B), whose elements
+ *  are taken from \a A and \a B on access.
+ *
+ * Views can be nested, so that a block matrix can be built by means of a
+ * single copy (e.g., by assigning or evaluating
+ * <code>lazy_cat_columns(lazy_cat_rows(A,B), lazy_cat_rows(C,D))</code>).
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename InMatrixExpr1T,
+    typename InMatrixExpr2T
+>
+BOOST_UBLAS_INLINE
+concat_view<InMatrixExpr1T,InMatrixExpr2T,1> lazy_cat_columns(matrix_expression<InMatrixExpr1T> const& A, matrix_expression<InMatrixExpr2T> const& B)
+{
+    return concat_view<InMatrixExpr1T,InMatrixExpr2T,1>(A(), B());
+}
+
+
+/**
+ * \brief Concatenate arrays by rows (i.e., along columns) without copying
+ *  their elements.
+ *
+ * \tparam InMatrixExpr1T The type of the first input matrix expression.
+ * \tparam InMatrixExpr2T The type of the second input matrix expression.
+ *
+ * \param A The first input matrix expression.
+ * \param B The second input matrix expression.
+ * \return A view of the matrix returned by \c cat_rows(A,B), whose elements
+ *  are taken from \a A and \a B on access.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename InMatrixExpr1T,
+    typename InMatrixExpr2T
+>
+BOOST_UBLAS_INLINE
+concat_view<InMatrixExpr1T,InMatrixExpr2T,2> lazy_cat_rows(matrix_expression<InMatrixExpr1T> const& A, matrix_expression<InMatrixExpr2T> const& B)
+{
+    return concat_view<InMatrixExpr1T,InMatrixExpr2T,2>(A(), B());
+}
+
+template <
+    std::size_t Dim,
+    typename InMatrixExpr1T,
+    typename InMatrixExpr2T
+>
+BOOST_UBLAS_INLINE
+concat_view<InMatrixExpr1T,InMatrixExpr2T,Dim> lazy_cat(matrix_expression<InMatrixExpr1T> const& A, matrix_expression<InMatrixExpr2T> const& B)
+{
+    return concat_view<InMatrixExpr1T,InMatrixExpr2T,Dim>(A(), B());
+}
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -31,6 +31,17 @@
  *              \end{cases}
  * \f}
  *
+ * Besides the exact condition numbers, the 1-norm, the infinity norm and the
+ * 2-norm condition numbers can be estimated (see \c cond_method).
+ * The 1-norm and infinity norm estimates come from a single LU factorization
+ * and the Hager/Higham norm estimator (LAPACK \c gecon), so they cost
+ * \f$O(n^3/3)\f$ flops instead of the \f$O(2n^3)\f$ flops needed to form
+ * the inverse, and the estimates are usually within a factor of 3 of the exact
+ * value.
+ * The 2-norm estimate runs a few power iterations on \f$A^H A\f$ and on its
+ * inverse (by means of the same LU factors) to approximate the extreme
+ * singular values of \f$A\f$, thus avoiding the SVD.
+ *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
  * <hr/>
@@ -50,13 +61,18 @@
 #include <boost/numeric/ublas/fwd.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublasx/operation/any.hpp>
 #include <boost/numeric/ublasx/operation/inv.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
 #include <boost/numeric/ublasx/operation/max.hpp>
 #include <boost/numeric/ublasx/operation/min.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/rcond.hpp>
 #include <boost/numeric/ublasx/operation/svd.hpp>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <stdexcept>
@@ -67,8 +83,30 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief The method used to compute a matrix condition number.
+ *
+ * The estimates are much cheaper than the exact values for large matrices
+ * and are usually enough to decide whether a matrix is ill-conditioned.
+ */
+enum cond_method
+{
+    exact_cond_method, ///< Compute the exact value (by the inverse or the SVD).
+    estimate_cond_method ///< Estimate the value from a single LU factorization.
+};
+
+
 namespace detail {
 
+/// The maximum number of power iterations of the 2-norm condition number
+/// estimate (for each one of the extreme singular values).
+static const ::std::size_t cond_2_estimate_max_iterations = 20;
+
+/// The relative tolerance used to stop the power iterations of the 2-norm
+/// condition number estimate.
+static const double cond_2_estimate_tolerance = 1.0e-3;
+
+
 enum norm_categories
 {
     norm_inf_category = -1,
@@ -79,7 +117,7 @@ enum norm_categories
 
 
 template <int Norm, typename MatrixExprT>
-typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_impl(matrix_expression<MatrixExprT> const& A)
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_impl(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename type_traits<value_type>::real_type real_type;
@@ -126,7 +164,7 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
             break;
         case norm_2_category: // 2-norm
             {
-                vector<real_type> s = svd_values(A);
+                vector<real_type> s = svd_values(A, alg);
                 if (any(s, ::std::bind2nd(::std::equal_to<real_type>(), 0)))
                 {
                     // Singular matrix
@@ -143,6 +181,164 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
     return c;
 }
 
+
+/// Make the starting vector of the power iterations (like LAPACK \c lacn2,
+/// alternate signs and growing magnitudes make it unlikely to be orthogonal
+/// to the wanted singular vector).
+template <typename VectorT>
+void cond_2_estimate_start(VectorT& x)
+{
+    typedef typename vector_traits<VectorT>::value_type value_type;
+    typedef typename vector_traits<VectorT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    const size_type n = size(x);
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        const real_type xi = real_type(1) + ((n > 1) ? real_type(i)/real_type(n-1) : real_type(0));
+        x(i) = (i % 2) ? -xi : xi;
+    }
+    x /= norm_2(x);
+}
+
+
+/**
+ * \brief Estimate the 2-norm condition number of the square matrix \a A from
+ *  its LU decomposition \a lu.
+ *
+ * The largest eigenvalue of \f$A^H A\f$ (i.e., \f$\sigma_{\max}^2\f$) is
+ * approximated by power iterations with \f$A^H A\f$, while the largest
+ * eigenvalue of \f$(A^H A)^{-1}\f$ (i.e., \f$\sigma_{\min}^{-2}\f$) is
+ * approximated by power iterations with \f$A^{-1} A^{-H}\f$, where each
+ * iteration costs two pairs of triangular solves with the cached LU factors.
+ * Each approximation is a lower bound, so the result never exceeds the exact
+ * condition number.
+ */
+template <typename MatrixExprT, typename ValueT>
+typename type_traits<ValueT>::real_type cond_2_estimate_impl(matrix_expression<MatrixExprT> const& A, lu_decomposition<ValueT> const& lu)
+{
+    typedef ValueT value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n = num_rows(A);
+
+    if (lu.singular())
+    {
+        return ::std::numeric_limits<real_type>::infinity();
+    }
+    if (n == 0)
+    {
+        return real_type(1);
+    }
+
+    const real_type tol = static_cast<real_type>(cond_2_estimate_tolerance);
+
+    vector<value_type> x(n);
+    vector<value_type> y(n);
+
+    // Power iterations for sigma_max^2
+    real_type smax2(0);
+    cond_2_estimate_start(x);
+    for (size_type k = 0; k < cond_2_estimate_max_iterations; ++k)
+    {
+        noalias(y) = prod(A, x);
+        noalias(x) = prod(herm(A), y);
+
+        const real_type est = norm_2(x);
+        if (est == real_type(0))
+        {
+            break;
+        }
+        x /= est;
+
+        const bool converged = ::std::abs(est-smax2) <= tol*est;
+        smax2 = est;
+        if (converged)
+        {
+            break;
+        }
+    }
+
+    // Power iterations for sigma_min^{-2}, with (A^H A)^{-1} = A^{-1} A^{-H}
+    real_type sinv2(0);
+    cond_2_estimate_start(x);
+    for (size_type k = 0; k < cond_2_estimate_max_iterations; ++k)
+    {
+        lu.solve_herm_inplace(x);
+        lu.solve_inplace(x);
+
+        const real_type est = norm_2(x);
+        if (!(est < ::std::numeric_limits<real_type>::infinity()))
+        {
+            // The matrix is numerically singular
+            return ::std::numeric_limits<real_type>::infinity();
+        }
+        x /= est;
+
+        const bool converged = ::std::abs(est-sinv2) <= tol*est;
+        sinv2 = est;
+        if (converged)
+        {
+            break;
+        }
+    }
+
+    return ::std::sqrt(smax2*sinv2);
+}
+
+
+/// Turn a reciprocal condition number estimate into a condition number
+/// estimate.
+template <typename RealT>
+BOOST_UBLAS_INLINE
+RealT cond_from_rcond(RealT rc)
+{
+    return (rc > RealT(0)) ? RealT(1)/rc : ::std::numeric_limits<RealT>::infinity();
+}
+
+
+template <int Norm, typename MatrixExprT>
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_estimate_impl(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    if (num_rows(A) != num_columns(A))
+    {
+        if (Norm != norm_2_category)
+        {
+            throw ::std::invalid_argument("[boost::numeric::ublasx::detail::cond_estimate_impl] For rectangular matrices use the 2 norm.");
+        }
+
+        // The estimate relies on the LU factorization: fall back to the SVD
+        return cond_impl<norm_2_category>(A, alg);
+    }
+
+    // Factorize A just once
+    lu_decomposition<value_type> lu(A);
+
+    real_type c;
+
+    switch (Norm)
+    {
+        case norm_inf_category: // Infinity norm
+            c = cond_from_rcond(lu_rcond(lu, 'I'));
+            break;
+        case norm_1_category: // 1-norm
+            c = cond_from_rcond(lu_rcond(lu, 'O'));
+            break;
+        case norm_2_category: // 2-norm
+            c = cond_2_estimate_impl(A, lu);
+            break;
+        default:
+            throw ::std::invalid_argument("[boost::numeric::ublasx::detail::cond_estimate_impl] Unsupported norm for the condition number estimate.");
+    }
+
+    return c;
+}
+
 } // Namespace detail
 
 
@@ -151,24 +347,53 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
  *
  * \tparam MatrixExprT The matrix expression type.
  * \param A The input matrix expression.
- * \return The 1-norm condition number if \a A is not singular; otherwise,
- *  \f$+\infty\f$.
+ * \param method Tell whether the condition number is computed exactly or
+ *  estimated (by a single LU factorization and LAPACK \c gecon).
+ * \return The 1-norm condition number (or its estimate) if \a A is not
+ *  singular; otherwise, \f$+\infty\f$.
  *
  * \author Marco Guazzone, marco.guazzone@gmail.com
  */
 template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
-typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_1(matrix_expression<MatrixExprT> const& A)
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_1(matrix_expression<MatrixExprT> const& A, cond_method method = exact_cond_method)
 {
+    if (method == estimate_cond_method)
+    {
+        return detail::cond_estimate_impl<detail::norm_1_category>(A);
+    }
+
     return detail::cond_impl<detail::norm_1_category>(A);
 }
 
 
+/**
+ * \brief Estimate of the 1-norm matrix condition number with respect to
+ *  inversion, computed from an existing LU decomposition.
+ *
+ * \tparam ValueT The type of the elements of the decomposed matrix.
+ * \param lu The LU decomposition of a \e square matrix.
+ * \return The estimate of the 1-norm condition number if the decomposed
+ *  matrix is not singular; otherwise, \f$+\infty\f$.
+ *
+ * The decomposed matrix is not factorized again.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+BOOST_UBLAS_INLINE
+typename type_traits<ValueT>::real_type cond_1(lu_decomposition<ValueT> const& lu)
+{
+    return detail::cond_from_rcond(detail::lu_rcond(lu, 'O'));
+}
+
+
 /**
  * \brief The 2-norm matrix condition number with respect to inversion.
  *
  * \tparam MatrixExprT The matrix expression type.
  * \param A The input matrix expression.
+ * \param alg The LAPACK driver used to compute the singular values of \a A.
  * \return The 2-norm condition number if \a A is not singular; otherwise,
  *  \f$+\infty\f$.
  *
@@ -176,9 +401,41 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
  */
 template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
-typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_2(matrix_expression<MatrixExprT> const& A)
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_2(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
 {
-    return detail::cond_impl<detail::norm_2_category>(A);
+    return detail::cond_impl<detail::norm_2_category>(A, alg);
+}
+
+
+/**
+ * \brief The 2-norm matrix condition number with respect to inversion,
+ *  computed by the given method.
+ *
+ * \tparam MatrixExprT The matrix expression type.
+ * \param A The input matrix expression.
+ * \param method Tell whether the condition number is computed exactly (by the
+ *  SVD) or estimated (by a few power iterations on \f$A^H A\f$ and on its
+ *  inverse, through a single LU factorization).
+ * \param alg The LAPACK driver used to compute the singular values of \a A,
+ *  when they are needed.
+ * \return The 2-norm condition number (or its estimate, which never exceeds
+ *  the exact value) if \a A is not singular; otherwise, \f$+\infty\f$.
+ *
+ * The estimate is only available for square matrices; for rectangular
+ * matrices the exact value is computed.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_2(matrix_expression<MatrixExprT> const& A, cond_method method, svd_algorithm alg = auto_svd_algorithm)
+{
+    if (method == estimate_cond_method)
+    {
+        return detail::cond_estimate_impl<detail::norm_2_category>(A, alg);
+    }
+
+    return detail::cond_impl<detail::norm_2_category>(A, alg);
 }
 
 
@@ -187,19 +444,47 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
  *
  * \tparam MatrixExprT The matrix expression type.
  * \param A The input matrix expression.
- * \return The infinity norm condition number if \a A is not singular;
- *  otherwise, \f$+\infty\f$.
+ * \param method Tell whether the condition number is computed exactly or
+ *  estimated (by a single LU factorization and LAPACK \c gecon).
+ * \return The infinity norm condition number (or its estimate) if \a A is
+ *  not singular; otherwise, \f$+\infty\f$.
  *
  * \author Marco Guazzone, marco.guazzone@gmail.com
  */
 template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
-typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_inf(matrix_expression<MatrixExprT> const& A)
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond_inf(matrix_expression<MatrixExprT> const& A, cond_method method = exact_cond_method)
 {
+    if (method == estimate_cond_method)
+    {
+        return detail::cond_estimate_impl<detail::norm_inf_category>(A);
+    }
+
     return detail::cond_impl<detail::norm_inf_category>(A);
 }
 
 
+/**
+ * \brief Estimate of the infinity norm matrix condition number with respect
+ *  to inversion, computed from an existing LU decomposition.
+ *
+ * \tparam ValueT The type of the elements of the decomposed matrix.
+ * \param lu The LU decomposition of a \e square matrix.
+ * \return The estimate of the infinity norm condition number if the
+ *  decomposed matrix is not singular; otherwise, \f$+\infty\f$.
+ *
+ * The decomposed matrix is not factorized again.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+BOOST_UBLAS_INLINE
+typename type_traits<ValueT>::real_type cond_inf(lu_decomposition<ValueT> const& lu)
+{
+    return detail::cond_from_rcond(detail::lu_rcond(lu, 'I'));
+}
+
+
 /**
  * \brief The Frobenius norm matrix condition number with respect to inversion.
  *
@@ -223,6 +508,7 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
  *
  * \tparam MatrixExprT The matrix expression type.
  * \param A The input matrix expression.
+ * \param alg The LAPACK driver used to compute the singular values of \a A.
  * \return The 2-norm condition number if \a A is not singular; otherwise,
  *  \f$+\infty\f$.
  *
@@ -230,9 +516,25 @@ typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type
  */
 template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
-typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond(matrix_expression<MatrixExprT> const& A)
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
+{
+    return detail::cond_impl<detail::norm_2_category>(A, alg);
+}
+
+
+/**
+ * \brief The 2-norm matrix condition number with respect to inversion,
+ *  computed by the given method.
+ *
+ * \sa cond_2
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type cond(matrix_expression<MatrixExprT> const& A, cond_method method, svd_algorithm alg = auto_svd_algorithm)
 {
-    return detail::cond_impl<detail::norm_2_category>(A);
+    return cond_2(A, method, alg);
 }
 
 }}} // Namespace boost::numeric::ublasx
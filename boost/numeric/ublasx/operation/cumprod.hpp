@@ -0,0 +1,410 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/cumprod.hpp
+ *
+ * \brief Compute the cumulative product of an array.
+ *
+ * The cumulative product is the scan by \c std::multiplies (see
+ * \c boost/numeric/ublasx/operation/scan.hpp), so that long dense containers
+ * are multiplied by concurrent threads.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_CUMPROD_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_CUMPROD_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/detail/temporary.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/scan.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_expression.hpp>
+#include <cstddef>
+#include <functional>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+//@{ Declarations
+
+/**
+ * \brief Compute the cumulative product of the elements of the given vector
+ *  expression.
+ * \tparam VectorExprT The type of the vector expression.
+ * \param ve The vector expression whose elements are cumprodmed up.
+ * \return The cumulative product of the elements of the vector expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT>
+vector<typename vector_traits<VectorExprT>::value_type> cumprod(vector_expression<VectorExprT> const& ve);
+
+
+/**
+ * \brief Compute the cumulative product of the elements over each column of the
+ *  given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param ve The matrix expression whose elements are cumulative productmed up over
+ *  each column.
+ * \return The cumulative product of the elements over each column of the give
+ *  matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod(matrix_expression<MatrixExprT> const& me);
+
+/**
+ * \brief Compute the cumulative product of the elements over each column of the
+ *  given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param ve The matrix expression whose elements are cumulative productmed up over
+ *  each column.
+ * \return The cumulative product of the elements over each column of the given
+ *  matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_rows(matrix_expression<MatrixExprT> const& me);
+
+/**
+ * \brief Compute the cumulative product of the elements over each row of the
+ *  given matrix  expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are cumulative productmed up over
+ *  each row.
+ * \return A vector containing the cumulative product of the elements over each row of
+ *  the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_columns(matrix_expression<MatrixExprT> const& me);
+
+/**
+ * \brief Replace the elements of the given vector container with their
+ *  cumulative product.
+ * \tparam VectorT The type of the vector container.
+ * \param v The vector container whose elements are cumulative productmed up.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorT>
+void cumprod_inplace(vector_container<VectorT>& v);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative product over each column.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative productmed up over
+ *  each column.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumprod_inplace(matrix_container<MatrixT>& A);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative product over each column.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative productmed up over
+ *  each column.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumprod_rows_inplace(matrix_container<MatrixT>& A);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative product over each row.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative productmed up over
+ *  each row.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumprod_columns_inplace(matrix_container<MatrixT>& A);
+
+/**
+ * \brief Compute the cumulative product of the elements of the given matrix
+ *  expression along the given dimension tag.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are cumulative productmed up along
+ *  the given dimension.
+ * \return A vector containing the cumulative product of the elements along the
+ *  given dimension of the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename TagT, typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_by_tag(matrix_expression<MatrixExprT> const& me);
+
+//@} Declarations
+
+
+namespace detail {
+
+//@{ Declarations
+
+/**
+ * \brief Auxiliary class for computing the cumulative product of the elements over the given
+ *  dimension for a container of the given category.
+ * \tparam Dim The dimension number (starting from 1).
+ * \tparam CategoryT The category type (e.g., vector_tag).
+ */
+template <std::size_t Dim, typename CategoryT>
+struct cumprod_by_dim_impl;
+
+/**
+ * \brief Auxiliary class for computing the cumulative product of the elements over the given
+ *  dimension tag for a container of the given category.
+ * \tparam TagT The dimension tag type (e.g., tag::major).
+ * \tparam CategoryT The category type (e.g., vector_tag).
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ */
+template <typename TagT, typename CategoryT, typename OrientationT>
+struct cumprod_by_tag_impl;
+
+//@} Declarations
+
+
+//@{ Definitions
+
+template <>
+struct cumprod_by_dim_impl<1, vector_tag>
+{
+    template <typename VectorExprT>
+    BOOST_UBLAS_INLINE
+    static vector<typename vector_traits<VectorExprT>::value_type> apply(vector_expression<VectorExprT> const& ve)
+    {
+        return cumprod(ve);
+    }
+};
+
+
+template <>
+struct cumprod_by_dim_impl<1, matrix_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_rows(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_dim_impl<2, matrix_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_columns(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::major, matrix_tag, row_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_rows(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::minor, matrix_tag, row_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_columns(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::leading, matrix_tag, row_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_columns(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::major, matrix_tag, column_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_columns(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::minor, matrix_tag, column_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_rows(me);
+    }
+};
+
+
+template <>
+struct cumprod_by_tag_impl<tag::leading, matrix_tag, column_major_tag>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static matrix<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        return cumprod_rows(me);
+    }
+};
+
+
+template <typename TagT>
+struct cumprod_by_tag_impl<TagT, matrix_tag, unknown_orientation_tag>: cumprod_by_tag_impl<TagT, matrix_tag, row_major_tag>
+{
+    // Empty
+};
+
+//@} Definitions
+
+} // Namespace detail
+
+
+//@{ Definitions
+
+template <typename VectorExprT>
+BOOST_UBLAS_INLINE
+vector<typename vector_traits<VectorExprT>::value_type> cumprod(vector_expression<VectorExprT> const& ve)
+{
+    return scan(ve, ::std::multiplies<typename vector_traits<VectorExprT>::value_type>());
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod(matrix_expression<MatrixExprT> const& me)
+{
+    return cumprod_rows(me);
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_rows(matrix_expression<MatrixExprT> const& me)
+{
+    return scan_rows(me, ::std::multiplies<typename matrix_traits<MatrixExprT>::value_type>());
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_columns(matrix_expression<MatrixExprT> const& me)
+{
+    return scan_columns(me, ::std::multiplies<typename matrix_traits<MatrixExprT>::value_type>());
+}
+
+
+template <typename VectorT>
+BOOST_UBLAS_INLINE
+void cumprod_inplace(vector_container<VectorT>& v)
+{
+    scan_inplace(v, ::std::multiplies<typename vector_traits<VectorT>::value_type>());
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumprod_inplace(matrix_container<MatrixT>& A)
+{
+    cumprod_rows_inplace(A);
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumprod_rows_inplace(matrix_container<MatrixT>& A)
+{
+    scan_rows_inplace(A, ::std::multiplies<typename matrix_traits<MatrixT>::value_type>());
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumprod_columns_inplace(matrix_container<MatrixT>& A)
+{
+    scan_columns_inplace(A, ::std::multiplies<typename matrix_traits<MatrixT>::value_type>());
+}
+
+
+template <size_t Dim, typename VectorExprT>
+BOOST_UBLAS_INLINE
+vector<typename vector_traits<VectorExprT>::value_type> cumprod(vector_expression<VectorExprT> const& ve)
+{
+    return detail::cumprod_by_dim_impl<Dim, vector_tag>::template apply(ve);
+}
+
+
+template <size_t Dim, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod(matrix_expression<MatrixExprT> const& me)
+{
+    return detail::cumprod_by_dim_impl<Dim, matrix_tag>::template apply(me);
+}
+
+
+template <typename TagT, typename MatrixExprT>
+//template <typename MatrixExprT, typename TagT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> cumprod_by_tag(matrix_expression<MatrixExprT> const& me)
+{
+    return detail::cumprod_by_tag_impl<TagT, matrix_tag, typename matrix_traits<MatrixExprT>::orientation_category>::template apply(me);
+}
+
+//@} Definitions
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_CUMPROD_HPP
@@ -5,6 +5,10 @@
  *
  * \brief Compute the cumulative sum of an array.
  *
+ * The cumulative sum is the scan by \c std::plus (see
+ * \c boost/numeric/ublasx/operation/scan.hpp), so that long dense containers
+ * are summed up by concurrent threads.
+ *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
  * <hr/>
@@ -26,15 +30,13 @@
 #include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/scan.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
 #include <cstddef>
-
-
-//FIXME: could not user boost::[matrix|vector]_temporary_traits since some
-//container type (e.g., zero_matrix) does not define such type.
+#include <functional>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -99,6 +101,53 @@ matrix<typename matrix_traits<MatrixExprT>::value_type> cumsum_rows(matrix_expre
 template <typename MatrixExprT>
 matrix<typename matrix_traits<MatrixExprT>::value_type> cumsum_columns(matrix_expression<MatrixExprT> const& me);
 
+/**
+ * \brief Replace the elements of the given vector container with their
+ *  cumulative sum.
+ * \tparam VectorT The type of the vector container.
+ * \param v The vector container whose elements are cumulative summed up.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorT>
+void cumsum_inplace(vector_container<VectorT>& v);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative sum over each column.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative summed up over
+ *  each column.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumsum_inplace(matrix_container<MatrixT>& A);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative sum over each column.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative summed up over
+ *  each column.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumsum_rows_inplace(matrix_container<MatrixT>& A);
+
+/**
+ * \brief Replace the elements of the given matrix container with their
+ *  cumulative sum over each row.
+ * \tparam MatrixT The type of the matrix container.
+ * \param A The matrix container whose elements are cumulative summed up over
+ *  each row.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT>
+void cumsum_columns_inplace(matrix_container<MatrixT>& A);
+
 /**
  * \brief Compute the cumulative sum of the elements of the given matrix
  *  expression along the given dimension tag.
@@ -269,18 +318,7 @@ template <typename VectorExprT>
 BOOST_UBLAS_INLINE
 vector<typename vector_traits<VectorExprT>::value_type> cumsum(vector_expression<VectorExprT> const& ve)
 {
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
-    typedef vector<typename vector_traits<VectorExprT>::value_type> result_type;
-
-    size_type n = size(ve);
-    result_type s(ve);
-
-    for (size_type i = 1; i < n; ++i)
-    {
-        s(i) += s(i-1);
-    }
-
-    return s;
+    return scan(ve, ::std::plus<typename vector_traits<VectorExprT>::value_type>());
 }
 
 
@@ -288,23 +326,7 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 matrix<typename matrix_traits<MatrixExprT>::value_type> cumsum(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef matrix<typename matrix_traits<MatrixExprT>::value_type> result_type;
-
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    result_type s(me);
-
-    for (size_type c = 0; c < nc; ++c)
-    {
-        for (size_type r = 1; r < nr; ++r)
-        {
-            s(r,c) += s(r-1,c);
-        }
-    }
-
-    return s;
+    return cumsum_rows(me);
 }
 
 
@@ -312,7 +334,7 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 matrix<typename matrix_traits<MatrixExprT>::value_type> cumsum_rows(matrix_expression<MatrixExprT> const& me)
 {
-    return cumsum(me);
+    return scan_rows(me, ::std::plus<typename matrix_traits<MatrixExprT>::value_type>());
 }
 
 
@@ -320,23 +342,39 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 matrix<typename matrix_traits<MatrixExprT>::value_type> cumsum_columns(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef matrix<typename matrix_traits<MatrixExprT>::value_type> result_type;
+    return scan_columns(me, ::std::plus<typename matrix_traits<MatrixExprT>::value_type>());
+}
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
 
-    result_type s(me);
+template <typename VectorT>
+BOOST_UBLAS_INLINE
+void cumsum_inplace(vector_container<VectorT>& v)
+{
+    scan_inplace(v, ::std::plus<typename vector_traits<VectorT>::value_type>());
+}
 
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 1; c < nc; ++c)
-        {
-            s(r,c) += s(r,c-1);
-        }
-    }
 
-    return s;
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumsum_inplace(matrix_container<MatrixT>& A)
+{
+    cumsum_rows_inplace(A);
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumsum_rows_inplace(matrix_container<MatrixT>& A)
+{
+    scan_rows_inplace(A, ::std::plus<typename matrix_traits<MatrixT>::value_type>());
+}
+
+
+template <typename MatrixT>
+BOOST_UBLAS_INLINE
+void cumsum_columns_inplace(matrix_container<MatrixT>& A)
+{
+    scan_columns_inplace(A, ::std::plus<typename matrix_traits<MatrixT>::value_type>());
 }
 
 
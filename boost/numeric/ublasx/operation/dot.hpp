@@ -23,6 +23,8 @@
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublasx/detail/summation.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
 #include <boost/numeric/ublasx/operation/sum.hpp>
 
 
@@ -71,6 +73,46 @@ struct mdot_traits_type
 };
 
 
+namespace detail {
+
+/**
+ * \brief Auxiliary class for computing the dot product of two vector
+ *  expressions.
+ * \tparam Contiguous Tells if both vector expressions are dense containers
+ *  whose elements can be accessed through their storage array.
+ */
+template <bool Contiguous>
+struct vdot_impl
+{
+    template <typename VecExpr1T, typename VecExpr2T>
+    BOOST_UBLAS_INLINE
+    static typename vdot_traits_type<VecExpr1T,VecExpr2T>::result_type apply(vector_expression<VecExpr1T> const& v1,
+                                                                             vector_expression<VecExpr2T> const& v2)
+    {
+        return inner_prod(v1, v2);
+    }
+};
+
+
+template <>
+struct vdot_impl<true>
+{
+    template <typename VecExpr1T, typename VecExpr2T>
+    BOOST_UBLAS_INLINE
+    static typename vdot_traits_type<VecExpr1T,VecExpr2T>::result_type apply(vector_expression<VecExpr1T> const& v1,
+                                                                             vector_expression<VecExpr2T> const& v2)
+    {
+        typedef typename vdot_traits_type<VecExpr1T,VecExpr2T>::result_type value_type;
+
+        BOOST_UBLAS_CHECK( v1().size() == v2().size(), external_logic() );
+
+        return pairwise_dot<value_type>(v1().data().begin(), v2().data().begin(), v1().size());
+    }
+};
+
+} // Namespace detail
+
+
 /**
  * \brief Scalar product of two vectors.
  *
@@ -90,7 +132,10 @@ BOOST_UBLAS_INLINE
 typename vdot_traits_type<VecExpr1T,VecExpr2T>::result_type dot(vector_expression<VecExpr1T> const& v1,
                                                                 vector_expression<VecExpr2T> const& v2)
 {
-    return inner_prod(v1, v2);
+    return detail::vdot_impl<
+                detail::has_contiguous_storage<VecExpr1T>::value
+                && detail::has_contiguous_storage<VecExpr2T>::value
+            >::apply(v1, v2);
 }
 
 
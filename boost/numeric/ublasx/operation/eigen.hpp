@@ -21,20 +21,30 @@
 #define BOOST_NUMERIC_UBLASX_OPERATION_EIGEN_HPP
 
 
+#include <algorithm>
 #include <boost/mpl/and.hpp>
 #include <boost/numeric/bindings/lapack/driver/geev.hpp>
 #include <boost/numeric/bindings/lapack/driver/ggev.hpp>
 #include <boost/numeric/bindings/lapack/driver/heev.hpp>
+#include <boost/numeric/bindings/lapack/driver/heevd.hpp>
+#include <boost/numeric/bindings/lapack/driver/heevr.hpp>
 #include <boost/numeric/bindings/lapack/driver/hegv.hpp>
 #include <boost/numeric/bindings/lapack/driver/syev.hpp>
+#include <boost/numeric/bindings/lapack/driver/syevd.hpp>
+#include <boost/numeric/bindings/lapack/driver/syevr.hpp>
 #include <boost/numeric/bindings/lapack/driver/sygv.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
+#include <boost/numeric/bindings/tag.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/exception.hpp>
 #include <boost/numeric/ublas/hermitian.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_proxy.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
 #include <boost/numeric/ublasx/detail/lapack.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
@@ -42,11 +52,13 @@
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_complex.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <limits>
 
 
@@ -55,6 +67,26 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief The LAPACK drivers for the eigenvalue problem of symmetric and
+ *  hermitian matrices.
+ *
+ * The QR-iteration driver is the fastest one for small matrices.
+ * The divide-and-conquer driver is much faster when eigenvectors are wanted
+ * for large matrices, at the price of a larger workspace.
+ * The MRRR (Multiple Relatively Robust Representations) driver is the only
+ * one able to compute a subset of the eigenvalues and eigenvectors, in a time
+ * proportional to the size of the subset.
+ */
+enum eigen_algorithm
+{
+    auto_eigen_algorithm, ///< Select the driver by matrix size, by the requested eigenvectors and by the requested subset of eigenvalues.
+    syev_eigen_algorithm, ///< QR-iteration driver (LAPACK \c syev and \c heev).
+    syevd_eigen_algorithm, ///< Divide-and-conquer driver (LAPACK \c syevd and \c heevd).
+    syevr_eigen_algorithm ///< MRRR driver (LAPACK \c syevr and \c heevr).
+};
+
+
 namespace detail {
 
 /// Side of eigenvectors
@@ -70,28 +102,414 @@ enum eigenvectors_side
 //@{ Eigenvalues problem
 
 
-/// Eigenvalues of a general real matrix (column-major case).
-//FIXME: It seems that LAPACK (v. 3.2.1) wants that VR and VL have right dimensions even if they should be not referenced (e.g., jobvl='N' or jobvr='N').
+/// Optimal workspace query of LAPACK \c geev for real matrices.
+template <typename ValueT, typename RWorkVectorT>
+void geev_query(char jobvl, char jobvr, ::fortran_int_t n, ::fortran_int_t ldvl, ::fortran_int_t ldvr, ValueT* opt_work, RWorkVectorT&, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::detail::geev(jobvl, jobvr, n, 0, ::std::max(n, ::fortran_int_t(1)), 0, 0, 0, ldvl, 0, ldvr, opt_work, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c geev for complex matrices.
+template <typename ValueT, typename RWorkVectorT>
+void geev_query(char jobvl, char jobvr, ::fortran_int_t n, ::fortran_int_t ldvl, ::fortran_int_t ldvr, ValueT* opt_work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::detail::geev(jobvl, jobvr, n, 0, ::std::max(n, ::fortran_int_t(1)), 0, 0, ldvl, 0, ldvr, opt_work, -1, &rwork[0]);
+}
+
+
+/// Optimal workspace query of LAPACK \c syev (real matrices).
+template <typename ValueT, typename RWorkVectorT>
+void syev_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RWorkVectorT&, ::boost::false_type)
+{
+    // The optimal workspace size does not depend on the referenced triangle
+    ::boost::numeric::bindings::lapack::detail::syev(jobz, ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c heev (complex matrices).
+template <typename ValueT, typename RWorkVectorT>
+void syev_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    // The optimal workspace size does not depend on the referenced triangle
+    ::boost::numeric::bindings::lapack::detail::heev(jobz, ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1, &rwork[0]);
+}
+
+
+/// The minimum order of the matrix for which \c auto_eigen_algorithm selects
+/// the divide-and-conquer driver.
+static const ::std::size_t eigen_syevd_min_size = 32;
+
+
+/**
+ * \brief Resolve the driver to use for the eigenvalue problem of a \a n by
+ *  \a n symmetric or hermitian matrix.
+ *
+ * Only LAPACK \c syevr/\c heevr compute a subset of the eigenvalues, so it
+ * is used for any \a range other than 'A', whatever \a alg is.
+ * \c auto_eigen_algorithm selects \c syevd/\c heevd only when eigenvectors
+ * are wanted and \a n is at least \c eigen_syevd_min_size, since for the
+ * eigenvalues alone all drivers run the same tridiagonal QR iteration.
+ */
+inline eigen_algorithm select_eigen_algorithm(eigen_algorithm alg, ::std::size_t n, bool want_V, char range)
+{
+    if (range != 'A')
+    {
+        return syevr_eigen_algorithm;
+    }
+    if (alg == auto_eigen_algorithm)
+    {
+        return (want_V && n >= eigen_syevd_min_size) ? syevd_eigen_algorithm : syev_eigen_algorithm;
+    }
+    return alg;
+}
+
+
+/// Optimal workspace query of LAPACK \c syevd (real matrices).
+template <typename ValueT, typename RealT>
+void syevd_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RealT*, ::fortran_int_t* opt_iwork, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::detail::syevd(jobz, ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1, opt_iwork, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c heevd (complex matrices).
+template <typename ValueT, typename RealT>
+void syevd_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RealT* opt_rwork, ::fortran_int_t* opt_iwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::detail::heevd(jobz, ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1, opt_rwork, -1, opt_iwork, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c syevr (real matrices).
+template <typename ValueT, typename RealT>
+void syevr_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RealT*, ::fortran_int_t* opt_iwork, ::boost::false_type)
+{
+    // The optimal workspace size does not depend on the requested subset
+    ::fortran_int_t m = 0;
+    ::boost::numeric::bindings::lapack::detail::syevr(jobz, 'A', ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), ValueT(0), ValueT(0), 1, n, ValueT(0), m, 0, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1, opt_iwork, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c heevr (complex matrices).
+template <typename ValueT, typename RealT>
+void syevr_query(char jobz, ::fortran_int_t n, ValueT* opt_work, RealT* opt_rwork, ::fortran_int_t* opt_iwork, ::boost::true_type)
+{
+    // The optimal workspace size does not depend on the requested subset
+    ::fortran_int_t m = 0;
+    ::boost::numeric::bindings::lapack::detail::heevr(jobz, 'A', ::boost::numeric::bindings::tag::lower(), n, 0, ::std::max(n, ::fortran_int_t(1)), RealT(0), RealT(0), 1, n, RealT(0), m, 0, 0, ::std::max(n, ::fortran_int_t(1)), 0, opt_work, -1, opt_rwork, -1, opt_iwork, -1);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the eigenvalue drivers of a single matrix.
+ *
+ * Owns the work arrays needed by LAPACK \c geev (general matrices) and
+ * \c syev/\c heev, \c syevd/\c heevd and \c syevr/\c heevr (symmetric and
+ * hermitian matrices) together with the scratch matrices used to hold a copy
+ * of the input matrix (which is overwritten by LAPACK) and the eigenvectors
+ * computed by LAPACK.
+ * The optimal size of the work arrays is queried (\c lwork=-1) only when the
+ * driver, the problem size or the kind of requested eigenvectors change, so
+ * that repeated decompositions of same-sized matrices do not allocate memory.
+ *
+ * \tparam ValueT The type of the elements of the matrices to decompose.
+ */
+template <typename ValueT>
+class eigen_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+    public: typedef vector<real_type> real_work_vector_type;
+    public: typedef vector< ::fortran_int_t > integer_work_vector_type;
+
+
+    /// Default constructor.
+    public: eigen_workspace()
+        : n_(0),
+          job1_('N'),
+          job2_('N'),
+          driver_(no_driver),
+          alg_(syev_eigen_algorithm)
+    {
+    }
+
+
+    /// Create a workspace for the eigenvalues and eigenvectors of general
+    /// \a n by \a n matrices.
+    public: explicit eigen_workspace(size_type n)
+        : n_(0),
+          job1_('N'),
+          job2_('N'),
+          driver_(no_driver),
+          alg_(syev_eigen_algorithm)
+    {
+        resize_general(n, 'V', 'V');
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the eigenvalue problem of general
+     *  \a n by \a n matrices (LAPACK \c geev).
+     *
+     * \param n The order of the matrix.
+     * \param jobvl The LAPACK \c geev option for left eigenvectors ('V' or 'N').
+     * \param jobvr The LAPACK \c geev option for right eigenvectors ('V' or 'N').
+     */
+    public: void resize_general(size_type n, char jobvl, char jobvr)
+    {
+        if (driver_ == general_driver && n == n_ && jobvl == job1_ && jobvr == job2_)
+        {
+            return;
+        }
+
+        const size_type n_LV = (jobvl == 'V') ? n : size_type(detail::lapack::min_array_size);
+        const size_type n_RV = (jobvr == 'V') ? n : size_type(detail::lapack::min_array_size);
+
+        if (num_rows(LV_) != n_LV || num_columns(LV_) != n_LV)
+        {
+            LV_.resize(n_LV, n_LV, false);
+        }
+        if (num_rows(RV_) != n_RV || num_columns(RV_) != n_RV)
+        {
+            RV_.resize(n_RV, n_RV, false);
+        }
+        if (::boost::is_complex<value_type>::value)
+        {
+            rwork_.resize(::std::max(2*n, size_type(1)), false);
+        }
+        else
+        {
+            wr_.resize(n, false);
+            wi_.resize(n, false);
+        }
+
+        value_type opt_work = 0;
+        detail::geev_query(jobvl,
+                           jobvr,
+                           static_cast< ::fortran_int_t >(n),
+                           static_cast< ::fortran_int_t >(::std::max(n_LV, size_type(1))),
+                           static_cast< ::fortran_int_t >(::std::max(n_RV, size_type(1))),
+                           &opt_work,
+                           rwork_,
+                           ::boost::is_complex<value_type>());
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        n_ = n;
+        job1_ = jobvl;
+        job2_ = jobvr;
+        driver_ = general_driver;
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the eigenvalue problem of symmetric
+     *  (real case) or hermitian (complex case) \a n by \a n matrices.
+     *
+     * \param n The order of the matrix.
+     * \param jobz The LAPACK option for eigenvectors ('V' or 'N').
+     * \param alg The driver, either \c syev_eigen_algorithm (LAPACK \c syev
+     *  and \c heev), \c syevd_eigen_algorithm (LAPACK \c syevd and
+     *  \c heevd) or \c syevr_eigen_algorithm (LAPACK \c syevr and
+     *  \c heevr).
+     */
+    public: void resize_hermitian(size_type n, char jobz, eigen_algorithm alg = syev_eigen_algorithm)
+    {
+        BOOST_UBLAS_CHECK( alg != auto_eigen_algorithm, bad_argument() );
+
+        if (driver_ == hermitian_driver && n == n_ && jobz == job1_ && alg == alg_)
+        {
+            return;
+        }
+
+        value_type opt_work = 0;
+        if (alg == syev_eigen_algorithm)
+        {
+            if (::boost::is_complex<value_type>::value)
+            {
+                rwork_.resize(::std::max(3*n, size_type(3))-2, false);
+            }
+
+            detail::syev_query(jobz,
+                               static_cast< ::fortran_int_t >(n),
+                               &opt_work,
+                               rwork_,
+                               ::boost::is_complex<value_type>());
+        }
+        else
+        {
+            real_type opt_rwork = 0;
+            ::fortran_int_t opt_iwork = 0;
+
+            if (alg == syevd_eigen_algorithm)
+            {
+                detail::syevd_query(jobz,
+                                    static_cast< ::fortran_int_t >(n),
+                                    &opt_work,
+                                    &opt_rwork,
+                                    &opt_iwork,
+                                    ::boost::is_complex<value_type>());
+            }
+            else
+            {
+                detail::syevr_query(jobz,
+                                    static_cast< ::fortran_int_t >(n),
+                                    &opt_work,
+                                    &opt_rwork,
+                                    &opt_iwork,
+                                    ::boost::is_complex<value_type>());
+                isuppz_.resize(::std::max(2*n, size_type(2)), false);
+            }
+            if (::boost::is_complex<value_type>::value)
+            {
+                rwork_.resize(::std::max(static_cast<size_type>(opt_rwork), size_type(1)), false);
+            }
+            iwork_.resize(::std::max(static_cast<size_type>(opt_iwork), size_type(1)), false);
+        }
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        n_ = n;
+        job1_ = jobz;
+        job2_ = 'N';
+        driver_ = hermitian_driver;
+        alg_ = alg;
+    }
+
+
+    /// Return the scratch matrix for the copy of the matrix to decompose.
+    public: work_matrix_type& work_matrix()
+    {
+        return A_;
+    }
+
+
+    /// Return the scratch matrix for the left eigenvectors (LAPACK \c geev).
+    public: work_matrix_type& left_work_matrix()
+    {
+        return LV_;
+    }
+
+
+    /// Return the scratch matrix for the right eigenvectors (LAPACK \c geev).
+    public: work_matrix_type& right_work_matrix()
+    {
+        return RV_;
+    }
+
+
+    /// Return the scratch vector for the real parts of the eigenvalues (LAPACK
+    /// \c geev for real matrices).
+    public: real_work_vector_type& real_values()
+    {
+        return wr_;
+    }
+
+
+    /// Return the scratch vector for the imaginary parts of the eigenvalues
+    /// (LAPACK \c geev for real matrices).
+    public: real_work_vector_type& imag_values()
+    {
+        return wi_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// Return the real work array (used for complex matrices only).
+    public: real_work_vector_type& rwork()
+    {
+        return rwork_;
+    }
+
+
+    /// Return the integer work array (LAPACK \c syevd/\c heevd and
+    /// \c syevr/\c heevr).
+    public: integer_work_vector_type& iwork()
+    {
+        return iwork_;
+    }
+
+
+    /// Return the array for the support of the eigenvectors (LAPACK
+    /// \c syevr/\c heevr).
+    public: integer_work_vector_type& isuppz()
+    {
+        return isuppz_;
+    }
+
+
+    /// The LAPACK drivers this workspace can be prepared for.
+    private: enum driver_category
+    {
+        no_driver,
+        general_driver,
+        hermitian_driver
+    };
+
+
+    /// The order of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// The first eigenvectors option this workspace is prepared for.
+    private: char job1_;
+    /// The second eigenvectors option this workspace is prepared for.
+    private: char job2_;
+    /// The LAPACK driver this workspace is prepared for.
+    private: driver_category driver_;
+    /// The algorithm of the symmetric/hermitian driver this workspace is
+    /// prepared for.
+    private: eigen_algorithm alg_;
+    /// The scratch matrix for the copy of the matrix to decompose.
+    private: work_matrix_type A_;
+    /// The scratch matrix for the left eigenvectors.
+    private: work_matrix_type LV_;
+    /// The scratch matrix for the right eigenvectors.
+    private: work_matrix_type RV_;
+    /// The scratch vector for the real parts of the eigenvalues.
+    private: real_work_vector_type wr_;
+    /// The scratch vector for the imaginary parts of the eigenvalues.
+    private: real_work_vector_type wi_;
+    /// The work array.
+    private: work_vector_type work_;
+    /// The real work array.
+    private: real_work_vector_type rwork_;
+    /// The integer work array.
+    private: integer_work_vector_type iwork_;
+    /// The support of the eigenvectors.
+    private: integer_work_vector_type isuppz_;
+};
+
+
+namespace detail {
+
+/// Eigenvalues of a general real matrix.
 template <
     typename MatrixExprT,    // must be of real type
-    typename OutRealVectorT, // must be of real type
-    typename OutImagVectorT, // must be of real type
+    typename OutVectorT,     // must be of complex type
     typename OutLeftMatrixT, // must be of complex type
     typename OutRightMatrixT // must be of complex type
 >
-void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutRealVectorT& rw, OutImagVectorT& iw, OutLeftMatrixT& LV, OutRightMatrixT& RV, column_major_tag)
+typename ::boost::disable_if<
+    ::boost::is_complex<typename matrix_traits<MatrixExprT>::value_type>,
+    void
+>::type eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, eigen_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
 {
     // precondition: A must be a real matrix
     BOOST_STATIC_ASSERT((
         !::boost::is_complex<typename matrix_traits<MatrixExprT>::value_type>::value
     ));
-    // precondition: rw must be a real vector
-    BOOST_STATIC_ASSERT((
-        !::boost::is_complex<typename vector_traits<OutRealVectorT>::value_type>::value
-    ));
-    // precondition: iw must be a real vector
+    // precondition: w must be a complex vector
     BOOST_STATIC_ASSERT((
-        !::boost::is_complex<typename vector_traits<OutImagVectorT>::value_type>::value
+        ::boost::is_complex<typename vector_traits<OutVectorT>::value_type>::value
     ));
     // precondition: LV must be a complex matrix
     BOOST_STATIC_ASSERT((
@@ -105,61 +523,58 @@ void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side,
 
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef matrix<value_type, column_major> work_matrix_type;
+    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
+    typedef typename eigen_workspace<value_type>::work_matrix_type work_matrix_type;
+    typedef typename eigen_workspace<value_type>::real_work_vector_type work_vector_type;
 
     size_type n = num_rows(A);
 
     char jobvl;
     char jobvr;
-    size_type work_n_LV;
     size_type out_n_LV;
-    size_type work_n_RV;
     size_type out_n_RV;
 
-    // Copy the original A matrix since LAPACK GEEV overwrites it.
-    work_matrix_type tmp_A(A);
-
     switch (side)
     {
         case both_eigenvectors:
             jobvl = jobvr = 'V';
-            work_n_LV = out_n_LV = work_n_RV = out_n_RV = n;
+            out_n_LV = out_n_RV = n;
             break;
         case left_eigenvectors:
             jobvl = 'V';
             jobvr = 'N';
-            work_n_LV = out_n_LV = n;
-            work_n_RV = detail::lapack::min_array_size;
+            out_n_LV = n;
             out_n_RV = 0;
             break;
         case right_eigenvectors:
             jobvl = 'N';
             jobvr = 'V';
-            work_n_LV = detail::lapack::min_array_size;
             out_n_LV = 0;
-            work_n_RV = out_n_RV = n;
+            out_n_RV = n;
             break;
         case none_eigenvectors:
         default:
             jobvl = jobvr = 'N';
-            work_n_LV = work_n_RV = detail::lapack::min_array_size;
             out_n_LV = out_n_RV = 0;
     }
 
-    // Create temporary real matrices for eigenvectors
-    // NOTE: LAPACK wants the arrays be correctly sized even if they are not
-    // requested as output (i.e., jobvl == 'N' and/or jobvr == 'N').
-    work_matrix_type tmp_LV(work_n_LV, work_n_LV);
-    work_matrix_type tmp_RV(work_n_RV, work_n_RV);
+    // NOTE: LAPACK wants the eigenvectors arrays be correctly sized even if
+    // they are not requested as output (i.e., jobvl == 'N' and/or
+    // jobvr == 'N'); the workspace takes care of it.
+    ws.resize_general(n, jobvl, jobvr);
 
-    if (size(rw) != n)
-    {
-        rw.resize(n, false);
-    }
-    if (size(iw) != n)
+    // Copy the original A matrix since LAPACK GEEV overwrites it.
+    work_matrix_type& tmp_A = ws.work_matrix();
+    if (num_rows(tmp_A) != n || num_columns(tmp_A) != n)
     {
-        iw.resize(n, false);
+        tmp_A.resize(n, n, false);
     }
+    noalias(tmp_A) = A;
+
+    work_matrix_type& tmp_LV = ws.left_work_matrix();
+    work_matrix_type& tmp_RV = ws.right_work_matrix();
+    work_vector_type& rw = ws.real_values();
+    work_vector_type& iw = ws.imag_values();
 
     ::boost::numeric::bindings::lapack::geev(
         jobvl,
@@ -168,9 +583,20 @@ void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side,
         rw,
         iw,
         tmp_LV,
-        tmp_RV
+        tmp_RV,
+        ::boost::numeric::bindings::lapack::workspace(ws.work())
     );
 
+    if (size(w) != n)
+    {
+        w.resize(n, false);
+    }
+    for (size_type i = 0; i < n; ++i)
+    {
+        // Assume that out_value_type is a complex-like type
+        w(i) = out_value_type(rw(i), iw(i));
+    }
+
     // Resize output complex eigenvectors matrices ...
 
     if (num_rows(LV) != out_n_LV || num_columns(LV) != out_n_LV)
@@ -248,35 +674,7 @@ void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side,
 }
 
 
-/// Eigenvalues of a general real matrix (row-major case).
-template <
-    typename MatrixExprT,
-    typename OutRealVectorT,
-    typename OutImagVectorT,
-    typename OutLeftMatrixT,
-    typename OutRightMatrixT
->
-void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutRealVectorT& rw, OutImagVectorT& iw, OutLeftMatrixT& LV, OutRightMatrixT& RV, row_major_tag)
-{
-    // Note: LAPACK works with column-major matrices
-
-    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
-
-    typedef matrix<value_type, column_major> colmaj_matrix_type;
-
-    colmaj_matrix_type tmp_A(A);
-    colmaj_matrix_type tmp_LV;
-    colmaj_matrix_type tmp_RV;
-
-    eigen_impl(tmp_A, side, rw, iw, tmp_LV, tmp_RV, column_major_tag());
-
-    LV = tmp_LV;
-    RV = tmp_RV;
-}
-
-
-/// Eigenvalues of a general complex matrix (column-major case).
-//FIXME: It seems that LAPACK (v. 3.2.1) wants that VR and VL have right dimensions even if they should be not referenced (e.g., jobvl='N' or jobvr='N').
+/// Eigenvalues of a general complex matrix.
 template <
     typename MatrixExprT,    // must be of complex type
     typename OutVectorT,     // must be of complex type
@@ -286,7 +684,7 @@ template <
 typename ::boost::enable_if<
     ::boost::is_complex<typename matrix_traits<MatrixExprT>::value_type>,
     void
->::type eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, column_major_tag)
+>::type eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, eigen_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
 {
     // precondition: A must be a complex matrix
     BOOST_STATIC_ASSERT((
@@ -308,13 +706,12 @@ typename ::boost::enable_if<
 
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename eigen_workspace<value_type>::work_matrix_type work_matrix_type;
 
     size_type n = num_rows(A);
     size_type n_lv;
     size_type n_rv;
 
-    matrix<value_type, column_major> tmp_A(A); // LAPACK GEEV overwrites the original input matrix A
-
     char jobvl;
     char jobvr;
 
@@ -342,86 +739,62 @@ typename ::boost::enable_if<
             n_lv = n_rv = 0;
     }
 
+    ws.resize_general(n, jobvl, jobvr);
+
+    // LAPACK GEEV overwrites the original input matrix A
+    work_matrix_type& tmp_A = ws.work_matrix();
+    if (num_rows(tmp_A) != n || num_columns(tmp_A) != n)
+    {
+        tmp_A.resize(n, n, false);
+    }
+    noalias(tmp_A) = A;
+
     if (size(w) != n)
     {
         w.resize(n, false);
     }
-    if (num_rows(LV) != n || num_columns(LV) != n)
+
+    ::boost::numeric::bindings::lapack::geev(
+        jobvl,
+        jobvr,
+        tmp_A,
+        w,
+        ws.left_work_matrix(),
+        ws.right_work_matrix(),
+        ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork())
+    );
+
+    if (num_rows(LV) != n_lv || num_columns(LV) != n_lv)
     {
-        LV.resize(n, n, false);
+        LV.resize(n_lv, n_lv, false);
     }
-    if (num_rows(RV) != n || num_columns(RV) != n)
+    if (n_lv > 0)
     {
-        RV.resize(n, n, false);
+        noalias(LV) = ws.left_work_matrix();
     }
-
-    ::boost::numeric::bindings::lapack::geev(jobvl, jobvr, tmp_A, w, LV, RV);
-
-    if (num_rows(LV) != n_lv)
+    if (num_rows(RV) != n_rv || num_columns(RV) != n_rv)
     {
-        LV.resize(n_lv, n_lv, true);
+        RV.resize(n_rv, n_rv, false);
     }
-    if (num_rows(RV) != n_rv)
+    if (n_rv > 0)
     {
-        RV.resize(n_rv, n_rv, true);
+        noalias(RV) = ws.right_work_matrix();
     }
 }
 
 
-/// Eigenvalues of a general real matrix (column-major case).
+/// Eigenvalues of a general real/complex matrix (column-major case).
 template <
     typename MatrixExprT,
     typename OutVectorT,
     typename OutLeftMatrixT,
     typename OutRightMatrixT
 >
-typename ::boost::disable_if<
-    ::boost::is_complex<typename matrix_traits<MatrixExprT>::value_type>,
-    void
->::type eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, column_major_tag)
+void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, column_major_tag)
 {
-    // precondition: A must be a real matrix
-    BOOST_STATIC_ASSERT((
-        !::boost::is_complex<typename matrix_traits<MatrixExprT>::value_type>::value
-    ));
-    // precondition: w must be a complex vector
-    BOOST_STATIC_ASSERT((
-        ::boost::is_complex<typename vector_traits<OutVectorT>::value_type>::value
-    ));
-    // precondition: LV must be a complex matrix
-    BOOST_STATIC_ASSERT((
-        ::boost::is_complex<typename matrix_traits<OutLeftMatrixT>::value_type>::value
-    ));
-    // precondition: LV must be a complex matrix
-    BOOST_STATIC_ASSERT((
-        ::boost::is_complex<typename matrix_traits<OutRightMatrixT>::value_type>::value
-    ));
+    eigen_workspace<typename matrix_traits<MatrixExprT>::value_type> ws;
 
-
-    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
-    typedef typename vector_traits<OutVectorT>::size_type size_type;
-    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
-
-    size_type n_w = size(w);
-    size_type n = num_rows(A);
-
-    if (n_w != n)
-    {
-        w.resize(n, false);
-        n_w = n;
-    }
-
-    vector<value_type> rw(n_w);
-    vector<value_type> iw(n_w);
-
-    eigen_impl(A, side, rw, iw, LV, RV, column_major_tag());
-
-    for (size_type i = 0; i < n_w; ++i)
-    {
-        // Assume that out_value_type is a complex-like type
-        //w(i) = ::std::complex<value_type>(rw(i), iw(i));
-        w(i) = out_value_type(rw(i), iw(i));
-    }
+    eigen_impl(A, side, w, LV, RV, ws);
 }
 
 
@@ -434,54 +807,143 @@ template <
 >
 void eigen_impl(matrix_expression<MatrixExprT> const& A, eigenvectors_side side, OutVectorT& w, OutLeftMatrixT& LV, OutRightMatrixT& RV, row_major_tag)
 {
-    typedef typename promote_traits<
-                        typename matrix_traits<MatrixExprT>::value_type,
-                        typename promote_traits<
-                            typename matrix_traits<OutRightMatrixT>::value_type,
-                            typename matrix_traits<OutLeftMatrixT>::value_type
-                        >::promote_type
-            >::promote_type value_type;
+    // Note: LAPACK works with column-major matrices; the workspace holds
+    // column-major copies of the input and of the eigenvectors.
 
-    typedef matrix<value_type, column_major> colmaj_matrix_type;
+    eigen_workspace<typename matrix_traits<MatrixExprT>::value_type> ws;
 
-    colmaj_matrix_type tmp_A(A);
-    colmaj_matrix_type tmp_LV;
-    colmaj_matrix_type tmp_RV;
+    eigen_impl(A, side, w, LV, RV, ws);
+}
 
-    eigen_impl(tmp_A, side, w, tmp_LV, tmp_RV, column_major_tag());
 
-    LV = tmp_LV;
-    RV = tmp_RV;
+/// Call LAPACK \c syev or \c syevd (real symmetric matrices).
+template <typename WorkMatrixT, typename OutVectorT, typename ValueT>
+void hermitian_eigen_driver(char jobz, eigen_algorithm alg, WorkMatrixT& A, OutVectorT& w, eigen_workspace<ValueT>& ws, ::boost::false_type)
+{
+    if (alg == syevd_eigen_algorithm)
+    {
+        ::boost::numeric::bindings::lapack::syevd(
+            jobz,
+            A,
+            w,
+            ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.iwork())
+        );
+    }
+    else
+    {
+        ::boost::numeric::bindings::lapack::syev(
+            jobz,
+            A,
+            w,
+            ::boost::numeric::bindings::lapack::workspace(ws.work())
+        );
+    }
+}
+
+
+/// Call LAPACK \c heev or \c heevd (complex hermitian matrices).
+template <typename WorkMatrixT, typename OutVectorT, typename ValueT>
+void hermitian_eigen_driver(char jobz, eigen_algorithm alg, WorkMatrixT& A, OutVectorT& w, eigen_workspace<ValueT>& ws, ::boost::true_type)
+{
+    if (alg == syevd_eigen_algorithm)
+    {
+        ::boost::numeric::bindings::lapack::heevd(
+            jobz,
+            A,
+            w,
+            ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork(), ws.iwork())
+        );
+    }
+    else
+    {
+        ::boost::numeric::bindings::lapack::heev(
+            jobz,
+            A,
+            w,
+            ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork())
+        );
+    }
+}
+
+
+/// Call LAPACK \c syevr (real symmetric matrices) and return the number of
+/// eigenvalues found.
+template <typename WorkMatrixT, typename RealT, typename OutVectorT, typename OutMatrixT, typename ValueT>
+::fortran_int_t hermitian_eigen_subset_driver(char jobz, char range, WorkMatrixT& A, RealT vl, RealT vu, ::fortran_int_t il, ::fortran_int_t iu, OutVectorT& w, OutMatrixT& Z, eigen_workspace<ValueT>& ws, ::boost::false_type)
+{
+    ::fortran_int_t m = 0;
+
+    ::boost::numeric::bindings::lapack::syevr(
+        jobz,
+        range,
+        A,
+        vl,
+        vu,
+        il,
+        iu,
+        RealT(0),
+        m,
+        w,
+        Z,
+        ws.isuppz(),
+        ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.iwork())
+    );
+
+    return m;
+}
+
+
+/// Call LAPACK \c heevr (complex hermitian matrices) and return the number of
+/// eigenvalues found.
+template <typename WorkMatrixT, typename RealT, typename OutVectorT, typename OutMatrixT, typename ValueT>
+::fortran_int_t hermitian_eigen_subset_driver(char jobz, char range, WorkMatrixT& A, RealT vl, RealT vu, ::fortran_int_t il, ::fortran_int_t iu, OutVectorT& w, OutMatrixT& Z, eigen_workspace<ValueT>& ws, ::boost::true_type)
+{
+    ::fortran_int_t m = 0;
+
+    ::boost::numeric::bindings::lapack::heevr(
+        jobz,
+        range,
+        A,
+        vl,
+        vu,
+        il,
+        iu,
+        RealT(0),
+        m,
+        w,
+        Z,
+        ws.isuppz(),
+        ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork(), ws.iwork())
+    );
+
+    return m;
 }
 
 
-/// Eigenvalues of a hermitian matrix (column-major case).
+/**
+ * \brief Eigenvalues of a symmetric or hermitian matrix.
+ *
+ * \tparam WorkMatrixT The symmetric or hermitian adaptor passed to LAPACK.
+ *
+ * \param range 'A' for all the eigenvalues, 'I' for the ones with
+ *  (zero-based) index in [\a il, \a iu], 'V' for the ones in the half-open
+ *  interval (\a vl, \a vu].
+ *
+ * When a subset is requested, \a w and \a V are resized to the number of
+ * eigenvalues actually found, and \a V is a \c n by \c m matrix.
+ */
 template <
-    typename ValueT,
-    typename TriangularT,
+    typename WorkMatrixT,
+    typename MatrixT,
     typename OutVectorT,
-    typename OutMatrixT
+    typename OutMatrixT,
+    typename ValueT
 >
-void eigen_impl(hermitian_matrix<ValueT,TriangularT,column_major> const& A, eigenvectors_side side, OutVectorT& w, OutMatrixT& V)
+void hermitian_eigen_impl(MatrixT const& A, eigenvectors_side side, char range, typename eigen_workspace<ValueT>::real_type vl, typename eigen_workspace<ValueT>::real_type vu, ::std::size_t il, ::std::size_t iu, OutVectorT& w, OutMatrixT& V, eigen_workspace<ValueT>& ws, eigen_algorithm alg)
 {
-    // precondition: A must be a complex matrix
-    BOOST_STATIC_ASSERT((
-        ::boost::is_complex<ValueT>::value
-    ));
-    // precondition: w must be a real vector
-    BOOST_STATIC_ASSERT((
-        !::boost::is_complex<typename vector_traits<OutVectorT>::value_type>::value
-    ));
-    // precondition: V must be a complex matrix
-    BOOST_STATIC_ASSERT((
-        ::boost::is_complex<typename matrix_traits<OutMatrixT>::value_type>::value
-    ));
-
-
-    typedef hermitian_matrix<ValueT, TriangularT, column_major> matrix_type;
-    typedef typename matrix_traits<matrix_type>::size_type size_type;
-    typedef OutMatrixT out_matrix_type;
-    typedef hermitian_adaptor<out_matrix_type, TriangularT> work_matrix_type;
+    typedef typename eigen_workspace<ValueT>::size_type size_type;
+    typedef typename eigen_workspace<ValueT>::work_matrix_type aux_matrix_type;
+    typedef typename eigen_workspace<ValueT>::real_work_vector_type aux_vector_type;
 
     size_type n = num_rows(A);
     size_type n_v;
@@ -500,56 +962,153 @@ void eigen_impl(hermitian_matrix<ValueT,TriangularT,column_major> const& A, eige
             n_v = 0;
     }
 
-    if (size(w) != n)
+    alg = select_eigen_algorithm(alg, n, n_v > 0, range);
+
+    ws.resize_hermitian(n, jobvz, alg);
+
+    aux_matrix_type& aux_A = ws.work_matrix();
+    if (num_rows(aux_A) != n || num_columns(aux_A) != n)
     {
-        w.resize(n, false);
+        aux_A.resize(n, n, false);
+    }
+    noalias(aux_A) = A;
+    WorkMatrixT tmp_A(aux_A);
+
+    if (alg != syevr_eigen_algorithm)
+    {
+        if (size(w) != n)
+        {
+            w.resize(n, false);
+        }
+        if (num_rows(V) != n_v || num_columns(V) != n_v)
+        {
+            V.resize(n_v, n_v, false);
+        }
+
+        hermitian_eigen_driver(jobvz, alg, tmp_A, w, ws, ::boost::is_complex<ValueT>());
+
+        if (n_v > 0)
+        {
+            noalias(V) = aux_A;
+        }
+
+        return;
+    }
+
+    // LAPACK syevr/heevr writes the eigenvalues and eigenvectors found into
+    // the workspace, which is then copied into the (possibly smaller) outputs.
+
+    // Upper bound on the number of eigenvalues found
+    size_type n_max = (range == 'I') ? (iu-il+1) : n;
+
+    aux_vector_type& aux_w = ws.real_values();
+    if (size(aux_w) != n)
+    {
+        aux_w.resize(n, false);
     }
-    if (num_rows(V) != n_v)
+    aux_matrix_type& aux_Z = ws.right_work_matrix();
+    // Z is not referenced when eigenvectors are not wanted, but LAPACK still
+    // requires ldz >= 1
+    size_type nr_z = (n_v > 0) ? n : 1;
+    size_type nc_z = (n_v > 0) ? n_max : 1;
+    if (num_rows(aux_Z) != nr_z || num_columns(aux_Z) != nc_z)
     {
-        V.resize(n_v, n_v, false);
+        aux_Z.resize(nr_z, nc_z, false);
     }
 
-    out_matrix_type aux_A(A);
-    work_matrix_type tmp_A(aux_A);
+    size_type m = static_cast<size_type>(
+        hermitian_eigen_subset_driver(
+            jobvz,
+            range,
+            tmp_A,
+            vl,
+            vu,
+            static_cast< ::fortran_int_t >(il+1),
+            static_cast< ::fortran_int_t >(iu+1),
+            aux_w,
+            aux_Z,
+            ws,
+            ::boost::is_complex<ValueT>()
+        )
+    );
 
-    ::boost::numeric::bindings::lapack::heev(jobvz, tmp_A, w);
+    if (size(w) != m)
+    {
+        w.resize(m, false);
+    }
+    noalias(w) = subrange(aux_w, 0, m);
 
     if (n_v > 0)
     {
-        V = aux_A;
+        if (num_rows(V) != n || num_columns(V) != m)
+        {
+            V.resize(n, m, false);
+        }
+        noalias(V) = subrange(aux_Z, 0, n, 0, m);
+    }
+    else if (num_rows(V) != 0)
+    {
+        V.resize(0, 0, false);
     }
 }
 
 
-/// Eigenvalues of a hermitian matrix (row-major case).
+/// Eigenvalues of a hermitian matrix.
 template <
     typename ValueT,
     typename TriangularT,
+    typename LayoutT,
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen_impl(hermitian_matrix<ValueT,TriangularT,row_major> const& A, eigenvectors_side side, OutVectorT& w, OutMatrixT& V)
+void eigen_impl(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, eigenvectors_side side, char range, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, ::std::size_t il, ::std::size_t iu, OutVectorT& w, OutMatrixT& V, eigen_workspace<ValueT>& ws, eigen_algorithm alg)
 {
-    typedef hermitian_matrix<ValueT, TriangularT, column_major> colmaj_in_matrix_type;
-    typedef matrix<typename matrix_traits<OutMatrixT>::value_type, column_major> colmaj_out_matrix_type;
+    // precondition: A must be a complex matrix
+    BOOST_STATIC_ASSERT((
+        ::boost::is_complex<ValueT>::value
+    ));
+    // precondition: w must be a real vector
+    BOOST_STATIC_ASSERT((
+        !::boost::is_complex<typename vector_traits<OutVectorT>::value_type>::value
+    ));
+    // precondition: V must be a complex matrix
+    BOOST_STATIC_ASSERT((
+        ::boost::is_complex<typename matrix_traits<OutMatrixT>::value_type>::value
+    ));
 
-    colmaj_in_matrix_type tmp_A(A);
-    colmaj_out_matrix_type tmp_V;
 
-    eigen_impl(tmp_A, side, w, tmp_V);
+    typedef typename eigen_workspace<ValueT>::work_matrix_type aux_matrix_type;
+    typedef hermitian_adaptor<aux_matrix_type, TriangularT> work_matrix_type;
 
-    V = tmp_V;
+    hermitian_eigen_impl<work_matrix_type>(A, side, range, vl, vu, il, iu, w, V, ws, alg);
+}
+
+
+/// Eigenvalues of a hermitian matrix.
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_impl(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, eigenvectors_side side, char range, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, ::std::size_t il, ::std::size_t iu, OutVectorT& w, OutMatrixT& V, eigen_algorithm alg)
+{
+    eigen_workspace<ValueT> ws;
+
+    eigen_impl(A, side, range, vl, vu, il, iu, w, V, ws, alg);
 }
 
 
-/// Eigenvalues of a symmetric matrix (column-major case).
+/// Eigenvalues of a symmetric matrix.
 template <
     typename ValueT,
     typename TriangularT,
+    typename LayoutT,
     typename OutVectorT,
     typename OutMatrixT
 >
-void  eigen_impl(symmetric_matrix<ValueT,TriangularT,column_major> const& A, eigenvectors_side side, OutVectorT& w, OutMatrixT& V)
+void eigen_impl(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, eigenvectors_side side, char range, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, ::std::size_t il, ::std::size_t iu, OutVectorT& w, OutMatrixT& V, eigen_workspace<ValueT>& ws, eigen_algorithm alg)
 {
     // NOTE: a symmetric matrix is a real hermitian matrix
 
@@ -567,69 +1126,26 @@ void  eigen_impl(symmetric_matrix<ValueT,TriangularT,column_major> const& A, eig
     ));
 
 
-    typedef symmetric_matrix<ValueT, TriangularT, column_major> matrix_type;
-    //typedef symmetric_matrix<double, lower, column_major> matrix_type;
-    typedef typename matrix_traits<matrix_type>::size_type size_type;
-    //typedef matrix<ValueT, column_major> aux_matrix_type;
-    typedef OutMatrixT out_matrix_type;
-    typedef symmetric_adaptor<out_matrix_type, TriangularT> work_matrix_type;
-
-    size_type n = num_rows(A);
-    size_type n_v;
-
-    char jobvz;
-
-    switch (side)
-    {
-        case both_eigenvectors:
-            jobvz = 'V';
-            n_v = n;
-            break;
-        case none_eigenvectors:
-        default:
-            jobvz = 'N';
-            n_v = 0;
-    }
-
-    if (size(w) != n)
-    {
-        w.resize(n, false);
-    }
-    if (num_rows(V) != n_v)
-    {
-        V.resize(n_v, n_v, false);
-    }
-
-    out_matrix_type aux_A(A);
-    work_matrix_type tmp_A(aux_A);
-
-    ::boost::numeric::bindings::lapack::syev(jobvz, tmp_A, w);
+    typedef typename eigen_workspace<ValueT>::work_matrix_type aux_matrix_type;
+    typedef symmetric_adaptor<aux_matrix_type, TriangularT> work_matrix_type;
 
-    if (n_v > 0)
-    {
-        V = aux_A;
-    }
+    hermitian_eigen_impl<work_matrix_type>(A, side, range, vl, vu, il, iu, w, V, ws, alg);
 }
 
 
-/// Eigenvalues of a symmetric matrix (row-major case).
+/// Eigenvalues of a symmetric matrix.
 template <
     typename ValueT,
     typename TriangularT,
+    typename LayoutT,
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen_impl(symmetric_matrix<ValueT,TriangularT,row_major> const& A, eigenvectors_side side, OutVectorT& w, OutMatrixT& V)
+void eigen_impl(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, eigenvectors_side side, char range, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, ::std::size_t il, ::std::size_t iu, OutVectorT& w, OutMatrixT& V, eigen_algorithm alg)
 {
-    typedef symmetric_matrix<ValueT, TriangularT, column_major> colmaj_in_matrix_type;
-    typedef matrix<typename matrix_traits<OutMatrixT>::value_type, column_major> colmaj_out_matrix_type;
+    eigen_workspace<ValueT> ws;
 
-    colmaj_in_matrix_type tmp_A(A);
-    colmaj_out_matrix_type tmp_V;
-
-    eigen_impl(tmp_A, side, w, tmp_V);
-
-    V = tmp_V;
+    eigen_impl(A, side, range, vl, vu, il, iu, w, V, ws, alg);
 }
 
 
@@ -1573,6 +2089,33 @@ void eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>
 }
 
 
+/**
+ * \brief Compute the eigenvalues and the left and right eigenvectors
+ *  of the given matrix expression by means of the given workspace.
+ *
+ * No memory is allocated when the workspace and the outputs are already sized
+ * for a matrix with the same size of \a A.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename MatrixExprT,
+    typename OutVectorT,
+    typename OutLeftMatrixT,
+    typename OutRightMatrixT
+>
+void eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, matrix_container<OutLeftMatrixT>& LV, matrix_container<OutRightMatrixT>& RV, eigen_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, v(), LV(), RV(), ws);
+}
+
+
 /**
  * \brief Compute the eigenvalues and the eigenvectors of the given symmetric
  *  matrix.
@@ -1586,6 +2129,7 @@ void eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>
  * \param v The output eigenvalues vector.
  * \param V The output eigenvectors matrix (each eigenvector is stored
  *  column-wise).
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
  *
  * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
  *  eigenvectors of \a A, respectively.
@@ -1603,7 +2147,7 @@ template <
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_algorithm alg = auto_eigen_algorithm)
 {
     typedef symmetric_matrix<ValueT, TriangularT, LayoutT> matrix_type;
     typedef typename matrix_traits<matrix_type>::orientation_category orientation_category1;
@@ -1619,7 +2163,7 @@ void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_contain
         bad_argument()
     );
 
-    detail::eigen_impl(A, detail::both_eigenvectors, v(), V());
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, v(), V(), alg);
 
     // If eigen_impl assume that the input matrix can be changed, then use
     // these instructions below instead of the above one.
@@ -1628,6 +2172,34 @@ void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_contain
 }
 
 
+/**
+ * \brief Compute the eigenvalues and the eigenvectors of the given symmetric
+ *  matrix by means of the given workspace.
+ *
+ * No memory is allocated when the workspace and the outputs are already sized
+ * for a matrix with the same size of \a A.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws, eigen_algorithm alg = auto_eigen_algorithm)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, v(), V(), ws, alg);
+}
+
+
 /**
  * \brief Compute the eigenvalues and the eigenvectors of the given hermitian
  *  matrix.
@@ -1641,6 +2213,7 @@ void eigen(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_contain
  * \param v The output eigenvalues vector.
  * \param V The output eigenvectors matrix (each eigenvector is stored
  *  column-wise).
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
  *
  * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
  *  eigenvectors of \a A, respectively.
@@ -1658,7 +2231,7 @@ template <
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigen(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_algorithm alg = auto_eigen_algorithm)
 {
     typedef hermitian_matrix<ValueT, TriangularT, LayoutT> matrix_type;
     typedef typename matrix_traits<matrix_type>::orientation_category orientation_category1;
@@ -1674,7 +2247,7 @@ void eigen(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_contain
         bad_argument()
     );
 
-    detail::eigen_impl(A, detail::both_eigenvectors, v(), V());
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, v(), V(), alg);
 
     // If eigen_impl assume that the input matrix can be changed, then use
     // these instructions below instead of the above one.
@@ -1684,189 +2257,740 @@ void eigen(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_contain
 
 
 /**
- * \brief Compute the eigenvalues and the left and right eigenvectors
- *  of the given matrix expression.
- *
- * \tparam MatrixExprT The type of the input matrix expression.
- * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutLeftMatrixT The type of the left eigenvectors matrix.
- * \tparam OutRightMatrixT The type of the right eigenvectors matrix.
- *
- * \param A The input matrix expression.
- * \param v The output eigenvalues vector.
- * \param LV The output left eigenvectors matrix (each eigenvector is stored
- *  column-wise).
- * \param RV The output right eigenvectors matrix (each eigenvector is stored
- *  column-wise).
+ * \brief Compute the eigenvalues and the eigenvectors of the given hermitian
+ *  matrix by means of the given workspace.
  *
- * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
- *  left eigenvectors, and the right eigenvector of \a A, respectively.
+ * No memory is allocated when the workspace and the outputs are already sized
+ * for a matrix with the same size of \a A.
  *
- *  \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_workspace
  */
 template <
-    typename AMatrixExprT,
-    typename BMatrixExprT,
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
     typename OutVectorT,
-    typename OutLeftMatrixT,
-    typename OutRightMatrixT
+    typename OutMatrixT
 >
-void eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutLeftMatrixT>& LV, matrix_container<OutRightMatrixT>& RV)
+void eigen(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws, eigen_algorithm alg = auto_eigen_algorithm)
 {
-    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
-    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
-    typedef typename matrix_traits<OutLeftMatrixT>::orientation_category orientation_category3;
-    typedef typename matrix_traits<OutRightMatrixT>::orientation_category orientation_category4;
-
-    // precondition: same orientation category
-    BOOST_STATIC_ASSERT((
-        ::boost::mpl::and_<
-            ::boost::is_same<orientation_category1,orientation_category2>,
-            ::boost::mpl::and_<
-                ::boost::is_same<orientation_category1,orientation_category3>,
-                ::boost::is_same<orientation_category1,orientation_category4>
-            >
-        >::value
-    ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
-    // precondition: B is square
-    BOOST_UBLAS_CHECK(
-        (num_rows(B) == num_columns(B)),
-        bad_argument()
-    );
 
-    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), LV(), RV(), orientation_category1());
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, v(), V(), ws, alg);
 }
 
 
 /**
- * \brief Compute the eigenvalues and the eigenvectors of the given symmatrix
- *  matrix expression.
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  and the corresponding eigenvectors of the given symmetric matrix.
  *
- * \tparam AValueT The type of the elements of the first input matrix
- *  expression.
- * \tparam ATriangularT The type of the triangular shape of the first input
- *  matrix expression.
+ * The eigenvalues are sorted in ascending order, so that, for instance,
+ * <code>il=0</code> and <code>iu=k-1</code> select the \c k smallest
+ * eigenvalues.
+ * Only the requested eigenpairs are computed by means of the MRRR algorithm
+ * (LAPACK \c syevr), which is much cheaper than the full eigendecomposition
+ * when <code>iu-il+1</code> is small compared to the order of \a A.
+ *
+ * \tparam ValueT The type of the input matrix elements.
+ * \tparam TriangularT The type of the triangular shape.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The input matrix.
+ * \param il The index of the smallest eigenvalue to compute.
+ * \param iu The index of the largest eigenvalue to compute.
+ * \param v The output eigenvalues vector (of size <code>iu-il+1</code>).
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the selected eigenvalues, and
+ *  the corresponding eigenvectors of \a A, respectively.
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_index(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'I', 0, 0, il, iu, v(), V(), syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  and the corresponding eigenvectors of the given symmetric matrix.
+ *
+ * Only the requested eigenpairs are computed by means of the MRRR algorithm
+ * (LAPACK \c syevr).
+ * On exit, \a v and \a V are resized to the number of eigenvalues found.
+ *
+ * \tparam ValueT The type of the input matrix elements.
+ * \tparam TriangularT The type of the triangular shape.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The input matrix.
+ * \param vl The lower bound (excluded) of the interval.
+ * \param vu The upper bound (included) of the interval.
+ * \param v The output eigenvalues vector.
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the selected eigenvalues, and
+ *  the corresponding eigenvectors of \a A, respectively.
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_value(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'V', vl, vu, 0, 0, v(), V(), syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  and the corresponding eigenvectors of the given symmetric matrix by means of
+ *  the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_index(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'I', 0, 0, il, iu, v(), V(), ws, syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  and the corresponding eigenvectors of the given symmetric matrix by means of
+ *  the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_value(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'V', vl, vu, 0, 0, v(), V(), ws, syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  and the corresponding eigenvectors of the given hermitian matrix.
+ *
+ * The eigenvalues are sorted in ascending order, so that, for instance,
+ * <code>il=0</code> and <code>iu=k-1</code> select the \c k smallest
+ * eigenvalues.
+ * Only the requested eigenpairs are computed by means of the MRRR algorithm
+ * (LAPACK \c heevr), which is much cheaper than the full eigendecomposition
+ * when <code>iu-il+1</code> is small compared to the order of \a A.
+ *
+ * \tparam ValueT The type of the input matrix elements.
+ * \tparam TriangularT The type of the triangular shape.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The input matrix.
+ * \param il The index of the smallest eigenvalue to compute.
+ * \param iu The index of the largest eigenvalue to compute.
+ * \param v The output eigenvalues vector (of size <code>iu-il+1</code>).
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the selected eigenvalues, and
+ *  the corresponding eigenvectors of \a A, respectively.
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_index(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'I', 0, 0, il, iu, v(), V(), syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  and the corresponding eigenvectors of the given hermitian matrix.
+ *
+ * Only the requested eigenpairs are computed by means of the MRRR algorithm
+ * (LAPACK \c heevr).
+ * On exit, \a v and \a V are resized to the number of eigenvalues found.
+ *
+ * \tparam ValueT The type of the input matrix elements.
+ * \tparam TriangularT The type of the triangular shape.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The input matrix.
+ * \param vl The lower bound (excluded) of the interval.
+ * \param vu The upper bound (included) of the interval.
+ * \param v The output eigenvalues vector.
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the selected eigenvalues, and
+ *  the corresponding eigenvectors of \a A, respectively.
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_value(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'V', vl, vu, 0, 0, v(), V(), syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  and the corresponding eigenvectors of the given hermitian matrix by means of
+ *  the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_index(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'I', 0, 0, il, iu, v(), V(), ws, syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  and the corresponding eigenvectors of the given hermitian matrix by means of
+ *  the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen_by_value(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V, eigen_workspace<ValueT>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
+
+    detail::eigen_impl(A, detail::both_eigenvectors, 'V', vl, vu, 0, 0, v(), V(), ws, syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues and the left and right eigenvectors
+ *  of the given matrix expression.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutLeftMatrixT The type of the left eigenvectors matrix.
+ * \tparam OutRightMatrixT The type of the right eigenvectors matrix.
+ *
+ * \param A The input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \param LV The output left eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ * \param RV The output right eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
+ *  left eigenvectors, and the right eigenvector of \a A, respectively.
+ *
+ *  \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename AMatrixExprT,
+    typename BMatrixExprT,
+    typename OutVectorT,
+    typename OutLeftMatrixT,
+    typename OutRightMatrixT
+>
+void eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutLeftMatrixT>& LV, matrix_container<OutRightMatrixT>& RV)
+{
+    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutLeftMatrixT>::orientation_category orientation_category3;
+    typedef typename matrix_traits<OutRightMatrixT>::orientation_category orientation_category4;
+
+    // precondition: same orientation category
+    BOOST_STATIC_ASSERT((
+        ::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::mpl::and_<
+                ::boost::is_same<orientation_category1,orientation_category3>,
+                ::boost::is_same<orientation_category1,orientation_category4>
+            >
+        >::value
+    ));
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: B is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(B) == num_columns(B)),
+        bad_argument()
+    );
+
+    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), LV(), RV(), orientation_category1());
+}
+
+
+/**
+ * \brief Compute the eigenvalues and the eigenvectors of the given symmatrix
+ *  matrix expression.
+ *
+ * \tparam AValueT The type of the elements of the first input matrix
+ *  expression.
+ * \tparam ATriangularT The type of the triangular shape of the first input
+ *  matrix expression.
+ * \tparam BValueT The type of the elements of the second input matrix
+ *  expression.
+ * \tparam BTriangularT The type of the triangular shape of the second input
+ *  matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The first input matrix expression.
+ * \param B The second input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
+ *  left eigenvectors, and the right eigenvector of \a A, respectively.
+ *
+ * \note
+ *  The second input matrix \a B is assumed to be positive definite.
+ *
+ *  \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename AValueT,
+    typename ATriangularT,
+    typename ALayoutT,
+    typename BValueT,
+    typename BTriangularT,
+    typename BLayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen(symmetric_matrix<AValueT,ATriangularT,ALayoutT> const& A, symmetric_matrix<BValueT,BTriangularT,BLayoutT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    typedef symmetric_matrix<AValueT,ATriangularT,ALayoutT> A_matrix_type;
+    typedef symmetric_matrix<BValueT,BTriangularT,BLayoutT> B_matrix_type;
+    typedef typename matrix_traits<A_matrix_type>::orientation_category orientation_category1;
+    typedef typename matrix_traits<B_matrix_type>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
+
+    // precondition: same triangular shape
+    BOOST_STATIC_ASSERT((
+        ::boost::is_same<ATriangularT,BTriangularT>::value
+    ));
+    // precondition: same orientation category
+    BOOST_STATIC_ASSERT((
+        ::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::is_same<orientation_category1,orientation_category3>
+        >::value
+    ));
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: B is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(B) == num_columns(B)),
+        bad_argument()
+    );
+
+    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), V());
+}
+
+
+/**
+ * \brief Compute the eigenvalues and the eigenvectors of the given symmatrix
+ *  matrix expression.
+ *
+ * \tparam AValueT The type of the elements of the first input matrix
+ *  expression.
+ * \tparam ATriangularT The type of the triangular shape of the first input
+ *  matrix expression.
  * \tparam BValueT The type of the elements of the second input matrix
  *  expression.
- * \tparam BTriangularT The type of the triangular shape of the second input
- *  matrix expression.
+ * \tparam BTriangularT The type of the triangular shape of the second input
+ *  matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the eigenvectors matrix.
+ *
+ * \param A The first input matrix expression.
+ * \param B The second input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \param V The output eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
+ *  left eigenvectors, and the right eigenvector of \a A, respectively.
+ *
+ * \note
+ *  The second input matrix \a B is assumed to be positive definite.
+ *
+ *  \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename AValueT,
+    typename ATriangularT,
+    typename ALayoutT,
+    typename BValueT,
+    typename BTriangularT,
+    typename BLayoutT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void eigen(hermitian_matrix<AValueT,ATriangularT,ALayoutT> const& A, hermitian_matrix<BValueT,BTriangularT,BLayoutT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    typedef symmetric_matrix<AValueT,ATriangularT,ALayoutT> A_matrix_type;
+    typedef symmetric_matrix<BValueT,BTriangularT,BLayoutT> B_matrix_type;
+    typedef typename matrix_traits<A_matrix_type>::orientation_category orientation_category1;
+    typedef typename matrix_traits<B_matrix_type>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
+
+    // precondition: same triangular shape
+    BOOST_STATIC_ASSERT((
+        ::boost::is_same<ATriangularT,BTriangularT>::value
+    ));
+    // precondition: same orientation category
+    BOOST_STATIC_ASSERT((
+        ::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::is_same<orientation_category1,orientation_category3>
+        >::value
+    ));
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: B is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(B) == num_columns(B)),
+        bad_argument()
+    );
+
+    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), V());
+}
+
+
+/**
+ * \brief Compute the eigenvalues and the left eigenvectors of the given matrix
+ *  expression.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the left eigenvectors matrix.
+ *
+ * \param A The input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \param V The output left eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
+ *  left eigenvectors of \a A, respectively.
+ *
+ *  \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename MatrixExprT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void left_eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category2;
+    typedef typename layout_type<OutMatrixT>::type out_layout_type;
+
+    // precondition: same orientation category
+    BOOST_STATIC_ASSERT((
+        ::boost::is_same<orientation_category1,orientation_category2>::value
+    ));
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    //OutMatrixT dummy_RV;
+    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_RV;
+
+    detail::eigen_impl(A, detail::left_eigenvectors, v(), V(), dummy_RV, orientation_category1());
+}
+
+
+/**
+ * \brief Compute the generazlied eigenvalues and the left generazlied
+ *  eigenvectors of the given matrix pair expression.
+ *
+ * \tparam AMatrixExprT The type of the first input matrix expression.
+ * \tparam BMatrixExprT The type of the second input matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ * \tparam OutMatrixT The type of the left eigenvectors matrix.
+ *
+ * \param A The first input matrix expression.
+ * \param B The second input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \param V The output left eigenvectors matrix (each eigenvector is stored
+ *  column-wise).
+ *
+ * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
+ *  left eigenvectors of \a (A,B), respectively.
+ *
+ *  \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename AMatrixExprT,
+    typename BMatrixExprT,
+    typename OutVectorT,
+    typename OutMatrixT
+>
+void left_eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+{
+    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
+    typedef typename layout_type<OutMatrixT>::type out_layout_type;
+
+    // precondition: same orientation category
+    BOOST_STATIC_ASSERT((
+        ::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::is_same<orientation_category1,orientation_category3>
+        >::value
+    ));
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: B is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(B) == num_columns(B)),
+        bad_argument()
+    );
+
+    //OutMatrixT dummy_RV;
+    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_RV;
+
+    detail::geigen_impl(A, B, detail::left_eigenvectors, true, v(), V(), dummy_RV, orientation_category1());
+}
+
+
+/**
+ * \brief Compute the eigenvalues and the right eigenvectors of the given matrix
+ *  expression.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
  * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the eigenvectors matrix.
+ * \tparam OutMatrixT The type of the right eigenvectors matrix.
  *
- * \param A The first input matrix expression.
- * \param B The second input matrix expression.
+ * \param A The input matrix expression.
  * \param v The output eigenvalues vector.
- * \param V The output eigenvectors matrix (each eigenvector is stored
+ * \param V The output right eigenvectors matrix (each eigenvector is stored
  *  column-wise).
  *
- * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
- *  left eigenvectors, and the right eigenvector of \a A, respectively.
- *
- * \note
- *  The second input matrix \a B is assumed to be positive definite.
+ * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
+ *  right eigenvectors of \a A, respectively.
  *
  *  \author Marco Guazzone, marco.guazzone@gmail.com
  */
 template <
-    typename AValueT,
-    typename ATriangularT,
-    typename ALayoutT,
-    typename BValueT,
-    typename BTriangularT,
-    typename BLayoutT,
+    typename MatrixExprT,
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen(symmetric_matrix<AValueT,ATriangularT,ALayoutT> const& A, symmetric_matrix<BValueT,BTriangularT,BLayoutT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void right_eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
 {
-    typedef symmetric_matrix<AValueT,ATriangularT,ALayoutT> A_matrix_type;
-    typedef symmetric_matrix<BValueT,BTriangularT,BLayoutT> B_matrix_type;
-    typedef typename matrix_traits<A_matrix_type>::orientation_category orientation_category1;
-    typedef typename matrix_traits<B_matrix_type>::orientation_category orientation_category2;
-    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category2;
+    typedef typename layout_type<OutMatrixT>::type out_layout_type;
 
-    // precondition: same triangular shape
-    BOOST_STATIC_ASSERT((
-        ::boost::is_same<ATriangularT,BTriangularT>::value
-    ));
     // precondition: same orientation category
     BOOST_STATIC_ASSERT((
-        ::boost::mpl::and_<
-            ::boost::is_same<orientation_category1,orientation_category2>,
-            ::boost::is_same<orientation_category1,orientation_category3>
-        >::value
+        ::boost::is_same<orientation_category1,orientation_category2>::value
     ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
-    // precondition: B is square
-    BOOST_UBLAS_CHECK(
-        (num_rows(B) == num_columns(B)),
-        bad_argument()
-    );
 
-    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), V());
+    //OutMatrixT dummy_LV;
+    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_LV;
+
+    detail::eigen_impl(A, detail::right_eigenvectors, v(), dummy_LV, V(), orientation_category1());
 }
 
 
 /**
- * \brief Compute the eigenvalues and the eigenvectors of the given symmatrix
- *  matrix expression.
+ * \brief Compute the generazlied eigenvalues and the right generazlied
+ *  eigenvectors of the given matrix pair expression.
  *
- * \tparam AValueT The type of the elements of the first input matrix
- *  expression.
- * \tparam ATriangularT The type of the triangular shape of the first input
- *  matrix expression.
- * \tparam BValueT The type of the elements of the second input matrix
- *  expression.
- * \tparam BTriangularT The type of the triangular shape of the second input
- *  matrix expression.
+ * \tparam AMatrixExprT The type of the first input matrix expression.
+ * \tparam BMatrixExprT The type of the second input matrix expression.
  * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the eigenvectors matrix.
+ * \tparam OutMatrixT The type of the right eigenvectors matrix.
  *
  * \param A The first input matrix expression.
  * \param B The second input matrix expression.
  * \param v The output eigenvalues vector.
- * \param V The output eigenvectors matrix (each eigenvector is stored
+ * \param V The output right eigenvectors matrix (each eigenvector is stored
  *  column-wise).
  *
- * \return Nothing, but \a v, \a LV, and \a RV contain the eigenvalues, the
- *  left eigenvectors, and the right eigenvector of \a A, respectively.
- *
- * \note
- *  The second input matrix \a B is assumed to be positive definite.
+ * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
+ *  right eigenvectors of \a (A,B), respectively.
  *
  *  \author Marco Guazzone, marco.guazzone@gmail.com
  */
 template <
-    typename AValueT,
-    typename ATriangularT,
-    typename ALayoutT,
-    typename BValueT,
-    typename BTriangularT,
-    typename BLayoutT,
+    typename AMatrixExprT,
+    typename BMatrixExprT,
     typename OutVectorT,
     typename OutMatrixT
 >
-void eigen(hermitian_matrix<AValueT,ATriangularT,ALayoutT> const& A, hermitian_matrix<BValueT,BTriangularT,BLayoutT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void right_eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
 {
-    typedef symmetric_matrix<AValueT,ATriangularT,ALayoutT> A_matrix_type;
-    typedef symmetric_matrix<BValueT,BTriangularT,BLayoutT> B_matrix_type;
-    typedef typename matrix_traits<A_matrix_type>::orientation_category orientation_category1;
-    typedef typename matrix_traits<B_matrix_type>::orientation_category orientation_category2;
+    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
     typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
+    typedef typename layout_type<OutMatrixT>::type out_layout_type;
 
-    // precondition: same triangular shape
-    BOOST_STATIC_ASSERT((
-        ::boost::is_same<ATriangularT,BTriangularT>::value
-    ));
     // precondition: same orientation category
     BOOST_STATIC_ASSERT((
         ::boost::mpl::and_<
@@ -1885,267 +3009,384 @@ void eigen(hermitian_matrix<AValueT,ATriangularT,ALayoutT> const& A, hermitian_m
         bad_argument()
     );
 
-    detail::geigen_impl(A, B, detail::both_eigenvectors, true, v(), V());
+    //OutMatrixT dummy_LV;
+    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_LV;
+
+    detail::geigen_impl(A, B, detail::right_eigenvectors, true, v(), dummy_LV, V(), orientation_category1());
+}
+
+
+/**
+ * \brief Compute the eigenvalues of the given matrix expression.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ *
+ * \param A The input matrix expression.
+ * \param v The output eigenvalues vector.
+ * \return Nothing; however the parameter \a v will store on exit the
+ *  eigenvalues vector of \a A.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename MatrixExprT,
+    typename OutVectorT
+>
+void eigenvalues(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v)
+{
+    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
+
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    matrix<out_value_type, typename layout_type<MatrixExprT>::type> tmp_LV;
+    matrix<out_value_type, typename layout_type<MatrixExprT>::type> tmp_RV;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, v(), tmp_LV, tmp_RV, orientation_category());
+}
+
+
+/**
+ * \brief Compute the eigenvalues of the given matrix expression by means of
+ *  the given workspace.
+ *
+ * No memory is allocated when the workspace and the output vector \a v are
+ * already sized for a matrix with the same size of \a A.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename MatrixExprT,
+    typename OutVectorT
+>
+void eigenvalues(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, eigen_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
+
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    // Empty matrices do not allocate memory
+    matrix<out_value_type, column_major> tmp_LV;
+    matrix<out_value_type, column_major> tmp_RV;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, v(), tmp_LV, tmp_RV, ws);
+}
+
+
+/**
+ * \brief Compute the eigenvalues of the given symmetrix matrix.
+ *
+ * \tparam ValueT The type of the elements of the input symmetric matrix.
+ * \tparam Triangular The triangular type of the input symmetric matrix.
+ * \tparam LayoutT The storage layout type of the input symmetric matrix.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ *
+ * \param A The input symmetric matrix.
+ * \param v The output eigenvalues vector.
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
+ * \return Nothing; however the parameter \a v will store on exit the
+ *  eigenvalues vector of \a A.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
+>
+void eigenvalues(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, eigen_algorithm alg = auto_eigen_algorithm)
+{
+    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
+
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    matrix<out_value_type, LayoutT> tmp_V;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, 'A', 0, 0, 0, 0, v(), tmp_V, alg);
+}
+
+
+/**
+ * \brief Compute the eigenvalues of the given symmetric matrix by means of the
+ *  given workspace.
+ *
+ * No memory is allocated when the workspace and the output vector \a v are
+ * already sized for a matrix with the same size of \a A.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
+>
+void eigenvalues(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws, eigen_algorithm alg = auto_eigen_algorithm)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    // Empty matrices do not allocate memory
+    matrix<typename vector_traits<OutVectorT>::value_type, LayoutT> tmp_V;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, 'A', 0, 0, 0, 0, v(), tmp_V, ws, alg);
+}
+
+
+/**
+ * \brief Compute the eigenvalues of the given hermitian matrix.
+ *
+ * \tparam ValueT The type of the elements of the input hermitian matrix.
+ * \tparam Triangular The triangular type of the input hermitian matrix.
+ * \tparam LayoutT The storage layout type of the input hermitian matrix.
+ * \tparam OutVectorT The type of the eigenvalues vector.
+ *
+ * \param A The input hermitian matrix.
+ * \param v The output eigenvalues vector.
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
+ * \return Nothing; however the parameter \a v will store on exit the
+ *  eigenvalues vector of \a A.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
+>
+void eigenvalues(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, eigen_algorithm alg = auto_eigen_algorithm)
+{
+    typedef ValueT in_value_type;
+
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+
+    matrix<in_value_type, LayoutT> tmp_V;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, 'A', 0, 0, 0, 0, v(), tmp_V, alg);
 }
 
 
 /**
- * \brief Compute the eigenvalues and the left eigenvectors of the given matrix
- *  expression.
- *
- * \tparam MatrixExprT The type of the input matrix expression.
- * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the left eigenvectors matrix.
- *
- * \param A The input matrix expression.
- * \param v The output eigenvalues vector.
- * \param V The output left eigenvectors matrix (each eigenvector is stored
- *  column-wise).
+ * \brief Compute the eigenvalues of the given hermitian matrix by means of the
+ *  given workspace.
  *
- * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
- *  left eigenvectors of \a A, respectively.
+ * No memory is allocated when the workspace and the output vector \a v are
+ * already sized for a matrix with the same size of \a A.
  *
- *  \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_workspace
  */
 template <
-    typename MatrixExprT,
-    typename OutVectorT,
-    typename OutMatrixT
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
 >
-void left_eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigenvalues(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws, eigen_algorithm alg = auto_eigen_algorithm)
 {
-    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
-    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category2;
-    typedef typename layout_type<OutMatrixT>::type out_layout_type;
-
-    // precondition: same orientation category
-    BOOST_STATIC_ASSERT((
-        ::boost::is_same<orientation_category1,orientation_category2>::value
-    ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
 
-    //OutMatrixT dummy_RV;
-    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_RV;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::eigen_impl(A, detail::left_eigenvectors, v(), V(), dummy_RV, orientation_category1());
+    detail::eigen_impl(A, detail::none_eigenvectors, 'A', 0, 0, 0, 0, v(), tmp_V, ws, alg);
 }
 
 
 /**
- * \brief Compute the generazlied eigenvalues and the left generazlied
- *  eigenvectors of the given matrix pair expression.
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  of the given symmetric matrix.
  *
- * \tparam AMatrixExprT The type of the first input matrix expression.
- * \tparam BMatrixExprT The type of the second input matrix expression.
+ * \tparam ValueT The type of the elements of the input symmetric matrix.
+ * \tparam Triangular The triangular type of the input symmetric matrix.
+ * \tparam LayoutT The storage layout type of the input symmetric matrix.
  * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the left eigenvectors matrix.
- *
- * \param A The first input matrix expression.
- * \param B The second input matrix expression.
- * \param v The output eigenvalues vector.
- * \param V The output left eigenvectors matrix (each eigenvector is stored
- *  column-wise).
  *
- * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
- *  left eigenvectors of \a (A,B), respectively.
+ * \param A The input symmetric matrix.
+ * \param il The index of the smallest eigenvalue to compute.
+ * \param iu The index of the largest eigenvalue to compute.
+ * \param v The output eigenvalues vector (of size <code>iu-il+1</code>).
+ * \return Nothing; however the parameter \a v will store on exit the
+ *  selected eigenvalues of \a A, in ascending order.
  *
- *  \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_by_index
  */
 template <
-    typename AMatrixExprT,
-    typename BMatrixExprT,
-    typename OutVectorT,
-    typename OutMatrixT
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
 >
-void left_eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigenvalues_by_index(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v)
 {
-    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
-    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
-    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
-    typedef typename layout_type<OutMatrixT>::type out_layout_type;
-
-    // precondition: same orientation category
-    BOOST_STATIC_ASSERT((
-        ::boost::mpl::and_<
-            ::boost::is_same<orientation_category1,orientation_category2>,
-            ::boost::is_same<orientation_category1,orientation_category3>
-        >::value
-    ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
-    // precondition: B is square
+    // precondition: 0 <= il <= iu < n
     BOOST_UBLAS_CHECK(
-        (num_rows(B) == num_columns(B)),
+        (il <= iu && iu < num_rows(A)),
         bad_argument()
     );
 
-    //OutMatrixT dummy_RV;
-    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_RV;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::geigen_impl(A, B, detail::left_eigenvectors, true, v(), V(), dummy_RV, orientation_category1());
+    detail::eigen_impl(A, detail::none_eigenvectors, 'I', 0, 0, il, iu, v(), tmp_V, syevr_eigen_algorithm);
 }
 
 
 /**
- * \brief Compute the eigenvalues and the right eigenvectors of the given matrix
- *  expression.
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  of the given symmetric matrix.
  *
- * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam ValueT The type of the elements of the input symmetric matrix.
+ * \tparam Triangular The triangular type of the input symmetric matrix.
+ * \tparam LayoutT The storage layout type of the input symmetric matrix.
  * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the right eigenvectors matrix.
  *
- * \param A The input matrix expression.
+ * \param A The input symmetric matrix.
+ * \param vl The lower bound (excluded) of the interval.
+ * \param vu The upper bound (included) of the interval.
  * \param v The output eigenvalues vector.
- * \param V The output right eigenvectors matrix (each eigenvector is stored
- *  column-wise).
- *
- * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
- *  right eigenvectors of \a A, respectively.
+ * \return Nothing; however the parameter \a v will store on exit the
+ *  eigenvalues of \a A in (\a vl, \a vu], in ascending order.
  *
- *  \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_by_value
  */
 template <
-    typename MatrixExprT,
-    typename OutVectorT,
-    typename OutMatrixT
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
 >
-void right_eigen(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigenvalues_by_value(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v)
 {
-    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
-    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category2;
-    typedef typename layout_type<OutMatrixT>::type out_layout_type;
-
-    // precondition: same orientation category
-    BOOST_STATIC_ASSERT((
-        ::boost::is_same<orientation_category1,orientation_category2>::value
-    ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
 
-    //OutMatrixT dummy_LV;
-    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_LV;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::eigen_impl(A, detail::right_eigenvectors, v(), dummy_LV, V(), orientation_category1());
+    detail::eigen_impl(A, detail::none_eigenvectors, 'V', vl, vu, 0, 0, v(), tmp_V, syevr_eigen_algorithm);
 }
 
 
 /**
- * \brief Compute the generazlied eigenvalues and the right generazlied
- *  eigenvectors of the given matrix pair expression.
- *
- * \tparam AMatrixExprT The type of the first input matrix expression.
- * \tparam BMatrixExprT The type of the second input matrix expression.
- * \tparam OutVectorT The type of the eigenvalues vector.
- * \tparam OutMatrixT The type of the right eigenvectors matrix.
- *
- * \param A The first input matrix expression.
- * \param B The second input matrix expression.
- * \param v The output eigenvalues vector.
- * \param V The output right eigenvectors matrix (each eigenvector is stored
- *  column-wise).
- *
- * \return Nothing, but \a v, and \a V contain the eigenvalues, and the
- *  right eigenvectors of \a (A,B), respectively.
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  of the given symmetric matrix by means of the given workspace.
  *
- *  \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_workspace
  */
 template <
-    typename AMatrixExprT,
-    typename BMatrixExprT,
-    typename OutVectorT,
-    typename OutMatrixT
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
 >
-void right_eigen(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, vector_container<OutVectorT>& v, matrix_container<OutMatrixT>& V)
+void eigenvalues_by_index(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws)
 {
-    typedef typename matrix_traits<AMatrixExprT>::orientation_category orientation_category1;
-    typedef typename matrix_traits<BMatrixExprT>::orientation_category orientation_category2;
-    typedef typename matrix_traits<OutMatrixT>::orientation_category orientation_category3;
-    typedef typename layout_type<OutMatrixT>::type out_layout_type;
-
-    // precondition: same orientation category
-    BOOST_STATIC_ASSERT((
-        ::boost::mpl::and_<
-            ::boost::is_same<orientation_category1,orientation_category2>,
-            ::boost::is_same<orientation_category1,orientation_category3>
-        >::value
-    ));
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
-    // precondition: B is square
+    // precondition: 0 <= il <= iu < n
     BOOST_UBLAS_CHECK(
-        (num_rows(B) == num_columns(B)),
+        (il <= iu && iu < num_rows(A)),
         bad_argument()
     );
 
-    //OutMatrixT dummy_LV;
-    matrix<typename matrix_traits<OutMatrixT>::value_type, out_layout_type> dummy_LV;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::geigen_impl(A, B, detail::right_eigenvectors, true, v(), dummy_LV, V(), orientation_category1());
+    detail::eigen_impl(A, detail::none_eigenvectors, 'I', 0, 0, il, iu, v(), tmp_V, ws, syevr_eigen_algorithm);
 }
 
 
 /**
- * \brief Compute the eigenvalues of the given matrix expression.
- *
- * \tparam MatrixExprT The type of the input matrix expression.
- * \tparam OutVectorT The type of the eigenvalues vector.
- *
- * \param A The input matrix expression.
- * \param v The output eigenvalues vector.
- * \return Nothing; however the parameter \a v will store on exit the
- *  eigenvalues vector of \a A.
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  of the given symmetric matrix by means of the given workspace.
  *
- * \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_workspace
  */
 template <
-    typename MatrixExprT,
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
     typename OutVectorT
 >
-void eigenvalues(matrix_expression<MatrixExprT> const& A, vector_container<OutVectorT>& v)
+void eigenvalues_by_value(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws)
 {
-    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
-    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
-
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
 
-    matrix<out_value_type, typename layout_type<MatrixExprT>::type> tmp_LV;
-    matrix<out_value_type, typename layout_type<MatrixExprT>::type> tmp_RV;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::eigen_impl(A, detail::none_eigenvectors, v(), tmp_LV, tmp_RV, orientation_category());
+    detail::eigen_impl(A, detail::none_eigenvectors, 'V', vl, vu, 0, 0, v(), tmp_V, ws, syevr_eigen_algorithm);
 }
 
 
 /**
- * \brief Compute the eigenvalues of the given symmetrix matrix.
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  of the given hermitian matrix.
  *
- * \tparam ValueT The type of the elements of the input symmetric matrix.
- * \tparam Triangular The triangular type of the input symmetric matrix.
- * \tparam LayoutT The storage layout type of the input symmetric matrix.
+ * \tparam ValueT The type of the elements of the input hermitian matrix.
+ * \tparam Triangular The triangular type of the input hermitian matrix.
+ * \tparam LayoutT The storage layout type of the input hermitian matrix.
  * \tparam OutVectorT The type of the eigenvalues vector.
  *
- * \param A The input symmetric matrix.
- * \param v The output eigenvalues vector.
+ * \param A The input hermitian matrix.
+ * \param il The index of the smallest eigenvalue to compute.
+ * \param iu The index of the largest eigenvalue to compute.
+ * \param v The output eigenvalues vector (of size <code>iu-il+1</code>).
  * \return Nothing; however the parameter \a v will store on exit the
- *  eigenvalues vector of \a A.
+ *  selected eigenvalues of \a A, in ascending order.
  *
- * \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_by_index
  */
 template <
     typename ValueT,
@@ -2153,24 +3394,29 @@ template <
     typename LayoutT,
     typename OutVectorT
 >
-void eigenvalues(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v)
+void eigenvalues_by_index(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v)
 {
-    typedef typename vector_traits<OutVectorT>::value_type out_value_type;
-
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
 
-    matrix<out_value_type, LayoutT> tmp_V;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::eigen_impl(A, detail::none_eigenvectors, v(), tmp_V);
+    detail::eigen_impl(A, detail::none_eigenvectors, 'I', 0, 0, il, iu, v(), tmp_V, syevr_eigen_algorithm);
 }
 
 
 /**
- * \brief Compute the eigenvalues of the given hermitian matrix.
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  of the given hermitian matrix.
  *
  * \tparam ValueT The type of the elements of the input hermitian matrix.
  * \tparam Triangular The triangular type of the input hermitian matrix.
@@ -2178,11 +3424,13 @@ void eigenvalues(symmetric_matrix<ValueT,TriangularT,LayoutT> const& A, vector_c
  * \tparam OutVectorT The type of the eigenvalues vector.
  *
  * \param A The input hermitian matrix.
+ * \param vl The lower bound (excluded) of the interval.
+ * \param vu The upper bound (included) of the interval.
  * \param v The output eigenvalues vector.
  * \return Nothing; however the parameter \a v will store on exit the
- *  eigenvalues vector of \a A.
+ *  eigenvalues of \a A in (\a vl, \a vu], in ascending order.
  *
- * \author Marco Guazzone, marco.guazzone@gmail.com
+ * \sa eigen_by_value
  */
 template <
     typename ValueT,
@@ -2190,19 +3438,87 @@ template <
     typename LayoutT,
     typename OutVectorT
 >
-void eigenvalues(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, vector_container<OutVectorT>& v)
+void eigenvalues_by_value(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v)
 {
-    typedef ValueT in_value_type;
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
+
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, 'V', vl, vu, 0, 0, v(), tmp_V, syevr_eigen_algorithm);
+}
+
+
+/**
+ * \brief Compute the eigenvalues with (zero-based) index in [\a il, \a iu]
+ *  of the given hermitian matrix by means of the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
+>
+void eigenvalues_by_index(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, ::std::size_t il, ::std::size_t iu, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws)
+{
+    // precondition: A is square
+    BOOST_UBLAS_CHECK(
+        (num_rows(A) == num_columns(A)),
+        bad_argument()
+    );
+    // precondition: 0 <= il <= iu < n
+    BOOST_UBLAS_CHECK(
+        (il <= iu && iu < num_rows(A)),
+        bad_argument()
+    );
+
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
+
+    detail::eigen_impl(A, detail::none_eigenvectors, 'I', 0, 0, il, iu, v(), tmp_V, ws, syevr_eigen_algorithm);
+}
 
+
+/**
+ * \brief Compute the eigenvalues in the half-open interval (\a vl, \a vu]
+ *  of the given hermitian matrix by means of the given workspace.
+ *
+ * \sa eigen_workspace
+ */
+template <
+    typename ValueT,
+    typename TriangularT,
+    typename LayoutT,
+    typename OutVectorT
+>
+void eigenvalues_by_value(hermitian_matrix<ValueT,TriangularT,LayoutT> const& A, typename type_traits<ValueT>::real_type vl, typename type_traits<ValueT>::real_type vu, vector_container<OutVectorT>& v, eigen_workspace<ValueT>& ws)
+{
     // precondition: A is square
     BOOST_UBLAS_CHECK(
         (num_rows(A) == num_columns(A)),
         bad_argument()
     );
+    // precondition: vl < vu
+    BOOST_UBLAS_CHECK(
+        (vl < vu),
+        bad_argument()
+    );
 
-    matrix<in_value_type, LayoutT> tmp_V;
+    // Empty matrices do not allocate memory
+    matrix<ValueT, LayoutT> tmp_V;
 
-    detail::eigen_impl(A, detail::none_eigenvectors, v(), tmp_V);
+    detail::eigen_impl(A, detail::none_eigenvectors, 'V', vl, vu, 0, 0, v(), tmp_V, ws, syevr_eigen_algorithm);
 }
 
 
@@ -2270,6 +3586,7 @@ void eigenvectors(matrix_expression<MatrixExprT> const& A, matrix_container<OutL
  * \param A The input symmetric matrix.
  * \param V The output (right) eigenvectors matrix (each eigenvector is stored
  *  column-wise).
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
  *
  * \return Nothing; however parameter \a V will store on exit the right
  *  eigenvectors matrix of \a A.
@@ -2286,7 +3603,7 @@ template <
     typename LayoutT,
     typename OutMatrixT
 >
-void eigenvectors(symmetric_matrix<ValueT, TriangularT, LayoutT> const& A, matrix_container<OutMatrixT>& V)
+void eigenvectors(symmetric_matrix<ValueT, TriangularT, LayoutT> const& A, matrix_container<OutMatrixT>& V, eigen_algorithm alg = auto_eigen_algorithm)
 {
     typedef symmetric_matrix<ValueT, TriangularT, LayoutT> in_matrix_type;
     typedef typename matrix_traits<OutMatrixT>::value_type out_value_type;
@@ -2305,7 +3622,7 @@ void eigenvectors(symmetric_matrix<ValueT, TriangularT, LayoutT> const& A, matri
 
     vector<out_value_type> tmp_v;
 
-    detail::eigen_impl(A, detail::both_eigenvectors, tmp_v, V());
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, tmp_v, V(), alg);
 }
 
 
@@ -2320,6 +3637,7 @@ void eigenvectors(symmetric_matrix<ValueT, TriangularT, LayoutT> const& A, matri
  * \param A The input hermitian matrix.
  * \param V The output (right) eigenvectors matrix (each eigenvector is stored
  *  column-wise).
+ * \param alg The LAPACK driver to use (see \c eigen_algorithm).
  *
  * \return Nothing; however parameter \a V will store on exit the right
  *  eigenvectors matrix of \a A.
@@ -2336,7 +3654,7 @@ template <
     typename LayoutT,
     typename OutMatrixT
 >
-void eigenvectors(hermitian_matrix<ValueT, TriangularT, LayoutT> const& A, matrix_container<OutMatrixT>& V)
+void eigenvectors(hermitian_matrix<ValueT, TriangularT, LayoutT> const& A, matrix_container<OutMatrixT>& V, eigen_algorithm alg = auto_eigen_algorithm)
 {
     typedef hermitian_matrix<ValueT, TriangularT, LayoutT> in_matrix_type;
     typedef typename matrix_traits<OutMatrixT>::value_type out_value_type;
@@ -2353,9 +3671,9 @@ void eigenvectors(hermitian_matrix<ValueT, TriangularT, LayoutT> const& A, matri
         bad_argument()
     );
 
-    vector<out_value_type> tmp_v;
+    vector<typename type_traits<out_value_type>::real_type> tmp_v;
 
-    detail::eigen_impl(A, detail::both_eigenvectors, tmp_v, V());
+    detail::eigen_impl(A, detail::both_eigenvectors, 'A', 0, 0, 0, 0, tmp_v, V(), alg);
 }
 
 
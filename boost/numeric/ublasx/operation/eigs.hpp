@@ -0,0 +1,1350 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/eigs.hpp
+ *
+ * \brief Iterative eigensolvers for a few eigenpairs of large matrices.
+ *
+ * Computes \f$k\f$ eigenvalues \f$\lambda_i\f$ of a n-by-n real/complex
+ * matrix \f$A\f$ at one end of the spectrum, together with the associated
+ * eigenvectors \f$x_i\f$:
+ * \f[
+ *   A x_i = \lambda_i x_i, \quad i=1,\ldots,k
+ * \f]
+ * without computing the whole eigendecomposition.
+ *
+ * The eigenpairs are approximated by the Ritz pairs of the projection of
+ * \f$A\f$ onto a Krylov subspace of dimension \f$m > k\f$, which is built by
+ * the <em>Lanczos process</em> (for symmetric and hermitian matrices) or by
+ * the <em>Arnoldi process</em> (for general matrices), with full
+ * reorthogonalization.
+ * The subspace is <em>implicitly restarted</em> (Sorensen; Lehoucq and
+ * Sorensen) by applying the \f$m-k\f$ unwanted Ritz values as shifts of the
+ * QR iteration to the small projected matrix, until the wanted Ritz pairs
+ * converge.
+ * The eigenpairs of the small projected matrix are computed by the dense
+ * eigensolvers of \c eigen.hpp.
+ *
+ * The matrix \f$A\f$ is only accessed through matrix-vector products, so
+ * that it can be any matrix expression (including sparse matrices) or a
+ * user function computing \f$y = A x\f$.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_EIGS_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_EIGS_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_proxy.hpp>
+#include <boost/numeric/ublasx/operation/eigen.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/operation/svds.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/// The part of the spectrum the eigenvalues are computed from.
+enum eigs_which
+{
+    largest_magnitude_eigs, ///< The eigenvalues of largest magnitude.
+    largest_real_eigs, ///< The eigenvalues of largest real part.
+    smallest_real_eigs ///< The eigenvalues of smallest real part.
+};
+
+
+namespace detail {
+
+/// Compute \f$Y = A X\f$ for a matrix expression \a A and a single-column
+/// matrix \a X.
+template <typename MatrixExprT>
+class eigs_matrix_operator
+{
+    public: explicit eigs_matrix_operator(MatrixExprT const& A)
+        : A_(A)
+    {
+    }
+
+
+    public: template <typename XMatrixT, typename YMatrixT>
+        void operator()(XMatrixT const& X, YMatrixT& Y)
+    {
+        svds_prod(A_, X, Y);
+    }
+
+
+    private: MatrixExprT const& A_;
+};
+
+
+/// Compute \f$Y = A X\f$ for a single-column matrix \a X by means of a user
+/// function \c f(x,y) computing \f$y = A x\f$.
+template <typename FunctorT, typename ValueT>
+class eigs_function_operator
+{
+    public: eigs_function_operator(FunctorT f, ::std::size_t n)
+        : f_(f),
+          x_(n),
+          y_(n)
+    {
+    }
+
+
+    public: template <typename XMatrixT, typename YMatrixT>
+        void operator()(XMatrixT const& X, YMatrixT& Y)
+    {
+        matrix_column<YMatrixT> y(Y, 0);
+
+        noalias(x_) = column(X, 0);
+        f_(static_cast<vector<ValueT> const&>(x_), y_);
+        noalias(y) = y_;
+    }
+
+
+    private: FunctorT f_;
+    private: vector<ValueT> x_;
+    private: vector<ValueT> y_;
+};
+
+
+/**
+ * \brief Orthogonalize vector \a x against the first \a j columns of \a V
+ *  (which must be orthonormal) and store in \a h the projection
+ *  coefficients \f$V^H x\f$.
+ *
+ * Classical Gram-Schmidt is applied twice; \a c is scratch space.
+ */
+template <typename MatrixT, typename VectorT, typename WorkVectorT>
+void eigs_orthogonalize(MatrixT const& V, ::std::size_t j, VectorT& x, WorkVectorT& h, WorkVectorT& c)
+{
+    const ::std::size_t n = num_rows(V);
+    vector_range<WorkVectorT> hj(h, range(0, j));
+    vector_range<WorkVectorT> cj(c, range(0, j));
+
+    noalias(hj) = prod(herm(subrange(V, 0, n, 0, j)), x);
+    noalias(x) -= prod(subrange(V, 0, n, 0, j), hj);
+    noalias(cj) = prod(herm(subrange(V, 0, n, 0, j)), x);
+    noalias(x) -= prod(subrange(V, 0, n, 0, j), cj);
+    hj += cj;
+}
+
+
+/// Store the projection coefficients of the j-th Lanczos vector into the
+/// tridiagonal matrix \a H.
+template <typename HMatrixT, typename WorkVectorT>
+void eigs_store_projection(HMatrixT& H, WorkVectorT const& h, ::std::size_t j, ::boost::true_type)
+{
+    H(j,j) = ::std::real(h(j));
+}
+
+
+/// Store the projection coefficients of the j-th Arnoldi vector into the
+/// upper Hessenberg matrix \a H.
+template <typename HMatrixT, typename WorkVectorT>
+void eigs_store_projection(HMatrixT& H, WorkVectorT const& h, ::std::size_t j, ::boost::false_type)
+{
+    for (::std::size_t i = 0; i <= j; ++i)
+    {
+        H(i,j) = h(i);
+    }
+}
+
+
+/**
+ * \brief Extend the Arnoldi factorization \f$A V_k = V_k H_k + f e_k^T\f$
+ *  to \f$A V_m = V_m H_m + f e_m^T\f$.
+ *
+ * \a F is the n-by-1 matrix holding the residual vector \f$f\f$.
+ * For hermitian problems (\a HermitianT is \c true_type), only the
+ * tridiagonal part of \a H is built (Lanczos process).
+ * When an invariant subspace is found, the process is continued with a
+ * random vector orthogonal to the current basis.
+ */
+template <typename OperatorT, typename MatrixT, typename HMatrixT, typename FMatrixT, typename WorkVectorT, typename RNGT, typename HermitianT>
+void eigs_arnoldi(OperatorT& op, MatrixT& V, HMatrixT& H, FMatrixT& F, ::std::size_t k, ::std::size_t m, WorkVectorT& h, WorkVectorT& c, RNGT& rng, HermitianT hermitian)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    const ::std::size_t n = num_rows(V);
+    const real_type eps = ::std::numeric_limits<real_type>::epsilon();
+
+    matrix_column<FMatrixT> f(F, 0);
+
+    for (::std::size_t j = k; j < m; ++j)
+    {
+        matrix_column<MatrixT> v(V, j);
+
+        if (j == 0)
+        {
+            svds_random_orthonormal(V, 0, v, h, rng);
+        }
+        else
+        {
+            real_type beta = norm_2(f);
+            if (beta <= eps*norm_frobenius(subrange(H, 0, j, 0, j)))
+            {
+                beta = 0;
+                svds_random_orthonormal(V, j, v, h, rng);
+            }
+            else
+            {
+                noalias(v) = f/beta;
+            }
+            H(j,j-1) = beta;
+            if (HermitianT::value)
+            {
+                H(j-1,j) = beta;
+            }
+        }
+
+        matrix_range<MatrixT> Vj(V, range(0, n), range(j, j+1));
+
+        // f = (I - V_j V_j^H) A v_j
+        op(Vj, F);
+        eigs_orthogonalize(V, j+1, f, h, c);
+        eigs_store_projection(H, h, j, hermitian);
+    }
+}
+
+
+/**
+ * \brief Compute the Givens rotation
+ *  \f$G = \begin{pmatrix} c & s \\ -\bar{s} & c \end{pmatrix}\f$, with real
+ *  \f$c\f$, such that the second component of \f$G (a, b)^T\f$ is zero.
+ */
+template <typename ValueT>
+void eigs_givens(ValueT a, ValueT b, typename type_traits<ValueT>::real_type& c, ValueT& s)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    const real_type abs_a = ::std::abs(a);
+    const real_type abs_b = ::std::abs(b);
+
+    if (abs_b == 0)
+    {
+        c = 1;
+        s = 0;
+    }
+    else if (abs_a == 0)
+    {
+        c = 0;
+        s = 1;
+    }
+    else
+    {
+        const real_type r = ::std::sqrt(abs_a*abs_a + abs_b*abs_b);
+
+        c = abs_a/r;
+        s = (a/abs_a)*type_traits<ValueT>::conj(b)/r;
+    }
+}
+
+
+/// Apply the Givens rotation \f$G\f$ to rows \a i and \a i+1 of \a A, in the
+/// columns from \a j0 to \a j1 (excluded).
+template <typename MatrixT, typename RealT, typename ValueT>
+void eigs_rotate_rows(MatrixT& A, ::std::size_t i, RealT c, ValueT s, ::std::size_t j0, ::std::size_t j1)
+{
+    for (::std::size_t j = j0; j < j1; ++j)
+    {
+        const ValueT x = A(i,j);
+        const ValueT y = A(i+1,j);
+
+        A(i,j) = c*x + s*y;
+        A(i+1,j) = c*y - type_traits<ValueT>::conj(s)*x;
+    }
+}
+
+
+/// Apply the Givens rotation \f$G^H\f$ to columns \a j and \a j+1 of \a A,
+/// in the rows from \a i0 to \a i1 (excluded).
+template <typename MatrixT, typename RealT, typename ValueT>
+void eigs_rotate_columns(MatrixT& A, ::std::size_t j, RealT c, ValueT s, ::std::size_t i0, ::std::size_t i1)
+{
+    for (::std::size_t i = i0; i < i1; ++i)
+    {
+        const ValueT x = A(i,j);
+        const ValueT y = A(i,j+1);
+
+        A(i,j) = c*x + type_traits<ValueT>::conj(s)*y;
+        A(i,j+1) = c*y - s*x;
+    }
+}
+
+
+/**
+ * \brief Apply a step of the QR iteration to the upper Hessenberg matrix
+ *  \a H with shift \a mu: \f$H - \mu I = QR\f$, \f$H \gets RQ + \mu I = Q^H H Q\f$
+ *  and \f$Q_{acc} \gets Q_{acc} Q\f$.
+ *
+ * \f$Q\f$ is the product of \f$m-1\f$ Givens rotations, so that the step
+ * costs \f$O(m^2)\f$ operations.
+ */
+template <typename HMatrixT, typename ValueT>
+void eigs_shift(HMatrixT& H, ValueT mu, HMatrixT& Qacc)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    const ::std::size_t m = num_rows(H);
+
+    ::std::vector<real_type> c(m);
+    ::std::vector<ValueT> s(m);
+
+    for (::std::size_t i = 0; i < m; ++i)
+    {
+        H(i,i) -= mu;
+    }
+    // H - mu I = QR
+    for (::std::size_t i = 0; i+1 < m; ++i)
+    {
+        eigs_givens(ValueT(H(i,i)), ValueT(H(i+1,i)), c[i], s[i]);
+        eigs_rotate_rows(H, i, c[i], s[i], i, m);
+        H(i+1,i) = 0;
+    }
+    // RQ is upper Hessenberg
+    for (::std::size_t i = 0; i+1 < m; ++i)
+    {
+        eigs_rotate_columns(H, i, c[i], s[i], 0, i+2);
+        eigs_rotate_columns(Qacc, i, c[i], s[i], 0, m);
+    }
+    for (::std::size_t i = 0; i < m; ++i)
+    {
+        H(i,i) += mu;
+    }
+}
+
+
+/**
+ * \brief Apply a double step of the QR iteration to the real upper
+ *  Hessenberg matrix \a H with the complex conjugate shifts \f$\mu\f$ and
+ *  \f$\bar{\mu}\f$, in real arithmetic.
+ *
+ * This is the Francis double shift step
+ * \f$(H - \mu I)(H - \bar{\mu} I) = H^2 - 2\Re(\mu) H + |\mu|^2 I = QR\f$,
+ * \f$H \gets Q^T H Q\f$ and \f$Q_{acc} \gets Q_{acc} Q\f$, carried out by
+ * chasing the bulge with Householder reflectors of order 3.
+ * The order of \a H must be at least 3.
+ */
+template <typename HMatrixT, typename RealT>
+void eigs_double_shift(HMatrixT& H, ::std::complex<RealT> mu, HMatrixT& Qacc)
+{
+    const ::std::size_t m = num_rows(H);
+    const RealT sr = 2*mu.real();
+    const RealT t = ::std::norm(mu);
+
+    // First column of the shifted matrix
+    RealT x = H(0,0)*H(0,0) + H(0,1)*H(1,0) - sr*H(0,0) + t;
+    RealT y = H(1,0)*(H(0,0) + H(1,1) - sr);
+    RealT z = H(1,0)*H(2,1);
+
+    for (::std::size_t k = 0; k+2 < m; ++k)
+    {
+        const RealT nrm = ::std::sqrt(x*x + y*y + z*z);
+
+        if (nrm != 0)
+        {
+            // P = I - tau v v^T maps (x,y,z) onto a multiple of e_1
+            const RealT v0 = x - ((x >= 0) ? -nrm : nrm);
+            const RealT tau = 2/(v0*v0 + y*y + z*z);
+            const ::std::size_t j0 = (k > 0) ? k-1 : 0;
+            const ::std::size_t i1 = ::std::min(k+4, m);
+
+            for (::std::size_t j = j0; j < m; ++j)
+            {
+                const RealT d = tau*(v0*H(k,j) + y*H(k+1,j) + z*H(k+2,j));
+
+                H(k,j) -= d*v0;
+                H(k+1,j) -= d*y;
+                H(k+2,j) -= d*z;
+            }
+            for (::std::size_t i = 0; i < i1; ++i)
+            {
+                const RealT d = tau*(H(i,k)*v0 + H(i,k+1)*y + H(i,k+2)*z);
+
+                H(i,k) -= d*v0;
+                H(i,k+1) -= d*y;
+                H(i,k+2) -= d*z;
+            }
+            for (::std::size_t i = 0; i < m; ++i)
+            {
+                const RealT d = tau*(Qacc(i,k)*v0 + Qacc(i,k+1)*y + Qacc(i,k+2)*z);
+
+                Qacc(i,k) -= d*v0;
+                Qacc(i,k+1) -= d*y;
+                Qacc(i,k+2) -= d*z;
+            }
+        }
+
+        // Chase the bulge
+        x = H(k+1,k);
+        y = H(k+2,k);
+        z = (k+3 < m) ? H(k+3,k) : RealT(0);
+    }
+
+    // Last rotation
+    RealT c;
+    RealT s;
+
+    eigs_givens(x, y, c, s);
+    eigs_rotate_rows(H, m-2, c, s, m-3, m);
+    eigs_rotate_columns(H, m-2, c, s, 0, m);
+    eigs_rotate_columns(Qacc, m-2, c, s, 0, m);
+}
+
+
+/// Compute \f$Y = V Z\f$ where \a V and \a Z have the same value type.
+template <typename VMatrixT, typename ZMatrixExprT, typename YMatrixT, typename ComplexT>
+void eigs_prod(VMatrixT const& V, ZMatrixExprT const& Z, YMatrixT& Y, ComplexT, ComplexT)
+{
+    svds_prod(V, Z, Y);
+}
+
+
+/// Compute \f$Y = V Z\f$ where \a V is complex and \a Z is real.
+template <typename VMatrixT, typename ZMatrixExprT, typename YMatrixT>
+void eigs_prod(VMatrixT const& V, ZMatrixExprT const& Z, YMatrixT& Y, ::boost::true_type, ::boost::false_type)
+{
+    typedef typename matrix_traits<VMatrixT>::value_type value_type;
+
+    // Promote the (small) real factor to complex
+    matrix<value_type, column_major> Zc(Z);
+
+    svds_prod(V, Zc, Y);
+}
+
+
+/// Compute \f$Y = V Z\f$ where \a V is real and \a Z is complex.
+template <typename VMatrixT, typename ZMatrixExprT, typename YMatrixT>
+void eigs_prod(VMatrixT const& V, ZMatrixExprT const& Z, YMatrixT& Y, ::boost::false_type, ::boost::true_type)
+{
+    typedef typename matrix_traits<VMatrixT>::value_type real_type;
+    typedef typename matrix_traits<YMatrixT>::value_type complex_type;
+
+    const ::std::size_t n = num_rows(V);
+    const ::std::size_t k = num_columns(Z);
+
+    // Multiply the real and the imaginary parts separately in real
+    // arithmetic
+    matrix<real_type, column_major> Zr(real(Z));
+    matrix<real_type, column_major> Yr(n, k);
+    matrix<real_type, column_major> Yi(n, k);
+
+    svds_prod(V, Zr, Yr);
+    Zr = imag(Z);
+    svds_prod(V, Zr, Yi);
+    for (::std::size_t j = 0; j < k; ++j)
+    {
+        for (::std::size_t i = 0; i < n; ++i)
+        {
+            Y(i,j) = complex_type(Yr(i,j), Yi(i,j));
+        }
+    }
+}
+
+
+/// Compute \f$Y = V Z\f$, where \a V and \a Z can be one real and the
+/// other complex.
+template <typename VMatrixT, typename ZMatrixExprT, typename YMatrixT>
+void eigs_prod(VMatrixT const& V, ZMatrixExprT const& Z, YMatrixT& Y)
+{
+    eigs_prod(V,
+              Z,
+              Y,
+              ::boost::is_complex<typename matrix_traits<VMatrixT>::value_type>(),
+              ::boost::is_complex<typename matrix_traits<ZMatrixExprT>::value_type>());
+}
+
+
+/**
+ * \brief Truncate the Arnoldi factorization of length \f$m\f$ to length
+ *  \a k after the shifts have been applied to the projected matrix.
+ *
+ * \f$V_k \gets V_m Q_{acc}(:,1{:}k)\f$ and
+ * \f$f \gets V_m Q_{acc}(:,k+1) \beta_k + f Q_{acc}(m,k)\f$, where
+ * \f$\beta_k\f$ is the element \f$(k+1,k)\f$ of the shifted projected
+ * matrix.
+ * \a W is a scratch matrix.
+ */
+template <typename MatrixT, typename QMatrixT, typename BetaT, typename FMatrixT>
+void eigs_truncate(MatrixT& V, QMatrixT const& Qacc, BetaT beta_k, FMatrixT& F, ::std::size_t k, MatrixT& W)
+{
+    const ::std::size_t n = num_rows(V);
+    const ::std::size_t m = num_columns(V);
+
+    if (num_rows(W) != n || num_columns(W) != k+1)
+    {
+        W.resize(n, k+1, false);
+    }
+    eigs_prod(V, subrange(Qacc, 0, m, 0, k+1), W);
+
+    matrix_column<FMatrixT> f(F, 0);
+
+    f *= Qacc(m-1,k-1);
+    noalias(f) += beta_k*column(W, k);
+    noalias(subrange(V, 0, n, 0, k)) = subrange(W, 0, n, 0, k);
+}
+
+
+/// Order the Ritz values from the most wanted to the least wanted.
+template <typename VectorT>
+struct eigs_ritz_order
+{
+    eigs_ritz_order(VectorT const& theta, eigs_which which)
+        : theta_(theta),
+          which_(which)
+    {
+    }
+
+    bool operator()(::std::size_t i, ::std::size_t j) const
+    {
+        switch (which_)
+        {
+            case largest_real_eigs:
+                return ::std::real(theta_(i)) > ::std::real(theta_(j));
+            case smallest_real_eigs:
+                return ::std::real(theta_(i)) < ::std::real(theta_(j));
+            case largest_magnitude_eigs:
+            default:
+                return ::std::abs(theta_(i)) > ::std::abs(theta_(j));
+        }
+    }
+
+    VectorT const& theta_;
+    eigs_which which_;
+};
+
+
+/// Sort the indices of the Ritz values \a theta from the most wanted to the
+/// least wanted.
+template <typename VectorT>
+void eigs_sort(VectorT const& theta, eigs_which which, ::std::vector< ::std::size_t >& order)
+{
+    order.resize(size(theta));
+    for (::std::size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    // Stable, so that complex conjugate pairs stay adjacent
+    ::std::stable_sort(order.begin(), order.end(), eigs_ritz_order<VectorT>(theta, which));
+}
+
+
+/// Number of converged Ritz pairs among the first \a k wanted ones.
+template <typename VectorT, typename MatrixT, typename RealT>
+::std::size_t eigs_num_converged(VectorT const& theta, MatrixT const& Y, ::std::vector< ::std::size_t > const& order, ::std::size_t k, RealT beta, RealT tol)
+{
+    const ::std::size_t m = num_rows(Y);
+    const RealT eps23 = ::std::pow(::std::numeric_limits<RealT>::epsilon(), RealT(2)/RealT(3));
+
+    ::std::size_t nconv = 0;
+    for (::std::size_t i = 0; i < k; ++i)
+    {
+        // The residual norm of the Ritz pair is |beta e_m^T y|
+        if (beta*::std::abs(Y(m-1,order[i])) <= tol*::std::max(eps23, RealT(::std::abs(theta(order[i])))))
+        {
+            ++nconv;
+        }
+    }
+
+    return nconv;
+}
+
+
+/// Size of the Krylov subspace for \a k eigenpairs of a n-by-n matrix, given
+/// the requested size \a ncv (0 for the default).
+inline ::std::size_t eigs_subspace_size(::std::size_t n, ::std::size_t k, ::std::size_t ncv)
+{
+    if (ncv == 0)
+    {
+        ncv = ::std::max(2*k+1, ::std::size_t(20));
+    }
+
+    return ::std::min(::std::max(ncv, k+1), n);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Computes a few eigenpairs of a symmetric (real case) or hermitian
+ *  (complex case) matrix by the implicitly restarted Lanczos method.
+ *
+ * Computes an approximation of the \f$k\f$ eigenvalues of a n-by-n
+ * symmetric/hermitian matrix \f$A\f$ at the end of the spectrum selected by
+ * an \c eigs_which value, together with the associated orthonormal
+ * eigenvectors.
+ * Since \f$A\f$ is only accessed through the products \f$A x\f$, it can be
+ * any matrix expression whose product is the one of a symmetric/hermitian
+ * matrix (e.g., a full dense or sparse matrix, or a \c symmetric_matrix),
+ * or a user function computing them.
+ *
+ * The Ritz pair \f$(\theta, x)\f$ is considered converged when the norm of
+ * its residual \f$\|Ax - \theta x\|\f$ is not greater than
+ * \f$\tau \max(\epsilon^{2/3}, |\theta|)\f$, where \f$\tau\f$ is the
+ * tolerance (the machine epsilon by default).
+ * If not all eigenpairs converge within the maximum number of restarts, the
+ * best approximations are returned and \c num_converged() tells how many of
+ * them did converge.
+ *
+ * \tparam ValueT The type of the elements of the matrix to decompose.
+ */
+template <typename ValueT>
+class eigsh_decomposition
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef vector<real_type> vector_type;
+    public: typedef matrix<value_type, column_major> matrix_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef matrix<real_type, column_major> real_matrix_type;
+    private: typedef symmetric_matrix<real_type, lower, column_major> symmetric_matrix_type;
+    private: typedef vector<value_type> work_vector_type;
+    private: typedef ::boost::random::mt19937 random_generator_type;
+
+
+    /// Default constructor
+    public: eigsh_decomposition()
+        : ncv_(0),
+          max_restarts_(300),
+          tol_(::std::numeric_limits<real_type>::epsilon()),
+          seed_(5489UL),
+          nconv_(0),
+          nrestarts_(0)
+    {
+    }
+
+
+    /// A constructor.
+    public: template <typename MatrixExprT>
+        eigsh_decomposition(matrix_expression<MatrixExprT> const& A, size_type k, eigs_which which = largest_magnitude_eigs)
+        : ncv_(0),
+          max_restarts_(300),
+          tol_(::std::numeric_limits<real_type>::epsilon()),
+          seed_(5489UL),
+          nconv_(0),
+          nrestarts_(0)
+    {
+        decompose(A, k, which);
+    }
+
+
+    /// Set the dimension of the Krylov subspace (default: 0, which means
+    /// \f$\max(2k+1,20)\f$).
+    public: void subspace_size(size_type ncv)
+    {
+        ncv_ = ncv;
+    }
+
+
+    /// Return the dimension of the Krylov subspace (0 for the default).
+    public: size_type subspace_size() const
+    {
+        return ncv_;
+    }
+
+
+    /// Set the maximum number of restarts (default: 300).
+    public: void max_restarts(size_type n)
+    {
+        max_restarts_ = n;
+    }
+
+
+    /// Return the maximum number of restarts.
+    public: size_type max_restarts() const
+    {
+        return max_restarts_;
+    }
+
+
+    /// Set the relative tolerance of the convergence test (default: machine
+    /// epsilon).
+    public: void tolerance(real_type tol)
+    {
+        tol_ = tol;
+    }
+
+
+    /// Return the relative tolerance of the convergence test.
+    public: real_type tolerance() const
+    {
+        return tol_;
+    }
+
+
+    /// Set the seed of the random number generator of the starting vector.
+    public: void seed(unsigned long s)
+    {
+        seed_ = s;
+    }
+
+
+    /// Return the seed of the random number generator of the starting
+    /// vector.
+    public: unsigned long seed() const
+    {
+        return seed_;
+    }
+
+
+    /**
+     * \brief Compute \a k eigenpairs of the symmetric/hermitian matrix \a A.
+     *
+     * \param A The matrix to decompose.
+     * \param k The number of eigenpairs to compute; it is reduced to the
+     *  order of \a A if greater.
+     * \param which The part of the spectrum to compute.
+     */
+    public: template <typename MatrixExprT>
+        void decompose(matrix_expression<MatrixExprT> const& A, size_type k, eigs_which which = largest_magnitude_eigs)
+    {
+        BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_argument() );
+
+        detail::eigs_matrix_operator<MatrixExprT> op(A());
+
+        lanczos(op, num_rows(A), k, which);
+    }
+
+
+    /**
+     * \brief Compute \a k eigenpairs of the n-by-n symmetric/hermitian matrix
+     *  \f$A\f$ given by the function \a f.
+     *
+     * \param f The function computing the product \f$y = A x\f$ when called
+     *  as <code>f(x,y)</code>, where \c x and \c y are
+     *  <code>vector<value_type></code> of size \a n.
+     * \param n The order of the matrix.
+     * \param k The number of eigenpairs to compute; it is reduced to \a n if
+     *  greater.
+     * \param which The part of the spectrum to compute.
+     */
+    public: template <typename FunctorT>
+        typename ::boost::disable_if<
+            ::boost::is_base_of<matrix_expression<FunctorT>, FunctorT>,
+            void
+        >::type decompose(FunctorT f, size_type n, size_type k, eigs_which which = largest_magnitude_eigs)
+    {
+        detail::eigs_function_operator<FunctorT,value_type> op(f, n);
+
+        lanczos(op, n, k, which);
+    }
+
+
+    /// Return the vector of the computed eigenvalues, from the most wanted to
+    /// the least wanted.
+    public: vector_type const& eigenvalues() const
+    {
+        return w_;
+    }
+
+
+    /// Return the matrix of the computed eigenvectors (each eigenvector is
+    /// stored column-wise).
+    public: matrix_type const& eigenvectors() const
+    {
+        return X_;
+    }
+
+
+    /// Return the number of converged eigenpairs.
+    public: size_type num_converged() const
+    {
+        return nconv_;
+    }
+
+
+    /// Return the number of restarts performed.
+    public: size_type num_restarts() const
+    {
+        return nrestarts_;
+    }
+
+
+    /**
+     * \brief Implicitly restarted Lanczos method.
+     *
+     * \c V_ and \c F_ hold the Lanczos vectors and the residual vector, and
+     * \c T_ the real symmetric tridiagonal projected matrix.
+     */
+    private: template <typename OperatorT>
+        void lanczos(OperatorT& op, size_type n, size_type k, eigs_which which)
+    {
+        k = ::std::min(k, n);
+
+        nconv_ = 0;
+        nrestarts_ = 0;
+        if (k == 0)
+        {
+            w_.resize(0, false);
+            X_.resize(n, 0, false);
+            return;
+        }
+
+        const size_type m = detail::eigs_subspace_size(n, k, ncv_);
+
+        rng_.seed(static_cast<random_generator_type::result_type>(seed_));
+
+        V_.resize(n, m, false);
+        F_.resize(n, 1, false);
+        T_.resize(m, m, false);
+        T_.clear();
+        S_.resize(m, m, false);
+        h_.resize(m, false);
+        c_.resize(m, false);
+
+        size_type kk = 0;
+        while (true)
+        {
+            detail::eigs_arnoldi(op, V_, T_, F_, kk, m, h_, c_, rng_, ::boost::true_type());
+
+            // Ritz pairs
+            for (size_type j = 0; j < m; ++j)
+            {
+                for (size_type i = j; i < m; ++i)
+                {
+                    S_(i,j) = T_(i,j);
+                }
+            }
+            eigen(S_, theta_, Y_, eigen_ws_);
+            detail::eigs_sort(theta_, which, order_);
+
+            const real_type beta = norm_2(column(F_, 0));
+
+            nconv_ = detail::eigs_num_converged(theta_, Y_, order_, k, beta, tol_);
+            if (nconv_ >= k || nrestarts_ >= max_restarts_ || m == n)
+            {
+                break;
+            }
+
+            // Keep some more Ritz vectors as the wanted ones converge, to
+            // speed up the convergence of the others
+            kk = k + ::std::min(nconv_, (m-k)/2);
+
+            // Apply the unwanted Ritz values as exact shifts
+            Q_ = identity_matrix<real_type>(m);
+            for (size_type i = kk; i < m; ++i)
+            {
+                detail::eigs_shift(T_, theta_(order_[i]), Q_);
+            }
+            // Restore the symmetric tridiagonal structure lost to rounding
+            for (size_type j = 0; j < m; ++j)
+            {
+                for (size_type i = 0; i < m; ++i)
+                {
+                    if (i > j+1 || j > i+1)
+                    {
+                        T_(i,j) = 0;
+                    }
+                }
+                if (j+1 < m)
+                {
+                    T_(j,j+1) = T_(j+1,j);
+                }
+            }
+
+            detail::eigs_truncate(V_, Q_, T_(kk,kk-1), F_, kk, W_);
+
+            ++nrestarts_;
+        }
+
+        // Ritz vectors of the wanted Ritz values
+        w_.resize(k, false);
+        Z_.resize(m, k, false);
+        for (size_type i = 0; i < k; ++i)
+        {
+            w_(i) = theta_(order_[i]);
+            column(Z_, i) = column(Y_, order_[i]);
+        }
+        X_.resize(n, k, false);
+        detail::eigs_prod(V_, Z_, X_);
+    }
+
+
+    /// The requested dimension of the Krylov subspace.
+    private: size_type ncv_;
+    /// The maximum number of restarts.
+    private: size_type max_restarts_;
+    /// The relative tolerance of the convergence test.
+    private: real_type tol_;
+    /// The seed of the random number generator.
+    private: unsigned long seed_;
+    /// The number of converged eigenpairs.
+    private: size_type nconv_;
+    /// The number of restarts performed.
+    private: size_type nrestarts_;
+    /// The random number generator.
+    private: random_generator_type rng_;
+    /// The vector of eigenvalues.
+    private: vector_type w_;
+    /// The matrix of eigenvectors.
+    private: matrix_type X_;
+    /// The Lanczos vectors.
+    private: matrix_type V_;
+    /// The residual vector (as a n-by-1 matrix).
+    private: matrix_type F_;
+    /// The scratch matrix for the restarted Lanczos vectors.
+    private: matrix_type W_;
+    /// The projected tridiagonal matrix.
+    private: real_matrix_type T_;
+    /// The projected matrix as a symmetric matrix.
+    private: symmetric_matrix_type S_;
+    /// The Ritz values.
+    private: vector_type theta_;
+    /// The eigenvectors of the projected matrix.
+    private: real_matrix_type Y_;
+    /// The wanted eigenvectors of the projected matrix.
+    private: real_matrix_type Z_;
+    /// The accumulated orthogonal transformation of the restart.
+    private: real_matrix_type Q_;
+    /// The indices of the Ritz values from the most to the least wanted.
+    private: ::std::vector<size_type> order_;
+    /// The scratch vectors of the reorthogonalization coefficients.
+    private: work_vector_type h_;
+    private: work_vector_type c_;
+    /// The workspace of the eigendecomposition of the projected matrix.
+    private: eigen_workspace<real_type> eigen_ws_;
+};
+
+
+/**
+ * \brief Computes a few eigenpairs of a general matrix by the implicitly
+ *  restarted Arnoldi method.
+ *
+ * Computes an approximation of the \f$k\f$ eigenvalues of a n-by-n matrix
+ * \f$A\f$ at the end of the spectrum selected by an \c eigs_which value,
+ * together with the associated (right) eigenvectors, normalized to unit
+ * 2-norm.
+ * Since the eigenpairs of a real matrix can be complex, the eigenvalues and
+ * the eigenvectors are always complex; for real matrices, the restart is
+ * carried out in real arithmetic by applying complex conjugate shifts in
+ * pairs.
+ *
+ * The convergence test is the same as the one of \c eigsh_decomposition.
+ *
+ * \tparam ValueT The type of the elements of the matrix to decompose.
+ */
+template <typename ValueT>
+class eigs_decomposition
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::complex<real_type> complex_type;
+    public: typedef vector<complex_type> vector_type;
+    public: typedef matrix<complex_type, column_major> matrix_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef matrix<value_type, column_major> work_matrix_type;
+    private: typedef vector<value_type> work_vector_type;
+    private: typedef ::boost::random::mt19937 random_generator_type;
+
+
+    /// Default constructor
+    public: eigs_decomposition()
+        : ncv_(0),
+          max_restarts_(300),
+          tol_(::std::numeric_limits<real_type>::epsilon()),
+          seed_(5489UL),
+          nconv_(0),
+          nrestarts_(0)
+    {
+    }
+
+
+    /// A constructor.
+    public: template <typename MatrixExprT>
+        eigs_decomposition(matrix_expression<MatrixExprT> const& A, size_type k, eigs_which which = largest_magnitude_eigs)
+        : ncv_(0),
+          max_restarts_(300),
+          tol_(::std::numeric_limits<real_type>::epsilon()),
+          seed_(5489UL),
+          nconv_(0),
+          nrestarts_(0)
+    {
+        decompose(A, k, which);
+    }
+
+
+    /// Set the dimension of the Krylov subspace (default: 0, which means
+    /// \f$\max(2k+1,20)\f$).
+    public: void subspace_size(size_type ncv)
+    {
+        ncv_ = ncv;
+    }
+
+
+    /// Return the dimension of the Krylov subspace (0 for the default).
+    public: size_type subspace_size() const
+    {
+        return ncv_;
+    }
+
+
+    /// Set the maximum number of restarts (default: 300).
+    public: void max_restarts(size_type n)
+    {
+        max_restarts_ = n;
+    }
+
+
+    /// Return the maximum number of restarts.
+    public: size_type max_restarts() const
+    {
+        return max_restarts_;
+    }
+
+
+    /// Set the relative tolerance of the convergence test (default: machine
+    /// epsilon).
+    public: void tolerance(real_type tol)
+    {
+        tol_ = tol;
+    }
+
+
+    /// Return the relative tolerance of the convergence test.
+    public: real_type tolerance() const
+    {
+        return tol_;
+    }
+
+
+    /// Set the seed of the random number generator of the starting vector.
+    public: void seed(unsigned long s)
+    {
+        seed_ = s;
+    }
+
+
+    /// Return the seed of the random number generator of the starting
+    /// vector.
+    public: unsigned long seed() const
+    {
+        return seed_;
+    }
+
+
+    /**
+     * \brief Compute \a k eigenpairs of the matrix \a A.
+     *
+     * \param A The matrix to decompose.
+     * \param k The number of eigenpairs to compute; it is reduced to the
+     *  order of \a A if greater.
+     * \param which The part of the spectrum to compute.
+     */
+    public: template <typename MatrixExprT>
+        void decompose(matrix_expression<MatrixExprT> const& A, size_type k, eigs_which which = largest_magnitude_eigs)
+    {
+        BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_argument() );
+
+        detail::eigs_matrix_operator<MatrixExprT> op(A());
+
+        arnoldi(op, num_rows(A), k, which);
+    }
+
+
+    /**
+     * \brief Compute \a k eigenpairs of the n-by-n matrix \f$A\f$ given by the
+     *  function \a f.
+     *
+     * \param f The function computing the product \f$y = A x\f$ when called
+     *  as <code>f(x,y)</code>, where \c x and \c y are
+     *  <code>vector<value_type></code> of size \a n.
+     * \param n The order of the matrix.
+     * \param k The number of eigenpairs to compute; it is reduced to \a n if
+     *  greater.
+     * \param which The part of the spectrum to compute.
+     */
+    public: template <typename FunctorT>
+        typename ::boost::disable_if<
+            ::boost::is_base_of<matrix_expression<FunctorT>, FunctorT>,
+            void
+        >::type decompose(FunctorT f, size_type n, size_type k, eigs_which which = largest_magnitude_eigs)
+    {
+        detail::eigs_function_operator<FunctorT,value_type> op(f, n);
+
+        arnoldi(op, n, k, which);
+    }
+
+
+    /// Return the vector of the computed eigenvalues, from the most wanted to
+    /// the least wanted.
+    public: vector_type const& eigenvalues() const
+    {
+        return w_;
+    }
+
+
+    /// Return the matrix of the computed eigenvectors (each eigenvector is
+    /// stored column-wise).
+    public: matrix_type const& eigenvectors() const
+    {
+        return X_;
+    }
+
+
+    /// Return the number of converged eigenpairs.
+    public: size_type num_converged() const
+    {
+        return nconv_;
+    }
+
+
+    /// Return the number of restarts performed.
+    public: size_type num_restarts() const
+    {
+        return nrestarts_;
+    }
+
+
+    /**
+     * \brief Implicitly restarted Arnoldi method.
+     *
+     * \c V_ and \c F_ hold the Arnoldi vectors and the residual vector, and
+     * \c H_ the upper Hessenberg projected matrix.
+     */
+    private: template <typename OperatorT>
+        void arnoldi(OperatorT& op, size_type n, size_type k, eigs_which which)
+    {
+        k = ::std::min(k, n);
+
+        nconv_ = 0;
+        nrestarts_ = 0;
+        if (k == 0)
+        {
+            w_.resize(0, false);
+            X_.resize(n, 0, false);
+            return;
+        }
+
+        const size_type m = detail::eigs_subspace_size(n, k, ncv_);
+
+        rng_.seed(static_cast<random_generator_type::result_type>(seed_));
+
+        V_.resize(n, m, false);
+        F_.resize(n, 1, false);
+        H_.resize(m, m, false);
+        H_.clear();
+        h_.resize(m, false);
+        c_.resize(m, false);
+
+        size_type kk = 0;
+        while (true)
+        {
+            detail::eigs_arnoldi(op, V_, H_, F_, kk, m, h_, c_, rng_, ::boost::false_type());
+
+            // Ritz pairs
+            detail::eigen_impl(H_, detail::right_eigenvectors, theta_, LY_, Y_, eigen_ws_);
+            detail::eigs_sort(theta_, which, order_);
+
+            const real_type beta = norm_2(column(F_, 0));
+
+            nconv_ = detail::eigs_num_converged(theta_, Y_, order_, k, beta, tol_);
+            if (nconv_ >= k || nrestarts_ >= max_restarts_ || m == n)
+            {
+                break;
+            }
+
+            kk = k + ::std::min(nconv_, (m-k)/2);
+            // Do not split a complex conjugate pair of Ritz values of a real
+            // matrix between the wanted and the unwanted ones
+            if (!::boost::is_complex<value_type>::value
+                && theta_(order_[kk-1]).imag() != 0
+                && theta_(order_[kk]) == ::std::conj(theta_(order_[kk-1])))
+            {
+                kk = (kk+1 < m) ? kk+1 : kk-1;
+            }
+            if (kk == 0)
+            {
+                // Only a conjugate pair fits in the subspace: restart
+                // explicitly from the Ritz vector of the most wanted value
+                break;
+            }
+
+            // Apply the unwanted Ritz values as exact shifts
+            Q_ = identity_matrix<value_type>(m);
+            for (size_type i = kk; i < m; ++i)
+            {
+                apply_shift(theta_(order_[i]), ::boost::is_complex<value_type>());
+            }
+            // Restore the upper Hessenberg structure lost to rounding
+            for (size_type j = 0; j < m; ++j)
+            {
+                for (size_type i = j+2; i < m; ++i)
+                {
+                    H_(i,j) = 0;
+                }
+            }
+
+            detail::eigs_truncate(V_, Q_, H_(kk,kk-1), F_, kk, W_);
+
+            ++nrestarts_;
+        }
+
+        // Ritz vectors of the wanted Ritz values
+        w_.resize(k, false);
+        Z_.resize(m, k, false);
+        for (size_type i = 0; i < k; ++i)
+        {
+            w_(i) = theta_(order_[i]);
+            column(Z_, i) = column(Y_, order_[i]);
+        }
+        X_.resize(n, k, false);
+        detail::eigs_prod(V_, Z_, X_);
+    }
+
+
+    /// Apply a shift to the projected matrix (real case).
+    private: void apply_shift(complex_type mu, ::boost::false_type)
+    {
+        if (mu.imag() == 0)
+        {
+            detail::eigs_shift(H_, value_type(mu.real()), Q_);
+        }
+        else if (mu.imag() > 0)
+        {
+            // The conjugate shift is applied together with this one
+            detail::eigs_double_shift(H_, mu, Q_);
+        }
+    }
+
+
+    /// Apply a shift to the projected matrix (complex case).
+    private: void apply_shift(complex_type mu, ::boost::true_type)
+    {
+        detail::eigs_shift(H_, value_type(mu), Q_);
+    }
+
+
+    /// The requested dimension of the Krylov subspace.
+    private: size_type ncv_;
+    /// The maximum number of restarts.
+    private: size_type max_restarts_;
+    /// The relative tolerance of the convergence test.
+    private: real_type tol_;
+    /// The seed of the random number generator.
+    private: unsigned long seed_;
+    /// The number of converged eigenpairs.
+    private: size_type nconv_;
+    /// The number of restarts performed.
+    private: size_type nrestarts_;
+    /// The random number generator.
+    private: random_generator_type rng_;
+    /// The vector of eigenvalues.
+    private: vector_type w_;
+    /// The matrix of eigenvectors.
+    private: matrix_type X_;
+    /// The Arnoldi vectors.
+    private: work_matrix_type V_;
+    /// The residual vector (as a n-by-1 matrix).
+    private: work_matrix_type F_;
+    /// The scratch matrix for the restarted Arnoldi vectors.
+    private: work_matrix_type W_;
+    /// The projected upper Hessenberg matrix.
+    private: work_matrix_type H_;
+    /// The Ritz values.
+    private: vector_type theta_;
+    /// The (unused) left eigenvectors of the projected matrix.
+    private: matrix_type LY_;
+    /// The eigenvectors of the projected matrix.
+    private: matrix_type Y_;
+    /// The wanted eigenvectors of the projected matrix.
+    private: matrix_type Z_;
+    /// The accumulated unitary transformation of the restart.
+    private: work_matrix_type Q_;
+    /// The indices of the Ritz values from the most to the least wanted.
+    private: ::std::vector<size_type> order_;
+    /// The scratch vectors of the reorthogonalization coefficients.
+    private: work_vector_type h_;
+    private: work_vector_type c_;
+    /// The workspace of the eigendecomposition of the projected matrix.
+    private: eigen_workspace<value_type> eigen_ws_;
+};
+
+
+/// Compute \a k eigenvalues of the symmetric/hermitian matrix \a A.
+template <typename MatrixExprT>
+vector<
+    typename type_traits<
+        typename matrix_traits<MatrixExprT>::value_type
+    >::real_type
+> eigsh_values(matrix_expression<MatrixExprT> const& A, ::std::size_t k, eigs_which which = largest_magnitude_eigs)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    eigsh_decomposition<value_type> eigsh(A, k, which);
+
+    return eigsh.eigenvalues();
+}
+
+
+/// Compute \a k eigenpairs of the symmetric/hermitian matrix \a A.
+template <typename MatrixExprT>
+eigsh_decomposition<typename matrix_traits<MatrixExprT>::value_type> eigsh_decompose(matrix_expression<MatrixExprT> const& A, ::std::size_t k, eigs_which which = largest_magnitude_eigs)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return eigsh_decomposition<value_type>(A, k, which);
+}
+
+
+/// Compute \a k eigenvalues of the matrix \a A.
+template <typename MatrixExprT>
+vector<
+    ::std::complex<
+        typename type_traits<
+            typename matrix_traits<MatrixExprT>::value_type
+        >::real_type
+    >
+> eigs_values(matrix_expression<MatrixExprT> const& A, ::std::size_t k, eigs_which which = largest_magnitude_eigs)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    eigs_decomposition<value_type> eigs(A, k, which);
+
+    return eigs.eigenvalues();
+}
+
+
+/// Compute \a k eigenpairs of the matrix \a A.
+template <typename MatrixExprT>
+eigs_decomposition<typename matrix_traits<MatrixExprT>::value_type> eigs_decompose(matrix_expression<MatrixExprT> const& A, ::std::size_t k, eigs_which which = largest_magnitude_eigs)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return eigs_decomposition<value_type>(A, k, which);
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_EIGS_HPP
@@ -1,6 +1,6 @@
 /* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
 
-//FIXME: this function does not seem to work. Need more testing
+//FIXME: the legacy expm_pad function does not seem to work (expm is not affected). Need more testing
 
 //
 //  Copyright (c) 2007
@@ -43,10 +43,20 @@
 #define BOOST_NUMERIC_UBLASX_OPERATION_EXPM_HPP
 
 
+#include <boost/numeric/ublas/exception.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <cmath>
 #include <complex>
+#include <cstddef>
+#include <limits>
 #include <stdexcept>
 
 
@@ -56,6 +66,497 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief Workspace for the matrix exponential.
+ *
+ * Owns the scratch matrices used by \c expm (the scaled input, its even
+ * powers, the numerator and denominator of the Pad&eacute; approximant and a
+ * product buffer) and the pivots of the LU factorization, so that repeated
+ * exponentials of same-sized matrices do not allocate memory.
+ * The matrices are column-major, so that the linear system of the
+ * approximant is solved by LAPACK.
+ *
+ * \tparam ValueT The type of the elements of the matrices to exponentiate.
+ */
+template <typename ValueT>
+class expm_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef permutation_matrix<size_type> permutation_matrix_type;
+
+
+    /// Default constructor.
+    public: expm_workspace()
+        : n_(0),
+          P_(0)
+    {
+    }
+
+
+    /// Create a workspace for the exponential of \a n by \a n matrices.
+    public: explicit expm_workspace(size_type n)
+        : n_(0),
+          P_(0)
+    {
+        resize(n);
+    }
+
+
+    /// Prepare the workspace for the exponential of \a n by \a n matrices.
+    public: void resize(size_type n)
+    {
+        if (n == n_)
+        {
+            return;
+        }
+
+        A_.resize(n, n, false);
+        for (size_type k = 0; k < 4; ++k)
+        {
+            pow_[k].resize(n, n, false);
+        }
+        U_.resize(n, n, false);
+        V_.resize(n, n, false);
+        T_.resize(n, n, false);
+        P_.resize(n, false);
+
+        n_ = n;
+    }
+
+
+    /// Return the scratch matrix for the (scaled) input matrix.
+    public: work_matrix_type& scaled_matrix()
+    {
+        return A_;
+    }
+
+
+    /// Return the scratch matrix for the power \f$A^{2k}\f$, \f$k=1,\ldots,4\f$.
+    public: work_matrix_type& even_power(size_type k)
+    {
+        return pow_[k-1];
+    }
+
+
+    /// Return the scratch matrix for the odd part of the approximant.
+    public: work_matrix_type& U()
+    {
+        return U_;
+    }
+
+
+    /// Return the scratch matrix for the even part of the approximant (and
+    /// for the result).
+    public: work_matrix_type& V()
+    {
+        return V_;
+    }
+
+
+    /// Return the scratch matrix for products and for the LU factors.
+    public: work_matrix_type& T()
+    {
+        return T_;
+    }
+
+
+    /// Return the pivots of the LU factorization.
+    public: permutation_matrix_type& P()
+    {
+        return P_;
+    }
+
+
+    /// The order of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// The scratch matrix for the (scaled) input matrix.
+    private: work_matrix_type A_;
+    /// The scratch matrices for the powers A^2, A^4, A^6 and A^8.
+    private: work_matrix_type pow_[4];
+    /// The scratch matrix for the odd part of the approximant.
+    private: work_matrix_type U_;
+    /// The scratch matrix for the even part of the approximant.
+    private: work_matrix_type V_;
+    /// The scratch matrix for products and for the LU factors.
+    private: work_matrix_type T_;
+    /// The pivots of the LU factorization.
+    private: permutation_matrix_type P_;
+};
+
+
+namespace detail {
+
+/// The type of the matrix returned by \c expm.
+template <typename MatrixExprT>
+struct expm_traits
+{
+    typedef matrix<
+                typename matrix_traits<MatrixExprT>::value_type,
+                typename layout_type<MatrixExprT>::type
+            > result_type;
+};
+
+
+/**
+ * \brief The 1-norm bounds \f$\theta_m\f$ below which the Pad&eacute;
+ *  approximant of degree \f$m\f$ is accurate to the unit roundoff.
+ *
+ * Values from [1, Table 2.3]: for double precision the degrees are 3, 5, 7, 9
+ * and 13; for single precision 3, 5 and 7 are enough.
+ * Types more precise than \c double use the double precision bounds.
+ */
+template <typename RealT>
+struct expm_pade_bounds
+{
+    static bool single_precision()
+    {
+        return ::std::numeric_limits<RealT>::digits <= ::std::numeric_limits<float>::digits;
+    }
+
+    static ::std::size_t num_degrees()
+    {
+        return single_precision() ? 3 : 5;
+    }
+
+    static int degree(::std::size_t i)
+    {
+        static const int degrees[] = {3, 5, 7, 9, 13};
+
+        return degrees[i];
+    }
+
+    static RealT theta(::std::size_t i)
+    {
+        static const double double_thetas[] = {1.495585217958292e-2,
+                                               2.539398330063230e-1,
+                                               9.504178996162932e-1,
+                                               2.097847961257068e+0,
+                                               5.371920351148152e+0};
+        static const double single_thetas[] = {4.258730016922831e-1,
+                                               1.880152677804762e+0,
+                                               3.925724783138660e+0};
+
+        return static_cast<RealT>(single_precision() ? single_thetas[i] : double_thetas[i]);
+    }
+};
+
+
+/// The coefficients \f$b_0,\ldots,b_m\f$ of the Pad&eacute; approximant of degree \f$m\f$.
+inline double const* expm_pade_coefficients(int m)
+{
+    static const double b3[] = {120.0, 60.0, 12.0, 1.0};
+    static const double b5[] = {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0};
+    static const double b7[] = {17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0};
+    static const double b9[] = {17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0,
+                                2162160.0, 110880.0, 3960.0, 90.0, 1.0};
+    static const double b13[] = {64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+                                 1187353796428800.0, 129060195264000.0, 10559470521600.0,
+                                 670442572800.0, 33522128640.0, 1323241920.0, 40840800.0,
+                                 960960.0, 16380.0, 182.0, 1.0};
+
+    switch (m)
+    {
+        case 3:
+            return b3;
+        case 5:
+            return b5;
+        case 7:
+            return b7;
+        case 9:
+            return b9;
+        default:
+            return b13;
+    }
+}
+
+
+/// Add the given scalar to the diagonal of \a X.
+template <typename MatrixT, typename T>
+void expm_add_diagonal(MatrixT& X, T b)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+    const size_type n = num_rows(X);
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        X(i,i) += value_type(b);
+    }
+}
+
+
+/**
+ * \brief Compute the odd part \f$U\f$ and the even part \f$V\f$ of the
+ *  Pad&eacute; approximant of degree \f$m \le 9\f$ of the matrix stored in
+ *  the workspace, whose even powers up to \f$A^{m-1}\f$ are already computed.
+ *
+ * \f$U = A \sum_k b_{2k+1} A^{2k}\f$ and \f$V = \sum_k b_{2k} A^{2k}\f$.
+ */
+template <typename ValueT>
+void expm_pade_low(expm_workspace<ValueT>& ws, int m)
+{
+    typedef typename expm_workspace<ValueT>::size_type size_type;
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    double const* b = expm_pade_coefficients(m);
+
+    typename expm_workspace<ValueT>::work_matrix_type& T = ws.T();
+    typename expm_workspace<ValueT>::work_matrix_type& V = ws.V();
+
+    noalias(T) = real_type(b[3])*ws.even_power(1);
+    noalias(V) = real_type(b[2])*ws.even_power(1);
+    for (size_type k = 2; 2*k < size_type(m); ++k)
+    {
+        noalias(T) += real_type(b[2*k+1])*ws.even_power(k);
+        noalias(V) += real_type(b[2*k])*ws.even_power(k);
+    }
+    expm_add_diagonal(T, real_type(b[1]));
+    expm_add_diagonal(V, real_type(b[0]));
+
+    noalias(ws.U()) = prod(ws.scaled_matrix(), T);
+}
+
+
+/**
+ * \brief Compute the odd part \f$U\f$ and the even part \f$V\f$ of the
+ *  Pad&eacute; approximant of degree 13 of the matrix stored in the
+ *  workspace, whose powers \f$A^2\f$, \f$A^4\f$ and \f$A^6\f$ are already
+ *  computed.
+ *
+ * The approximant is evaluated by the scheme of [1, Eq. 2.6], with three
+ * further matrix products.
+ */
+template <typename ValueT>
+void expm_pade13(expm_workspace<ValueT>& ws)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    double const* b = expm_pade_coefficients(13);
+
+    typename expm_workspace<ValueT>::work_matrix_type& A2 = ws.even_power(1);
+    typename expm_workspace<ValueT>::work_matrix_type& A4 = ws.even_power(2);
+    typename expm_workspace<ValueT>::work_matrix_type& A6 = ws.even_power(3);
+    typename expm_workspace<ValueT>::work_matrix_type& W = ws.even_power(4); // A^8 is not needed
+    typename expm_workspace<ValueT>::work_matrix_type& T = ws.T();
+    typename expm_workspace<ValueT>::work_matrix_type& V = ws.V();
+
+    noalias(T) = real_type(b[13])*A6 + real_type(b[11])*A4 + real_type(b[9])*A2;
+    noalias(W) = prod(A6, T);
+    noalias(W) += real_type(b[7])*A6 + real_type(b[5])*A4 + real_type(b[3])*A2;
+    expm_add_diagonal(W, real_type(b[1]));
+    noalias(ws.U()) = prod(ws.scaled_matrix(), W);
+
+    noalias(T) = real_type(b[12])*A6 + real_type(b[10])*A4 + real_type(b[8])*A2;
+    noalias(V) = prod(A6, T);
+    noalias(V) += real_type(b[6])*A6 + real_type(b[4])*A4 + real_type(b[2])*A2;
+    expm_add_diagonal(V, real_type(b[0]));
+}
+
+
+/**
+ * \brief Compute the exponential of the matrix \a A into the matrix \a V of
+ *  the workspace.
+ */
+template <typename MatrixExprT>
+void expm_impl(matrix_expression<MatrixExprT> const& A, expm_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef expm_pade_bounds<real_type> bounds_type;
+    typedef typename expm_workspace<value_type>::work_matrix_type work_matrix_type;
+
+    const size_type n = num_rows(A);
+
+    ws.resize(n);
+
+    work_matrix_type& X = ws.scaled_matrix();
+    noalias(X) = A;
+
+    const real_type nrm = norm_1(X);
+
+    if (!::std::isfinite(nrm))
+    {
+        ws.V() = scalar_matrix<value_type>(n, n, ::std::numeric_limits<real_type>::quiet_NaN());
+        return;
+    }
+
+    // Select the lowest degree whose bound is not exceeded; otherwise scale
+    // the matrix by 2^-s so that the highest degree can be used.
+    const ::std::size_t nd = bounds_type::num_degrees();
+    ::std::size_t d = 0;
+    while (d < nd && !(nrm <= bounds_type::theta(d)))
+    {
+        ++d;
+    }
+    int s = 0;
+    if (d == nd)
+    {
+        --d;
+        s = static_cast<int>(::std::ceil(::std::log(nrm/bounds_type::theta(d))/::std::log(real_type(2))));
+        if (s > 0)
+        {
+            X *= ::std::ldexp(real_type(1), -s);
+        }
+        else
+        {
+            s = 0;
+        }
+    }
+    const int m = bounds_type::degree(d);
+
+    // Even powers of the (scaled) matrix, shared by all the degrees
+    noalias(ws.even_power(1)) = prod(X, X);
+    if (m >= 5)
+    {
+        noalias(ws.even_power(2)) = prod(ws.even_power(1), ws.even_power(1));
+    }
+    if (m >= 7)
+    {
+        noalias(ws.even_power(3)) = prod(ws.even_power(1), ws.even_power(2));
+    }
+    if (m == 9)
+    {
+        noalias(ws.even_power(4)) = prod(ws.even_power(2), ws.even_power(2));
+    }
+
+    if (m == 13)
+    {
+        expm_pade13(ws);
+    }
+    else
+    {
+        expm_pade_low(ws, m);
+    }
+
+    // Solve (V-U)*R = V+U
+    work_matrix_type& Q = ws.T();
+    work_matrix_type& R = ws.V();
+    noalias(Q) = R - ws.U();
+    noalias(R) += ws.U();
+    if (lu_decompose_inplace(Q, ws.P()) != 0)
+    {
+        throw ::std::runtime_error("[boost::numeric::ublasx::expm] Singular denominator of the Pade approximant.");
+    }
+    lu_apply_inplace(Q, ws.P(), R);
+
+    // Undo the scaling by repeated squaring
+    for (int i = 0; i < s; ++i)
+    {
+        noalias(Q) = prod(R, R);
+        R.swap(Q);
+    }
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Compute the exponential of the given square matrix by means of the
+ *  given workspace.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam MatrixT The type of the output matrix.
+ *
+ * \param A The square matrix (of real or complex numbers) to exponentiate.
+ * \param E The matrix where the exponential of \a A is stored (it is resized,
+ *  if needed).
+ * \param ws The workspace, which is resized if it is not prepared for the
+ *  order of \a A.
+ *
+ * Uses the scaling and squaring method of [1]: the degree of the diagonal
+ * Pad&eacute; approximant (3, 5, 7, 9 or 13 for double precision, and 3, 5
+ * or 7 for single precision) is chosen from the 1-norm of \a A, and \a A is
+ * scaled by a power of two (and the approximant squared back) only if the
+ * highest degree does not suffice.
+ * The powers \f$A^2\f$, \f$A^4\f$ and \f$A^6\f$ are shared by the numerator
+ * and the denominator of the approximant, and the rational function is
+ * evaluated by solving a linear system with one LU factorization, without
+ * inverting the denominator.
+ * Apart from the output matrix, no memory is allocated when the workspace
+ * is already prepared for the order of \a A.
+ *
+ * \throw std::runtime_error if the denominator of the approximant is
+ *  singular (which may only happen if \a A has non-finite elements).
+ *
+ * <b>References</b>
+ * -# N.J. Higham. "The Scaling and Squaring Method for the Matrix Exponential
+ *    Revisited". SIAM J. Matrix Anal. Appl. 26(4):1179-1193, 2005.
+ * .
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT, typename MatrixT>
+void expm(matrix_expression<MatrixExprT> const& A, matrix_container<MatrixT>& E, expm_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_size() );
+
+    detail::expm_impl(A, ws);
+
+    if (num_rows(E) != num_rows(A) || num_columns(E) != num_columns(A))
+    {
+        E().resize(num_rows(A), num_columns(A), false);
+    }
+    noalias(E()) = ws.V();
+}
+
+
+/**
+ * \brief Compute the exponential of the given square matrix by means of the
+ *  given workspace.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ *
+ * \param A The square matrix (of real or complex numbers) to exponentiate.
+ * \param ws The workspace, which is resized if it is not prepared for the
+ *  order of \a A.
+ * \return The exponential of \a A.
+ *
+ * See the \c expm function with the output matrix.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT>
+typename detail::expm_traits<MatrixExprT>::result_type expm(matrix_expression<MatrixExprT> const& A, expm_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    typename detail::expm_traits<MatrixExprT>::result_type E;
+
+    expm(A, E, ws);
+
+    return E;
+}
+
+
+/**
+ * \brief Compute the exponential of the given square matrix.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ *
+ * \param A The square matrix (of real or complex numbers) to exponentiate.
+ * \return The exponential of \a A.
+ *
+ * See the \c expm function with the output matrix; use it with an
+ * \c expm_workspace to exponentiate several matrices of the same order
+ * without allocating memory.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT>
+typename detail::expm_traits<MatrixExprT>::result_type expm(matrix_expression<MatrixExprT> const& A)
+{
+    expm_workspace<typename matrix_traits<MatrixExprT>::value_type> ws;
+
+    return expm(A, ws);
+}
+
+
+/**
+ * Legacy Pad&eacute; approximant of fixed degree \a p, with the scaling and
+ * squaring chosen from the infinity norm; prefer \c expm.
+ */
 template<typename MATRIX>
 MATRIX expm_pad(const MATRIX &H, const int p = 6)
 {
@@ -0,0 +1,631 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/expmv.hpp
+ *
+ * \brief Action of the matrix exponential on a vector.
+ *
+ * Computes \f$e^{tA}v\f$ without forming \f$e^{tA}\f$, by the truncated
+ * Taylor series method of Al-Mohy and Higham [1]: the matrix is shifted by
+ * \f$\mu=\mathrm{trace}(A)/n\f$, and \f$e^{t(A-\mu I)}v\f$ is computed as
+ * \f$s\f$ steps of a Taylor polynomial of degree \f$m\f$, where \f$s\f$ and
+ * \f$m\f$ minimize the number \f$ms\f$ of matrix-vector products among those
+ * satisfying the backward error bound of the unit roundoff.
+ * The bound is computed from estimates of \f$\|(A-\mu I)^p\|_1^{1/p}\f$
+ * (block 1-norm estimator of Higham and Tisseur, with one column), which only
+ * need products with \f$A-\mu I\f$ and its conjugate transpose.
+ *
+ * The matrix is only accessed through matrix-vector products (and its
+ * diagonal), so that it can be any matrix expression, including sparse
+ * matrices, and only a few vectors of its order are allocated.
+ *
+ * <b>References</b>
+ * -# A.H. Al-Mohy and N.J. Higham. "Computing the Action of the Matrix
+ *    Exponential, with an Application to Exponential Integrators". SIAM J.
+ *    Sci. Comput. 33(2):488-511, 2011.
+ * -# N.J. Higham and F. Tisseur. "A Block Algorithm for Matrix 1-Norm
+ *    Estimation, with an Application to 1-Norm Pseudospectra". SIAM J. Matrix
+ *    Anal. Appl. 21(4):1185-1201, 2000.
+ * .
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_EXPMV_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_EXPMV_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/ublas/exception.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+namespace detail {
+
+/// The types of the vectors and matrices returned by \c expmv.
+template <typename MatrixExprT, typename VectorExprT>
+struct expmv_traits
+{
+    typedef typename promote_traits<
+                typename matrix_traits<MatrixExprT>::value_type,
+                typename vector_traits<VectorExprT>::value_type
+            >::promote_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef vector<value_type> vector_type;
+    typedef matrix<value_type, column_major> matrix_type;
+};
+
+
+/**
+ * \brief The parameters of the truncated Taylor method.
+ *
+ * \f$\theta_m\f$ is the largest \f$\theta\f$ such that the relative backward
+ * error of the Taylor polynomial of degree \f$m\f$ is not greater than the
+ * unit roundoff on matrices of 1-norm \f$\theta\f$ [1, Sec. 3]; the values
+ * for \f$m=1,\ldots,55\f$ have been computed in high precision arithmetic
+ * (they agree with [1, Table 3.1]).
+ * Types more precise than \c double use the double precision values.
+ */
+template <typename RealT>
+struct expmv_params
+{
+    /// The maximum degree of the Taylor polynomial.
+    static ::std::size_t max_degree()
+    {
+        return 55;
+    }
+
+    /// The maximum power whose 1-norm is estimated.
+    static ::std::size_t max_power()
+    {
+        return 8;
+    }
+
+    static bool single_precision()
+    {
+        return ::std::numeric_limits<RealT>::digits <= ::std::numeric_limits<float>::digits;
+    }
+
+    /// The unit roundoff.
+    static RealT tolerance()
+    {
+        return single_precision()
+               ? static_cast<RealT>(::std::ldexp(1.0, -24))
+               : static_cast<RealT>(::std::ldexp(1.0, -53));
+    }
+
+    /// The bound \f$\theta_m\f$, \f$m=1,\ldots,55\f$.
+    static RealT theta(::std::size_t m)
+    {
+        static const double double_thetas[] = {
+                2.220446049250313e-16, 2.580956802971767e-08, 1.386347866119121e-05, 3.397168839976962e-04,
+                2.400876357887274e-03, 9.065656407595102e-03, 2.384455532500274e-02, 4.991228871115323e-02,
+                8.957760203223343e-02, 1.441829761614378e-01, 2.142358068451711e-01, 2.996158913811581e-01,
+                3.997775336316795e-01, 5.139146936124294e-01, 6.410835233041199e-01, 7.802874256626574e-01,
+                9.305328460786568e-01, 1.090863719290036e+00, 1.260381060642639e+00, 1.438252596804337e+00,
+                1.623715950235821e+00, 1.816077816215086e+00, 2.014710780944616e+00, 2.219048869365090e+00,
+                2.428582524442827e+00, 2.642853457459435e+00, 2.861449633934264e+00, 3.084000544989162e+00,
+                3.310172839890271e+00, 3.539666348743689e+00, 3.772210495681751e+00, 4.007561086118040e+00,
+                4.245497442579696e+00, 4.485819859447369e+00, 4.728347345793539e+00, 4.972915626191981e+00,
+                5.219375371084058e+00, 5.467590630524544e+00, 5.717437447572013e+00, 5.968802630041849e+00,
+                6.221582661689891e+00, 6.475682736079984e+00, 6.731015898381024e+00, 6.987502282130630e+00,
+                7.245068429597951e+00, 7.503646685788864e+00, 7.763174657377987e+00, 8.023594728939980e+00,
+                8.284853629803917e+00, 8.546902045684933e+00, 8.809694269971322e+00, 9.073187890176145e+00,
+                9.337343505612013e+00, 9.602124472826556e+00, 9.867496675753401e+00
+        };
+        static const double single_thetas[] = {
+                1.192092800768788e-07, 5.978858893805234e-04, 1.123386473528671e-02, 5.116619363445086e-02,
+                1.308487164599470e-01, 2.495289322846698e-01, 4.014582423510480e-01, 5.800524627688768e-01,
+                7.795113374358031e-01, 9.951840790004457e-01, 1.223479542424143e+00, 1.461661507209034e+00,
+                1.707648529608701e+00, 1.959850585959898e+00, 2.217044394974721e+00, 2.478280877521971e+00,
+                2.742817112698780e+00, 3.010066362817634e+00, 3.279561212635997e+00, 3.550926214706495e+00,
+                3.823857425450966e+00, 4.098106972191506e+00, 4.373471311840500e+00, 4.649782224100758e+00,
+                4.926899843755911e+00, 5.204707228012360e+00, 5.483106087658634e+00, 5.762013408447769e+00,
+                6.041358758192571e+00, 6.321082126301961e+00, 6.601132179501162e+00, 6.881464845209718e+00,
+                7.162042154487760e+00, 7.442831291936598e+00, 7.723803811553991e+00, 8.004934986436286e+00,
+                8.286203267002165e+00, 8.567589827662577e+00, 8.849078185923950e+00, 9.130653881090101e+00,
+                9.412304202219415e+00, 9.694017956963012e+00, 9.975785274470677e+00, 1.025759743679749e+01,
+                1.053944673424217e+01, 1.082132634085215e+01, 1.110323020698068e+01, 1.138515296630914e+01,
+                1.166708985517880e+01, 1.194903664242897e+01, 1.223098956822813e+01, 1.251294529062442e+01,
+                1.279490083873945e+01, 1.307685357169422e+01, 1.335880114249304e+01
+        };
+
+        return static_cast<RealT>(single_precision() ? single_thetas[m-1] : double_thetas[m-1]);
+    }
+};
+
+
+/// Compute \f$y=(A-\mu I)x\f$.
+template <typename MatrixExprT, typename ValueT, typename XVectorT, typename YVectorT>
+void expmv_prod(MatrixExprT const& A, ValueT mu, XVectorT const& x, YVectorT& y)
+{
+    axpy_prod(A, x, y, true);
+    noalias(y) -= mu*x;
+}
+
+
+/// Compute \f$y=(A-\mu I)^H x\f$.
+template <typename MatrixExprT, typename ValueT, typename XVectorT, typename YVectorT>
+void expmv_prod_herm(MatrixExprT const& A, ValueT mu, XVectorT const& x, YVectorT& y)
+{
+    // y^T = conj(x)^T A, so that A is traversed like in A*x
+    axpy_prod(conj(x), A, y, true);
+    noalias(y) = conj(y) - type_traits<ValueT>::conj(mu)*x;
+}
+
+
+/// Column 1-norms of the matrix \a A (row-major traversal).
+template <typename MatrixExprT, typename VectorT>
+void expmv_column_norms(MatrixExprT const& A, VectorT& colsum, row_major_tag)
+{
+    typedef typename MatrixExprT::const_iterator1 iterator1_type;
+    typedef typename MatrixExprT::const_iterator2 iterator2_type;
+
+    for (iterator1_type it1 = A.begin1(); it1 != A.end1(); ++it1)
+    {
+        for (iterator2_type it2 = it1.begin(); it2 != it1.end(); ++it2)
+        {
+            colsum(it2.index2()) += ::std::abs(*it2);
+        }
+    }
+}
+
+
+/// Column 1-norms of the matrix \a A (column-major traversal).
+template <typename MatrixExprT, typename VectorT>
+void expmv_column_norms(MatrixExprT const& A, VectorT& colsum, column_major_tag)
+{
+    typedef typename MatrixExprT::const_iterator1 iterator1_type;
+    typedef typename MatrixExprT::const_iterator2 iterator2_type;
+
+    for (iterator2_type it2 = A.begin2(); it2 != A.end2(); ++it2)
+    {
+        for (iterator1_type it1 = it2.begin(); it1 != it2.end(); ++it1)
+        {
+            colsum(it1.index2()) += ::std::abs(*it1);
+        }
+    }
+}
+
+
+/// Column 1-norms of the matrix \a A (other orientations).
+template <typename MatrixExprT, typename VectorT, typename OrientationT>
+void expmv_column_norms(MatrixExprT const& A, VectorT& colsum, OrientationT)
+{
+    expmv_column_norms(A, colsum, row_major_tag());
+}
+
+
+/// The sign of a number: \f$x/|x|\f$, or 1 if \f$x=0\f$.
+template <typename ValueT>
+ValueT expmv_sign(ValueT x)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    const real_type ax = ::std::abs(x);
+
+    return ax > 0 ? ValueT(x/ax) : ValueT(1);
+}
+
+
+/**
+ * \brief The norms of the powers of the shifted matrix needed to choose the
+ *  parameters of the truncated Taylor method.
+ *
+ * The norm estimates do not depend on \f$t\f$, so that they are computed at
+ * most once for all the time steps.
+ */
+template <typename MatrixExprT, typename ValueT>
+class expmv_norms
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef typename matrix_traits<MatrixExprT>::value_type matrix_value_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef expmv_params<real_type> params_type;
+    private: typedef vector<value_type> work_vector_type;
+
+
+    public: expmv_norms(MatrixExprT const& A, matrix_value_type mu)
+    : A_(A),
+      mu_(mu),
+      norm1_(0),
+      have_alpha_(false)
+    {
+        const size_type n = num_rows(A);
+
+        // Exact 1-norm of A-mu*I
+        vector<real_type> colsum(n, 0);
+        expmv_column_norms(A, colsum, typename matrix_traits<MatrixExprT>::orientation_category());
+        for (size_type j = 0; j < n; ++j)
+        {
+            const matrix_value_type ajj = A(j,j);
+            colsum(j) += ::std::abs(ajj-mu) - ::std::abs(ajj);
+            norm1_ = ::std::max(norm1_, colsum(j));
+        }
+    }
+
+
+    /// The 1-norm of the shifted matrix.
+    public: real_type norm_1() const
+    {
+        return norm1_;
+    }
+
+
+    /**
+     * \brief The bound \f$\alpha_p=\max(d_p,d_{p+1})\f$, where
+     *  \f$d_p=\|(A-\mu I)^p\|_1^{1/p}\f$ is estimated.
+     */
+    public: real_type alpha(size_type p)
+    {
+        if (!have_alpha_)
+        {
+            const size_type pmax = params_type::max_power();
+
+            vector<real_type> d(pmax+2, 0);
+            for (size_type q = 2; q <= pmax+1; ++q)
+            {
+                d(q) = ::std::pow(normest_power(q), real_type(1)/real_type(q));
+            }
+            alpha_.resize(pmax+1, false);
+            for (size_type q = 2; q <= pmax; ++q)
+            {
+                alpha_(q) = ::std::max(d(q), d(q+1));
+            }
+            have_alpha_ = true;
+        }
+
+        return alpha_(p);
+    }
+
+
+    /// Compute \f$y=(A-\mu I)^p x\f$ (or its conjugate transpose), overwriting \a x.
+    private: void prod_power(size_type p, work_vector_type& x, work_vector_type& y, bool herm)
+    {
+        for (size_type k = 0; k < p; ++k)
+        {
+            if (herm)
+            {
+                expmv_prod_herm(A_, mu_, x, y);
+            }
+            else
+            {
+                expmv_prod(A_, mu_, x, y);
+            }
+            if (k+1 < p)
+            {
+                x.swap(y);
+            }
+        }
+    }
+
+
+    /// Estimate \f$\|(A-\mu I)^p\|_1\f$ (Hager's method, as refined in [2]).
+    private: real_type normest_power(size_type p)
+    {
+        const size_type n = num_rows(A_);
+        const size_type max_iter = 5;
+
+        work_vector_type x(n);
+        work_vector_type y(n);
+
+        // Alternative estimate, useful for matrices the power method misses
+        for (size_type i = 0; i < n; ++i)
+        {
+            const real_type v = real_type(1) + (n > 1 ? real_type(i)/real_type(n-1) : real_type(0));
+            x(i) = (i % 2) ? -v : v;
+        }
+        prod_power(p, x, y, false);
+        real_type est = 2*ublas::norm_1(y)/real_type(3*n);
+
+        x = scalar_vector<value_type>(n, real_type(1)/real_type(n));
+        real_type old_est = 0;
+        size_type old_j = n;
+        for (size_type k = 0; k < max_iter; ++k)
+        {
+            prod_power(p, x, y, false);
+            const real_type cur_est = ublas::norm_1(y);
+            if (k > 0 && cur_est <= old_est)
+            {
+                break;
+            }
+            old_est = cur_est;
+            est = ::std::max(est, cur_est);
+
+            for (size_type i = 0; i < n; ++i)
+            {
+                x(i) = expmv_sign(value_type(y(i)));
+            }
+            prod_power(p, x, y, true);
+
+            const size_type j = index_norm_inf(y);
+            if (k > 0 && (j == old_j || ::std::abs(y(j)) <= ::std::abs(y(old_j))))
+            {
+                break;
+            }
+            x = zero_vector<value_type>(n);
+            x(j) = 1;
+            old_j = j;
+        }
+
+        return est;
+    }
+
+
+    private: MatrixExprT const& A_;
+    private: matrix_value_type mu_;
+    private: real_type norm1_;
+    private: bool have_alpha_;
+    private: vector<real_type> alpha_;
+};
+
+
+/**
+ * \brief Choose the degree \a m of the Taylor polynomial and the number \a s
+ *  of steps minimizing the number of matrix-vector products for
+ *  \f$e^{t(A-\mu I)}\f$ [1, Code Fragment 3.1].
+ */
+template <typename NormsT, typename RealT>
+void expmv_select(NormsT& norms, RealT abs_t, ::std::size_t& m, ::std::size_t& s)
+{
+    typedef typename NormsT::real_type real_type;
+    typedef expmv_params<real_type> params_type;
+
+    const ::std::size_t mmax = params_type::max_degree();
+    const ::std::size_t pmax = params_type::max_power();
+    const real_type norm1 = abs_t*norms.norm_1();
+
+    m = 0;
+    s = 1;
+    if (norm1 == 0)
+    {
+        return;
+    }
+
+    // When the 1-norm of tA is small, estimating the norms of the powers would
+    // cost more than it saves [1, Eq. 3.13]
+    const bool cheap = norm1 <= 4*params_type::theta(mmax)*pmax*(pmax+3)/mmax;
+
+    real_type best_cost = ::std::numeric_limits<real_type>::infinity();
+    for (::std::size_t p = 2; p <= (cheap ? 2 : pmax); ++p)
+    {
+        const real_type alpha = cheap ? norm1 : abs_t*norms.alpha(p);
+        for (::std::size_t mm = ::std::max(p*(p-1)-1, ::std::size_t(1)); mm <= mmax; ++mm)
+        {
+            const real_type ss = ::std::max(::std::ceil(alpha/params_type::theta(mm)), real_type(1));
+            const real_type cost = mm*ss;
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                m = mm;
+                s = static_cast< ::std::size_t >(ss);
+            }
+        }
+    }
+}
+
+
+/// Replace \a f with \f$e^{tA}f\f$, using \a b and \a y as scratch vectors.
+template <typename MatrixExprT, typename NormsT, typename RealT, typename VectorT>
+void expmv_step(MatrixExprT const& A, typename matrix_traits<MatrixExprT>::value_type mu, NormsT& norms, RealT t, VectorT& f, VectorT& b, VectorT& y)
+{
+    typedef typename NormsT::value_type value_type;
+    typedef typename NormsT::real_type real_type;
+    typedef expmv_params<real_type> params_type;
+
+    if (t == 0)
+    {
+        return;
+    }
+
+    ::std::size_t m = 0;
+    ::std::size_t s = 1;
+    expmv_select(norms, ::std::abs(t), m, s);
+
+    const real_type tol = params_type::tolerance();
+    const value_type eta = ::std::exp(value_type(t/real_type(s))*value_type(mu));
+
+    b = f;
+    for (::std::size_t i = 0; i < s; ++i)
+    {
+        real_type c1 = norm_inf(b);
+        for (::std::size_t j = 1; j <= m; ++j)
+        {
+            expmv_prod(A, mu, b, y);
+            b.swap(y);
+            b *= t/real_type(s*j);
+            const real_type c2 = norm_inf(b);
+            f += b;
+            // Stop when the last two terms are negligible
+            if (c1+c2 <= tol*norm_inf(f))
+            {
+                break;
+            }
+            c1 = c2;
+        }
+        f *= eta;
+        b = f;
+    }
+}
+
+
+/// The shift \f$\mu=\mathrm{trace}(A)/n\f$.
+template <typename MatrixExprT>
+typename matrix_traits<MatrixExprT>::value_type expmv_shift(MatrixExprT const& A)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    const size_type n = num_rows(A);
+
+    value_type tr(0);
+    for (size_type i = 0; i < n; ++i)
+    {
+        tr += A(i,i);
+    }
+
+    return n > 0 ? value_type(tr/real_type(n)) : value_type(0);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Compute the action \f$e^{tA}v\f$ of the exponential of the given
+ *  square matrix on the given vector.
+ *
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam VectorExprT The type of the vector expression.
+ * \tparam RealT The type of the time.
+ *
+ * \param A The square matrix (of real or complex numbers), which can be any
+ *  matrix expression, including sparse matrices.
+ * \param v The vector.
+ * \param t The time.
+ * \return The vector \f$e^{tA}v\f$.
+ *
+ * Only matrix-vector products with \a A and its conjugate transpose are
+ * computed (see \c expmv.hpp), so that the cost is proportional to the
+ * number of nonzeros of \a A.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT, typename VectorExprT, typename RealT>
+typename ::boost::enable_if<
+    ::boost::is_arithmetic<RealT>,
+    typename detail::expmv_traits<MatrixExprT,VectorExprT>::vector_type
+>::type expmv(matrix_expression<MatrixExprT> const& A, vector_expression<VectorExprT> const& v, RealT t)
+{
+    typedef detail::expmv_traits<MatrixExprT,VectorExprT> traits_type;
+    typedef typename traits_type::value_type value_type;
+    typedef typename traits_type::real_type real_type;
+    typedef typename traits_type::vector_type vector_type;
+
+    BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_size() );
+    BOOST_UBLAS_CHECK( size(v) == num_rows(A), bad_size() );
+
+    const typename matrix_traits<MatrixExprT>::value_type mu = detail::expmv_shift(A());
+    detail::expmv_norms<MatrixExprT,value_type> norms(A(), mu);
+
+    vector_type f(v);
+    vector_type b(size(v));
+    vector_type y(size(v));
+
+    detail::expmv_step(A(), mu, norms, real_type(t), f, b, y);
+
+    return f;
+}
+
+
+/**
+ * \brief Compute the action \f$e^{A}v\f$ of the exponential of the given
+ *  square matrix on the given vector.
+ *
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam VectorExprT The type of the vector expression.
+ *
+ * \param A The square matrix (of real or complex numbers), which can be any
+ *  matrix expression, including sparse matrices.
+ * \param v The vector.
+ * \return The vector \f$e^{A}v\f$.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT, typename VectorExprT>
+typename detail::expmv_traits<MatrixExprT,VectorExprT>::vector_type expmv(matrix_expression<MatrixExprT> const& A, vector_expression<VectorExprT> const& v)
+{
+    return expmv(A, v, 1);
+}
+
+
+/**
+ * \brief Compute the actions \f$e^{t_k A}v\f$ of the exponential of the given
+ *  square matrix on the given vector, at several times \f$t_k\f$.
+ *
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam VectorExprT The type of the vector expression.
+ * \tparam TimeVectorExprT The type of the vector expression of the times.
+ *
+ * \param A The square matrix (of real or complex numbers), which can be any
+ *  matrix expression, including sparse matrices.
+ * \param v The vector.
+ * \param t The times.
+ * \return The matrix whose \f$k\f$-th column is \f$e^{t_k A}v\f$.
+ *
+ * The results are computed in one sweep, each one from the previous one as
+ * \f$e^{t_k A}v=e^{(t_k-t_{k-1})A}e^{t_{k-1}A}v\f$ (with \f$t_{-1}=0\f$),
+ * and the norm estimates needed to choose the parameters of each step are
+ * computed only once; hence the times should be sorted in increasing order.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT, typename VectorExprT, typename TimeVectorExprT>
+typename detail::expmv_traits<MatrixExprT,VectorExprT>::matrix_type expmv(matrix_expression<MatrixExprT> const& A, vector_expression<VectorExprT> const& v, vector_expression<TimeVectorExprT> const& t)
+{
+    typedef detail::expmv_traits<MatrixExprT,VectorExprT> traits_type;
+    typedef typename traits_type::value_type value_type;
+    typedef typename traits_type::real_type real_type;
+    typedef typename traits_type::vector_type vector_type;
+    typedef typename traits_type::matrix_type matrix_type;
+    typedef typename vector_traits<TimeVectorExprT>::size_type size_type;
+
+    BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_size() );
+    BOOST_UBLAS_CHECK( size(v) == num_rows(A), bad_size() );
+
+    const size_type nt = size(t);
+
+    const typename matrix_traits<MatrixExprT>::value_type mu = detail::expmv_shift(A());
+    detail::expmv_norms<MatrixExprT,value_type> norms(A(), mu);
+
+    matrix_type F(size(v), nt);
+    vector_type f(v);
+    vector_type b(size(v));
+    vector_type y(size(v));
+
+    real_type t_prev = 0;
+    for (size_type k = 0; k < nt; ++k)
+    {
+        const real_type t_k = t()(k);
+
+        detail::expmv_step(A(), mu, norms, t_k-t_prev, f, b, y);
+        column(F, k) = f;
+        t_prev = t_k;
+    }
+
+    return F;
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_EXPMV_HPP
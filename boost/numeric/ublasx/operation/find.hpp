@@ -20,16 +20,17 @@
 #ifndef BOOST_NUMERIC_UBLASX_OPERATION_FIND_HPP
 #define BOOST_NUMERIC_UBLASX_OPERATION_FIND_HPP
 
-//TODO: Implementation for matrix expressions.
-
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/match.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
-#include <functional>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -73,31 +74,87 @@ vector<typename vector_traits<VectorExprT>::value_type> find(vector_expression<V
 template <typename VectorExprT>
 vector<typename vector_traits<VectorExprT>::value_type> find(vector_expression<VectorExprT> const& ve);
 
+/**
+ * \brief Find the elments of the given matrix expression which satisfy the
+ *  given unary predicate.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam UnaryPredicateT The type of the unary predicate functor.
+ * \param me The matrix expression over which check for the predicate.
+ * \param p The unary predicate functor: must accept one argument and return
+ * a boolean value.
+ * \return A vector of the elements of the given matrix expression which satisfy
+ *  the given predicate, in column-major order (i.e., column by column and,
+ *  within a column, by increasing row, whatever the storage layout of the
+ *  matrix expression); an empty vector, if no element satisfies the given
+ *  predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename UnaryPredicateT>
+vector<typename matrix_traits<MatrixExprT>::value_type> find(matrix_expression<MatrixExprT> const& me, UnaryPredicateT p);
+
+/**
+ * \brief Find the non-zero elments of the given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression over which check for existence of non-zero
+ *  elements.
+ * \return A vector of the non-zero elements of the given matrix expression, in
+ *  column-major order (i.e., column by column and, within a column, by
+ *  increasing row, whatever the storage layout of the matrix expression); an
+ *  empty vector, if no non-zero element is found.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+vector<typename matrix_traits<MatrixExprT>::value_type> find(matrix_expression<MatrixExprT> const& me);
+
 //@} Declarations
 
 
+namespace detail {
+
+/// Collect the visited elements.
+template <typename ValueT>
+struct find_collector
+{
+    template <typename SizeT>
+    void operator()(SizeT, ValueT const& x)
+    {
+        values.push_back(x);
+    }
+
+    template <typename SizeT>
+    void operator()(SizeT, SizeT, ValueT const& x)
+    {
+        values.push_back(x);
+    }
+
+    vector<ValueT> result() const
+    {
+        vector<ValueT> res(values.size());
+        ::std::copy(values.begin(), values.end(), res.begin());
+        return res;
+    }
+
+    // The buffer grows geometrically, so that collecting the elements takes
+    // linear time; the result is then allocated only once.
+    ::std::vector<ValueT> values;
+};
+
+} // Namespace detail
+
+
 //@{ Definitions
 
 template <typename VectorExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
 vector<typename vector_traits<VectorExprT>::value_type> find(vector_expression<VectorExprT> const& ve, UnaryPredicateT p)
 {
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
-    typedef typename vector_traits<VectorExprT>::value_type value_type;
+    detail::find_collector<typename vector_traits<VectorExprT>::value_type> collector;
 
-    vector<value_type> res;
-    size_type n = size(ve);
-    size_type j = 0;
-    for (size_type i = 0; i < n; ++i)
-    {
-        if (p(ve()(i)))
-        {
-            res.resize(res.size()+1);
-            res(j++) = ve()(i);
-        }
-    }
+    detail::for_each_match(ve, p, collector);
 
-    return res;
+    return collector.result();
 }
 
 
@@ -107,7 +164,29 @@ vector<typename vector_traits<VectorExprT>::value_type> find(vector_expression<V
 {
     typedef typename vector_traits<VectorExprT>::value_type value_type;
 
-    return find(ve, ::std::bind2nd(::std::not_equal_to<value_type>(), 0));
+    return find(ve, detail::nonzero_predicate<value_type>());
+}
+
+
+template <typename MatrixExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+vector<typename matrix_traits<MatrixExprT>::value_type> find(matrix_expression<MatrixExprT> const& me, UnaryPredicateT p)
+{
+    detail::find_collector<typename matrix_traits<MatrixExprT>::value_type> collector;
+
+    detail::for_each_match(me, p, collector);
+
+    return collector.result();
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+vector<typename matrix_traits<MatrixExprT>::value_type> find(matrix_expression<MatrixExprT> const& me)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return find(me, detail::nonzero_predicate<value_type>());
 }
 
 //@} Definitions
@@ -22,10 +22,16 @@
 
 #include <boost/numeric/ublas/fwd.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/assign.hpp>
+#include <boost/numeric/ublasx/detail/parallel.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/tags.hpp>
+#include <boost/numeric/ublasx/traits/is_execution_policy.hpp>
+#include <boost/static_assert.hpp>
+#include <algorithm>
 #include <cstddef>
 
 
@@ -299,6 +305,266 @@ void for_each_by_tag(matrix_expression<MatrixExprT> const& me, UnaryFunctorT f)
 }
 
 
+namespace detail {
+
+/// Apply a copy of a function to the elements of a chunk of storage positions.
+template <typename EvaluatorT, typename UnaryFunctorT>
+struct for_each_flat_chunk
+{
+    for_each_flat_chunk(EvaluatorT const& ev, UnaryFunctorT const& f)
+    : ev_(ev),
+      f_(f)
+    {
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        EvaluatorT ev(ev_);
+        UnaryFunctorT f(f_);
+
+        for (::std::size_t i = lo; i < hi; ++i)
+        {
+            f(ev[i]);
+        }
+    }
+
+    EvaluatorT ev_;
+    UnaryFunctorT f_;
+};
+
+
+/**
+ * \brief Apply a copy of a function to the elements of a chunk of rows
+ *  (columns) of a row-major (column-major) matrix expression.
+ */
+template <typename MatrixExprT, typename UnaryFunctorT>
+struct for_each_lines_chunk
+{
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
+
+    for_each_lines_chunk(MatrixExprT const& me, UnaryFunctorT const& f)
+    : me_(&me),
+      f_(f)
+    {
+    }
+
+    size_type num_lines() const
+    {
+        return num_lines(orientation_category());
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        UnaryFunctorT f(f_);
+
+        apply(f, lo, hi, orientation_category());
+    }
+
+    template <typename OrientationT>
+    size_type num_lines(OrientationT) const
+    {
+        return me_->size1();
+    }
+
+    size_type num_lines(column_major_tag) const
+    {
+        return me_->size2();
+    }
+
+    template <typename OrientationT>
+    void apply(UnaryFunctorT& f, size_type lo, size_type hi, OrientationT) const
+    {
+        const size_type nc(me_->size2());
+
+        for (size_type r = lo; r < hi; ++r)
+        {
+            for (size_type c = 0; c < nc; ++c)
+            {
+                f((*me_)(r,c));
+            }
+        }
+    }
+
+    void apply(UnaryFunctorT& f, size_type lo, size_type hi, column_major_tag) const
+    {
+        const size_type nr(me_->size1());
+
+        for (size_type c = lo; c < hi; ++c)
+        {
+            for (size_type r = 0; r < nr; ++r)
+            {
+                f((*me_)(r,c));
+            }
+        }
+    }
+
+    MatrixExprT const* me_;
+    UnaryFunctorT f_;
+};
+
+
+/// Apply a copy of a function to the elements of a chunk of a vector expression.
+template <typename VectorExprT, typename UnaryFunctorT>
+struct for_each_elements_chunk
+{
+    for_each_elements_chunk(VectorExprT const& ve, UnaryFunctorT const& f)
+    : ve_(&ve),
+      f_(f)
+    {
+    }
+
+    void operator()(::std::size_t /*k*/, ::std::size_t lo, ::std::size_t hi) const
+    {
+        UnaryFunctorT f(f_);
+
+        for (::std::size_t i = lo; i < hi; ++i)
+        {
+            f((*ve_)(i));
+        }
+    }
+
+    VectorExprT const* ve_;
+    UnaryFunctorT f_;
+};
+
+
+/// Auxiliary class for the implementation of the \c for_each operation with an execution policy.
+template <bool Parallel, bool Flat>
+struct for_each_policy_impl;
+
+
+template <bool Flat>
+struct for_each_policy_impl<false, Flat>
+{
+    template <typename MatrixExprT, typename UnaryFunctorT>
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryFunctorT f)
+    {
+        for_each(me, f);
+    }
+
+    template <typename VectorExprT, typename UnaryFunctorT>
+    static void apply(vector_expression<VectorExprT> const& ve, UnaryFunctorT f)
+    {
+        for_each(ve, f);
+    }
+};
+
+
+template <>
+struct for_each_policy_impl<true, true>
+{
+    template <typename MatrixExprT, typename UnaryFunctorT>
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryFunctorT f)
+    {
+        typedef flat_evaluator<MatrixExprT, typename matrix_traits<MatrixExprT>::orientation_category> evaluator_type;
+
+        ::std::size_t n(num_rows(me)*num_columns(me));
+
+        parallel_for_chunks(parallel_num_chunks(n), n, for_each_flat_chunk<evaluator_type,UnaryFunctorT>(evaluator_type(me()), f));
+    }
+
+    template <typename VectorExprT, typename UnaryFunctorT>
+    static void apply(vector_expression<VectorExprT> const& ve, UnaryFunctorT f)
+    {
+        typedef flat_evaluator<VectorExprT, unknown_orientation_tag> evaluator_type;
+
+        ::std::size_t n(size(ve));
+
+        parallel_for_chunks(parallel_num_chunks(n), n, for_each_flat_chunk<evaluator_type,UnaryFunctorT>(evaluator_type(ve()), f));
+    }
+};
+
+
+template <>
+struct for_each_policy_impl<true, false>
+{
+    template <typename MatrixExprT, typename UnaryFunctorT>
+    static void apply(matrix_expression<MatrixExprT> const& me, UnaryFunctorT f)
+    {
+        typedef for_each_lines_chunk<MatrixExprT,UnaryFunctorT> chunk_type;
+
+        chunk_type chunk(me(), f);
+        ::std::size_t nlines(chunk.num_lines());
+        ::std::size_t nchunks(::std::min(parallel_num_chunks(num_rows(me)*num_columns(me)), nlines));
+
+        parallel_for_chunks(nchunks, nlines, chunk);
+    }
+
+    template <typename VectorExprT, typename UnaryFunctorT>
+    static void apply(vector_expression<VectorExprT> const& ve, UnaryFunctorT f)
+    {
+        ::std::size_t n(size(ve));
+
+        parallel_for_chunks(parallel_num_chunks(n), n, for_each_elements_chunk<VectorExprT,UnaryFunctorT>(ve(), f));
+    }
+};
+
+} // Namespace detail
+
+
+/**
+ * \brief Apply a function to a vector expression, according to the given
+ *  execution policy.
+ *
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam VectorExprT The type of input vector expression.
+ * \tparam UnaryFunctorT The type of the function to be applied.
+ *
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param ve The input vector expression.
+ * \param f The unary function to be applied to the vector expression.
+ *
+ * Under a parallel policy, the vector is split into blocks of consecutive
+ * elements, each visited in order by a separate copy of \a f, and the blocks
+ * are visited concurrently by several threads.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExecutionPolicyT, typename VectorExprT, typename UnaryFunctorT>
+void for_each(ExecutionPolicyT const& /*policy*/, vector_expression<VectorExprT> const& ve, UnaryFunctorT f)
+{
+    BOOST_STATIC_ASSERT( is_execution_policy<ExecutionPolicyT>::value );
+
+    detail::for_each_policy_impl<
+            is_parallel_execution_policy<ExecutionPolicyT>::value,
+            detail::flat_evaluator<VectorExprT, unknown_orientation_tag>::value
+        >::apply(ve, f);
+}
+
+
+/**
+ * \brief Apply a function to a matrix expression, according to the given
+ *  execution policy.
+ *
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam MatrixExprT The type of input matrix expression.
+ * \tparam UnaryFunctorT The type of the function to be applied.
+ *
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param me The input matrix expression.
+ * \param f The unary function to be applied to the matrix expression.
+ *
+ * Under a parallel policy, the elements are visited in storage order (for
+ * dense element-wise expressions) or by rows (columns) of a row-major
+ * (column-major) expression, split into blocks each visited in order by a
+ * separate copy of \a f, and the blocks are visited concurrently by several
+ * threads.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExecutionPolicyT, typename MatrixExprT, typename UnaryFunctorT>
+void for_each(ExecutionPolicyT const& /*policy*/, matrix_expression<MatrixExprT> const& me, UnaryFunctorT f)
+{
+    BOOST_STATIC_ASSERT( is_execution_policy<ExecutionPolicyT>::value );
+
+    detail::for_each_policy_impl<
+            is_parallel_execution_policy<ExecutionPolicyT>::value,
+            detail::flat_evaluator<MatrixExprT, typename matrix_traits<MatrixExprT>::orientation_category>::value
+        >::apply(me, f);
+}
+
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -32,40 +32,109 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
-template <typename VectorExprT>
+/// Functor telling if its argument is different from zero.
+template <typename ArgT>
+struct nonzero_functor
+{
+    typedef ArgT argument_type;
+    typedef bool result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return x != argument_type(0);
+    }
+};
+
+
+/// Functor adapting a unary predicate (either a function pointer or a functor)
+/// so that it can be statically bound to a functor expression.
+template <typename ArgT, typename UnaryPredicateT>
+class predicate_functor
+{
+    public: typedef ArgT argument_type;
+    public: typedef bool result_type;
+
+
+    public: explicit predicate_functor(UnaryPredicateT const& pred)
+    : pred_(pred)
+    {
+    }
+
+
+    public: BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return pred_(x) ? true : false;
+    }
+
+
+    private: mutable UnaryPredicateT pred_;
+};
+
+
+template <typename VectorExprT, typename UnaryPredicateT = void>
 struct vector_hold_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef bool signature_result_type;
+    typedef predicate_functor<signature_argument_type,UnaryPredicateT> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
 
-template <typename MatrixExprT>
+template <typename VectorExprT>
+struct vector_hold_functor_traits<VectorExprT,void>
+{
+    typedef VectorExprT input_expression_type;
+    typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
+    typedef bool signature_result_type;
+    typedef nonzero_functor<signature_argument_type> functor_type;
+    typedef vector_unary_functor_traits<
+                input_expression_type,
+                functor_type
+            > unary_functor_expression_type;
+    typedef typename unary_functor_expression_type::result_type result_type;
+    typedef typename unary_functor_expression_type::expression_type expression_type;
+};
+
+
+template <typename MatrixExprT, typename UnaryPredicateT = void>
 struct matrix_hold_functor_traits
 {
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef bool signature_result_type;
+    typedef predicate_functor<signature_argument_type,UnaryPredicateT> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-bool nz(double v);
-bool nz(double v)
+
+template <typename MatrixExprT>
+struct matrix_hold_functor_traits<MatrixExprT,void>
 {
-    return v != 0;
-}
+    typedef MatrixExprT input_expression_type;
+    typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
+    typedef bool signature_result_type;
+    typedef nonzero_functor<signature_argument_type> functor_type;
+    typedef matrix_unary_functor_traits<
+                input_expression_type,
+                functor_type
+            > unary_functor_expression_type;
+    typedef typename unary_functor_expression_type::result_type result_type;
+    typedef typename unary_functor_expression_type::expression_type expression_type;
+};
 
 } // Namespace detail
 
@@ -88,12 +157,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_hold_functor_traits<VectorExprT>::result_type hold(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_hold_functor_traits<VectorExprT>::expression_type expression_type;
+    typedef typename detail::vector_hold_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(
-                ve(),
-                //::std::bind2nd(::std::not_equal_to<value_type>(), 0)
-                &detail::nz
-        );
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -114,12 +180,9 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_hold_functor_traits<MatrixExprT>::result_type hold(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_hold_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_hold_functor_traits<MatrixExprT>::signature_argument_type value_type;
+    typedef typename detail::matrix_hold_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(
-                me(),
-                ::std::bind2nd(::std::not_equal_to<value_type>(), 0)
-        );
+    return expression_type(me(), functor_type());
 }
 
 
@@ -143,11 +206,12 @@ typename detail::matrix_hold_functor_traits<MatrixExprT>::result_type hold(matri
  */
 template <typename VectorExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
-typename detail::vector_hold_functor_traits<VectorExprT>::result_type hold(vector_expression<VectorExprT> const& ve, UnaryPredicateT pred)
+typename detail::vector_hold_functor_traits<VectorExprT,UnaryPredicateT>::result_type hold(vector_expression<VectorExprT> const& ve, UnaryPredicateT pred)
 {
-    typedef typename detail::vector_hold_functor_traits<VectorExprT>::expression_type expression_type;
+    typedef typename detail::vector_hold_functor_traits<VectorExprT,UnaryPredicateT>::expression_type expression_type;
+    typedef typename detail::vector_hold_functor_traits<VectorExprT,UnaryPredicateT>::functor_type functor_type;
 
-    return expression_type(ve(), pred);
+    return expression_type(ve(), functor_type(pred));
 }
 
 
@@ -171,11 +235,12 @@ typename detail::vector_hold_functor_traits<VectorExprT>::result_type hold(vecto
  */
 template <typename MatrixExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
-typename detail::matrix_hold_functor_traits<MatrixExprT>::result_type hold(matrix_expression<MatrixExprT> const& me, UnaryPredicateT pred)
+typename detail::matrix_hold_functor_traits<MatrixExprT,UnaryPredicateT>::result_type hold(matrix_expression<MatrixExprT> const& me, UnaryPredicateT pred)
 {
-    typedef typename detail::matrix_hold_functor_traits<MatrixExprT>::expression_type expression_type;
+    typedef typename detail::matrix_hold_functor_traits<MatrixExprT,UnaryPredicateT>::expression_type expression_type;
+    typedef typename detail::matrix_hold_functor_traits<MatrixExprT,UnaryPredicateT>::functor_type functor_type;
 
-    return expression_type(me(), pred);
+    return expression_type(me(), functor_type(pred));
 }
 
 }}} // Namespace boost::numeric::ublasx
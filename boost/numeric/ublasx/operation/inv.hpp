@@ -5,12 +5,20 @@
  *
  * \brief Matrix inverse.
  *
+ * The inverse is computed by means of a single LU factorization (LAPACK
+ * \c getrf), which is reused both to estimate the reciprocal condition number
+ * of the matrix (LAPACK \c gecon) and to compute the inverse in place (LAPACK
+ * \c getri).
+ * All the work arrays are held by an \c inv_workspace object, which can be
+ * reused across calls (e.g., one per thread) in order to avoid any heap
+ * allocation when matrices of the same size are repeatedly inverted.
+ *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
  * <hr/>
  *
  * Copyright (c) 2012, Marco Guazzone
- * 
+ *
  * Distributed under the Boost Software License, Version 1.0. (See
  * accompanying file LICENSE_1_0.txt or copy at
  * http://www.boost.org/LICENSE_1_0.txt)
@@ -20,14 +28,25 @@
 #define BOOST_NUMERIC_UBLASX_OPERATION_INV_HPP
 
 
+#include <algorithm>
+#include <boost/mpl/if.hpp>
+#include <boost/numeric/bindings/lapack/computational/gecon.hpp>
+#include <boost/numeric/bindings/lapack/computational/getrf.hpp>
+#include <boost/numeric/bindings/lapack/computational/getri.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
+#include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/ublas/exception.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
-#include <boost/numeric/ublasx/operation/illcond.hpp>
 #include <boost/numeric/ublasx/operation/lu.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
 #include <limits>
 
 
@@ -36,16 +55,282 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace boost::numeric::ublas;
 
 /**
- * \brief Matrix inversion of a square matrix.
+ * \brief Outcome of a matrix inversion.
  *
- * \return \c true if the given input matrix is invertible; \c false is the
- *  input matrix is (nearly) singular.
+ * \tparam RealT The type of the reciprocal condition number.
+ */
+template <typename RealT>
+struct inv_info
+{
+    /// \c true if the matrix is exactly singular (i.e., the LU factorization
+    /// has a zero pivot); in this case the inverse is filled with \c Inf.
+    bool singular;
+    /// \c true if the matrix is close to singular or badly scaled, so that the
+    /// computed inverse may be inaccurate.
+    bool illcond;
+    /// The estimate of the reciprocal condition number in the 1-norm.
+    RealT rcond;
+};
+
+
+/**
+ * \brief Reusable workspace for the inversion of square matrices.
+ *
+ * The workspace holds the pivot vector, the (optimal) work array of LAPACK
+ * \c getri, the work arrays of LAPACK \c gecon and, for matrices which cannot
+ * be passed to LAPACK as they are (e.g., row-major matrices), a column-major
+ * copy of the matrix to invert.
+ * The optimal size of the \c getri work array is queried only when the size
+ * of the workspace changes, so that no heap allocation is performed when the
+ * same workspace is used to invert several matrices of the same size.
+ *
+ * A workspace must not be shared among threads that concurrently perform an
+ * inversion; use a workspace per thread instead.
+ *
+ * \tparam ValueT The type of the elements of the matrices to invert.
+ */
+template <typename ValueT>
+class inv_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector< ::fortran_int_t > pivots_vector_type;
+    public: typedef vector<value_type> work_vector_type;
+    /// Type of the auxiliary work array of \c gecon (\c iwork for real types
+    /// and \c rwork for complex types).
+    public: typedef vector<
+                        typename ::boost::mpl::if_<
+                                ::boost::is_complex<value_type>,
+                                real_type,
+                                ::fortran_int_t
+                            >::type
+                    > aux_work_vector_type;
+
+
+    /// Default constructor: create an empty workspace.
+    public: inv_workspace()
+    : n_(0)
+    {
+    }
+
+
+    /// Create a workspace for the inversion of \a n by \a n matrices.
+    public: explicit inv_workspace(size_type n)
+    : n_(0)
+    {
+        resize(n);
+    }
+
+
+    /// Resize the workspace for the inversion of \a n by \a n matrices.
+    public: void resize(size_type n)
+    {
+        if (n == n_ && ipiv_.size() == n)
+        {
+            return;
+        }
+
+        const size_type nn = ::std::max(n, size_type(1));
+
+        ipiv_.resize(n, false);
+        if (::boost::is_complex<value_type>::value)
+        {
+            gecon_work_.resize(2*nn, false);
+            gecon_aux_work_.resize(2*nn, false);
+        }
+        else
+        {
+            gecon_work_.resize(4*nn, false);
+            gecon_aux_work_.resize(nn, false);
+        }
+
+        // Workspace query for getri
+        size_type lwork = nn;
+        if (n > 0)
+        {
+            value_type opt_lwork;
+            ::boost::numeric::bindings::lapack::detail::getri(
+                static_cast< ::fortran_int_t >(n),
+                static_cast<value_type*>(0),
+                static_cast< ::fortran_int_t >(n),
+                static_cast< ::fortran_int_t const* >(0),
+                &opt_lwork,
+                -1
+            );
+            lwork = ::std::max(lwork, static_cast<size_type>(::std::real(opt_lwork)));
+        }
+        getri_work_.resize(lwork, false);
+
+        n_ = n;
+    }
+
+
+    /// Return the size of the matrices this workspace is sized for.
+    public: size_type size() const
+    {
+        return n_;
+    }
+
+
+    /// Return the column-major copy of the matrix to invert.
+    public: work_matrix_type& work_matrix()
+    {
+        if (W_.size1() != n_ || W_.size2() != n_)
+        {
+            W_.resize(n_, n_, false);
+        }
+
+        return W_;
+    }
+
+
+    /// Return the pivot vector of the LU factorization.
+    public: pivots_vector_type& pivots()
+    {
+        return ipiv_;
+    }
+
+
+    /// Return the work array of \c getri.
+    public: work_vector_type& getri_work()
+    {
+        return getri_work_;
+    }
+
+
+    /// Return the work array of \c gecon.
+    public: work_vector_type& gecon_work()
+    {
+        return gecon_work_;
+    }
+
+
+    /// Return the auxiliary work array of \c gecon.
+    public: aux_work_vector_type& gecon_aux_work()
+    {
+        return gecon_aux_work_;
+    }
+
+
+    private: size_type n_;
+    private: work_matrix_type W_;
+    private: pivots_vector_type ipiv_;
+    private: work_vector_type getri_work_;
+    private: work_vector_type gecon_work_;
+    private: aux_work_vector_type gecon_aux_work_;
+};
+
+
+namespace detail {
+
+/// Invert in place a dense column-major matrix which can be directly passed to
+/// LAPACK.
+template <typename MatrixT, typename ValueT>
+inv_info<typename type_traits<ValueT>::real_type> inv_lapack_inplace(MatrixT& A, inv_workspace<ValueT>& ws)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    inv_info<real_type> info;
+    info.singular = false;
+    info.illcond = false;
+    info.rcond = real_type(1);
+
+    if (num_rows(A) == 0)
+    {
+        return info;
+    }
+
+    const real_type anorm = norm_1(A);
+
+    // Compute the LU factorization of A (just once)
+    ::std::ptrdiff_t ret;
+    ret = ::boost::numeric::bindings::lapack::getrf(A, ws.pivots());
+    if (ret > 0)
+    {
+        info.singular = true;
+        info.illcond = true;
+        info.rcond = real_type(0);
+
+        return info;
+    }
+
+    // Estimate the reciprocal condition number from the LU factors
+    ::boost::numeric::bindings::lapack::gecon(
+            'O',
+            A,
+            anorm,
+            info.rcond,
+            ::boost::numeric::bindings::lapack::workspace(ws.gecon_work(), ws.gecon_aux_work())
+        );
+
+    volatile real_type rp1 = info.rcond + real_type(1);
+    info.illcond = (rp1 == real_type(1)) || ::std::isnan(info.rcond);
+
+    // Compute the inverse from the LU factors
+    ::boost::numeric::bindings::lapack::getri(
+            A,
+            ws.pivots(),
+            ::boost::numeric::bindings::lapack::workspace(ws.getri_work())
+        );
+
+    return info;
+}
+
+
+/// Invert in place a dense column-major matrix.
+template <typename ValueT, typename ArrayT>
+inv_info<typename type_traits<ValueT>::real_type> inv_inplace_impl(matrix<ValueT,column_major,ArrayT>& A, inv_workspace<ValueT>& ws)
+{
+    return inv_lapack_inplace(A, ws);
+}
+
+
+/// Invert in place a generic matrix (by means of a column-major copy).
+template <typename MatrixT, typename ValueT>
+inv_info<typename type_traits<ValueT>::real_type> inv_inplace_impl(MatrixT& A, inv_workspace<ValueT>& ws)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    typename inv_workspace<ValueT>::work_matrix_type& W = ws.work_matrix();
+
+    W = A;
+
+    inv_info<real_type> info = inv_lapack_inplace(W, ws);
+
+    if (!info.singular)
+    {
+        A = W;
+    }
+
+    return info;
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Matrix inversion of a square matrix, using the given workspace.
+ *
+ * \param A The matrix to invert; on exit, it contains its inverse or, if the
+ *  matrix is singular, it is filled with \c Inf (like MATLAB does).
+ * \param ws The workspace, which is resized if needed.
+ * \return The outcome of the inversion, including the estimate of the
+ *  reciprocal condition number of the input matrix in the 1-norm.
+ *
+ * The matrix is factorized only once and no heap allocation is performed when
+ * \a ws is already sized for \a A and \a A is a dense column-major matrix.
  */
 template <typename MatrixT>
-bool inv_inplace(MatrixT& A)
+inv_info<
+    typename type_traits<
+        typename matrix_traits<MatrixT>::value_type
+    >::real_type
+> inv_inplace(MatrixT& A, inv_workspace<typename matrix_traits<MatrixT>::value_type>& ws)
 {
     typedef typename matrix_traits<MatrixT>::value_type value_type;
-    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
 
     //pre: A is square
     BOOST_UBLAS_CHECK(
@@ -53,18 +338,13 @@ bool inv_inplace(MatrixT& A)
         bad_size()
     );
 
-    // Compute the inverse X=A^{-1} as the solution of the linear system
-    //  AX = I
-
-    MatrixT X(identity_matrix<value_type>(num_rows(A)));
+    ws.resize(num_rows(A));
 
-    size_type sing;
-    sing = lu_solve_inplace(A, X);
+    inv_info<real_type> info = detail::inv_inplace_impl(A, ws);
 
-    // Check if matrix is singular
-    if (sing)
+    if (info.singular)
     {
-        BOOST_UBLASX_DEBUG_TRACE("Warning: Matrix is (nearly) singular: cannot compute its inverse.");
+        BOOST_UBLASX_DEBUG_TRACE("Warning: Matrix is singular: cannot compute its inverse.");
 
         // Fill the matrix with Inf (like MATLAB does)
         A = scalar_matrix<value_type>(
@@ -72,22 +352,36 @@ bool inv_inplace(MatrixT& A)
                 num_columns(A),
                 ::std::numeric_limits<value_type>::infinity()
             );
-
-        return false;
     }
-
-    // Check if matrix is ill-conditioned
-    if (illcond(A))
+    else if (info.illcond)
     {
         BOOST_UBLASX_DEBUG_TRACE("Warning: Matrix is close to singular or badly scaled.  Results may be inaccurate.");
-        ::std::clog << "[Warning] Matrix is close to singular or badly scaled.  Results may be inaccurate." << ::std::endl;
     }
 
-    A = X;
+    return info;
+}
+
+
+/**
+ * \brief Matrix inversion of a square matrix.
+ *
+ * \return \c true if the given input matrix is invertible; \c false is the
+ *  input matrix is singular.
+ *
+ * Use the overload taking an \c inv_workspace to get the estimate of the
+ * reciprocal condition number and to avoid the allocation of the work arrays.
+ */
+template <typename MatrixT>
+bool inv_inplace(MatrixT& A)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    inv_workspace<value_type> ws;
 
-    return true;
+    return !inv_inplace(A, ws).singular;
 }
 
+
 /**
  * \brief Matrix inversion of a square matrix.
  */
@@ -104,6 +398,73 @@ matrix<typename matrix_traits<MatrixExprT>::value_type> inv(matrix_expression<Ma
     return X;
 }
 
+
+/**
+ * \brief Matrix inversion of a square matrix, reporting the outcome of the
+ *  inversion.
+ */
+template <typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> inv(matrix_expression<MatrixExprT> const& A, inv_info<typename type_traits<typename matrix_traits<MatrixExprT>::value_type>::real_type>& info)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef matrix<value_type> out_matrix_type;
+
+    out_matrix_type X(A);
+    inv_workspace<value_type> ws;
+
+    info = inv_inplace(X, ws);
+
+    return X;
+}
+
+
+/**
+ * \brief Matrix inversion of a square matrix from an existing LU
+ *  decomposition.
+ *
+ * The inverse is computed from the cached LU factors (LAPACK \c getri), so that
+ * the decomposed matrix is not factorized again; if it is singular, the
+ * returned matrix is filled with \c Inf (like MATLAB does).
+ */
+template <typename ValueT>
+BOOST_UBLAS_INLINE
+typename lu_decomposition<ValueT>::inverse_matrix_type inv(lu_decomposition<ValueT> const& lu)
+{
+    typedef typename lu_decomposition<ValueT>::size_type size_type;
+    typedef typename lu_decomposition<ValueT>::real_type real_type;
+    typedef typename lu_decomposition<ValueT>::inverse_matrix_type inverse_matrix_type;
+
+    // pre: A is square
+    BOOST_UBLAS_CHECK( num_rows(lu.LU()) == num_columns(lu.LU()), bad_size() );
+
+    const size_type n = num_rows(lu.LU());
+
+    if (lu.singular())
+    {
+        return scalar_matrix<ValueT>(n, n, ::std::numeric_limits<real_type>::infinity());
+    }
+
+    inverse_matrix_type X(lu.LU());
+
+    if (n > 0)
+    {
+        // LAPACK pivots are 1-based
+        vector< ::fortran_int_t > ipiv(n);
+        for (size_type i = 0; i < n; ++i)
+        {
+            ipiv(i) = static_cast< ::fortran_int_t >(lu.P()(i)+1);
+        }
+
+        ::boost::numeric::bindings::lapack::getri(
+            X,
+            ipiv,
+            ::boost::numeric::bindings::lapack::optimal_workspace()
+        );
+    }
+
+    return X;
+}
+
 }}} // Namespace boost::numeric::ublasx
 
 
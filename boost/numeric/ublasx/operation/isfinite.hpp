@@ -57,6 +57,48 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Wrapper for ::std::isfinite.
+template <typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::disable_if<
+            ::boost::is_complex<T>,
+            int
+>::type isfinite_impl(T x)
+{
+    return ::std::isfinite(x);
+}
+
+
+/// Auxiliary function used to replace ::std::isfinite when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+            ::boost::is_complex<T>,
+            int
+>::type isfinite_impl(T x)
+{
+	// See the MATLAB's isfinite function
+	// (https://www.mathworks.com/help/matlab/ref/isfinite.html)
+
+	return ::std::isfinite(x.real()) && ::std::isfinite(x.imag());
+}
+
+
+/// Functor telling if its argument is finite.
+template <typename ArgT, typename ResT>
+struct isfinite_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return isfinite_impl<argument_type>(x);
+    }
+};
+
+
 /// Helper type traits used by the `isfinite` function when it takes a vector expresion as input paramter.
 template <typename VectorExprT>
 struct vector_isfinite_functor_traits
@@ -64,9 +106,10 @@ struct vector_isfinite_functor_traits
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef int signature_result_type;
+    typedef isfinite_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -80,41 +123,15 @@ struct matrix_isfinite_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef int signature_result_type;
+    typedef isfinite_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Wrapper for ::std::isfinite.
-template <typename T>
-BOOST_UBLAS_INLINE
-typename ::boost::disable_if<
-            ::boost::is_complex<T>,
-            int
->::type isfinite_impl(T x)
-{
-    return ::std::isfinite(x);
-}
-
-
-/// Auxiliary function used to replace ::std::isfinite when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-typename ::boost::enable_if<
-            ::boost::is_complex<T>,
-            int
->::type isfinite_impl(T x)
-{
-	// See the MATLAB's isfinite function
-	// (https://www.mathworks.com/help/matlab/ref/isfinite.html)
-
-	return ::std::isfinite(x.real()) && ::std::isfinite(x.imag());
-}
-
 } // Namespace detail
 
 
@@ -134,9 +151,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_isfinite_functor_traits<VectorExprT>::result_type isfinite(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_isfinite_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_isfinite_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::vector_isfinite_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::isfinite_impl<signature_argument_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -156,9 +173,9 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_isfinite_functor_traits<MatrixExprT>::result_type isfinite(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_isfinite_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_isfinite_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::matrix_isfinite_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::isfinite_impl<signature_argument_type>);
+    return expression_type(me(), functor_type());
 }
 
 }}} // Namespace boost::numeric::ublasx
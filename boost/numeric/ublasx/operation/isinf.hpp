@@ -65,6 +65,48 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Wrapper for ::std::isinf.
+template <typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::disable_if<
+            ::boost::is_complex<T>,
+            int
+>::type isinf_impl(T x)
+{
+    return ::std::isinf(x);
+}
+
+
+/// Auxiliary function used to replace ::std::isinf when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+            ::boost::is_complex<T>,
+            int
+>::type isinf_impl(T x)
+{
+    // See the MATLAB's isinf function
+    // (https://www.mathworks.com/help/matlab/ref/isinf.html)
+
+    return ::std::isinf(x.real()) || ::std::isinf(x.imag());
+}
+
+
+/// Functor telling if its argument is infinite.
+template <typename ArgT, typename ResT>
+struct isinf_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return isinf_impl<argument_type>(x);
+    }
+};
+
+
 /// Helper type traits used by the `isinf` function when it takes a matrix expresion as input paramter.
 template <typename VectorExprT>
 struct vector_isinf_functor_traits
@@ -72,9 +114,10 @@ struct vector_isinf_functor_traits
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef int signature_result_type;
+    typedef isinf_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -88,41 +131,15 @@ struct matrix_isinf_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef int signature_result_type;
+    typedef isinf_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Wrapper for ::std::isinf.
-template <typename T>
-BOOST_UBLAS_INLINE
-typename ::boost::disable_if<
-            ::boost::is_complex<T>,
-            int
->::type isinf_impl(T x)
-{
-    return ::std::isinf(x);
-}
-
-
-/// Auxiliary function used to replace ::std::isinf when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-typename ::boost::enable_if<
-            ::boost::is_complex<T>,
-            int
->::type isinf_impl(T x)
-{
-    // See the MATLAB's isinf function
-    // (https://www.mathworks.com/help/matlab/ref/isinf.html)
-
-    return ::std::isinf(x.real()) || ::std::isinf(x.imag());
-}
-
 } // Namespace detail
 
 
@@ -144,9 +161,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_isinf_functor_traits<VectorExprT>::result_type isinf(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_isinf_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_isinf_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::vector_isinf_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::isinf_impl<signature_argument_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -168,9 +185,9 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_isinf_functor_traits<MatrixExprT>::result_type isinf(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_isinf_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_isinf_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::matrix_isinf_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::isinf_impl<signature_argument_type>);
+    return expression_type(me(), functor_type());
 }
 
 }}} // Namespace boost::numeric::ublasx
@@ -24,6 +24,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 
 
@@ -33,15 +34,40 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Auxiliary function used to replace ::std::log2 when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+T log(T x)
+{
+    return ::std::log(x);
+}
+
+
+/// Functor computing the natural logarithm of its argument.
+template <typename ArgT, typename ResT>
+struct log_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return detail::log<result_type>(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_log_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef log_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -54,23 +80,15 @@ struct matrix_log_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef log_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Auxiliary function used to replace ::std::log2 when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-T log(T x)
-{
-    return ::std::log(x);
-}
-
 } // Namespace detail
 
 
@@ -91,9 +109,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_log_functor_traits<VectorExprT>::result_type log(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_log_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_log_functor_traits<VectorExprT>::signature_result_type signature_result_type;
+    typedef typename detail::vector_log_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::log<signature_result_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -114,11 +132,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_log_functor_traits<MatrixExprT>::result_type log(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_log_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_log_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_log_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::log<signature_result_type>);
+    return expression_type(me(), functor_type());
 }
 
+
+// log(policy, e), which evaluates log(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(log)
+
 }}} // Namespace boost::numeric::ublasx
 
 
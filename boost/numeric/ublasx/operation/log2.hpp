@@ -24,6 +24,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 #include <complex>
 
@@ -34,15 +35,42 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Auxiliary function used to replace ::std::log2 when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+T log2(T x)
+{
+  // C++0x and higher has std::log2 but it 
+  // doesn't work with complex numbers.
+    return ::std::log(x)/::std::log(2);
+}
+
+
+/// Functor computing the base-2 logarithm of its argument.
+template <typename ArgT, typename ResT>
+struct log2_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return detail::log2<result_type>(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_log2_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef log2_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -55,25 +83,15 @@ struct matrix_log2_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef log2_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Auxiliary function used to replace ::std::log2 when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-T log2(T x)
-{
-  // C++0x and higher has std::log2 but it 
-  // doesn't work with complex numbers.
-    return ::std::log(x)/::std::log(2);
-}
-
 } // Namespace detail
 
 
@@ -93,9 +111,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_log2_functor_traits<VectorExprT>::result_type log2(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_log2_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_log2_functor_traits<VectorExprT>::signature_result_type signature_result_type;
+    typedef typename detail::vector_log2_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::log2<signature_result_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -115,13 +133,18 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_log2_functor_traits<MatrixExprT>::result_type log2(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_log2_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_log2_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_log2_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::log2<signature_result_type>);
+    return expression_type(me(), functor_type());
 }
 
+
 //TODO: added variant for log(A, F, E), where F is the output mantissa array and E is the exponent array such that A = F .*2.^E. To do so, apply the `f = std::frexp(a, &e)` function to each element of A; complex values must be treated separately
 
+
+// log2(policy, e), which evaluates log2(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(log2)
+
 }}} // Namespace boost::numeric::ublasx
 
 
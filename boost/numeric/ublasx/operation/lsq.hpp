@@ -22,7 +22,10 @@
 
 #include <algorithm>
 #include <boost/numeric/bindings/lapack/driver/gels.hpp>
+#include <boost/numeric/bindings/lapack/driver/gelsd.hpp>
 #include <boost/numeric/bindings/lapack/driver/gelss.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
+#include <boost/numeric/bindings/tag.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/ublas/detail/temporary.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
@@ -30,10 +33,15 @@
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/lapack.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/rcond.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/operation/svd.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <cstddef>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -96,64 +104,356 @@ void llsq_qr_impl(matrix_expression<MatrixT> const& A, VectorT& b, row_major_tag
 }
 
 
-template <typename MatrixT, typename VectorT>
-void llsq_svd_impl(MatrixT& A, VectorT& b, column_major_tag)
+/// Optimal workspace query of LAPACK \c gels.
+template <typename ValueT>
+void gels_query(::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t nrhs, ValueT* opt_work)
 {
-    typedef typename matrix_traits<MatrixT>::value_type value_type;
-    typedef typename type_traits<value_type>::real_type real_type;
-    typedef typename promote_traits<
-                typename matrix_traits<MatrixT>::size_type,
-                typename vector_traits<VectorT>::size_type
-        >::promote_type size_type;
-    typedef vector<real_type> work_vector_type;
+    ::boost::numeric::bindings::lapack::detail::gels(::boost::numeric::bindings::tag::no_transpose(), m, n, nrhs, 0, ::std::max(m, ::fortran_int_t(1)), 0, ::std::max(::std::max(m, n), ::fortran_int_t(1)), opt_work, -1);
+}
 
-    size_type m = num_rows(A);
-    size_type n = num_columns(A);
-    size_type k = ::std::min(m, n);
-    real_type rc = rcond(A);
-    ::fortran_int_t r;
-    //work_vector_type tmp_b(b);//TODO: should we do this in order to avoid problem with other types of vector (like sparse vector)
-    work_vector_type dummy_s(k);
 
-    ::boost::numeric::bindings::lapack::gelss(A, b, dummy_s, rc, r);
+/// Optimal workspace query of LAPACK \c gelss for real matrices.
+template <typename ValueT, typename RealT, typename RWorkVectorT>
+void gelss_query(::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t nrhs, RealT rc, ValueT* opt_work, RWorkVectorT&, ::boost::false_type)
+{
+    ::fortran_int_t r = 0;
+    ::boost::numeric::bindings::lapack::detail::gelss(m, n, nrhs, 0, ::std::max(m, ::fortran_int_t(1)), 0, ::std::max(::std::max(m, n), ::fortran_int_t(1)), 0, rc, r, opt_work, -1);
+}
 
-    b.resize(n, true);
+
+/// Optimal workspace query of LAPACK \c gelss for complex matrices.
+template <typename ValueT, typename RealT, typename RWorkVectorT>
+void gelss_query(::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t nrhs, RealT rc, ValueT* opt_work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    ::fortran_int_t r = 0;
+    ::boost::numeric::bindings::lapack::detail::gelss(m, n, nrhs, 0, ::std::max(m, ::fortran_int_t(1)), 0, ::std::max(::std::max(m, n), ::fortran_int_t(1)), 0, rc, r, opt_work, -1, &rwork[0]);
 }
 
 
-template <typename MatrixT, typename VectorT>
-void llsq_svd_impl(MatrixT& A, VectorT& b, row_major_tag)
+/// Optimal workspace query of LAPACK \c gelsd for real matrices.
+template <typename ValueT, typename RealT>
+void gelsd_query(::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t nrhs, RealT rc, ValueT* opt_work, RealT*, ::fortran_int_t* opt_iwork, ::boost::false_type)
 {
-    typedef typename matrix_traits<MatrixT>::value_type value_type;
-    typedef matrix<value_type, column_major> colmaj_matrix_type;
+    ::fortran_int_t r = 0;
+    ::boost::numeric::bindings::lapack::detail::gelsd(m, n, nrhs, 0, ::std::max(m, ::fortran_int_t(1)), 0, ::std::max(::std::max(m, n), ::fortran_int_t(1)), 0, rc, r, opt_work, -1, opt_iwork);
+}
+
+
+/// Optimal workspace query of LAPACK \c gelsd for complex matrices.
+template <typename ValueT, typename RealT>
+void gelsd_query(::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t nrhs, RealT rc, ValueT* opt_work, RealT* opt_rwork, ::fortran_int_t* opt_iwork, ::boost::true_type)
+{
+    ::fortran_int_t r = 0;
+    ::boost::numeric::bindings::lapack::detail::gelsd(m, n, nrhs, 0, ::std::max(m, ::fortran_int_t(1)), 0, ::std::max(::std::max(m, n), ::fortran_int_t(1)), 0, rc, r, opt_work, -1, opt_rwork, opt_iwork);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the linear least square solvers.
+ *
+ * Owns the work arrays needed by LAPACK \c gels (QR method) and \c gelss or
+ * \c gelsd (SVD method) together with the scratch matrix used to hold the
+ * column-major copy of the design matrix (which is overwritten by LAPACK) and
+ * the singular values computed by the SVD method.
+ * The optimal size of the work arrays is queried (\c lwork=-1) only when the
+ * method or the problem size change, so that repeated solutions of same-sized
+ * problems do not allocate memory.
+ *
+ * \tparam ValueT The type of the elements of the design matrix.
+ */
+template <typename ValueT>
+class llsq_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+    public: typedef vector<real_type> real_work_vector_type;
+    public: typedef vector< ::fortran_int_t > integer_work_vector_type;
+
+
+    /// Default constructor.
+    public: llsq_workspace()
+        : m_(0),
+          n_(0),
+          method_(no_method)
+    {
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the QR method (LAPACK \c gels) with a
+     *  \a m by \a n design matrix.
+     */
+    public: void resize_qr(size_type m, size_type n)
+    {
+        if (method_ == qr_method && m == m_ && n == n_)
+        {
+            return;
+        }
+
+        value_type opt_work = 0;
+        detail::gels_query(static_cast< ::fortran_int_t >(m),
+                           static_cast< ::fortran_int_t >(n),
+                           1,
+                           &opt_work);
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        m_ = m;
+        n_ = n;
+        method_ = qr_method;
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the SVD method with a \a m by \a n
+     *  design matrix.
+     *
+     * The SVD is computed by LAPACK \c gelsd if \a alg is
+     * \c gesdd_svd_algorithm, and by LAPACK \c gelss otherwise.
+     */
+    public: void resize_svd(size_type m, size_type n, svd_algorithm alg = gesvd_svd_algorithm)
+    {
+        const method_category method = (alg == gesdd_svd_algorithm) ? svd_dc_method : svd_method;
+
+        if (method_ == method && m == m_ && n == n_)
+        {
+            return;
+        }
+
+        const size_type k = ::std::min(m, n);
+
+        s_.resize(::std::max(k, size_type(detail::lapack::min_array_size)), false);
+
+        value_type opt_work = 0;
+        if (method == svd_dc_method)
+        {
+            real_type opt_rwork = 0;
+            ::fortran_int_t opt_iwork = 0;
+            detail::gelsd_query(static_cast< ::fortran_int_t >(m),
+                                static_cast< ::fortran_int_t >(n),
+                                1,
+                                real_type(-1),
+                                &opt_work,
+                                &opt_rwork,
+                                &opt_iwork,
+                                ::boost::is_complex<value_type>());
+            if (::boost::is_complex<value_type>::value)
+            {
+                rwork_.resize(::std::max(static_cast<size_type>(opt_rwork), size_type(1)), false);
+            }
+            iwork_.resize(::std::max(static_cast<size_type>(opt_iwork), size_type(1)), false);
+        }
+        else
+        {
+            if (::boost::is_complex<value_type>::value)
+            {
+                rwork_.resize(::std::max(5*k, size_type(1)), false);
+            }
+            detail::gelss_query(static_cast< ::fortran_int_t >(m),
+                                static_cast< ::fortran_int_t >(n),
+                                1,
+                                real_type(-1),
+                                &opt_work,
+                                rwork_,
+                                ::boost::is_complex<value_type>());
+        }
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        m_ = m;
+        n_ = n;
+        method_ = method;
+    }
+
+
+    /// Return the scratch matrix for the copy of the design matrix.
+    public: work_matrix_type& work_matrix()
+    {
+        return A_;
+    }
+
+
+    /// Return the scratch vector for the singular values (SVD method).
+    public: real_work_vector_type& singular_values()
+    {
+        return s_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// Return the real work array (used for complex matrices only).
+    public: real_work_vector_type& rwork()
+    {
+        return rwork_;
+    }
+
+
+    /// Return the integer work array (used by LAPACK \c gelsd only).
+    public: integer_work_vector_type& iwork()
+    {
+        return iwork_;
+    }
+
+
+    /// The least square methods this workspace can be prepared for.
+    private: enum method_category
+    {
+        no_method,
+        qr_method,
+        svd_method, ///< SVD method by LAPACK \c gelss.
+        svd_dc_method ///< SVD method by LAPACK \c gelsd.
+    };
+
+
+    /// The number of rows of the design matrices this workspace is prepared for.
+    private: size_type m_;
+    /// The number of columns of the design matrices this workspace is prepared for.
+    private: size_type n_;
+    /// The least square method this workspace is prepared for.
+    private: method_category method_;
+    /// The scratch matrix for the copy of the design matrix.
+    private: work_matrix_type A_;
+    /// The scratch vector for the singular values.
+    private: real_work_vector_type s_;
+    /// The work array.
+    private: work_vector_type work_;
+    /// The real work array.
+    private: real_work_vector_type rwork_;
+    /// The integer work array.
+    private: integer_work_vector_type iwork_;
+};
+
+
+namespace detail {
+
+/// Copy the design matrix \a A into the scratch matrix of the given workspace.
+template <typename MatrixT, typename ValueT>
+typename llsq_workspace<ValueT>::work_matrix_type& llsq_copy_design_matrix(matrix_expression<MatrixT> const& A, llsq_workspace<ValueT>& ws)
+{
+    typename llsq_workspace<ValueT>::work_matrix_type& tmp_A = ws.work_matrix();
+
+    if (num_rows(tmp_A) != num_rows(A) || num_columns(tmp_A) != num_columns(A))
+    {
+        tmp_A.resize(num_rows(A), num_columns(A), false);
+    }
+    noalias(tmp_A) = A;
+
+    return tmp_A;
+}
+
+
+/// Call LAPACK \c gelss with the work arrays of the given workspace (real
+/// case).
+template <typename MatrixT, typename VectorT, typename RealT, typename ValueT>
+void llsq_gelss(MatrixT& A, VectorT& b, RealT rc, ::fortran_int_t& r, llsq_workspace<ValueT>& ws, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::gelss(A, b, ws.singular_values(), rc, r, ::boost::numeric::bindings::lapack::workspace(ws.work()));
+}
+
+
+/// Call LAPACK \c gelss with the work arrays of the given workspace (complex
+/// case).
+template <typename MatrixT, typename VectorT, typename RealT, typename ValueT>
+void llsq_gelss(MatrixT& A, VectorT& b, RealT rc, ::fortran_int_t& r, llsq_workspace<ValueT>& ws, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::gelss(A, b, ws.singular_values(), rc, r, ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork()));
+}
 
-    colmaj_matrix_type tmp_A(A);
 
-    llsq_svd_impl(tmp_A, b, column_major_tag());
+/// Call LAPACK \c gelsd with the work arrays of the given workspace (real
+/// case).
+template <typename MatrixT, typename VectorT, typename RealT, typename ValueT>
+void llsq_gelsd(MatrixT& A, VectorT& b, RealT rc, ::fortran_int_t& r, llsq_workspace<ValueT>& ws, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::gelsd(A, b, ws.singular_values(), rc, r, ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.iwork()));
+}
+
+
+/// Call LAPACK \c gelsd with the work arrays of the given workspace (complex
+/// case).
+template <typename MatrixT, typename VectorT, typename RealT, typename ValueT>
+void llsq_gelsd(MatrixT& A, VectorT& b, RealT rc, ::fortran_int_t& r, llsq_workspace<ValueT>& ws, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::gelsd(A, b, ws.singular_values(), rc, r, ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork(), ws.iwork()));
 }
 
 
 template <typename MatrixT, typename VectorT>
-void llsq_svd_impl(matrix_expression<MatrixT> const& A, VectorT& b, column_major_tag)
+void llsq_qr_impl(matrix_expression<MatrixT> const& A, VectorT& b, llsq_workspace<typename matrix_traits<MatrixT>::value_type>& ws)
 {
     typedef typename matrix_traits<MatrixT>::value_type value_type;
-    typedef matrix<value_type, column_major> colmaj_matrix_type;
 
-    colmaj_matrix_type tmp_A(A);
+    typename llsq_workspace<value_type>::work_matrix_type& tmp_A = llsq_copy_design_matrix(A, ws);
 
-    llsq_svd_impl(tmp_A, b, column_major_tag());
+    ws.resize_qr(num_rows(tmp_A), num_columns(tmp_A));
+
+    ::boost::numeric::bindings::lapack::gels(tmp_A, b, ::boost::numeric::bindings::lapack::workspace(ws.work()));
+
+    b.resize(num_columns(tmp_A), true);
+}
+
+
+/**
+ * \brief Solve the least square problem by the SVD method, overwriting the
+ *  column-major design matrix \a A.
+ *
+ * The reciprocal condition number of \a A is used as threshold to determine
+ * the effective rank of \a A.
+ */
+template <typename MatrixT, typename VectorT, typename ValueT>
+void llsq_svd_solve(MatrixT& A, VectorT& b, svd_algorithm alg, llsq_workspace<ValueT>& ws)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    const ::std::size_t m = num_rows(A);
+    const ::std::size_t n = num_columns(A);
+
+    alg = select_svd_algorithm(alg, m, n, true, true, true, true);
+
+    ws.resize_svd(m, n, alg);
+
+    real_type rc = rcond(A);
+    ::fortran_int_t r;
+
+    if (alg == gesdd_svd_algorithm)
+    {
+        llsq_gelsd(A, b, rc, r, ws, ::boost::is_complex<ValueT>());
+    }
+    else
+    {
+        llsq_gelss(A, b, rc, r, ws, ::boost::is_complex<ValueT>());
+    }
+
+    b.resize(n, true);
+}
+
+
+template <typename MatrixT, typename VectorT>
+void llsq_svd_impl(matrix_expression<MatrixT> const& A, VectorT& b, svd_algorithm alg, llsq_workspace<typename matrix_traits<MatrixT>::value_type>& ws)
+{
+    llsq_svd_solve(llsq_copy_design_matrix(A, ws), b, alg, ws);
 }
 
 
 template <typename MatrixT, typename VectorT>
-void llsq_svd_impl(matrix_expression<MatrixT> const& A, VectorT& b, row_major_tag)
+void llsq_svd_impl(matrix_expression<MatrixT> const& A, VectorT& b, svd_algorithm alg)
 {
     typedef typename matrix_traits<MatrixT>::value_type value_type;
     typedef matrix<value_type, column_major> colmaj_matrix_type;
 
     colmaj_matrix_type tmp_A(A);
+    llsq_workspace<value_type> ws;
 
-    llsq_svd_impl(tmp_A, b, column_major_tag());
+    llsq_svd_solve(tmp_A, b, alg, ws);
 }
 
 } // Namespace detail
@@ -182,6 +482,26 @@ void llsq_qr_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b)
 }
 
 
+/**
+ * \brief Solve the linear (ordinary) least square problem by using the QR
+ *  decomposition and a reusable workspace.
+ * \tparam MatrixExprT Type of the input matrix expression.
+ * \tparam VectorExprT Type of the input/output vector.
+ * \param A The input matrix expression (i.e., the design matrix).
+ * \param b On entry, the input vector (i.e., the observations vector); on exit,
+ *  the least square solution.
+ * \param ws The workspace holding the LAPACK work array and the copy of the
+ *  design matrix; once sized, repeated solutions of same-sized problems do not
+ *  allocate memory (apart from shrinking \a b to the solution size).
+ */
+template <typename MatrixExprT, typename VectorT>
+BOOST_UBLAS_INLINE
+void llsq_qr_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b, llsq_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    detail::llsq_qr_impl(A, b, ws);
+}
+
+
 /**
  * \brief Solve the linear (ordinary) least square problem by using the QR
  *  decomposition.
@@ -218,6 +538,9 @@ typename vector_temporary_traits<VectorExprT>::type llsq_qr(matrix_expression<Ma
  * \param b On entry, the input vector (i.e., the observations vector); on exit,
  *  the least square solution.
  *
+ * \param alg The SVD driver: \c gesvd_svd_algorithm selects LAPACK \c gelss,
+ *  \c gesdd_svd_algorithm selects the divide-and-conquer LAPACK \c gelsd.
+ *
  * This method is the most computationally intensive, but is particularly useful
  * if the normal equations matrix is very ill-conditioned (i.e. if its condition
  * number multiplied by the machine's relative round-off error is appreciably
@@ -225,11 +548,34 @@ typename vector_temporary_traits<VectorExprT>::type llsq_qr(matrix_expression<Ma
  */
 template <typename MatrixExprT, typename VectorT>
 BOOST_UBLAS_INLINE
-void llsq_svd_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b)
+void llsq_svd_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b, svd_algorithm alg = auto_svd_algorithm)
 {
-    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
+    detail::llsq_svd_impl(A, b, alg);
+}
+
 
-    detail::llsq_svd_impl(A, b, orientation_category());
+/**
+ * \brief Solve the linear (ordinary) least square problem by using the Singular
+ *  Value Decomposition (SVD) method and a reusable workspace.
+ * \tparam MatrixExprT Type of the input matrix expression.
+ * \tparam VectorExprT Type of the input/output vector.
+ * \param A The input matrix expression (i.e., the design matrix).
+ * \param b On entry, the input vector (i.e., the observations vector); on exit,
+ *  the least square solution.
+ * \param ws The workspace holding the LAPACK work arrays, the singular values
+ *  and the copy of the design matrix.
+ * \param alg The SVD driver: \c gesvd_svd_algorithm selects LAPACK \c gelss,
+ *  \c gesdd_svd_algorithm selects the divide-and-conquer LAPACK \c gelsd.
+ *
+ * Only the LAPACK \c gelss (or \c gelsd) call takes its storage from \a ws;
+ * the estimate of the reciprocal condition number used as rank threshold
+ * still uses its own temporaries.
+ */
+template <typename MatrixExprT, typename VectorT>
+BOOST_UBLAS_INLINE
+void llsq_svd_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b, llsq_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, svd_algorithm alg = auto_svd_algorithm)
+{
+    detail::llsq_svd_impl(A, b, alg, ws);
 }
 
 
@@ -240,6 +586,8 @@ void llsq_svd_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b)
  * \tparam VectorExprT Type of the input/output vector.
  * \param A The input matrix expression (i.e., the design matrix).
  * \param b The input vector (i.e., the observations vector).
+ * \param alg The SVD driver: \c gesvd_svd_algorithm selects LAPACK \c gelss,
+ *  \c gesdd_svd_algorithm selects the divide-and-conquer LAPACK \c gelsd.
  * \return The least square solution.
  *
  * This method is the most computationally intensive, but is particularly useful
@@ -249,13 +597,13 @@ void llsq_svd_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b)
  */
 template <typename MatrixExprT, typename VectorExprT>
 BOOST_UBLAS_INLINE
-typename vector_temporary_traits<VectorExprT>::type llsq_svd(matrix_expression<MatrixExprT> const& A, vector_expression<VectorExprT> const& b)
+typename vector_temporary_traits<VectorExprT>::type llsq_svd(matrix_expression<MatrixExprT> const& A, vector_expression<VectorExprT> const& b, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename vector_temporary_traits<VectorExprT>::type out_vector_type;
 
     out_vector_type x(b);
 
-    llsq_svd_inplace(A, x);
+    llsq_svd_inplace(A, x, alg);
 
     return x;
 }
@@ -273,9 +621,7 @@ template <typename MatrixExprT, typename VectorT>
 BOOST_UBLAS_INLINE
 void llsq_inplace(matrix_expression<MatrixExprT> const& A, VectorT& b)
 {
-    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
-
-    detail::llsq_svd_impl(A, b, orientation_category());
+    detail::llsq_svd_impl(A, b, auto_svd_algorithm);
 }
 
 
@@ -22,6 +22,13 @@
  * having the same number of rows as \f$A\f$, while \f$U\f$ is exactly the same
  * shape as \f$A\f$.
  *
+ * The factorization is computed by a cache-blocked recursive algorithm, which
+ * does not need LAPACK.
+ * If the \c BOOST_UBLASX_USE_LAPACK macro is defined, dense column-major
+ * matrices of \c float, \c double and their complex counterparts are
+ * factorized and solved by LAPACK \c getrf and \c getrs instead (and LAPACK
+ * must be linked).
+ *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
  * <hr/>
@@ -36,26 +43,412 @@
 #ifndef BOOST_NUMERIC_UBLASX_OPERATION_LU_HPP
 #define BOOST_NUMERIC_UBLASX_OPERATION_LU_HPP
 
-//TODO: Use LAPACK functions in order to handle different types of matrices.
 //TODO: How about full pivoting?
-//TODO: Create a \c lu_decomposition class (e.g., \sa qr.hpp).
 
 
+#include <algorithm>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/numeric/ublas/detail/temporary.hpp>
 #include <boost/numeric/ublas/exception.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/triangular.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/lapack.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#ifdef BOOST_UBLASX_USE_LAPACK
+# include <boost/numeric/bindings/lapack/computational/getrf.hpp>
+# include <boost/numeric/bindings/lapack/computational/getrs.hpp>
+# include <boost/numeric/bindings/ublas.hpp>
+#endif // BOOST_UBLASX_USE_LAPACK
 
 
 namespace boost { namespace numeric { namespace ublasx {
 
 using namespace ::boost::numeric::ublas;
 
+namespace detail {
+
+/// Number of columns below which the recursive LU switches to the unblocked
+/// algorithm.
+static const ::std::size_t lu_recursion_min_columns = 16;
+
+
+/// Swap rows \a r1 and \a r2 of \a A.
+template <typename MatrixT>
+void lu_swap_rows(MatrixT& A, typename matrix_traits<MatrixT>::size_type r1, typename matrix_traits<MatrixT>::size_type r2)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+    const size_type nc = num_columns(A);
+    for (size_type j = 0; j < nc; ++j)
+    {
+        ::std::swap(A(r1,j), A(r2,j));
+    }
+}
+
+
+/**
+ * \brief Rank-1 update \f$A_{r+1:m,c+1:e} -= A_{r+1:m,c} A_{r,c+1:e}\f$
+ *  (row-major traversal).
+ */
+template <typename MatrixT>
+void lu_rank1_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type e, row_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = num_rows(A);
+    for (size_type i = r+1; i < nr; ++i)
+    {
+        const value_type l = A(i,c);
+        if (l != value_type(0))
+        {
+            for (size_type j = c+1; j < e; ++j)
+            {
+                A(i,j) -= l*A(r,j);
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Rank-1 update \f$A_{r+1:m,c+1:e} -= A_{r+1:m,c} A_{r,c+1:e}\f$
+ *  (column-major traversal).
+ */
+template <typename MatrixT>
+void lu_rank1_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type e, column_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = num_rows(A);
+    for (size_type j = c+1; j < e; ++j)
+    {
+        const value_type u = A(r,j);
+        if (u != value_type(0))
+        {
+            for (size_type i = r+1; i < nr; ++i)
+            {
+                A(i,j) -= A(i,c)*u;
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Solve \f$L_{11} X = A_{12}\f$ in place, where \f$L_{11}\f$ is the
+ *  unit lower triangular block of order \a n1 starting at (\a r, \a c) and
+ *  \f$A_{12}\f$ is the \a n1 by \a n2 block on its right (row-major
+ *  traversal).
+ */
+template <typename MatrixT>
+void lu_trsm_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type n1, typename matrix_traits<MatrixT>::size_type n2, row_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type c2 = c+n1;
+    for (size_type i = 1; i < n1; ++i)
+    {
+        for (size_type p = 0; p < i; ++p)
+        {
+            const value_type l = A(r+i,c+p);
+            if (l != value_type(0))
+            {
+                for (size_type j = c2; j < c2+n2; ++j)
+                {
+                    A(r+i,j) -= l*A(r+p,j);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Solve \f$L_{11} X = A_{12}\f$ in place, where \f$L_{11}\f$ is the
+ *  unit lower triangular block of order \a n1 starting at (\a r, \a c) and
+ *  \f$A_{12}\f$ is the \a n1 by \a n2 block on its right (column-major
+ *  traversal).
+ */
+template <typename MatrixT>
+void lu_trsm_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type n1, typename matrix_traits<MatrixT>::size_type n2, column_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type c2 = c+n1;
+    for (size_type j = c2; j < c2+n2; ++j)
+    {
+        for (size_type p = 0; p < n1; ++p)
+        {
+            const value_type x = A(r+p,j);
+            if (x != value_type(0))
+            {
+                for (size_type i = p+1; i < n1; ++i)
+                {
+                    A(r+i,j) -= A(r+i,c+p)*x;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Schur complement update \f$A_{22} -= L_{21} U_{12}\f$, where
+ *  \f$L_{21}\f$ has \a n1 columns starting at (\a r + \a n1, \a c) and
+ *  \f$U_{12}\f$ has \a n2 columns starting at (\a r, \a c + \a n1)
+ *  (row-major traversal).
+ */
+template <typename MatrixT>
+void lu_gemm_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type n1, typename matrix_traits<MatrixT>::size_type n2, row_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = num_rows(A);
+    const size_type c2 = c+n1;
+    for (size_type i = r+n1; i < nr; ++i)
+    {
+        for (size_type p = 0; p < n1; ++p)
+        {
+            const value_type l = A(i,c+p);
+            if (l != value_type(0))
+            {
+                for (size_type j = c2; j < c2+n2; ++j)
+                {
+                    A(i,j) -= l*A(r+p,j);
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Schur complement update \f$A_{22} -= L_{21} U_{12}\f$, where
+ *  \f$L_{21}\f$ has \a n1 columns starting at (\a r + \a n1, \a c) and
+ *  \f$U_{12}\f$ has \a n2 columns starting at (\a r, \a c + \a n1)
+ *  (column-major traversal).
+ */
+template <typename MatrixT>
+void lu_gemm_update(MatrixT& A, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type n1, typename matrix_traits<MatrixT>::size_type n2, column_major_tag)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = num_rows(A);
+    const size_type c2 = c+n1;
+    for (size_type j = c2; j < c2+n2; ++j)
+    {
+        for (size_type p = 0; p < n1; ++p)
+        {
+            const value_type u = A(r+p,j);
+            if (u != value_type(0))
+            {
+                for (size_type i = r+n1; i < nr; ++i)
+                {
+                    A(i,j) -= A(i,c+p)*u;
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * \brief Recursive LU factorization with partial pivoting of the \a n columns
+ *  of \a A starting at column \a c, restricted to the rows starting at row
+ *  \a r.
+ *
+ * The columns are split in two halves: the left half is factorized
+ * recursively, the right half is updated with a triangular solve and a matrix
+ * product (where most of the work takes place, on blocks which get smaller
+ * and smaller so that they eventually fit in cache), and finally the trailing
+ * submatrix is factorized recursively.
+ * Row interchanges are applied to whole rows, like in LAPACK \c getrf.
+ *
+ * \return Zero or 1 + the number of the first row with a zero pivot.
+ */
+template <typename MatrixT, typename PermutationMatrixT>
+typename matrix_traits<MatrixT>::size_type lu_recursive(MatrixT& A, PermutationMatrixT& P, typename matrix_traits<MatrixT>::size_type r, typename matrix_traits<MatrixT>::size_type c, typename matrix_traits<MatrixT>::size_type n)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+    typedef typename matrix_traits<MatrixT>::orientation_category orientation_category;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    size_type singular = 0;
+
+    if (n <= lu_recursion_min_columns)
+    {
+        // Unblocked algorithm (the same of ublas::lu_factorize)
+
+        const size_type nr = num_rows(A);
+        for (size_type s = 0; s < n; ++s)
+        {
+            const size_type ri = r+s;
+            const size_type ci = c+s;
+
+            // Find the pivot
+            size_type ip = ri;
+            real_type pmax = type_traits<value_type>::norm_inf(A(ri,ci));
+            for (size_type i = ri+1; i < nr; ++i)
+            {
+                const real_type t = type_traits<value_type>::norm_inf(A(i,ci));
+                if (t > pmax)
+                {
+                    pmax = t;
+                    ip = i;
+                }
+            }
+
+            P(ri) = ip;
+            if (A(ip,ci) != value_type(0))
+            {
+                if (ip != ri)
+                {
+                    lu_swap_rows(A, ri, ip);
+                }
+                const value_type pinv = value_type(1)/A(ri,ci);
+                for (size_type i = ri+1; i < nr; ++i)
+                {
+                    A(i,ci) *= pinv;
+                }
+            }
+            else if (singular == 0)
+            {
+                singular = ri+1;
+            }
+
+            lu_rank1_update(A, ri, ci, c+n, orientation_category());
+        }
+
+        return singular;
+    }
+
+    const size_type n1 = n/2;
+    const size_type n2 = n-n1;
+
+    singular = lu_recursive(A, P, r, c, n1);
+
+    lu_trsm_update(A, r, c, n1, n2, orientation_category());
+    lu_gemm_update(A, r, c, n1, n2, orientation_category());
+
+    const size_type singular2 = lu_recursive(A, P, r+n1, c+n1, n2);
+    if (singular == 0)
+    {
+        singular = singular2;
+    }
+
+    return singular;
+}
+
+
+/// LU factorization with partial pivoting by the cache-blocked recursive
+/// algorithm.
+template <typename MatrixT, typename PermutationMatrixT>
+typename matrix_traits<MatrixT>::size_type lu_decompose_inplace_impl(MatrixT& A, PermutationMatrixT& P, ::boost::mpl::false_)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+    typedef typename matrix_traits<MatrixT>::orientation_category orientation_category;
+
+    const size_type nr = num_rows(A);
+    const size_type nc = num_columns(A);
+    const size_type k = ::std::min(nr, nc);
+
+    size_type singular = lu_recursive(A, P, 0, 0, k);
+
+    // For wide matrices, compute the remaining columns of U
+    if (nc > k)
+    {
+        lu_trsm_update(A, 0, 0, k, nc-k, orientation_category());
+    }
+
+    return singular;
+}
+
+
+/// Complete the LUP forward/backward substitution by means of ublas.
+template <typename LUMatrixT, typename PermutationMatrixT, typename BT>
+void lu_apply_inplace_impl(LUMatrixT const& LU, PermutationMatrixT const& P, BT& B, ::boost::mpl::false_)
+{
+    lu_substitute(LU, P, B);
+}
+
+
+#ifdef BOOST_UBLASX_USE_LAPACK
+
+/// LU factorization with partial pivoting by LAPACK \c getrf.
+template <typename MatrixT, typename PermutationMatrixT>
+typename matrix_traits<MatrixT>::size_type lu_decompose_inplace_impl(MatrixT& A, PermutationMatrixT& P, ::boost::mpl::true_)
+{
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+    const size_type k = ::std::min(num_rows(A), num_columns(A));
+
+    if (k == 0)
+    {
+        return 0;
+    }
+
+    vector< ::fortran_int_t > ipiv(k);
+
+    ::std::ptrdiff_t info;
+    info = ::boost::numeric::bindings::lapack::getrf(A, ipiv);
+
+    // LAPACK pivots are 1-based
+    for (size_type i = 0; i < k; ++i)
+    {
+        P(i) = static_cast<size_type>(ipiv(i)-1);
+    }
+
+    return info > 0 ? static_cast<size_type>(info) : size_type(0);
+}
+
+
+/// Complete the LUP forward/backward substitution by LAPACK \c getrs.
+template <typename LUMatrixT, typename PermutationMatrixT, typename BT>
+void lu_apply_inplace_impl(LUMatrixT const& LU, PermutationMatrixT const& P, BT& B, ::boost::mpl::true_)
+{
+    typedef typename matrix_traits<LUMatrixT>::size_type size_type;
+
+    const size_type n = num_rows(LU);
+
+    if (n == 0)
+    {
+        return;
+    }
+
+    // LAPACK pivots are 1-based
+    vector< ::fortran_int_t > ipiv(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        ipiv(i) = static_cast< ::fortran_int_t >(P(i)+1);
+    }
+
+    ::boost::numeric::bindings::lapack::getrs(LU, ipiv, B);
+}
+
+#endif // BOOST_UBLASX_USE_LAPACK
+
+} // Namespace detail
+
 
 /**
  * \brief LU decomposition without pivoting of the given matrix \a A.
@@ -116,8 +509,20 @@ typename matrix_traits<MatrixT>::size_type lu_decompose_inplace(matrix_container
     {
         P.resize(nr_A, false);
     }
+    // Rows which are not interchanged are left untouched by the factorization
+    for (size_type i = 0; i < nr_A; ++i)
+    {
+        P(i) = i;
+    }
 
-    return lu_factorize(A(), P);
+    return detail::lu_decompose_inplace_impl(
+                A(),
+                P,
+                ::boost::mpl::bool_<
+                    detail::lapack::enabled
+                    && detail::lapack::is_supported_matrix<MatrixT>::value
+                >()
+            );
 //
 //  // postcondition: P is squared && size(P) == num_rows(A)
 //  BOOST_UBLAS_CHECK( size(P) == num_columns(P) && size(P) == num_rows(A), bad_size() );
@@ -289,7 +694,20 @@ void lu_apply_inplace(matrix_expression<LUMatrixExprT> const& LU, PermutationMat
     // precondition: size(b) == num_rows(LU)
     BOOST_UBLAS_CHECK( size(b) == num_rows(LU), bad_size() );
 
-    lu_substitute(LU(), P, b());
+    detail::lu_apply_inplace_impl(
+        LU(),
+        P,
+        b(),
+        ::boost::mpl::and_<
+            ::boost::mpl::bool_<detail::lapack::enabled>,
+            detail::lapack::is_supported_matrix<LUMatrixExprT>,
+            detail::lapack::is_supported_vector<BVectorT>,
+            ::boost::is_same<
+                typename matrix_traits<LUMatrixExprT>::value_type,
+                typename vector_traits<BVectorT>::value_type
+            >
+        >()
+    );
 }
 
 
@@ -325,7 +743,20 @@ void lu_apply_inplace(matrix_expression<LUMatrixExprT> const& LU, PermutationMat
     // pre: num_rows(b) == num_rows(LU)
     BOOST_UBLAS_CHECK( num_rows(B) == num_rows(LU), bad_size() );
 
-    lu_substitute(LU(), P, B());
+    detail::lu_apply_inplace_impl(
+        LU(),
+        P,
+        B(),
+        ::boost::mpl::and_<
+            ::boost::mpl::bool_<detail::lapack::enabled>,
+            detail::lapack::is_supported_matrix<LUMatrixExprT>,
+            detail::lapack::is_supported_matrix<BMatrixT>,
+            ::boost::is_same<
+                typename matrix_traits<LUMatrixExprT>::value_type,
+                typename matrix_traits<BMatrixT>::value_type
+            >
+        >()
+    );
 }
 
 
@@ -573,7 +1004,7 @@ typename matrix_traits<MatrixExprT>::size_type lu_solve(matrix_expression<Matrix
 
     // Ax=b ==> LUx=b ==> Ly=b AND Ux=y
 
-    typedef typename matrix_traits<MatrixExprT>::value_type size_type;
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename layout_type<MatrixExprT>::type layout_type;
 
@@ -621,7 +1052,7 @@ typename matrix_traits<AMatrixExprT>::size_type lu_solve(matrix_expression<AMatr
 
     // Ax=b ==> LUx=b ==> Ly=b AND Ux=y
 
-    typedef typename matrix_traits<AMatrixExprT>::value_type size_type;
+    typedef typename matrix_traits<AMatrixExprT>::size_type size_type;
     typedef typename matrix_traits<AMatrixExprT>::value_type value_type;
     typedef typename layout_type<AMatrixExprT>::type layout_type;
 
@@ -641,6 +1072,320 @@ typename matrix_traits<AMatrixExprT>::size_type lu_solve(matrix_expression<AMatr
     return singular;
 }
 
+
+/**
+ * \brief LU decomposition with partial pivoting of a matrix.
+ *
+ * The matrix is factorized once at construction (or by \c decompose) and the
+ * LU factors and the pivots are cached, so that any number of linear systems
+ * with the same coefficient matrix can be solved, and the determinant, the
+ * reciprocal condition number and the inverse can be computed, without ever
+ * refactorizing the matrix.
+ * The reciprocal condition number and the inverse need LAPACK and are
+ * computed by the \c rcond (in \c rcond.hpp) and \c inv (in \c inv.hpp)
+ * overloads taking an \c lu_decomposition.
+ *
+ * \tparam ValueT The type of the elements of the decomposed matrix.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ */
+template <typename ValueT>
+class lu_decomposition
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef work_matrix_type LU_matrix_type;
+    public: typedef work_matrix_type L_matrix_type;
+    public: typedef work_matrix_type U_matrix_type;
+    public: typedef work_matrix_type inverse_matrix_type;
+    public: typedef permutation_matrix<size_type> permutation_matrix_type;
+
+
+    public: lu_decomposition()
+    : P_(0),
+      info_(0),
+      norm_1_(0),
+      norm_inf_(0)
+    {
+        // empty
+    }
+
+
+    public: template <typename MatrixExprT>
+        lu_decomposition(matrix_expression<MatrixExprT> const& A)
+    : LU_(A),
+      P_(num_rows(A)),
+      info_(0),
+      norm_1_(0),
+      norm_inf_(0)
+    {
+        decompose();
+    }
+
+
+    public: template <typename MatrixExprT>
+        void decompose(matrix_expression<MatrixExprT> const& A)
+    {
+        LU_ = A;
+
+        decompose();
+    }
+
+
+    /**
+     * \brief Return zero if the decomposition succeeded; otherwise, return
+     *  1 + the number of the failing row (i.e., the matrix is singular).
+     */
+    public: size_type info() const
+    {
+        return info_;
+    }
+
+
+    /// Tell if the decomposed matrix is singular.
+    public: bool singular() const
+    {
+        return info_ != 0;
+    }
+
+
+    /// Return the LU matrix (i.e., L and U packed in a single matrix).
+    public: LU_matrix_type const& LU() const
+    {
+        return LU_;
+    }
+
+
+    /// Return the permutation matrix.
+    public: permutation_matrix_type const& P() const
+    {
+        return P_;
+    }
+
+
+    /// Return the unit lower triangular (trapezoidal) factor L.
+    public: L_matrix_type L() const
+    {
+        const size_type nr = num_rows(LU_);
+        const size_type k = ::std::min(nr, num_columns(LU_));
+
+        L_matrix_type tmp_L(nr, k);
+        for (size_type j = 0; j < k; ++j)
+        {
+            for (size_type i = 0; i < nr; ++i)
+            {
+                tmp_L(i,j) = (i > j) ? LU_(i,j) : ((i == j) ? value_type(1) : value_type(0));
+            }
+        }
+
+        return tmp_L;
+    }
+
+
+    /// Return the upper triangular (trapezoidal) factor U.
+    public: U_matrix_type U() const
+    {
+        const size_type nc = num_columns(LU_);
+        const size_type k = ::std::min(num_rows(LU_), nc);
+
+        U_matrix_type tmp_U(k, nc);
+        for (size_type j = 0; j < nc; ++j)
+        {
+            for (size_type i = 0; i < k; ++i)
+            {
+                tmp_U(i,j) = (i <= j) ? LU_(i,j) : value_type(0);
+            }
+        }
+
+        return tmp_U;
+    }
+
+
+    /// Solve the linear system \f$Ax=b\f$ and store the result in \a b.
+    public: template <typename VectorT>
+        void solve_inplace(vector_container<VectorT>& b) const
+    {
+        // pre: A is square and not singular
+        BOOST_UBLAS_CHECK( num_rows(LU_) == num_columns(LU_), bad_size() );
+        BOOST_UBLAS_CHECK( !singular(), ::boost::numeric::ublas::singular() );
+
+        lu_apply_inplace(LU_, P_, b);
+    }
+
+
+    /// Solve the linear system \f$AX=B\f$ and store the result in \a B.
+    public: template <typename MatrixT>
+        void solve_inplace(matrix_container<MatrixT>& B) const
+    {
+        // pre: A is square and not singular
+        BOOST_UBLAS_CHECK( num_rows(LU_) == num_columns(LU_), bad_size() );
+        BOOST_UBLAS_CHECK( !singular(), ::boost::numeric::ublas::singular() );
+
+        lu_apply_inplace(LU_, P_, B);
+    }
+
+
+    /// Solve the linear system \f$Ax=b\f$ and return the result.
+    public: template <typename VectorExprT>
+        typename vector_temporary_traits<VectorExprT>::type solve(vector_expression<VectorExprT> const& b) const
+    {
+        typename vector_temporary_traits<VectorExprT>::type x(b);
+
+        solve_inplace(x);
+
+        return x;
+    }
+
+
+    /**
+     * \brief Solve the linear system \f$A^H x=b\f$ and store the result in
+     *  \a b.
+     *
+     * Since \f$PA=LU\f$, the system is solved as \f$U^H L^H P x = b\f$ by a
+     * forward substitution with \f$U^H\f$, a backward substitution with
+     * \f$L^H\f$ and the inverse row permutation, so that the cached factors
+     * are reused as they are.
+     */
+    public: template <typename VectorT>
+        void solve_herm_inplace(vector_container<VectorT>& b) const
+    {
+        // pre: A is square and not singular
+        BOOST_UBLAS_CHECK( num_rows(LU_) == num_columns(LU_), bad_size() );
+        BOOST_UBLAS_CHECK( !singular(), ::boost::numeric::ublas::singular() );
+        // pre: size(b) == num_rows(A)
+        BOOST_UBLAS_CHECK( size(b) == num_rows(LU_), bad_size() );
+
+        const size_type n = num_rows(LU_);
+
+        // Forward substitution with U^H (the j-th column of U is contiguous)
+        for (size_type i = 0; i < n; ++i)
+        {
+            value_type s = b()(i);
+            for (size_type j = 0; j < i; ++j)
+            {
+                s -= type_traits<value_type>::conj(LU_(j,i))*b()(j);
+            }
+            b()(i) = s/type_traits<value_type>::conj(LU_(i,i));
+        }
+
+        // Backward substitution with L^H (L has a unit diagonal)
+        for (size_type i = n; i > 0; --i)
+        {
+            value_type s = b()(i-1);
+            for (size_type j = i; j < n; ++j)
+            {
+                s -= type_traits<value_type>::conj(LU_(j,i-1))*b()(j);
+            }
+            b()(i-1) = s;
+        }
+
+        // Undo the row interchanges in reverse order
+        for (size_type i = n; i > 0; --i)
+        {
+            if (P_(i-1) != i-1)
+            {
+                ::std::swap(b()(i-1), b()(P_(i-1)));
+            }
+        }
+    }
+
+
+    /// Solve the linear system \f$AX=B\f$ and return the result.
+    public: template <typename MatrixExprT>
+        typename matrix_temporary_traits<MatrixExprT>::type solve(matrix_expression<MatrixExprT> const& B) const
+    {
+        typename matrix_temporary_traits<MatrixExprT>::type X(B);
+
+        solve_inplace(X);
+
+        return X;
+    }
+
+
+    /// Return the determinant of the decomposed matrix.
+    public: value_type det() const
+    {
+        // pre: A is square
+        BOOST_UBLAS_CHECK( num_rows(LU_) == num_columns(LU_), bad_size() );
+
+        const size_type n = num_rows(LU_);
+
+        value_type d(1);
+        for (size_type i = 0; i < n; ++i)
+        {
+            d *= LU_(i,i);
+            if (P_(i) != i)
+            {
+                d = -d;
+            }
+        }
+
+        return d;
+    }
+
+
+    /**
+     * \brief Return the natural logarithm of the absolute value of the
+     *  determinant of the decomposed matrix.
+     *
+     * Unlike \c det, the result neither overflows nor underflows for large
+     * matrices; for singular matrices, \f$-\infty\f$ is returned.
+     */
+    public: real_type logdet() const
+    {
+        // pre: A is square
+        BOOST_UBLAS_CHECK( num_rows(LU_) == num_columns(LU_), bad_size() );
+
+        if (singular())
+        {
+            return -::std::numeric_limits<real_type>::infinity();
+        }
+
+        const size_type n = num_rows(LU_);
+
+        real_type ld(0);
+        for (size_type i = 0; i < n; ++i)
+        {
+            ld += ::std::log(::std::abs(LU_(i,i)));
+        }
+
+        return ld;
+    }
+
+
+    /// Return the 1-norm of the decomposed matrix.
+    public: real_type norm_1() const
+    {
+        return norm_1_;
+    }
+
+
+    /// Return the infinity norm of the decomposed matrix.
+    public: real_type norm_inf() const
+    {
+        return norm_inf_;
+    }
+
+
+    private: void decompose()
+    {
+        norm_1_ = ::boost::numeric::ublas::norm_1(LU_);
+        norm_inf_ = ::boost::numeric::ublas::norm_inf(LU_);
+        info_ = lu_decompose_inplace(LU_, P_);
+    }
+
+
+    private: work_matrix_type LU_;
+    private: permutation_matrix_type P_;
+    private: size_type info_;
+    /// The 1-norm of the decomposed matrix (needed by \c rcond).
+    private: real_type norm_1_;
+    /// The infinity norm of the decomposed matrix (needed by \c cond_inf).
+    private: real_type norm_inf_;
+};
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -26,6 +26,7 @@
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
@@ -184,6 +185,18 @@ struct max_by_dim_impl;
 template <typename TagT, typename CategoryT, typename OrientationT>
 struct max_by_tag_impl;
 
+/// Functor keeping the maximum of the visited matrix elements.
+template <typename ValueT>
+struct max_accumulator;
+
+/// Functor keeping the maximum of the visited matrix elements of each row.
+template <typename VectorT>
+struct max_rows_accumulator;
+
+/// Functor keeping the maximum of the visited matrix elements of each column.
+template <typename VectorT>
+struct max_columns_accumulator;
+
 //@} Declarations
 
 
@@ -233,6 +246,75 @@ template <typename T>
 const ::std::complex<T> minus_infinity< ::std::complex<T> >::value = ::std::complex<T>(T(0),T(0));
 
 
+template <typename ValueT>
+struct max_accumulator
+{
+    BOOST_UBLAS_INLINE
+    max_accumulator()
+    : m(minus_infinity<ValueT>::value)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT, ValueT const& x)
+    {
+        if (greater_than_impl(x, m))
+        {
+            m = x;
+        }
+    }
+
+    ValueT m;
+};
+
+
+template <typename VectorT>
+struct max_rows_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit max_rows_accumulator(VectorT& m)
+    : m(m)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT r, SizeT, typename VectorT::value_type const& x)
+    {
+        if (greater_than_impl(x, m(r)))
+        {
+            m(r) = x;
+        }
+    }
+
+    VectorT& m;
+};
+
+
+template <typename VectorT>
+struct max_columns_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit max_columns_accumulator(VectorT& m)
+    : m(m)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT c, typename VectorT::value_type const& x)
+    {
+        if (greater_than_impl(x, m(c)))
+        {
+            m(c) = x;
+        }
+    }
+
+    VectorT& m;
+};
+
+
 template <>
 struct max_by_dim_impl<1, vector_tag>
 {
@@ -390,29 +472,12 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 typename matrix_traits<MatrixExprT>::value_type max(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-//  value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                 ? - ::std::numeric_limits<value_type>::infinity()
-//                 : ::std::numeric_limits<value_type>::min();
-    value_type m = detail::minus_infinity<value_type>::value;
-
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-//          if (me()(r,c) > m)
-            if (detail::greater_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-    }
+    detail::max_accumulator<value_type> acc;
+    detail::for_each_in_storage_order(me, acc);
 
-    return m;
+    return acc.m;
 }
 
 
@@ -420,32 +485,14 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> max_rows(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef vector<value_type> result_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> res(nr);
-    size_type j = 0;
-    for (size_type r = 0; r < nr; ++r)
-    {
-//      value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                     ? - ::std::numeric_limits<value_type>::infinity()
-//                     : ::std::numeric_limits<value_type>::min();
-        value_type m = detail::minus_infinity<value_type>::value;
-
-        for (size_type c = 0; c < nc; ++c)
-        {
-//          if (me()(r,c) > m)
-            if (detail::greater_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-
-        res(j++) = m;
-    }
+    // Visit the elements in storage order and update the maximum of the
+    // visited element's row.
+    result_type res(num_rows(me), detail::minus_infinity<value_type>::value);
+    detail::max_rows_accumulator<result_type> acc(res);
+    detail::for_each_in_storage_order(me, acc);
 
     return res;
 }
@@ -455,32 +502,14 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> max_columns(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef vector<value_type> result_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> res(nc);
-    size_type j = 0;
-    for (size_type c = 0; c < nc; ++c)
-    {
-//      value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                     ? - ::std::numeric_limits<value_type>::infinity()
-//                     : ::std::numeric_limits<value_type>::min();
-        value_type m = detail::minus_infinity<value_type>::value;
-
-        for (size_type r = 0; r < nr; ++r)
-        {
-//          if (me()(r,c) > m)
-            if (detail::greater_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-
-        res(j++) = m;
-    }
+    // Visit the elements in storage order and update the maximum of the
+    // visited element's column.
+    result_type res(num_columns(me), detail::minus_infinity<value_type>::value);
+    detail::max_columns_accumulator<result_type> acc(res);
+    detail::for_each_in_storage_order(me, acc);
 
     return res;
 }
@@ -26,6 +26,7 @@
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
@@ -187,6 +188,18 @@ struct min_by_dim_impl;
 template <typename TagT, typename CategoryT, typename OrientationT>
 struct min_by_tag_impl;
 
+/// Functor keeping the minimum of the visited matrix elements.
+template <typename ValueT>
+struct min_accumulator;
+
+/// Functor keeping the minimum of the visited matrix elements of each row.
+template <typename VectorT>
+struct min_rows_accumulator;
+
+/// Functor keeping the minimum of the visited matrix elements of each column.
+template <typename VectorT>
+struct min_columns_accumulator;
+
 //@} Declarations
 
 
@@ -235,6 +248,75 @@ template <typename T>
 const ::std::complex<T> infinity< ::std::complex<T> >::value = ::std::complex<T>(infinity<T>::value,::std::numeric_limits<T>::quiet_NaN());
 
 
+template <typename ValueT>
+struct min_accumulator
+{
+    BOOST_UBLAS_INLINE
+    min_accumulator()
+    : m(infinity<ValueT>::value)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT, ValueT const& x)
+    {
+        if (less_than_impl(x, m))
+        {
+            m = x;
+        }
+    }
+
+    ValueT m;
+};
+
+
+template <typename VectorT>
+struct min_rows_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit min_rows_accumulator(VectorT& m)
+    : m(m)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT r, SizeT, typename VectorT::value_type const& x)
+    {
+        if (less_than_impl(x, m(r)))
+        {
+            m(r) = x;
+        }
+    }
+
+    VectorT& m;
+};
+
+
+template <typename VectorT>
+struct min_columns_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit min_columns_accumulator(VectorT& m)
+    : m(m)
+    {
+    }
+
+    template <typename SizeT>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT c, typename VectorT::value_type const& x)
+    {
+        if (less_than_impl(x, m(c)))
+        {
+            m(c) = x;
+        }
+    }
+
+    VectorT& m;
+};
+
+
 template <>
 struct min_by_dim_impl<1, vector_tag>
 {
@@ -394,29 +476,12 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 typename matrix_traits<MatrixExprT>::value_type min(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-//  value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                 ? ::std::numeric_limits<value_type>::infinity()
-//                 : ::std::numeric_limits<value_type>::max();
-    value_type m = detail::infinity<value_type>::value;
+    detail::min_accumulator<value_type> acc;
+    detail::for_each_in_storage_order(me, acc);
 
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-//          if (me()(r,c) < m)
-            if (detail::less_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-    }
-
-    return m;
+    return acc.m;
 }
 
 
@@ -424,32 +489,14 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> min_rows(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef vector<value_type> result_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> res(nr);
-    size_type j = 0;
-    for (size_type r = 0; r < nr; ++r)
-    {
-//      value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                     ? ::std::numeric_limits<value_type>::infinity()
-//                     : ::std::numeric_limits<value_type>::max();
-        value_type m = detail::infinity<value_type>::value;
-
-        for (size_type c = 0; c < nc; ++c)
-        {
-//          if (me()(r,c) < m)
-            if (detail::less_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-
-        res(j++) = m;
-    }
+    // Visit the elements in storage order and update the minimum of the
+    // visited element's row.
+    result_type res(num_rows(me), detail::infinity<value_type>::value);
+    detail::min_rows_accumulator<result_type> acc(res);
+    detail::for_each_in_storage_order(me, acc);
 
     return res;
 }
@@ -459,32 +506,14 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> min_columns(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef vector<value_type> result_type;
 
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> res(nc);
-    size_type j = 0;
-    for (size_type c = 0; c < nc; ++c)
-    {
-//      value_type m = ::std::numeric_limits<value_type>::has_infinity
-//                     ? ::std::numeric_limits<value_type>::infinity()
-//                     : ::std::numeric_limits<value_type>::max();
-        value_type m = detail::infinity<value_type>::value;
-
-        for (size_type r = 0; r < nr; ++r)
-        {
-//          if (me()(r,c) < m)
-            if (detail::less_than_impl(me()(r,c), m))
-            {
-                m = me()(r,c);
-            }
-        }
-
-        res(j++) = m;
-    }
+    // Visit the elements in storage order and update the minimum of the
+    // visited element's column.
+    result_type res(num_columns(me), detail::infinity<value_type>::value);
+    detail::min_columns_accumulator<result_type> acc(res);
+    detail::for_each_in_storage_order(me, acc);
 
     return res;
 }
@@ -72,6 +72,70 @@ typename matrix_traits<AMatrixT>::size_type mldivide(matrix_expression<AMatrixT>
     return lu_solve(A, B, X());
 }
 
+template<typename ValueT,
+         typename BVectorT>
+BOOST_UBLAS_INLINE
+typename lu_decomposition<ValueT>::size_type mldivide_inplace(lu_decomposition<ValueT> const& lu,
+                                                              vector_container<BVectorT>& b)
+{
+    if (!lu.singular())
+    {
+        lu.solve_inplace(b);
+    }
+
+    return lu.info();
+}
+
+template<typename ValueT,
+         typename BVectorT,
+         typename XVectorT>
+BOOST_UBLAS_INLINE
+typename lu_decomposition<ValueT>::size_type mldivide(lu_decomposition<ValueT> const& lu,
+                                                      vector_expression<BVectorT> const& b,
+                                                      vector_container<XVectorT>& x)
+{
+    if (!lu.singular())
+    {
+        x() = b;
+
+        lu.solve_inplace(x);
+    }
+
+    return lu.info();
+}
+
+template<typename ValueT,
+         typename BMatrixT>
+BOOST_UBLAS_INLINE
+typename lu_decomposition<ValueT>::size_type mldivide_inplace(lu_decomposition<ValueT> const& lu,
+                                                              matrix_container<BMatrixT>& B)
+{
+    if (!lu.singular())
+    {
+        lu.solve_inplace(B);
+    }
+
+    return lu.info();
+}
+
+template<typename ValueT,
+         typename BMatrixT,
+         typename XMatrixT>
+BOOST_UBLAS_INLINE
+typename lu_decomposition<ValueT>::size_type mldivide(lu_decomposition<ValueT> const& lu,
+                                                      matrix_expression<BMatrixT> const& B,
+                                                      matrix_container<XMatrixT>& X)
+{
+    if (!lu.singular())
+    {
+        X() = B;
+
+        lu.solve_inplace(X);
+    }
+
+    return lu.info();
+}
+
 }}} // Namespace boost::numeric::ublasx
 
 #endif // BOOST_NUMERIC_UBLASX_MLDIVIDE_HPP
@@ -21,11 +21,23 @@
 
 
 #include <boost/numeric/ublas/functional.hpp>
+#include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
 #include <boost/numeric/ublas/traits.hpp>
-#include <boost/numeric/ublasx/operation/inv.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/eigen.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/rcond.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -40,67 +52,256 @@ struct matrix_mpow_traits
     typedef typename MatrixExprT::matrix_temporary_type result_type;
 };
 
-} // Namespace detail
-
 
 /**
- * \brief Computes \a me to the power of \a p (me^p).
- *
- * If \a me is a square matrix and \a p is a positive integer, me^p effectively
- * multiplies \a me by itself p-1 times.
- * If \a me is square and nonsingular, me^(-p) effectively multiplies the
- * inverse of \a me by itself p-1 times.
- *
- * \note Fractional exponents are not currently supported.
- *
- * \tparam MatrixExprT The type of the input matrix expression.
+ * \brief Replaces the square matrix \a A with \a A^k, for \a k &gt; 0, by
+ *  means of exponentiation by squaring.
  *
- * \param me The input matrix expression.
- * \param p The exponent.
- * \return The result of \a me to the power of \a p.
- *
- * \author Marco Guazzone, marco.guazzone@gmail.com
+ * Only O(log k) matrix products are performed; the products are evaluated
+ * into two work matrices which are swapped with the operands (ping-pong
+ * buffers), so that no temporary is allocated inside the loop.
  */
-template <typename MatrixExprT, typename T>
-BOOST_UBLAS_INLINE
-typename detail::matrix_mpow_traits<MatrixExprT>::result_type mpow(matrix_expression<MatrixExprT> const& me, T p)
+template <typename MatrixT>
+void mpow_by_squaring_inplace(MatrixT& A, ::std::uintmax_t k)
 {
-    typedef typename detail::matrix_mpow_traits<MatrixExprT>::result_type result_type;
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+    const size_type n = num_rows(A);
 
-    result_type res;
+    MatrixT T(n, n); // The work buffer
 
-    if (p > 0)
+    // Skip the trailing zeros of k, so that the accumulator can be
+    // initialized with a copy of the current square.
+    while (!(k & 1))
     {
-        res = me;
+        noalias(T) = prod(A, A);
+        A.swap(T);
+        k >>= 1;
+    }
+
+    MatrixT R(A); // The result accumulator
 
-        --p;
-        while (p >= 1)
+    k >>= 1;
+    while (k > 0)
+    {
+        noalias(T) = prod(A, A);
+        A.swap(T);
+        if (k & 1)
         {
-            res = prod(res, me);
-            --p;
+            noalias(T) = prod(R, A);
+            R.swap(T);
         }
+        k >>= 1;
+    }
+
+    A.swap(R);
+}
+
+
+/// Integer power of a square matrix: \a me^(\a neg ? -k : k).
+template <typename MatrixExprT>
+typename matrix_mpow_traits<MatrixExprT>::result_type mpow_integer(matrix_expression<MatrixExprT> const& me, bool neg, ::std::uintmax_t k)
+{
+    typedef typename matrix_mpow_traits<MatrixExprT>::result_type result_type;
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    const size_type n = num_rows(me);
+
+    if (k == 0)
+    {
+        return identity_matrix<value_type>(n);
     }
-    else if (p < 0)
+
+    result_type res(me);
+
+    if (k > 1)
+    {
+        mpow_by_squaring_inplace(res, k);
+    }
+
+    if (neg)
     {
-        result_type inv_me = inv(me);
-        res = inv_me;
-        p = -p;
+        // Invert me^k by a single LU solve, rather than forming the inverse
+        // of me and raising it to the k-th power.
 
-        --p;
-        while (p >= 1)
+        permutation_matrix<size_type> P(n);
+
+        if (lu_decompose_inplace(res, P) != 0)
         {
-            res = prod(res, inv_me);
-            --p;
+            // Matrix is singular: fill the result with Inf (like inv does)
+            return scalar_matrix<value_type>(n, n, ::std::numeric_limits<real_type>::infinity());
         }
+
+        result_type X = identity_matrix<value_type>(n);
+        lu_apply_inplace(res, P, X);
+        res.swap(X);
+    }
+
+    return res;
+}
+
+
+/// Copy the complex matrix \a X into \a R (complex case).
+template <typename ComplexMatrixT, typename MatrixT>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    ::boost::is_complex<typename matrix_traits<MatrixT>::value_type>
+>::type mpow_assign(ComplexMatrixT const& X, MatrixT& R)
+{
+    R = X;
+}
+
+
+/// Copy the real part of the complex matrix \a X into \a R (real case).
+template <typename ComplexMatrixT, typename MatrixT>
+BOOST_UBLAS_INLINE
+typename ::boost::disable_if<
+    ::boost::is_complex<typename matrix_traits<MatrixT>::value_type>
+>::type mpow_assign(ComplexMatrixT const& X, MatrixT& R)
+{
+    R = real(X);
+}
+
+
+/**
+ * \brief Fractional power of a square matrix computed by eigendecomposition.
+ *
+ * If \f$A=V D V^{-1}\f$, then \f$A^p=V D^p V^{-1}\f$, where \f$D^p\f$ is
+ * computed by means of the principal branch of the complex power.
+ * If the reciprocal condition number of \f$V\f$ does not exceed \f$n\epsilon\f$,
+ * \f$A\f$ is taken as defective and the result is filled with NaN.
+ */
+template <typename MatrixExprT, typename T>
+typename matrix_mpow_traits<MatrixExprT>::result_type mpow_eigen(matrix_expression<MatrixExprT> const& me, T p)
+{
+    typedef typename matrix_mpow_traits<MatrixExprT>::result_type result_type;
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef ::std::complex<real_type> complex_type;
+    typedef matrix<value_type, column_major> matrix_type;
+    typedef matrix<complex_type, column_major> complex_matrix_type;
+
+    const size_type n = num_rows(me);
+
+    matrix_type A(me);
+    vector<complex_type> w(n);
+    complex_matrix_type LV;
+    complex_matrix_type V(n, n);
+
+    eigen_impl(A, right_eigenvectors, w, LV, V, column_major_tag());
+
+    // X = V*D^p
+    complex_matrix_type X(V);
+    for (size_type j = 0; j < n; ++j)
+    {
+        column(X, j) *= ::std::pow(w(j), static_cast<real_type>(p));
     }
-    else // p == 0
+
+    // Solve Y*V = X, that is V^T*Y^T = X^T, by factoring V^T
+    lu_decomposition<complex_type> lu(trans(V));
+
+    result_type res(n, n);
+
+    // Rounding seldom makes the eigenvector matrix of a defective (i.e., not
+    // diagonalizable) matrix exactly singular: the computed eigenvectors are
+    // rather nearly parallel, so that V^{-1} (and hence the result) is
+    // meaningless. Thus, reject V when its condition number is about 1/eps.
+    if (lu.singular() || rcond(lu) <= static_cast<real_type>(n)*::std::numeric_limits<real_type>::epsilon())
     {
-        res = identity_matrix<typename matrix_traits<MatrixExprT>::value_type>(num_rows(me));
+        res = scalar_matrix<value_type>(n, n, ::std::numeric_limits<real_type>::quiet_NaN());
+        return res;
     }
 
+    complex_matrix_type YT(trans(X));
+    lu.solve_inplace(YT);
+
+    mpow_assign(complex_matrix_type(trans(YT)), res);
+
     return res;
 }
 
+
+/// Power of a square matrix for an integral exponent.
+template <typename MatrixExprT, typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    ::boost::is_integral<T>,
+    typename matrix_mpow_traits<MatrixExprT>::result_type
+>::type mpow_impl(matrix_expression<MatrixExprT> const& me, T p)
+{
+    const bool neg = p < 0;
+    const ::std::uintmax_t k = neg ? static_cast< ::std::uintmax_t >(-(p+1))+1 : static_cast< ::std::uintmax_t >(p);
+
+    return mpow_integer(me, neg, k);
+}
+
+
+/// Power of a square matrix for a floating-point exponent.
+template <typename MatrixExprT, typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::disable_if<
+    ::boost::is_integral<T>,
+    typename matrix_mpow_traits<MatrixExprT>::result_type
+>::type mpow_impl(matrix_expression<MatrixExprT> const& me, T p)
+{
+    if (::std::floor(p) == p && ::std::abs(p) < static_cast<T>(::std::numeric_limits< ::std::uintmax_t >::max()))
+    {
+        const bool neg = p < 0;
+
+        return mpow_integer(me, neg, static_cast< ::std::uintmax_t >(neg ? -p : p));
+    }
+
+    return mpow_eigen(me, p);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Computes \a me to the power of \a p (me^p).
+ *
+ * If \a me is a square matrix and \a p is a positive integer, me^p is computed
+ * by exponentiation by squaring (i.e., with O(log p) matrix products).
+ * If \a me is square and nonsingular, me^(-p) is computed by raising \a me
+ * to the power of p as above and solving for the inverse of the result with
+ * a single LU factorization; if \a me^p is singular, the result is filled
+ * with Inf.
+ * If \a p is not an integer, me^p is computed from the eigendecomposition
+ * \f$V D V^{-1}\f$ of \a me as \f$V D^p V^{-1}\f$, using the principal branch
+ * of the power of each eigenvalue; if \a me is not diagonalizable (that is, if
+ * the reciprocal condition number of \f$V\f$ is not greater than \f$n\f$
+ * times the machine epsilon), the result is filled with NaN.
+ *
+ * \note For a real matrix and a non-integer exponent, only the real part of
+ *  me^p is returned (me^p may be complex, e.g., when \a me has negative real
+ *  eigenvalues); use a complex matrix to get the complex result.
+ *
+ * \note Non-integer exponents require LAPACK.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ *
+ * \param me The input matrix expression.
+ * \param p The exponent.
+ * \return The result of \a me to the power of \a p.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT, typename T>
+BOOST_UBLAS_INLINE
+typename detail::matrix_mpow_traits<MatrixExprT>::result_type mpow(matrix_expression<MatrixExprT> const& me, T p)
+{
+    // precondition: me is square
+    BOOST_UBLAS_CHECK(
+        num_rows(me) == num_columns(me),
+        bad_size()
+    );
+
+    return detail::mpow_impl(me, p);
+}
+
 }}} // Namespace boost::numeric::ublasx
 
 
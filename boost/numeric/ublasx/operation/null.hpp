@@ -0,0 +1,99 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/null.hpp
+ *
+ * \brief Orthonormal basis for the null space of a matrix.
+ *
+ * The \c null function returns a matrix \f$Z\f$ whose columns are an
+ * orthonormal basis for the null space of the input matrix \f$A\f$, that is
+ * \f$AZ\f$ is negligible and \f$Z^H Z=I\f$; the number of columns is the
+ * nullity of the input matrix.
+ *
+ * The basis is made of the last \f$n-r\f$ right singular vectors (by default)
+ * or of the last \f$n-r\f$ columns of \f$Q\f$ of the QR decomposition with
+ * column pivoting of \f$A^H\f$ (the null space of \f$A\f$ is the orthogonal
+ * complement of the range of \f$A^H\f$), where \f$r\f$ is the rank estimated
+ * by the same factorization (see \c rank_method).
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_NULL_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_NULL_HPP
+
+
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qrcp.hpp>
+#include <boost/numeric/ublasx/operation/rank.hpp>
+#include <boost/numeric/ublasx/operation/svd.hpp>
+#include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief Orthonormal basis for the null space of a matrix.
+ *
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \param A The input m-by-n matrix expression.
+ * \param method The factorization used to reveal the rank of \a A and to
+ *  compute the basis.
+ * \return An n-by-(n-r) matrix, where r is the rank of \a A, whose columns
+ *  are an orthonormal basis for the null space of \a A.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename MatrixExprT>
+matrix<
+    typename matrix_traits<MatrixExprT>::value_type,
+    typename layout_type<MatrixExprT>::type
+> null(matrix_expression<MatrixExprT> const& A, rank_method method = svd_rank_method)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef matrix<value_type, typename layout_type<MatrixExprT>::type> result_type;
+
+    const ::std::size_t m = num_rows(A);
+    const ::std::size_t n = num_columns(A);
+
+    if (method == qrcp_rank_method)
+    {
+        // A^H P = Q R: the last n-r columns of Q span the null space of A
+        qrcp_decomposition<value_type> qrcp(herm(A));
+
+        const ::std::size_t r = qrcp.rank();
+
+        return result_type(subrange(qrcp.Q(true), 0, n, r, n));
+    }
+
+    // A = U S V^H: the last n-r right singular vectors span the null space
+    // of A
+    svd_decomposition<value_type> svd(A, true);
+
+    const ::std::size_t r = detail::svd_rank(svd.s(), m, n);
+
+    return result_type(subrange(svd.V(), 0, n, r, n));
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_NULL_HPP
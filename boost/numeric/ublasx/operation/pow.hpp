@@ -24,6 +24,9 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_binary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_binary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
+#include <boost/numeric/ublasx/traits/is_execution_policy.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <cmath>
 #include <complex>
 
@@ -34,6 +37,50 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+// Wrappers to the std::pow function to avoid compiler errors
+
+template <typename T1, typename T2>
+BOOST_UBLAS_INLINE
+typename promote_traits<T1,T2>::promote_type pow(T1 x, T2 y)
+{
+    return ::std::pow(x, y);
+}
+
+template <typename T1, typename T2>
+BOOST_UBLAS_INLINE
+std::complex<T1> pow(std::complex<T1> const& x, T2 y)
+{
+    return ::std::pow(x, y);
+}
+
+template <typename T1, typename T2>
+BOOST_UBLAS_INLINE
+std::complex<T1> pow(T1 x, std::complex<T2> const& y)
+{
+    // Remember: if z=(a + ib) is a complex number and c is a scalar => c^z = e^{ln(c)*z}
+    return ::std::exp(::std::log(x)*y);
+}
+
+
+/// Functor computing the power of its first argument to its second argument.
+template <typename Arg1T, typename Arg2T, typename ResT>
+struct pow_functor
+{
+    typedef Arg1T first_argument_type;
+    typedef Arg2T second_argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(first_argument_type const& x, second_argument_type const& y) const
+    {
+        // Select the overload of detail::pow matching this exact signature
+        typedef result_type (*fun_ptr_type)(first_argument_type, second_argument_type);
+
+        return static_cast<fun_ptr_type>(&pow)(x, y);
+    }
+};
+
+
 template <typename VectorExprT, typename Arg2T>
 struct vector_pow_functor1_traits
 {
@@ -45,10 +92,11 @@ struct vector_pow_functor1_traits
                 signature_argument1_type,
                 signature_argument2_type
             >::promote_type signature_result_type;
+    typedef pow_functor<signature_argument1_type,signature_argument2_type,signature_result_type> functor_type;
     typedef vector_binary_functor1_traits<
                 input_expression_type,
                 Arg2T,
-                signature_result_type (signature_argument1_type, signature_argument2_type)
+                functor_type
             > binary_functor_expression_type;
     typedef typename binary_functor_expression_type::result_type result_type;
     typedef typename binary_functor_expression_type::expression_type expression_type;
@@ -66,10 +114,11 @@ struct vector_pow_functor2_traits
                 signature_argument1_type,
                 signature_argument2_type
             >::promote_type signature_result_type;
+    typedef pow_functor<signature_argument1_type,signature_argument2_type,signature_result_type> functor_type;
     typedef vector_binary_functor2_traits<
                 Arg1T,
                 input_expression_type,
-                signature_result_type (signature_argument1_type, signature_argument2_type)
+                functor_type
             > binary_functor_expression_type;
     typedef typename binary_functor_expression_type::result_type result_type;
     typedef typename binary_functor_expression_type::expression_type expression_type;
@@ -87,10 +136,11 @@ struct matrix_pow_functor1_traits
                 signature_argument1_type,
                 signature_argument2_type
             >::promote_type signature_result_type;
+    typedef pow_functor<signature_argument1_type,signature_argument2_type,signature_result_type> functor_type;
     typedef matrix_binary_functor1_traits<
                 input_expression_type,
                 Arg2T,
-                signature_result_type (signature_argument1_type, signature_argument2_type)
+                functor_type
             > binary_functor_expression_type;
     typedef typename binary_functor_expression_type::result_type result_type;
     typedef typename binary_functor_expression_type::expression_type expression_type;
@@ -108,40 +158,16 @@ struct matrix_pow_functor2_traits
                 signature_argument1_type,
                 signature_argument2_type
             >::promote_type signature_result_type;
+    typedef pow_functor<signature_argument1_type,signature_argument2_type,signature_result_type> functor_type;
     typedef matrix_binary_functor2_traits<
                 Arg1T,
                 input_expression_type,
-                signature_result_type (signature_argument1_type, signature_argument2_type)
+                functor_type
             > binary_functor_expression_type;
     typedef typename binary_functor_expression_type::result_type result_type;
     typedef typename binary_functor_expression_type::expression_type expression_type;
 };
 
-
-// Wrappers to the std::pow function to avoid compiler errors
-
-template <typename T1, typename T2>
-BOOST_UBLAS_INLINE
-typename promote_traits<T1,T2>::promote_type pow(T1 x, T2 y)
-{
-    return ::std::pow(x, y);
-}
-
-template <typename T1, typename T2>
-BOOST_UBLAS_INLINE
-std::complex<T1> pow(std::complex<T1> const& x, T2 y)
-{
-    return ::std::pow(x, y);
-}
-
-template <typename T1, typename T2>
-BOOST_UBLAS_INLINE
-std::complex<T1> pow(T1 x, std::complex<T2> const& y)
-{
-    // Remember: if z=(a + ib) is a complex number and c is a scalar => c^z = e^{ln(c)*z}
-    return ::std::exp(::std::log(x)*y);
-}
-
 } // Namespace detail
 
 
@@ -164,15 +190,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_pow_functor1_traits<VectorExprT,T>::result_type pow(vector_expression<VectorExprT> const& ve, T p)
 {
     typedef typename detail::vector_pow_functor1_traits<VectorExprT,T>::expression_type expression_type;
-    typedef typename detail::vector_pow_functor1_traits<VectorExprT,T>::signature_argument1_type signature_argument1_type;
-    typedef typename detail::vector_pow_functor1_traits<VectorExprT,T>::signature_argument2_type signature_argument2_type;
-    typedef typename detail::vector_pow_functor1_traits<VectorExprT,T>::signature_result_type signature_result_type;
-
-//  return expression_type(ve(), detail::pow<signature_result_type>);
-//  signature_result_type (*)(ptr_pow_fun)(signature_argument_type)(BOOST_NUMERIC_UBLASX_OPERATION_POW_NS_::pow); 
-    typedef signature_result_type(*fun_ptr_type)(signature_argument1_type, signature_argument2_type);
-    fun_ptr_type ptr_pow_fun(&detail::pow); 
-    return expression_type(ve(), p, ptr_pow_fun);
+    typedef typename detail::vector_pow_functor1_traits<VectorExprT,T>::functor_type functor_type;
+
+    return expression_type(ve(), p, functor_type());
 }
 
 
@@ -195,15 +215,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_pow_functor2_traits<T,VectorExprT>::result_type pow(T b, vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_pow_functor2_traits<T,VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_pow_functor2_traits<T,VectorExprT>::signature_argument1_type signature_argument1_type;
-    typedef typename detail::vector_pow_functor2_traits<T,VectorExprT>::signature_argument2_type signature_argument2_type;
-    typedef typename detail::vector_pow_functor2_traits<T,VectorExprT>::signature_result_type signature_result_type;
-
-//  return expression_type(ve(), detail::pow<signature_result_type>);
-//  signature_result_type (*)(ptr_pow_fun)(signature_argument_type)(BOOST_NUMERIC_UBLASX_OPERATION_POW_NS_::pow); 
-    typedef signature_result_type(*fun_ptr_type)(signature_argument1_type, signature_argument2_type);
-    fun_ptr_type ptr_pow_fun(&detail::pow); 
-    return expression_type(b, ve(), ptr_pow_fun);
+    typedef typename detail::vector_pow_functor2_traits<T,VectorExprT>::functor_type functor_type;
+
+    return expression_type(b, ve(), functor_type());
 }
 
 
@@ -226,16 +240,12 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::result_type pow(matrix_expression<MatrixExprT> const& me, T p)
 {
     typedef typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::expression_type expression_type;
-    typedef typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::signature_argument1_type signature_argument1_type;
-    typedef typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::signature_argument2_type signature_argument2_type;
-    typedef typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::signature_result_type signature_result_type;
-
-//  return expression_type(me(), detail::pow<signature_result_type>(signature_argument_type));
-    typedef signature_result_type(*fun_ptr_type)(signature_argument1_type, signature_argument2_type);
-    fun_ptr_type ptr_pow_fun(&detail::pow); 
-    return expression_type(me(), p, ptr_pow_fun);
+    typedef typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::functor_type functor_type;
+
+    return expression_type(me(), p, functor_type());
 }
 
+
 /**
  * \brief Applies the \c std::pow function to a given matrix expression,
  *  where each element of the matrix is treated as the power of the
@@ -255,14 +265,64 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::result_type pow(T b, matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::signature_argument1_type signature_argument1_type;
-    typedef typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::signature_argument2_type signature_argument2_type;
-    typedef typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::signature_result_type signature_result_type;
-
-//  return expression_type(me(), detail::pow<signature_result_type>(signature_argument_type));
-    typedef signature_result_type(*fun_ptr_type)(signature_argument1_type, signature_argument2_type);
-    fun_ptr_type ptr_pow_fun(&detail::pow); 
-    return expression_type(b, me(), ptr_pow_fun);
+    typedef typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::functor_type functor_type;
+
+    return expression_type(b, me(), functor_type());
+}
+
+
+// pow(policy, ...), which evaluates the corresponding pow(...) immediately
+// (see BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS)
+
+template <typename ExecutionPolicyT, typename VectorExprT, typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::vector_eval_traits<
+        typename detail::vector_pow_functor1_traits<VectorExprT,T>::expression_type
+    >::result_type
+>::type pow(ExecutionPolicyT const& policy, vector_expression<VectorExprT> const& ve, T p)
+{
+    return detail::evaluate(policy, pow(ve, p));
+}
+
+
+template <typename ExecutionPolicyT, typename T, typename VectorExprT>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::vector_eval_traits<
+        typename detail::vector_pow_functor2_traits<T,VectorExprT>::expression_type
+    >::result_type
+>::type pow(ExecutionPolicyT const& policy, T b, vector_expression<VectorExprT> const& ve)
+{
+    return detail::evaluate(policy, pow(b, ve));
+}
+
+
+template <typename ExecutionPolicyT, typename MatrixExprT, typename T>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::matrix_eval_traits<
+        typename detail::matrix_pow_functor1_traits<MatrixExprT,T>::expression_type
+    >::result_type
+>::type pow(ExecutionPolicyT const& policy, matrix_expression<MatrixExprT> const& me, T p)
+{
+    return detail::evaluate(policy, pow(me, p));
+}
+
+
+template <typename ExecutionPolicyT, typename T, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::matrix_eval_traits<
+        typename detail::matrix_pow_functor2_traits<T,MatrixExprT>::expression_type
+    >::result_type
+>::type pow(ExecutionPolicyT const& policy, T b, matrix_expression<MatrixExprT> const& me)
+{
+    return detail::evaluate(policy, pow(b, me));
 }
 
 }}} // Namespace boost::numeric::ublasx
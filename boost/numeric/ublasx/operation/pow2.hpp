@@ -24,6 +24,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 #include <complex>
 
@@ -34,15 +35,55 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Auxiliary function used to replace ::std::pow2 when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+T pow2(T x)
+{
+    return ::std::pow(2,x);
+}
+
+/// Auxiliary function used to replace ::std::pow2 when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+::std::complex<T> pow2(::std::complex<T> x)
+{
+    // Use the complex exponentiation formula.
+    // See:
+    // - http://en.wikipedia.org/wiki/Exponentiation#Powers_of_complex_numbers
+    // - http://mathworld.wolfram.com/ComplexExponentiation.html
+
+    T c0 = ::std::pow(2,x.real());
+    T c1 = x.imag()*::std::log(2);
+    return ::std::complex<T>(c0*::std::cos(c1),c0*::std::sin(c1));
+}
+
+
+/// Functor computing the base-2 exponential of its argument.
+template <typename ArgT, typename ResT>
+struct pow2_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return detail::pow2(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_pow2_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef pow2_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -55,38 +96,15 @@ struct matrix_pow2_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef pow2_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Auxiliary function used to replace ::std::pow2 when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-T pow2(T x)
-{
-    return ::std::pow(2,x);
-}
-
-/// Auxiliary function used to replace ::std::pow2 when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-::std::complex<T> pow2(::std::complex<T> x)
-{
-    // Use the complex exponentiation formula.
-    // See:
-    // - http://en.wikipedia.org/wiki/Exponentiation#Powers_of_complex_numbers
-    // - http://mathworld.wolfram.com/ComplexExponentiation.html
-
-    T c0 = ::std::pow(2,x.real());
-    T c1 = x.imag()*::std::log(2);
-    return ::std::complex<T>(c0*::std::cos(c1),c0*::std::sin(c1));
-}
-
 } // Namespace detail
 
 
@@ -106,14 +124,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_pow2_functor_traits<VectorExprT>::result_type pow2(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_pow2_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_pow2_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
-    typedef typename detail::vector_pow2_functor_traits<VectorExprT>::signature_result_type signature_result_type;
-
-//  return expression_type(ve(), detail::pow2<signature_result_type>);
-//  signature_result_type (*)(ptr_pow2_fun)(signature_argument_type)(BOOST_NUMERIC_UBLASX_OPERATION_POW2_NS_::pow2); 
-    typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
-    fun_ptr_type ptr_pow2_fun(&detail::pow2); 
-    return expression_type(ve(), ptr_pow2_fun);
+    typedef typename detail::vector_pow2_functor_traits<VectorExprT>::functor_type functor_type;
+
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -133,15 +146,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_pow2_functor_traits<MatrixExprT>::result_type pow2(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_pow2_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_pow2_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
-    typedef typename detail::matrix_pow2_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_pow2_functor_traits<MatrixExprT>::functor_type functor_type;
 
-//  return expression_type(me(), detail::pow2<signature_result_type>(signature_argument_type));
-    typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
-    fun_ptr_type ptr_pow2_fun(&detail::pow2); 
-    return expression_type(me(), ptr_pow2_fun);
+    return expression_type(me(), functor_type());
 }
 
+
+// pow2(policy, e), which evaluates pow2(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(pow2)
+
 }}} // Namespace boost::numeric::ublasx
 
 
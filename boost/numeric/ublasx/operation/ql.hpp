@@ -66,6 +66,7 @@
 #include <boost/numeric/bindings/lapack/computational/orgql.hpp>
 #include <boost/numeric/bindings/lapack/computational/ormql.hpp>
 #include <boost/numeric/bindings/lapack/computational/ungql.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/bindings/tag.hpp>
 #include <boost/numeric/bindings/trans.hpp>
@@ -81,6 +82,8 @@
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_complex.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <complex>
 #include <cstddef>
@@ -150,6 +153,62 @@ struct ql_decomposition_impl_common
     }
 
 
+    /// Performan QL decomposition of the given input matrix \a A by means of
+    /// the given \a work array (column-major case).
+    template <typename AMatrixT, typename TauVectorT, typename WorkVectorT>
+        static void decompose(AMatrixT& A, TauVectorT& tau, WorkVectorT& work, column_major_tag)
+    {
+        typedef typename matrix_traits<AMatrixT>::size_type size_type;
+
+        size_type k = ::std::min(num_rows(A), num_columns(A));
+
+        if (size(tau) != k)
+        {
+            tau.resize(k, false);
+        }
+
+        ::boost::numeric::bindings::lapack::geqlf(A, tau, ::boost::numeric::bindings::lapack::workspace(work));
+    }
+
+
+    /**
+     * \brief Copy the elementary reflectors stored in \a QL into the \a Q
+     *  matrix in order to build the Q matrix by means of LAPACK \c orgql
+     *  (column-major case).
+     */
+    template <typename QLMatrixT, typename QMatrixT>
+        static void init_Q(QLMatrixT const& QL, QMatrixT& Q, bool full)
+    {
+        typedef typename matrix_traits<QMatrixT>::size_type size_type;
+        typedef typename matrix_traits<QMatrixT>::value_type value_type;
+
+        size_type m = num_rows(QL);
+        size_type n = num_columns(QL);
+        size_type nc = full ? m : ::std::min(m,n);
+
+        if (num_rows(Q) != m || num_columns(Q) != nc)
+        {
+            Q.resize(m, nc, false);
+        }
+
+        if (m > n && full)
+        {
+            noalias(subrange(Q, 0, m, 0, m-n)) = scalar_matrix<value_type>(m, m-n, value_type/*zero*/());
+            noalias(subrange(Q, 0, m, m-n, m)) = QL;
+        }
+        else if (m < n)
+        {
+            noalias(subrange(Q, 0, m-1, 0, 1)) = scalar_matrix<value_type>(m-1, 1, value_type/*zero*/());
+            noalias(subrange(Q, m-1, m, 0, m)) = scalar_matrix<value_type>(1, m, value_type/*zero*/());
+            noalias(subrange(Q, 0, m-1, 1, m)) = subrange(QL, 0, m-1, n-m+1, n);
+        }
+        else
+        {
+            noalias(Q) = QL;
+        }
+    }
+
+
     /// Extract the L matrix from a previously computing QL decomposition
     /// (row-major case).
     template <typename QLMatrixT, typename LMatrixT>
@@ -555,40 +614,7 @@ struct ql_decomposition_impl<false>: public ql_decomposition_impl_common
     template <typename QLMatrixT, typename TauVectorT, typename QMatrixT>
         static void extract_Q(QLMatrixT const& QL, TauVectorT& tau, QMatrixT& Q, bool full, column_major_tag)
     {
-        typedef typename matrix_traits<QMatrixT>::size_type size_type;
-        typedef typename matrix_traits<QMatrixT>::value_type value_type;
-
-        size_type m = num_rows(QL);
-        size_type n = num_columns(QL);
-        size_type nc = full ? m : ::std::min(m,n);
-
-        if (num_rows(Q) != m || num_columns(Q) != nc)
-        {
-            Q.resize(m, nc, false);
-        }
-
-        if (m > n)
-        {
-            if (full)
-            {
-                subrange(Q, 0, m, 0, m-n) = scalar_matrix<value_type>(m, m-n, value_type/*zero*/());
-                subrange(Q, 0, m, m-n, m) = QL;
-            }
-            else
-            {
-                Q = QL;
-            }
-        }
-        else if (m < n)
-        {
-            subrange(Q, 0, m-1, 0, 1) = scalar_matrix<value_type>(m-1, 1, value_type/*zero*/());
-            subrange(Q, m-1, m, 0, m) = scalar_matrix<value_type>(1, m, value_type/*zero*/());
-            subrange(Q, 0, m-1, 1, m) = subrange(QL, 0, m-1, n-m+1, n);
-        }
-        else
-        {
-            Q = QL;
-        }
+        init_Q(QL, Q, full);
 
         ::boost::numeric::bindings::lapack::orgql(Q, tau);
 /*
@@ -628,6 +654,17 @@ struct ql_decomposition_impl<false>: public ql_decomposition_impl_common
         }
 */
     }
+
+
+    /// Extract the Q matrix from a previously computing QL decomposition by
+    /// means of the given \a work array (column-major case).
+    template <typename QLMatrixT, typename TauVectorT, typename QMatrixT, typename WorkVectorT>
+        static void extract_Q(QLMatrixT const& QL, TauVectorT const& tau, QMatrixT& Q, bool full, WorkVectorT& work, column_major_tag)
+    {
+        init_Q(QL, Q, full);
+
+        ::boost::numeric::bindings::lapack::orgql(Q, tau, ::boost::numeric::bindings::lapack::workspace(work));
+    }
 };
 
 
@@ -658,40 +695,7 @@ struct ql_decomposition_impl<true>: public ql_decomposition_impl_common
     template <typename QLMatrixT, typename TauVectorT, typename QMatrixT>
         static void extract_Q(QLMatrixT const& QL, TauVectorT& tau, QMatrixT& Q, bool full, column_major_tag)
     {
-        typedef typename matrix_traits<QMatrixT>::size_type size_type;
-        typedef typename matrix_traits<QMatrixT>::value_type value_type;
-
-        size_type m = num_rows(QL);
-        size_type n = num_columns(QL);
-        size_type nc = full ? m : std::min(m,n);
-
-        if (num_rows(Q) != m || num_columns(Q) != nc)
-        {
-            Q.resize(m, nc, false);
-        }
-
-        if (m > n)
-        {
-            if (full)
-            {
-                subrange(Q, 0, m, 0, m-n) = scalar_matrix<value_type>(m, m-n, 0);
-                subrange(Q, 0, m, m-n, m) = QL;
-            }
-            else
-            {
-                Q = QL;
-            }
-        }
-        else if (m < n)
-        {
-            subrange(Q, 0, m-1, 0, 1) = scalar_matrix<value_type>(m-1, 1, 0);
-            subrange(Q, m-1, m, 0, m) = scalar_matrix<value_type>(1, m, 0);
-            subrange(Q, 0, m-1, 1, m) = subrange(QL, 0, m-1, n-m+1, n);
-        }
-        else
-        {
-            Q = QL;
-        }
+        init_Q(QL, Q, full);
 
         ::boost::numeric::bindings::lapack::ungql(Q, tau);
 /*
@@ -731,6 +735,17 @@ struct ql_decomposition_impl<true>: public ql_decomposition_impl_common
         }
 */
     }
+
+
+    /// Extract the Q matrix from a previously computing QL decomposition by
+    /// means of the given \a work array (column-major case).
+    template <typename QLMatrixT, typename TauVectorT, typename QMatrixT, typename WorkVectorT>
+        static void extract_Q(QLMatrixT const& QL, TauVectorT const& tau, QMatrixT& Q, bool full, WorkVectorT& work, column_major_tag)
+    {
+        init_Q(QL, Q, full);
+
+        ::boost::numeric::bindings::lapack::ungql(Q, tau, ::boost::numeric::bindings::lapack::workspace(work));
+    }
 };
 
 
@@ -758,6 +773,191 @@ void ql_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, LMa
         >::template extract_L(tmp_QL, L, full, orientation);
 }
 
+
+/// Optimal workspace query of LAPACK \c geqlf and \c orgql (real matrices).
+template <typename ValueT>
+void ql_query(::fortran_int_t m, ::fortran_int_t n, ValueT* opt_geqlf, ValueT* opt_orgql, ::boost::false_type)
+{
+    const ::fortran_int_t lda = ::std::max(m, ::fortran_int_t(1));
+
+    ::boost::numeric::bindings::lapack::detail::geqlf(m, n, 0, lda, 0, opt_geqlf, -1);
+    ::boost::numeric::bindings::lapack::detail::orgql(m, m, ::std::min(m, n), 0, lda, 0, opt_orgql, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c geqlf and \c ungql (complex
+/// matrices).
+template <typename ValueT>
+void ql_query(::fortran_int_t m, ::fortran_int_t n, ValueT* opt_geqlf, ValueT* opt_orgql, ::boost::true_type)
+{
+    const ::fortran_int_t lda = ::std::max(m, ::fortran_int_t(1));
+
+    ::boost::numeric::bindings::lapack::detail::geqlf(m, n, 0, lda, 0, opt_geqlf, -1);
+    ::boost::numeric::bindings::lapack::detail::ungql(m, m, ::std::min(m, n), 0, lda, 0, opt_orgql, -1);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the QL decomposition.
+ *
+ * Owns the work array needed by LAPACK \c geqlf and \c orgql (\c ungql for
+ * complex matrices), the vector of the scalar factors of the elementary
+ * reflectors and the scratch matrices used to hold the factored matrix and
+ * (for row-major outputs) the Q matrix.
+ * The optimal size of the work array is queried (\c lwork=-1) only when the
+ * size of the matrix to decompose changes, so that repeated decompositions
+ * of same-sized matrices do not allocate memory.
+ *
+ * \tparam ValueT The type of the elements of the matrices to decompose.
+ */
+template <typename ValueT>
+class ql_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+
+
+    /// Default constructor.
+    public: ql_workspace()
+        : m_(0),
+          n_(0),
+          queried_(false)
+    {
+    }
+
+
+    /// Create a workspace for the QL decomposition of \a m by \a n matrices.
+    public: ql_workspace(size_type m, size_type n)
+        : m_(0),
+          n_(0),
+          queried_(false)
+    {
+        resize(m, n);
+    }
+
+
+    /// Prepare the workspace for the QL decomposition of \a m by \a n
+    /// matrices.
+    public: void resize(size_type m, size_type n)
+    {
+        if (queried_ && m == m_ && n == n_)
+        {
+            return;
+        }
+
+        value_type opt_geqlf = 0;
+        value_type opt_orgql = 0;
+        detail::ql_query(static_cast< ::fortran_int_t >(m),
+                         static_cast< ::fortran_int_t >(n),
+                         &opt_geqlf,
+                         &opt_orgql,
+                         ::boost::is_complex<value_type>());
+        const size_type lwork = ::std::max(static_cast<size_type>(::std::real(opt_geqlf)),
+                                           static_cast<size_type>(::std::real(opt_orgql)));
+        work_.resize(::std::max(lwork, size_type(1)), false);
+
+        m_ = m;
+        n_ = n;
+        queried_ = true;
+    }
+
+
+    /// Return the scratch matrix for the factored matrix.
+    public: work_matrix_type& work_matrix()
+    {
+        return QL_;
+    }
+
+
+    /// Return the scratch matrix for the Q matrix.
+    public: work_matrix_type& Q_work_matrix()
+    {
+        return Q_;
+    }
+
+
+    /// Return the scratch vector for the scalar factors of the elementary
+    /// reflectors.
+    public: work_vector_type& tau()
+    {
+        return tau_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// The number of rows of the matrices this workspace is prepared for.
+    private: size_type m_;
+    /// The number of columns of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// Tells if the work array has been sized.
+    private: bool queried_;
+    /// The scratch matrix for the factored matrix.
+    private: work_matrix_type QL_;
+    /// The scratch matrix for the Q matrix.
+    private: work_matrix_type Q_;
+    /// The scratch vector for the scalar factors of the elementary reflectors.
+    private: work_vector_type tau_;
+    /// The work array.
+    private: work_vector_type work_;
+};
+
+
+namespace detail {
+
+/// Free function performing the QL decomposition of the given matrix
+/// expression \a A by means of the given workspace (column-major case).
+template<typename MatrixExprT, typename QMatrixT, typename LMatrixT>
+void ql_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, LMatrixT& L, bool full, ql_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, column_major_tag)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef ql_decomposition_impl< ::boost::is_complex<value_type>::value > impl_type;
+
+    const ::std::size_t m = num_rows(A);
+    const ::std::size_t n = num_columns(A);
+
+    ws.resize(m, n);
+
+    typename ql_workspace<value_type>::work_matrix_type& QL = ws.work_matrix();
+    if (num_rows(QL) != m || num_columns(QL) != n)
+    {
+        QL.resize(m, n, false);
+    }
+    noalias(QL) = A;
+
+    impl_type::decompose(QL, ws.tau(), ws.work(), column_major_tag());
+    impl_type::extract_Q(QL, ws.tau(), Q, full, ws.work(), column_major_tag());
+    impl_type::extract_L(QL, L, full, column_major_tag());
+}
+
+
+/// Free function performing the QL decomposition of the given matrix
+/// expression \a A by means of the given workspace (row-major case).
+template<typename MatrixExprT, typename QMatrixT, typename LMatrixT>
+void ql_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, LMatrixT& L, bool full, ql_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, row_major_tag)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    typename ql_workspace<value_type>::work_matrix_type& tmp_Q = ws.Q_work_matrix();
+
+    ql_decompose_impl(A, tmp_Q, L, full, ws, column_major_tag());
+
+    if (num_rows(Q) != num_rows(tmp_Q) || num_columns(Q) != num_columns(tmp_Q))
+    {
+        Q.resize(num_rows(tmp_Q), num_columns(tmp_Q), false);
+    }
+    noalias(Q) = tmp_Q;
+}
+
 } // Namespace detail
 
 
@@ -802,7 +1002,11 @@ class ql_decomposition
     public: template <typename MatrixExprT>
         void decompose(matrix_expression<MatrixExprT> const& A)
     {
-        QL_ = A;
+        if (num_rows(QL_) != num_rows(A) || num_columns(QL_) != num_columns(A))
+        {
+            QL_.resize(num_rows(A), num_columns(A), false);
+        }
+        noalias(QL_) = A;
 
         decompose();
     }
@@ -955,9 +1159,11 @@ class ql_decomposition
 
     private: void decompose()
     {
+        ws_.resize(num_rows(QL_), num_columns(QL_));
+
         detail::ql_decomposition_impl<
                 ::boost::is_complex<value_type>::value
-            >::template decompose(QL_, tau_, column_major_tag());
+            >::template decompose(QL_, tau_, ws_.work(), column_major_tag());
     }
 
 
@@ -1072,6 +1278,8 @@ class ql_decomposition
     //       changes the QL matrix (and restores it before returning).
     private: mutable QL_matrix_type QL_;
     private: tau_vector_type tau_;
+    /// The workspace reused by subsequent decompositions.
+    private: ql_workspace<value_type> ws_;
 };
 
 
@@ -1096,6 +1304,35 @@ void ql_decompose(matrix_expression<MatrixExprT> const& A, OutMatrix1T& Q, OutMa
 }
 
 
+/**
+ * \brief Free function performing the QL decomposition of the given matrix
+ *  expression \a A by means of the given workspace.
+ *
+ * No memory is allocated when the workspace and the outputs are already sized
+ * for a matrix with the same size of \a A.
+ *
+ * \sa ql_workspace
+ */
+template<typename MatrixExprT, typename OutMatrix1T, typename OutMatrix2T>
+BOOST_UBLAS_INLINE
+void ql_decompose(matrix_expression<MatrixExprT> const& A, OutMatrix1T& Q, OutMatrix2T& L, bool full, ql_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<OutMatrix1T>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutMatrix2T>::orientation_category orientation_category3;
+
+    // precondition: same orientation category
+    BOOST_MPL_ASSERT(
+        (::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::is_same<orientation_category1,orientation_category3>
+        >)
+    );
+
+    detail::ql_decompose_impl(A, Q, L, full, ws, orientation_category1());
+}
+
+
 /// Free function performing the QL decomposition of the given matrix expression \a A.
 template<typename MatrixExprT>
 BOOST_UBLAS_INLINE
@@ -43,6 +43,9 @@
  *
  * This matrix decomposition can be used to solve linear systems of equations,
  * especially the ones involved in the linear least squares problem.
+ * The factors of a matrix that changes by a rank-1 term or by a row or a
+ * column can be updated at a fraction of the cost of a new decomposition (see
+ * \c boost/numeric/ublasx/operation/qr_update.hpp).
  *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
@@ -66,6 +69,7 @@
 #include <boost/numeric/bindings/lapack/computational/orgqr.hpp>
 #include <boost/numeric/bindings/lapack/computational/ormqr.hpp>
 #include <boost/numeric/bindings/lapack/computational/ungqr.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/bindings/tag.hpp>
 #include <boost/numeric/bindings/trans.hpp>
@@ -79,6 +83,8 @@
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_complex.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <complex>
 #include <cstddef>
@@ -148,6 +154,56 @@ struct qr_decomposition_impl_common
     }
 
 
+    /// Performan QR decomposition of the given input matrix \a A by means of
+    /// the given \a work array (column-major case).
+    template <typename AMatrixT, typename TauVectorT, typename WorkVectorT>
+        static void decompose(AMatrixT& A, TauVectorT& tau, WorkVectorT& work, column_major_tag)
+    {
+        typedef typename matrix_traits<AMatrixT>::size_type size_type;
+
+        size_type k = ::std::min(num_rows(A), num_columns(A));
+
+        if (size(tau) != k)
+        {
+            tau.resize(k, false);
+        }
+
+        ::boost::numeric::bindings::lapack::geqrf(A, tau, ::boost::numeric::bindings::lapack::workspace(work));
+    }
+
+
+    /**
+     * \brief Copy the elementary reflectors stored in \a QR into the \a Q
+     *  matrix in order to build the Q matrix by means of LAPACK \c orgqr
+     *  (column-major case).
+     */
+    template <typename QRMatrixT, typename QMatrixT>
+        static void init_Q(QRMatrixT const& QR, QMatrixT& Q, bool full)
+    {
+        typedef typename matrix_traits<QMatrixT>::size_type size_type;
+        typedef typename matrix_traits<QMatrixT>::value_type value_type;
+
+        size_type m = num_rows(QR);
+        size_type n = num_columns(QR);
+        size_type nc = full ? m : ::std::min(m,n);
+
+        if (num_rows(Q) != m || num_columns(Q) != nc)
+        {
+            Q.resize(m, nc, false);
+        }
+
+        if (m > n && full)
+        {
+            noalias(subrange(Q, 0, m, 0, n)) = QR;
+            noalias(subrange(Q, 0, m, n, m)) = scalar_matrix<value_type>(m, m-n, value_type/*zero*/());
+        }
+        else
+        {
+            noalias(Q) = subrange(QR, 0, m, 0, nc);
+        }
+    }
+
+
     /**
      * \brief Extract the R matrix from a previously computing QR decomposition
      * (row-major case).
@@ -537,40 +593,20 @@ struct qr_decomposition_impl<false>: public qr_decomposition_impl_common
     template <typename QRMatrixT, typename TauVectorT, typename QMatrixT>
         static void extract_Q(QRMatrixT const& QR, TauVectorT& tau, QMatrixT& Q, bool full, column_major_tag)
     {
-        typedef typename matrix_traits<QMatrixT>::size_type size_type;
-        typedef typename matrix_traits<QMatrixT>::value_type value_type;
+        init_Q(QR, Q, full);
 
-        size_type m = num_rows(QR);
-        size_type n = num_columns(QR);
-        size_type nc = full ? m : ::std::min(m,n);
+        ::boost::numeric::bindings::lapack::orgqr(Q, tau);
+    }
 
-        if (num_rows(Q) != m || num_columns(Q) != nc)
-        {
-            Q.resize(m, nc, false);
-        }
 
-        if (m > n)
-        {
-            if (full)
-            {
-                subrange(Q, 0, m, 0, n) = QR;
-                subrange(Q, 0, m, n, m) = scalar_matrix<value_type>(m, m-n, value_type/*zero*/());
-            }
-            else
-            {
-                Q = QR;
-            }
-        }
-        else if (m < n)
-        {
-            Q = subrange(QR, 0, m, 0, nc);
-        }
-        else
-        {
-            Q = QR;
-        }
+    /// Extract the Q matrix from a previously computing QR decomposition by
+    /// means of the given \a work array (column-major case).
+    template <typename QRMatrixT, typename TauVectorT, typename QMatrixT, typename WorkVectorT>
+        static void extract_Q(QRMatrixT const& QR, TauVectorT const& tau, QMatrixT& Q, bool full, WorkVectorT& work, column_major_tag)
+    {
+        init_Q(QR, Q, full);
 
-       ::boost::numeric::bindings::lapack::orgqr(Q, tau);
+        ::boost::numeric::bindings::lapack::orgqr(Q, tau, ::boost::numeric::bindings::lapack::workspace(work));
     }
 };
 
@@ -597,40 +633,20 @@ struct qr_decomposition_impl<true>: public qr_decomposition_impl_common
     template <typename QRMatrixT, typename TauVectorT, typename QMatrixT>
         static void extract_Q(QRMatrixT const& QR, TauVectorT const& tau, QMatrixT& Q, bool full, column_major_tag)
     {
-        typedef typename matrix_traits<QMatrixT>::size_type size_type;
-        typedef typename matrix_traits<QMatrixT>::value_type value_type;
+        init_Q(QR, Q, full);
 
-        size_type m = num_rows(QR);
-        size_type n = num_columns(QR);
-        size_type nc = full ? m : ::std::min(m,n);
+        ::boost::numeric::bindings::lapack::ungqr(Q, tau);
+    }
 
-        if (num_rows(Q) != m || num_columns(Q) != nc)
-        {
-            Q.resize(m, nc, false);
-        }
 
-        if (m > n)
-        {
-            if (full)
-            {
-                subrange(Q, 0, m, 0, n) = QR;
-                subrange(Q, 0, m, n, m) = scalar_matrix<value_type>(m, m-n, value_type/*zero*/());
-            }
-            else
-            {
-                Q = QR;
-            }
-        }
-        else if (m < n)
-        {
-            Q = subrange(QR, 0, m, 0, nc);
-        }
-        else
-        {
-            Q = QR;
-        }
+    /// Extract the Q matrix from a previously computing QR decomposition by
+    /// means of the given \a work array (column-major case).
+    template <typename QRMatrixT, typename TauVectorT, typename QMatrixT, typename WorkVectorT>
+        static void extract_Q(QRMatrixT const& QR, TauVectorT const& tau, QMatrixT& Q, bool full, WorkVectorT& work, column_major_tag)
+    {
+        init_Q(QR, Q, full);
 
-        ::boost::numeric::bindings::lapack::ungqr(Q, tau);
+        ::boost::numeric::bindings::lapack::ungqr(Q, tau, ::boost::numeric::bindings::lapack::workspace(work));
     }
 };
 
@@ -659,6 +675,191 @@ void qr_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, RMa
         >::template extract_R(tmp_QR, R, full, orientation);
 }
 
+
+/// Optimal workspace query of LAPACK \c geqrf and \c orgqr (real matrices).
+template <typename ValueT>
+void qr_query(::fortran_int_t m, ::fortran_int_t n, ValueT* opt_geqrf, ValueT* opt_orgqr, ::boost::false_type)
+{
+    const ::fortran_int_t lda = ::std::max(m, ::fortran_int_t(1));
+
+    ::boost::numeric::bindings::lapack::detail::geqrf(m, n, 0, lda, 0, opt_geqrf, -1);
+    ::boost::numeric::bindings::lapack::detail::orgqr(m, m, ::std::min(m, n), 0, lda, 0, opt_orgqr, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c geqrf and \c ungqr (complex
+/// matrices).
+template <typename ValueT>
+void qr_query(::fortran_int_t m, ::fortran_int_t n, ValueT* opt_geqrf, ValueT* opt_orgqr, ::boost::true_type)
+{
+    const ::fortran_int_t lda = ::std::max(m, ::fortran_int_t(1));
+
+    ::boost::numeric::bindings::lapack::detail::geqrf(m, n, 0, lda, 0, opt_geqrf, -1);
+    ::boost::numeric::bindings::lapack::detail::ungqr(m, m, ::std::min(m, n), 0, lda, 0, opt_orgqr, -1);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the QR decomposition.
+ *
+ * Owns the work array needed by LAPACK \c geqrf and \c orgqr (\c ungqr for
+ * complex matrices), the vector of the scalar factors of the elementary
+ * reflectors and the scratch matrices used to hold the factored matrix and
+ * (for row-major outputs) the Q matrix.
+ * The optimal size of the work array is queried (\c lwork=-1) only when the
+ * size of the matrix to decompose changes, so that repeated decompositions
+ * of same-sized matrices do not allocate memory.
+ *
+ * \tparam ValueT The type of the elements of the matrices to decompose.
+ */
+template <typename ValueT>
+class qr_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+
+
+    /// Default constructor.
+    public: qr_workspace()
+        : m_(0),
+          n_(0),
+          queried_(false)
+    {
+    }
+
+
+    /// Create a workspace for the QR decomposition of \a m by \a n matrices.
+    public: qr_workspace(size_type m, size_type n)
+        : m_(0),
+          n_(0),
+          queried_(false)
+    {
+        resize(m, n);
+    }
+
+
+    /// Prepare the workspace for the QR decomposition of \a m by \a n
+    /// matrices.
+    public: void resize(size_type m, size_type n)
+    {
+        if (queried_ && m == m_ && n == n_)
+        {
+            return;
+        }
+
+        value_type opt_geqrf = 0;
+        value_type opt_orgqr = 0;
+        detail::qr_query(static_cast< ::fortran_int_t >(m),
+                         static_cast< ::fortran_int_t >(n),
+                         &opt_geqrf,
+                         &opt_orgqr,
+                         ::boost::is_complex<value_type>());
+        const size_type lwork = ::std::max(static_cast<size_type>(::std::real(opt_geqrf)),
+                                           static_cast<size_type>(::std::real(opt_orgqr)));
+        work_.resize(::std::max(lwork, size_type(1)), false);
+
+        m_ = m;
+        n_ = n;
+        queried_ = true;
+    }
+
+
+    /// Return the scratch matrix for the factored matrix.
+    public: work_matrix_type& work_matrix()
+    {
+        return QR_;
+    }
+
+
+    /// Return the scratch matrix for the Q matrix.
+    public: work_matrix_type& Q_work_matrix()
+    {
+        return Q_;
+    }
+
+
+    /// Return the scratch vector for the scalar factors of the elementary
+    /// reflectors.
+    public: work_vector_type& tau()
+    {
+        return tau_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// The number of rows of the matrices this workspace is prepared for.
+    private: size_type m_;
+    /// The number of columns of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// Tells if the work array has been sized.
+    private: bool queried_;
+    /// The scratch matrix for the factored matrix.
+    private: work_matrix_type QR_;
+    /// The scratch matrix for the Q matrix.
+    private: work_matrix_type Q_;
+    /// The scratch vector for the scalar factors of the elementary reflectors.
+    private: work_vector_type tau_;
+    /// The work array.
+    private: work_vector_type work_;
+};
+
+
+namespace detail {
+
+/// Free function performing the QR decomposition of the given matrix
+/// expression \a A by means of the given workspace (column-major case).
+template<typename MatrixExprT, typename QMatrixT, typename RMatrixT>
+void qr_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, RMatrixT& R, bool full, qr_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, column_major_tag)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef qr_decomposition_impl< ::boost::is_complex<value_type>::value > impl_type;
+
+    const ::std::size_t m = num_rows(A);
+    const ::std::size_t n = num_columns(A);
+
+    ws.resize(m, n);
+
+    typename qr_workspace<value_type>::work_matrix_type& QR = ws.work_matrix();
+    if (num_rows(QR) != m || num_columns(QR) != n)
+    {
+        QR.resize(m, n, false);
+    }
+    noalias(QR) = A;
+
+    impl_type::decompose(QR, ws.tau(), ws.work(), column_major_tag());
+    impl_type::extract_Q(QR, ws.tau(), Q, full, ws.work(), column_major_tag());
+    impl_type::extract_R(QR, R, full, column_major_tag());
+}
+
+
+/// Free function performing the QR decomposition of the given matrix
+/// expression \a A by means of the given workspace (row-major case).
+template<typename MatrixExprT, typename QMatrixT, typename RMatrixT>
+void qr_decompose_impl(matrix_expression<MatrixExprT> const& A, QMatrixT& Q, RMatrixT& R, bool full, qr_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, row_major_tag)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    typename qr_workspace<value_type>::work_matrix_type& tmp_Q = ws.Q_work_matrix();
+
+    qr_decompose_impl(A, tmp_Q, R, full, ws, column_major_tag());
+
+    if (num_rows(Q) != num_rows(tmp_Q) || num_columns(Q) != num_columns(tmp_Q))
+    {
+        Q.resize(num_rows(tmp_Q), num_columns(tmp_Q), false);
+    }
+    noalias(Q) = tmp_Q;
+}
+
 } // Namespace detail
 
 
@@ -697,7 +898,11 @@ class qr_decomposition
     public: template <typename MatrixExprT>
         void decompose(matrix_expression<MatrixExprT> const& A)
     {
-        QR_ = A;
+        if (num_rows(QR_) != num_rows(A) || num_columns(QR_) != num_columns(A))
+        {
+            QR_.resize(num_rows(A), num_columns(A), false);
+        }
+        noalias(QR_) = A;
 
         decompose();
     }
@@ -817,9 +1022,11 @@ class qr_decomposition
 
     private: void decompose()
     {
+        ws_.resize(num_rows(QR_), num_columns(QR_));
+
         detail::qr_decomposition_impl<
                 ::boost::is_complex<value_type>::value
-            >::template decompose(QR_, tau_, column_major_tag());
+            >::template decompose(QR_, tau_, ws_.work(), column_major_tag());
     }
 
 
@@ -934,6 +1141,8 @@ class qr_decomposition
     //       changes the QR matrix (and restores it before returning).
     private: mutable QR_matrix_type QR_;
     private: tau_vector_type tau_;
+    /// The workspace reused by subsequent decompositions.
+    private: qr_workspace<value_type> ws_;
 };
 
 
@@ -958,6 +1167,35 @@ void qr_decompose(matrix_expression<MatrixExprT> const& A, OutMatrix1T& Q, OutMa
 }
 
 
+/**
+ * \brief Free function performing the QR decomposition of the given matrix
+ *  expression \a A by means of the given workspace.
+ *
+ * No memory is allocated when the workspace and the outputs are already sized
+ * for a matrix with the same size of \a A.
+ *
+ * \sa qr_workspace
+ */
+template<typename MatrixExprT, typename OutMatrix1T, typename OutMatrix2T>
+BOOST_UBLAS_INLINE
+void qr_decompose(matrix_expression<MatrixExprT> const& A, OutMatrix1T& Q, OutMatrix2T& R, bool full, qr_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws)
+{
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category1;
+    typedef typename matrix_traits<OutMatrix1T>::orientation_category orientation_category2;
+    typedef typename matrix_traits<OutMatrix2T>::orientation_category orientation_category3;
+
+    // precondition: same orientation category
+    BOOST_MPL_ASSERT(
+        (::boost::mpl::and_<
+            ::boost::is_same<orientation_category1,orientation_category2>,
+            ::boost::is_same<orientation_category1,orientation_category3>
+        >)
+    );
+
+    detail::qr_decompose_impl(A, Q, R, full, ws, orientation_category1());
+}
+
+
 /// Free function performing the QR decomposition of the given matrix expression \a A.
 template<typename MatrixExprT>
 BOOST_UBLAS_INLINE
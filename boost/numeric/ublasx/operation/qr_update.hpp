@@ -0,0 +1,675 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/qr_update.hpp
+ *
+ * \brief Update of the QR matrix decomposition.
+ *
+ * Given the QR decomposition \f$A=QR\f$ of an m-by-n matrix \f$A\f$, the
+ * operations in this file compute the QR decomposition of:
+ * - the rank-1 modification \f$A+uv^H\f$ (\c qr_update),
+ * - the matrix obtained by inserting a row in, or deleting a row from,
+ *   \f$A\f$ (\c qr_insert_row and \c qr_delete_row),
+ * - the matrix obtained by inserting a column in, or deleting a column from,
+ *   \f$A\f$ (\c qr_insert_column and \c qr_delete_column),
+ * by sweeps of Givens rotations applied to the explicit factors \f$Q\f$ and
+ * \f$R\f$.
+ * Each update costs \f$O(m^2+n^2)\f$ operations with the full factors and
+ * \f$O(mn)\f$ operations with the economy ones (see below), instead of the
+ * \f$O(mn^2)\f$ operations of a new decomposition.
+ *
+ * The factors can be either full (\f$Q\f$ is m-by-m and \f$R\f$ is m-by-n) or
+ * economy-size (\f$Q\f$ is m-by-k and \f$R\f$ is k-by-n, with
+ * \f$k=\min(m,n)\f$), like the ones returned by \c qr_decompose (or by the
+ * \c Q and \c R methods of \c qr_decomposition) when \c full is \c true or
+ * \c false, respectively.
+ * The kind of factors is preserved by the update.
+ * With the economy factors, the component of the new data that is orthogonal
+ * to the range of \f$Q\f$ is computed by the classical Gram-Schmidt process
+ * with reorthogonalization and, if it does not vanish, is appended to \f$Q\f$.
+ *
+ * The typical use is the sliding-window (or recursive) least squares problem,
+ * where each new observation appends a row and the oldest one is dropped.
+ *
+ * References:
+ * -# G.H. Golub and C.F. Van Loan,
+ *    "Matrix Computations," 3rd ed., Sec. 12.5,
+ *    The Johns Hopkins University Press, 1996.
+ * -# J.W. Daniel, W.B. Gragg, L. Kaufman and G.W. Stewart,
+ *    "Reorthogonalization and Stable Algorithms for Updating the Gram-Schmidt
+ *    QR Factorization,"
+ *    Mathematics of Computation 30(136):772-795, 1976.
+ * .
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_QR_UPDATE_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_QR_UPDATE_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/exception.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+namespace detail {
+
+/**
+ * \brief Compute the Givens rotation zeroing the second component of
+ *  \f$(f,g)^T\f$.
+ *
+ * The rotation is:
+ * \f[
+ *  G=\begin{pmatrix}
+ *     c & s \\
+ *     -\bar{s} & c
+ *    \end{pmatrix}
+ * \f]
+ * with a real \f$c\f$, and is such that \f$G(f,g)^T=(r,0)^T\f$ (like LAPACK
+ * \c lartg).
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+void qr_givens(ValueT const& f, ValueT const& g, typename type_traits<ValueT>::real_type& c, ValueT& s, ValueT& r)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    const real_type af = ::std::abs(f);
+    const real_type ag = ::std::abs(g);
+
+    if (ag == real_type(0))
+    {
+        c = real_type(1);
+        s = ValueT(0);
+        r = f;
+    }
+    else if (af == real_type(0))
+    {
+        c = real_type(0);
+        s = type_traits<ValueT>::conj(g)/ag;
+        r = ag;
+    }
+    else
+    {
+        // Scale to avoid overflow and underflow in the sum of squares
+        const real_type scale = ::std::max(af, ag);
+        const real_type nrm = scale*::std::sqrt((af/scale)*(af/scale)+(ag/scale)*(ag/scale));
+        const ValueT phase = f/af;
+
+        c = af/nrm;
+        s = phase*type_traits<ValueT>::conj(g)/nrm;
+        r = phase*nrm;
+    }
+}
+
+
+/// Apply the Givens rotation \f$G\f$ to the rows \a i and \a i+1 of \a R,
+/// from the column \a j on.
+template <typename MatrixT>
+void qr_rotate_rows(MatrixT& R, ::std::size_t i, ::std::size_t j, typename type_traits<typename matrix_traits<MatrixT>::value_type>::real_type c, typename matrix_traits<MatrixT>::value_type const& s)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const ::std::size_t n = num_columns(R);
+    const value_type cs = type_traits<value_type>::conj(s);
+
+    for (; j < n; ++j)
+    {
+        const value_type x = R(i,j);
+        const value_type y = R(i+1,j);
+
+        R(i,j) = c*x + s*y;
+        R(i+1,j) = c*y - cs*x;
+    }
+}
+
+
+/// Apply the Givens rotation \f$G^H\f$ from the right to the columns \a j and
+/// \a j+1 of \a Q, so that the product \f$QR\f$ is left unchanged by the
+/// rotation of the rows of \f$R\f$.
+template <typename MatrixT>
+void qr_rotate_columns(MatrixT& Q, ::std::size_t j, typename type_traits<typename matrix_traits<MatrixT>::value_type>::real_type c, typename matrix_traits<MatrixT>::value_type const& s)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+    const ::std::size_t m = num_rows(Q);
+    const value_type cs = type_traits<value_type>::conj(s);
+
+    for (::std::size_t i = 0; i < m; ++i)
+    {
+        const value_type x = Q(i,j);
+        const value_type y = Q(i,j+1);
+
+        Q(i,j) = c*x + cs*y;
+        Q(i,j+1) = c*y - s*x;
+    }
+}
+
+
+/**
+ * \brief Split \a x into its projection onto the range of \a Q and the
+ *  orthogonal residual.
+ *
+ * On return, \f$x=Qw+r\f$ with \f$Q^Hr=0\f$; the norm of \f$r\f$ is
+ * returned.
+ * The classical Gram-Schmidt step is repeated once, which is enough to get
+ * orthogonality to the working precision (Daniel et al., 1976).
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename XVectorT, typename WVectorT, typename RVectorT>
+typename type_traits<typename matrix_traits<QMatrixT>::value_type>::real_type qr_orthogonalize(QMatrixT const& Q, XVectorT const& x, WVectorT& w, RVectorT& r)
+{
+    typedef typename matrix_traits<QMatrixT>::value_type value_type;
+
+    w = prod(herm(Q), x);
+    r = x - prod(Q, w);
+
+    vector<value_type> dw(prod(herm(Q), r));
+    r.minus_assign(prod(Q, dw));
+    w += dw;
+
+    return norm_2(r);
+}
+
+
+/// Tell if the residual norm \a rho of a vector of norm \a xnorm is negligible
+/// with respect to the rounding errors of the orthogonalization against \a k
+/// vectors.
+template <typename RealT>
+bool qr_is_negligible(RealT rho, RealT xnorm, ::std::size_t k)
+{
+    return rho <= RealT(k+1)*::std::numeric_limits<RealT>::epsilon()*xnorm;
+}
+
+
+/// Append the unit vector \a q to the columns of \a Q and a zero row to \a R.
+template <typename QMatrixT, typename RMatrixT, typename VectorT>
+void qr_augment(QMatrixT& Q, RMatrixT& R, VectorT const& q)
+{
+    typedef typename matrix_traits<RMatrixT>::value_type value_type;
+
+    const ::std::size_t m = num_rows(Q);
+    const ::std::size_t k = num_columns(Q);
+    const ::std::size_t n = num_columns(R);
+
+    Q.resize(m, k+1, true);
+    column(Q, k) = q;
+    R.resize(k+1, n, true);
+    row(R, k) = zero_vector<value_type>(n);
+}
+
+
+/// Drop the trailing columns of \a Q and rows of \a R after the first \a p
+/// ones.
+template <typename QMatrixT, typename RMatrixT>
+void qr_trim(QMatrixT& Q, RMatrixT& R, ::std::size_t p)
+{
+    if (num_columns(Q) > p)
+    {
+        Q.resize(num_rows(Q), p, true);
+        R.resize(p, num_columns(R), true);
+    }
+}
+
+
+/// Restore the triangular form of the upper Hessenberg matrix \a R by
+/// rotating the rows \a first, ..., \f$\min(p,n)\f$.
+template <typename QMatrixT, typename RMatrixT>
+void qr_hessenberg_to_triangular(QMatrixT& Q, RMatrixT& R, ::std::size_t first)
+{
+    typedef typename matrix_traits<RMatrixT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+
+    const ::std::size_t p = num_rows(R);
+    const ::std::size_t n = num_columns(R);
+    const ::std::size_t nr = (p > 0) ? ::std::min(p-1, n) : 0;
+
+    for (::std::size_t i = first; i < nr; ++i)
+    {
+        real_type c;
+        value_type s;
+        value_type r;
+
+        qr_givens(R(i,i), R(i+1,i), c, s, r);
+        R(i,i) = r;
+        R(i+1,i) = value_type(0);
+        qr_rotate_rows(R, i, i+1, c, s);
+        qr_rotate_columns(Q, i, c, s);
+    }
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Update the QR decomposition of \f$A\f$ to the one of the rank-1
+ *  modification \f$A+uv^H\f$.
+ *
+ * \tparam QMatrixT The type of the \f$Q\f$ factor.
+ * \tparam RMatrixT The type of the \f$R\f$ factor.
+ * \tparam UVectorExprT The type of the vector expression \a u.
+ * \tparam VVectorExprT The type of the vector expression \a v.
+ * \param Q On input, the (full or economy) \f$Q\f$ factor of \f$A\f$; on
+ *  output, the one of \f$A+uv^H\f$.
+ * \param R On input, the (full or economy) \f$R\f$ factor of \f$A\f$; on
+ *  output, the one of \f$A+uv^H\f$.
+ * \param u The m-dimensional vector of the update.
+ * \param v The n-dimensional vector of the update.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename RMatrixT, typename UVectorExprT, typename VVectorExprT>
+void qr_update(matrix_container<QMatrixT>& Q, matrix_container<RMatrixT>& R, vector_expression<UVectorExprT> const& u, vector_expression<VVectorExprT> const& v)
+{
+    typedef typename matrix_traits<QMatrixT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef ::std::size_t size_type;
+
+    const size_type m = num_rows(Q);
+    const size_type k = num_columns(Q);
+    const size_type n = num_columns(R);
+
+    // precondition: Q and R are conformant
+    BOOST_UBLAS_CHECK( num_rows(R) == k, bad_size() );
+    // precondition: size(u) == m
+    BOOST_UBLAS_CHECK( size(u) == m, bad_size() );
+    // precondition: size(v) == n
+    BOOST_UBLAS_CHECK( size(v) == n, bad_size() );
+
+    // w = Q^H u
+    vector<value_type> w;
+    if (k < m)
+    {
+        vector<value_type> r;
+        const real_type rho = detail::qr_orthogonalize(Q(), u(), w, r);
+
+        if (!detail::qr_is_negligible(rho, real_type(norm_2(u)), k))
+        {
+            detail::qr_augment(Q(), R(), r/rho);
+            w.resize(k+1, true);
+            w(k) = rho;
+        }
+    }
+    else
+    {
+        w = prod(herm(Q()), u);
+    }
+
+    const size_type p = size(w);
+
+    if (p == 0)
+    {
+        return;
+    }
+
+    // Reduce w to a multiple of e_1, turning R into an upper Hessenberg matrix
+    for (size_type i = p-1; i > 0; --i)
+    {
+        real_type c;
+        value_type s;
+        value_type r;
+
+        detail::qr_givens(w(i-1), w(i), c, s, r);
+        w(i-1) = r;
+        w(i) = value_type(0);
+        detail::qr_rotate_rows(R(), i-1, i-1, c, s);
+        detail::qr_rotate_columns(Q(), i-1, c, s);
+    }
+
+    // The update now only touches the first row of R
+    row(R(), 0) += w(0)*conj(v());
+
+    detail::qr_hessenberg_to_triangular(Q(), R(), 0);
+
+    if (k < m)
+    {
+        detail::qr_trim(Q(), R(), ::std::min(m, n));
+    }
+}
+
+
+/**
+ * \brief Update the QR decomposition of \f$A\f$ to the one of the matrix
+ *  obtained by inserting the row \a x before the \a i-th row of \f$A\f$.
+ *
+ * \tparam QMatrixT The type of the \f$Q\f$ factor.
+ * \tparam RMatrixT The type of the \f$R\f$ factor.
+ * \tparam VectorExprT The type of the vector expression \a x.
+ * \param Q On input, the (full or economy) \f$Q\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param R On input, the (full or economy) \f$R\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param i The position of the new row, from 0 to the number of rows of
+ *  \f$A\f$ (to append it).
+ * \param x The n-dimensional new row.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename RMatrixT, typename VectorExprT>
+void qr_insert_row(matrix_container<QMatrixT>& Q, matrix_container<RMatrixT>& R, ::std::size_t i, vector_expression<VectorExprT> const& x)
+{
+    typedef typename matrix_traits<QMatrixT>::value_type value_type;
+    typedef ::std::size_t size_type;
+
+    const size_type m = num_rows(Q);
+    const size_type k = num_columns(Q);
+    const size_type n = num_columns(R);
+
+    // precondition: Q and R are conformant
+    BOOST_UBLAS_CHECK( num_rows(R) == k, bad_size() );
+    // precondition: i <= m
+    BOOST_UBLAS_CHECK( i <= m, bad_index() );
+    // precondition: size(x) == n
+    BOOST_UBLAS_CHECK( size(x) == n, bad_size() );
+
+    // The updated matrix is
+    //   [   A1   ]   [ 0  Q1 ] [ x^T ]
+    //   [  x^T   ] = [ 1  0  ] [  R  ]
+    //   [   A2   ]   [ 0  Q2 ]
+    // where the right factor is upper Hessenberg
+
+    QMatrixT QQ(m+1, k+1);
+    QQ = zero_matrix<value_type>(m+1, k+1);
+    QQ(i,0) = value_type(1);
+    if (k > 0)
+    {
+        if (i > 0)
+        {
+            subrange(QQ, 0, i, 1, k+1) = subrange(Q(), 0, i, 0, k);
+        }
+        if (i < m)
+        {
+            subrange(QQ, i+1, m+1, 1, k+1) = subrange(Q(), i, m, 0, k);
+        }
+    }
+
+    RMatrixT RR(k+1, n);
+    row(RR, 0) = x;
+    if (k > 0)
+    {
+        subrange(RR, 1, k+1, 0, n) = R();
+    }
+
+    detail::qr_hessenberg_to_triangular(QQ, RR, 0);
+
+    Q().assign_temporary(QQ);
+    R().assign_temporary(RR);
+
+    if (k < m)
+    {
+        detail::qr_trim(Q(), R(), ::std::min(m+1, n));
+    }
+}
+
+
+/**
+ * \brief Update the QR decomposition of \f$A\f$ to the one of the matrix
+ *  obtained by deleting the \a i-th row of \f$A\f$.
+ *
+ * \tparam QMatrixT The type of the \f$Q\f$ factor.
+ * \tparam RMatrixT The type of the \f$R\f$ factor.
+ * \param Q On input, the (full or economy) \f$Q\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param R On input, the (full or economy) \f$R\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param i The index of the row to delete.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename RMatrixT>
+void qr_delete_row(matrix_container<QMatrixT>& Q, matrix_container<RMatrixT>& R, ::std::size_t i)
+{
+    typedef typename matrix_traits<QMatrixT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef ::std::size_t size_type;
+
+    const size_type m = num_rows(Q);
+    const size_type k = num_columns(Q);
+    const size_type n = num_columns(R);
+
+    // precondition: Q and R are conformant
+    BOOST_UBLAS_CHECK( num_rows(R) == k, bad_size() );
+    // precondition: i < m
+    BOOST_UBLAS_CHECK( i < m, bad_index() );
+
+    if (k < m)
+    {
+        // Complete the i-th row of Q to a unit vector with the component of
+        // e_i that is orthogonal to the range of Q
+        unit_vector<value_type> e(m, i);
+        vector<value_type> w;
+        vector<value_type> r;
+        const real_type rho = detail::qr_orthogonalize(Q(), e, w, r);
+
+        if (!detail::qr_is_negligible(rho, real_type(1), k))
+        {
+            detail::qr_augment(Q(), R(), r/rho);
+        }
+    }
+
+    const size_type p = num_columns(Q);
+
+    if (p == 0)
+    {
+        // A has no columns
+        Q().resize(m-1, 0, false);
+        return;
+    }
+
+    // Reduce the i-th row of Q to a multiple of e_1^T, turning R into an upper
+    // Hessenberg matrix
+    vector<value_type> q(conj(row(Q(), i)));
+    for (size_type j = p-1; j > 0; --j)
+    {
+        real_type c;
+        value_type s;
+        value_type r;
+
+        detail::qr_givens(q(j-1), q(j), c, s, r);
+        q(j-1) = r;
+        q(j) = value_type(0);
+        detail::qr_rotate_rows(R(), j-1, j-1, c, s);
+        detail::qr_rotate_columns(Q(), j-1, c, s);
+    }
+
+    // Now the first column of Q is a multiple of e_i, so that dropping it
+    // together with the i-th row of Q and the first row of R leaves the
+    // factors of the updated matrix
+    QMatrixT QQ(m-1, p-1);
+    if (p > 1)
+    {
+        if (i > 0)
+        {
+            subrange(QQ, 0, i, 0, p-1) = subrange(Q(), 0, i, 1, p);
+        }
+        if (i+1 < m)
+        {
+            subrange(QQ, i, m-1, 0, p-1) = subrange(Q(), i+1, m, 1, p);
+        }
+    }
+
+    RMatrixT RR(p-1, n);
+    if (p > 1)
+    {
+        RR = subrange(R(), 1, p, 0, n);
+    }
+
+    Q().assign_temporary(QQ);
+    R().assign_temporary(RR);
+
+    if (k < m)
+    {
+        detail::qr_trim(Q(), R(), ::std::min(m-1, n));
+    }
+}
+
+
+/**
+ * \brief Update the QR decomposition of \f$A\f$ to the one of the matrix
+ *  obtained by inserting the column \a x before the \a j-th column of
+ *  \f$A\f$.
+ *
+ * \tparam QMatrixT The type of the \f$Q\f$ factor.
+ * \tparam RMatrixT The type of the \f$R\f$ factor.
+ * \tparam VectorExprT The type of the vector expression \a x.
+ * \param Q On input, the (full or economy) \f$Q\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param R On input, the (full or economy) \f$R\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param j The position of the new column, from 0 to the number of columns of
+ *  \f$A\f$ (to append it).
+ * \param x The m-dimensional new column.
+ *
+ * If the economy factors are given and \a x lies in the range of \f$Q\f$ (so
+ * that the updated matrix is rank deficient), \f$Q\f$ is left with
+ * \f$\min(m,n)\f$ columns and \f$R\f$ becomes upper trapezoidal.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename RMatrixT, typename VectorExprT>
+void qr_insert_column(matrix_container<QMatrixT>& Q, matrix_container<RMatrixT>& R, ::std::size_t j, vector_expression<VectorExprT> const& x)
+{
+    typedef typename matrix_traits<QMatrixT>::value_type value_type;
+    typedef typename type_traits<value_type>::real_type real_type;
+    typedef ::std::size_t size_type;
+
+    const size_type m = num_rows(Q);
+    const size_type k = num_columns(Q);
+    const size_type n = num_columns(R);
+
+    // precondition: Q and R are conformant
+    BOOST_UBLAS_CHECK( num_rows(R) == k, bad_size() );
+    // precondition: j <= n
+    BOOST_UBLAS_CHECK( j <= n, bad_index() );
+    // precondition: size(x) == m
+    BOOST_UBLAS_CHECK( size(x) == m, bad_size() );
+
+    // w = Q^H x
+    vector<value_type> w;
+    if (k < m)
+    {
+        vector<value_type> r;
+        const real_type rho = detail::qr_orthogonalize(Q(), x(), w, r);
+
+        if (!detail::qr_is_negligible(rho, real_type(norm_2(x)), k))
+        {
+            detail::qr_augment(Q(), R(), r/rho);
+            w.resize(k+1, true);
+            w(k) = rho;
+        }
+    }
+    else
+    {
+        w = prod(herm(Q()), x);
+    }
+
+    const size_type p = size(w);
+
+    RMatrixT RR(p, n+1);
+    if (j > 0)
+    {
+        subrange(RR, 0, p, 0, j) = subrange(R(), 0, p, 0, j);
+    }
+    column(RR, j) = w;
+    if (j < n)
+    {
+        subrange(RR, 0, p, j+1, n+1) = subrange(R(), 0, p, j, n);
+    }
+
+    // Zero the new column below the diagonal from the bottom up; the columns
+    // on its right only get fill on their diagonal
+    for (size_type i = p-1; i > j && i < p; --i)
+    {
+        real_type c;
+        value_type s;
+        value_type r;
+
+        detail::qr_givens(RR(i-1,j), RR(i,j), c, s, r);
+        RR(i-1,j) = r;
+        RR(i,j) = value_type(0);
+        detail::qr_rotate_rows(RR, i-1, j+1, c, s);
+        detail::qr_rotate_columns(Q(), i-1, c, s);
+    }
+
+    R().assign_temporary(RR);
+}
+
+
+/**
+ * \brief Update the QR decomposition of \f$A\f$ to the one of the matrix
+ *  obtained by deleting the \a j-th column of \f$A\f$.
+ *
+ * \tparam QMatrixT The type of the \f$Q\f$ factor.
+ * \tparam RMatrixT The type of the \f$R\f$ factor.
+ * \param Q On input, the (full or economy) \f$Q\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param R On input, the (full or economy) \f$R\f$ factor of \f$A\f$; on
+ *  output, the one of the updated matrix.
+ * \param j The index of the column to delete.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename QMatrixT, typename RMatrixT>
+void qr_delete_column(matrix_container<QMatrixT>& Q, matrix_container<RMatrixT>& R, ::std::size_t j)
+{
+    typedef ::std::size_t size_type;
+
+    const size_type m = num_rows(Q);
+    const size_type k = num_columns(Q);
+    const size_type n = num_columns(R);
+
+    // precondition: Q and R are conformant
+    BOOST_UBLAS_CHECK( num_rows(R) == k, bad_size() );
+    // precondition: j < n
+    BOOST_UBLAS_CHECK( j < n, bad_index() );
+
+    // Shift the columns on the right of the j-th one, leaving an upper
+    // Hessenberg matrix from the j-th column on
+    if (j+1 < n)
+    {
+        RMatrixT tmp(subrange(R(), 0, k, j+1, n));
+        subrange(R(), 0, k, j, n-1) = tmp;
+    }
+    R().resize(k, n-1, true);
+
+    detail::qr_hessenberg_to_triangular(Q(), R(), j);
+
+    if (k < m)
+    {
+        detail::qr_trim(Q(), R(), ::std::min(m, n-1));
+    }
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_QR_UPDATE_HPP
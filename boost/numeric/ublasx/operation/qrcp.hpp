@@ -0,0 +1,289 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/qrcp.hpp
+ *
+ * \brief The QR matrix decomposition with column pivoting.
+ *
+ * Given an \f$m\f$-by-\f$n\f$ matrix \f$A\f$, its QR-decomposition with
+ * column pivoting is a matrix decomposition of the form:
+ * \f[
+ *   AP=QR
+ * \f]
+ * where \f$P\f$ is an n-by-n permutation matrix, \f$Q\f$ is an m-by-m
+ * orthogonal (or unitary) matrix and \f$R\f$ is an m-by-n upper trapezoidal
+ * matrix whose diagonal elements are non-increasing in magnitude.
+ * At each step, the column with the largest remaining norm is moved to the
+ * front, so that if \f$A\f$ has (numerical) rank \f$r\f$ then:
+ * \f[
+ *  R=\begin{pmatrix}
+ *     R_{11} & R_{12} \\
+ *     0 & R_{22}
+ *    \end{pmatrix}
+ * \f]
+ * where \f$R_{11}\f$ is an r-by-r well-conditioned upper triangular matrix and
+ * \f$R_{22}\f$ is negligible.
+ * Thus, the decomposition reveals the rank of \f$A\f$, the first \f$r\f$
+ * columns of \f$Q\f$ are an orthonormal basis for the range of \f$A\f$ and
+ * the remaining ones are an orthonormal basis for the null space of
+ * \f$A^H\f$.
+ *
+ * The decomposition is computed by LAPACK \c geqp3, which costs about as much
+ * as the plain QR decomposition and several times less than the singular value
+ * decomposition of the same matrix.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_QRCP_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_QRCP_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/bindings/lapack/computational/geqp3.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
+#include <boost/numeric/bindings/ublas.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/eps.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qr.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <cmath>
+#include <cstddef>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/**
+ * \brief QR decomposition with column pivoting.
+ *
+ * \tparam ValueT The type of the elements of the matrix to decompose.
+ *
+ * The factored matrix is stored in the LAPACK format (the elementary
+ * reflectors below the diagonal and \f$R\f$ on and above it), so that
+ * \f$Q\f$ and \f$R\f$ are only built on request; the storage is reused by
+ * subsequent decompositions of same-sized matrices.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+class qrcp_decomposition
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef work_matrix_type QR_matrix_type;
+    public: typedef work_matrix_type Q_matrix_type;
+    public: typedef work_matrix_type R_matrix_type;
+    public: typedef vector<size_type> permutation_vector_type;
+    private: typedef vector<value_type> tau_vector_type;
+    private: typedef vector< ::fortran_int_t > pivots_vector_type;
+
+
+    public: qrcp_decomposition()
+    {
+        // empty
+    }
+
+
+    public: template <typename MatrixExprT>
+        qrcp_decomposition(matrix_expression<MatrixExprT> const& A)
+        : QR_(A)
+    {
+        decompose();
+    }
+
+
+    public: template <typename MatrixExprT>
+        void decompose(matrix_expression<MatrixExprT> const& A)
+    {
+        if (num_rows(QR_) != num_rows(A) || num_columns(QR_) != num_columns(A))
+        {
+            QR_.resize(num_rows(A), num_columns(A), false);
+        }
+        noalias(QR_) = A;
+
+        decompose();
+    }
+
+
+    /// Return the factored matrix in the LAPACK format.
+    public: QR_matrix_type const& QR() const
+    {
+        return QR_;
+    }
+
+
+    /// Return the Q matrix (the first min(m,n) columns if \a full is
+    /// \c false).
+    public: Q_matrix_type Q(bool full = true) const
+    {
+        Q_matrix_type tmp_Q;
+
+        detail::qr_decomposition_impl<
+                ::boost::is_complex<value_type>::value
+            >::template extract_Q(QR_, tau_, tmp_Q, full, column_major_tag());
+
+        return tmp_Q;
+    }
+
+
+    /// Return the R matrix (the first min(m,n) rows if \a full is \c false).
+    public: R_matrix_type R(bool full = true) const
+    {
+        R_matrix_type tmp_R;
+
+        detail::qr_decomposition_impl<
+                ::boost::is_complex<value_type>::value
+            >::template extract_R(QR_, tmp_R, full, column_major_tag());
+
+        return tmp_R;
+    }
+
+
+    /**
+     * \brief Return the column permutation as a vector of indices.
+     *
+     * The j-th column of \f$AP\f$ is the \c P()(j)-th column of \f$A\f$.
+     */
+    public: permutation_vector_type const& P() const
+    {
+        return P_;
+    }
+
+
+    /**
+     * \brief Return the default rank tolerance.
+     *
+     * The default tolerance is
+     * \f[
+     *   \max(m,n) {\epsilon}(|R_{11}|)
+     * \f]
+     * where \f$|R_{11}|\f$ (the largest diagonal element of \f$R\f$ in
+     * magnitude) estimates \f$\|A\|_2\f$ within a factor of \f$\sqrt{n}\f$,
+     * like the tolerance used with the singular values.
+     */
+    public: real_type tolerance() const
+    {
+        if (size(tau_) == 0)
+        {
+            return real_type(0);
+        }
+
+        return ::std::max(num_rows(QR_), num_columns(QR_))*eps(::std::abs(QR_(0,0)));
+    }
+
+
+    /// Return the number of diagonal elements of \f$R\f$ that are greater than
+    /// \a tol in magnitude.
+    public: size_type rank(real_type tol) const
+    {
+        const size_type k = size(tau_);
+
+        // The diagonal of R is non-increasing in magnitude
+        size_type r = 0;
+        while (r < k && ::std::abs(QR_(r,r)) > tol)
+        {
+            ++r;
+        }
+
+        return r;
+    }
+
+
+    /// Return the number of diagonal elements of \f$R\f$ that are greater than
+    /// the default tolerance in magnitude.
+    public: size_type rank() const
+    {
+        return rank(tolerance());
+    }
+
+
+    private: void decompose()
+    {
+        const size_type m = num_rows(QR_);
+        const size_type n = num_columns(QR_);
+        const size_type k = ::std::min(m, n);
+
+        if (size(tau_) != k)
+        {
+            tau_.resize(k, false);
+        }
+        if (size(jpvt_) != n)
+        {
+            jpvt_.resize(n, false);
+            P_.resize(n, false);
+        }
+
+        // All the columns are free to be moved
+        ::std::fill(jpvt_.begin(), jpvt_.end(), ::fortran_int_t(0));
+
+        if (m > 0 && n > 0)
+        {
+            ::boost::numeric::bindings::lapack::geqp3(
+                QR_,
+                jpvt_,
+                tau_,
+                ::boost::numeric::bindings::lapack::optimal_workspace()
+            );
+        }
+        else
+        {
+            for (size_type j = 0; j < n; ++j)
+            {
+                jpvt_(j) = static_cast< ::fortran_int_t >(j+1);
+            }
+        }
+
+        // LAPACK pivots are 1-based
+        for (size_type j = 0; j < n; ++j)
+        {
+            P_(j) = static_cast<size_type>(jpvt_(j)-1);
+        }
+    }
+
+
+    /// The factored matrix in the LAPACK format.
+    private: QR_matrix_type QR_;
+    /// The scalar factors of the elementary reflectors.
+    private: tau_vector_type tau_;
+    /// The LAPACK (1-based) column pivots.
+    private: pivots_vector_type jpvt_;
+    /// The (0-based) column permutation.
+    private: permutation_vector_type P_;
+};
+
+
+/// Free function performing the QR decomposition with column pivoting of the
+/// given matrix expression \a A.
+template<typename MatrixExprT>
+BOOST_UBLAS_INLINE
+qrcp_decomposition<typename matrix_traits<MatrixExprT>::value_type> qrcp_decompose(matrix_expression<MatrixExprT> const& A)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return qrcp_decomposition<value_type>(A);
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_QRCP_HPP
@@ -103,6 +103,7 @@
 #include <boost/numeric/bindings/lapack/computational/tgsen.hpp>
 #include <boost/numeric/bindings/lapack/computational/tgevc.hpp>
 #include <boost/numeric/bindings/lapack/driver/gges.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
 #include <boost/numeric/bindings/tag.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
 #include <boost/numeric/ublas/exception.hpp>
@@ -114,16 +115,19 @@
 #include <boost/numeric/ublas/vector_expression.hpp>
 #include <boost/numeric/ublasx/detail/compiler.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/detail/lapack.hpp>
 //#include <boost/numeric/ublasx/operation/balance.hpp>
 //#include <boost/numeric/ublasx/operation/eigen.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_complex.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <cmath>
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <limits>
@@ -645,6 +649,245 @@ void extract_eigenvectors(SMatrixT const& S, TMatrixT const& T, qz_eigenvectors_
 }
 
 
+/// Optimal workspace query of LAPACK \c gges for real matrices.
+template <typename ValueT, typename RWorkVectorT>
+void gges_query(char jobvsl, char jobvsr, char sort, ::fortran_int_t n, ValueT* opt_work, RWorkVectorT&, ::boost::false_type)
+{
+    const ::fortran_int_t ld = ::std::max(n, ::fortran_int_t(1));
+    ::fortran_int_t sdim = 0;
+    ::boost::numeric::bindings::lapack::detail::gges(jobvsl, jobvsr, sort, 0, n, 0, ld, 0, ld, sdim, 0, 0, 0, 0, ld, 0, ld, opt_work, -1, 0);
+}
+
+
+/// Optimal workspace query of LAPACK \c gges for complex matrices.
+template <typename ValueT, typename RWorkVectorT>
+void gges_query(char jobvsl, char jobvsr, char sort, ::fortran_int_t n, ValueT* opt_work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    const ::fortran_int_t ld = ::std::max(n, ::fortran_int_t(1));
+    ::fortran_int_t sdim = 0;
+    ::boost::numeric::bindings::lapack::detail::gges(jobvsl, jobvsr, sort, 0, n, 0, ld, 0, ld, sdim, 0, 0, 0, ld, 0, ld, opt_work, -1, &rwork[0], 0);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the generalized Schur (QZ) decomposition.
+ *
+ * Owns the work arrays needed by LAPACK \c gges together with the scratch
+ * matrices and vectors used to hold the column-major copies of row-major
+ * inputs and the generalized eigenvalues.
+ * The optimal size of the work array is queried (\c lwork=-1) only when the
+ * problem size or the LAPACK options change, so that repeated decompositions
+ * of same-sized matrix pairs do not allocate memory.
+ *
+ * \tparam ValueT The type of the elements of the matrices to decompose.
+ */
+template <typename ValueT>
+class qz_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+    public: typedef vector<real_type> real_work_vector_type;
+    public: typedef vector< ::fortran_bool_t > bool_work_vector_type;
+    public: typedef vector< ::std::complex<real_type> > alpha_vector_type;
+    public: typedef vector<value_type> beta_vector_type;
+
+
+    /// Default constructor.
+    public: qz_workspace()
+        : n_(0),
+          jobvsl_('N'),
+          jobvsr_('N'),
+          sort_('N'),
+          queried_(false)
+    {
+    }
+
+
+    /// Create a workspace for the QZ decomposition of \a n by \a n matrix
+    /// pairs, with both Schur vectors and without reordering.
+    public: explicit qz_workspace(size_type n)
+        : n_(0),
+          jobvsl_('N'),
+          jobvsr_('N'),
+          sort_('N'),
+          queried_(false)
+    {
+        resize(n, 'V', 'V', 'N');
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the QZ decomposition of \a n by \a n
+     *  matrix pairs.
+     *
+     * \param n The order of the matrices.
+     * \param jobvsl The LAPACK \c gges option for left Schur vectors ('V' or
+     *  'N').
+     * \param jobvsr The LAPACK \c gges option for right Schur vectors ('V' or
+     *  'N').
+     * \param sort The LAPACK \c gges option for eigenvalues ordering ('S' or
+     *  'N').
+     */
+    public: void resize(size_type n, char jobvsl, char jobvsr, char sort)
+    {
+        if (queried_ && n == n_ && jobvsl == jobvsl_ && jobvsr == jobvsr_ && sort == sort_)
+        {
+            return;
+        }
+
+        bwork_.resize((sort == 'S') ? ::std::max(n, size_type(1)) : size_type(detail::lapack::min_array_size), false);
+        if (::boost::is_complex<value_type>::value)
+        {
+            rwork_.resize(::std::max(8*n, size_type(1)), false);
+        }
+        else
+        {
+            alphar_.resize(n, false);
+            alphai_.resize(n, false);
+        }
+
+        value_type opt_work = 0;
+        detail::gges_query(jobvsl,
+                           jobvsr,
+                           sort,
+                           static_cast< ::fortran_int_t >(n),
+                           &opt_work,
+                           rwork_,
+                           ::boost::is_complex<value_type>());
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        n_ = n;
+        jobvsl_ = jobvsl;
+        jobvsr_ = jobvsr;
+        sort_ = sort;
+        queried_ = true;
+    }
+
+
+    /// Return the scratch matrix for the copy of the first matrix.
+    public: work_matrix_type& A_work_matrix()
+    {
+        return A_;
+    }
+
+
+    /// Return the scratch matrix for the copy of the second matrix.
+    public: work_matrix_type& B_work_matrix()
+    {
+        return B_;
+    }
+
+
+    /// Return the scratch matrix for the left Schur vectors.
+    public: work_matrix_type& Q_work_matrix()
+    {
+        return Q_;
+    }
+
+
+    /// Return the scratch matrix for the right Schur vectors.
+    public: work_matrix_type& Z_work_matrix()
+    {
+        return Z_;
+    }
+
+
+    /// Return the scratch vector for the numerators of the generalized
+    /// eigenvalues.
+    public: alpha_vector_type& alpha()
+    {
+        return alpha_;
+    }
+
+
+    /// Return the scratch vector for the denominators of the generalized
+    /// eigenvalues.
+    public: beta_vector_type& beta()
+    {
+        return beta_;
+    }
+
+
+    /// Return the scratch vector for the real parts of the numerators of the
+    /// generalized eigenvalues (LAPACK \c gges for real matrices).
+    public: real_work_vector_type& real_alpha()
+    {
+        return alphar_;
+    }
+
+
+    /// Return the scratch vector for the imaginary parts of the numerators of
+    /// the generalized eigenvalues (LAPACK \c gges for real matrices).
+    public: real_work_vector_type& imag_alpha()
+    {
+        return alphai_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// Return the real work array (used for complex matrices only).
+    public: real_work_vector_type& rwork()
+    {
+        return rwork_;
+    }
+
+
+    /// Return the logical work array (referenced only when eigenvalues are
+    /// reordered).
+    public: bool_work_vector_type& bwork()
+    {
+        return bwork_;
+    }
+
+
+    /// The order of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// The left Schur vectors option this workspace is prepared for.
+    private: char jobvsl_;
+    /// The right Schur vectors option this workspace is prepared for.
+    private: char jobvsr_;
+    /// The eigenvalues ordering option this workspace is prepared for.
+    private: char sort_;
+    /// Tells if the work array has been sized.
+    private: bool queried_;
+    /// The scratch matrix for the copy of the first matrix.
+    private: work_matrix_type A_;
+    /// The scratch matrix for the copy of the second matrix.
+    private: work_matrix_type B_;
+    /// The scratch matrix for the left Schur vectors.
+    private: work_matrix_type Q_;
+    /// The scratch matrix for the right Schur vectors.
+    private: work_matrix_type Z_;
+    /// The scratch vector for the numerators of the generalized eigenvalues.
+    private: alpha_vector_type alpha_;
+    /// The scratch vector for the denominators of the generalized eigenvalues.
+    private: beta_vector_type beta_;
+    /// The scratch vector for the real parts of the numerators.
+    private: real_work_vector_type alphar_;
+    /// The scratch vector for the imaginary parts of the numerators.
+    private: real_work_vector_type alphai_;
+    /// The work array.
+    private: work_vector_type work_;
+    /// The real work array.
+    private: real_work_vector_type rwork_;
+    /// The logical work array.
+    private: bool_work_vector_type bwork_;
+};
+
+
+namespace detail {
+
 /**
  * \brief Generalized (real/complex) Schur decomposition.
  *
@@ -719,6 +962,29 @@ struct qz_decomposition_impl<false>
      */
     template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
         static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, column_major_tag)
+    {
+        qz_workspace<typename matrix_traits<AMatrixT>::value_type> ws;
+
+        decompose(A, B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, Q, Z, alpha, beta, ws, column_major_tag());
+    }
+
+
+    /**
+     * \brief Compute the generalized Schur (QZ) factorization (column-major
+     *  case).
+     *
+     * Given two square matrices \a A and \a B of order \f$n\f$, computes the
+     * generalized eigenvalues \a alpha\ and \a beta, the generalized real Schur
+     * form (\a S,\a T), and the left and right matrices \a Q and \a Z of Schur
+     * vectors such that the generalized Schur (QZ) factorization holds:
+     * \f[ 
+     *  (A,B) = ( Q S Z^T, Q T Z^T )
+     * \f]
+     *
+     * The work arrays are taken from the given workspace \a ws.
+     */
+    template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
+        static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, qz_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, column_major_tag)
     {
         typedef typename promote_traits<
                     typename matrix_traits<AMatrixT>::value_type,
@@ -728,7 +994,7 @@ struct qz_decomposition_impl<false>
                     typename matrix_traits<AMatrixT>::size_type,
                     typename matrix_traits<BMatrixT>::size_type
                 >::promote_type size_type;
-        typedef vector<value_type> work_vector_type;
+        typedef typename qz_workspace<value_type>::real_work_vector_type real_work_vector_type;
 
         size_type n = num_rows(A);
         char jobvsl;
@@ -770,6 +1036,8 @@ struct qz_decomposition_impl<false>
             sort = 'N';
         }
 
+        ws.resize(n, jobvsl, jobvsr, sort);
+
         if (num_rows(Q) != n)
         {
             Q.resize(n, n, false);
@@ -779,8 +1047,8 @@ struct qz_decomposition_impl<false>
             Z.resize(n, n, false);
         }
 
-        work_vector_type alpha_real(n);
-        work_vector_type alpha_imag(n);
+        real_work_vector_type& alpha_real = ws.real_alpha();
+        real_work_vector_type& alpha_imag = ws.imag_alpha();
         if (size(beta) != n)
         {
             beta.resize(n, false);
@@ -800,7 +1068,8 @@ struct qz_decomposition_impl<false>
             alpha_imag,
             beta,
             Q,
-            Z
+            Z,
+            ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.bwork())
         );
 
         // Create the alpha vector
@@ -886,30 +1155,66 @@ struct qz_decomposition_impl<false>
      */
     template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
         static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, row_major_tag)
+    {
+        qz_workspace<typename matrix_traits<AMatrixT>::value_type> ws;
+
+        decompose(A, B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, Q, Z, alpha, beta, ws, row_major_tag());
+    }
+
+
+    /**
+     * \brief Compute the generalized Schur (QZ) factorization (row-major case).
+     *
+     * Given two square matrices \a A and \a B of order \f$n\f$, computes the
+     * generalized eigenvalues \a alpha\ and \a beta, the generalized real Schur
+     * form (\a S,\a T), and the left and right matrices \a Q and \a Z of Schur
+     * vectors such that the generalized Schur (QZ) factorization holds:
+     * \f[ 
+     *  (A,B) = ( Q S Z^T, Q T Z^T )
+     * \f]
+     *
+     * The work arrays and the scratch matrices are taken from the given
+     * workspace \a ws.
+     */
+    template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
+        static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, qz_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, row_major_tag)
     {
         // LAPACK works with dense column-major matrices
 
-//      matrix<typename matrix_traits<AMatrixT>::value_type, typename layout_type<AMatrixT>::type> tmp_A(A);
-//      matrix<typename matrix_traits<BMatrixT>::value_type, typename layout_type<BMatrixT>::type> tmp_B(B);
-//      matrix<typename matrix_traits<QMatrixT>::value_type, typename layout_type<QMatrixT>::type> tmp_Q(Q);
-//      matrix<typename matrix_traits<ZMatrixT>::value_type, typename layout_type<ZMatrixT>::type> tmp_Z(Z);
-        matrix<typename matrix_traits<AMatrixT>::value_type, column_major> tmp_A(A);
-        matrix<typename matrix_traits<BMatrixT>::value_type, column_major> tmp_B(B);
-        matrix<typename matrix_traits<QMatrixT>::value_type, column_major> tmp_Q(Q);
-        matrix<typename matrix_traits<ZMatrixT>::value_type, column_major> tmp_Z(Z);
+        typedef typename qz_workspace<typename matrix_traits<AMatrixT>::value_type>::work_matrix_type work_matrix_type;
 
-        decompose(tmp_A, tmp_B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, tmp_Q, tmp_Z, alpha, beta, column_major_tag());
+        const ::std::size_t n = num_rows(A);
 
-        A = tmp_A;
-        B = tmp_B;
-        Q = tmp_Q;
-        Z = tmp_Z;
+        work_matrix_type& tmp_A = ws.A_work_matrix();
+        work_matrix_type& tmp_B = ws.B_work_matrix();
+        work_matrix_type& tmp_Q = ws.Q_work_matrix();
+        work_matrix_type& tmp_Z = ws.Z_work_matrix();
 
-        if (!want_eigvals)
+        if (num_rows(tmp_A) != n || num_columns(tmp_A) != n)
         {
-            alpha.resize(0, false);
-            beta.resize(0, false);
+            tmp_A.resize(n, n, false);
+        }
+        noalias(tmp_A) = A;
+        if (num_rows(tmp_B) != n || num_columns(tmp_B) != n)
+        {
+            tmp_B.resize(n, n, false);
         }
+        noalias(tmp_B) = B;
+
+        decompose(tmp_A, tmp_B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, tmp_Q, tmp_Z, alpha, beta, ws, column_major_tag());
+
+        noalias(A) = tmp_A;
+        noalias(B) = tmp_B;
+        if (num_rows(Q) != num_rows(tmp_Q) || num_columns(Q) != num_columns(tmp_Q))
+        {
+            Q.resize(num_rows(tmp_Q), num_columns(tmp_Q), false);
+        }
+        noalias(Q) = tmp_Q;
+        if (num_rows(Z) != num_rows(tmp_Z) || num_columns(Z) != num_columns(tmp_Z))
+        {
+            Z.resize(num_rows(tmp_Z), num_columns(tmp_Z), false);
+        }
+        noalias(Z) = tmp_Z;
     }
 
 
@@ -1112,27 +1417,66 @@ struct qz_decomposition_impl<true>
      */
     template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
         static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, row_major_tag)
+    {
+        qz_workspace<typename matrix_traits<AMatrixT>::value_type> ws;
+
+        decompose(A, B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, Q, Z, alpha, beta, ws, row_major_tag());
+    }
+
+
+    /**
+     * \brief Compute the generalized Schur (QZ) factorization (row-major case).
+     *
+     * Given two square matrices \a A and \a B of order \f$n\f$, computes the
+     * generalized eigenvalues \a alpha\ and \a beta, the generalized real Schur
+     * form (\a S,\a T), and the left and right matrices \a Q and \a Z of Schur
+     * vectors such that the generalized Schur (QZ) factorization holds:
+     * \f[ 
+     *  (A,B) = ( Q S Z^T, Q T Z^T )
+     * \f]
+     *
+     * The work arrays and the scratch matrices are taken from the given
+     * workspace \a ws.
+     */
+    template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
+        static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, qz_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, row_major_tag)
     {
         // LAPACK works with dense column-major matrices
 
-        matrix<typename matrix_traits<AMatrixT>::value_type, column_major> tmp_A(A);
-        matrix<typename matrix_traits<BMatrixT>::value_type, column_major> tmp_B(B);
-        matrix<typename matrix_traits<QMatrixT>::value_type, column_major> tmp_Q(Q);
-        matrix<typename matrix_traits<ZMatrixT>::value_type, column_major> tmp_Z(Z);
+        typedef typename qz_workspace<typename matrix_traits<AMatrixT>::value_type>::work_matrix_type work_matrix_type;
 
-        //decompose(tmp_A, tmp_B, tmp_Q, tmp_Z, alpha, beta, side, order, selctg, column_major_tag());
-        decompose(tmp_A, tmp_B, tmp_Q, tmp_Z, alpha, beta, eigvecs_side, reorder_eigvals, eigvals_selector, column_major_tag());
+        const ::std::size_t n = num_rows(A);
 
-        A = tmp_A;
-        B = tmp_B;
-        Q = tmp_Q;
-        Z = tmp_Z;
+        work_matrix_type& tmp_A = ws.A_work_matrix();
+        work_matrix_type& tmp_B = ws.B_work_matrix();
+        work_matrix_type& tmp_Q = ws.Q_work_matrix();
+        work_matrix_type& tmp_Z = ws.Z_work_matrix();
 
-        if (!want_eigvals)
+        if (num_rows(tmp_A) != n || num_columns(tmp_A) != n)
         {
-            alpha.resize(0, false);
-            beta.resize(0, false);
+            tmp_A.resize(n, n, false);
+        }
+        noalias(tmp_A) = A;
+        if (num_rows(tmp_B) != n || num_columns(tmp_B) != n)
+        {
+            tmp_B.resize(n, n, false);
+        }
+        noalias(tmp_B) = B;
+
+        decompose(tmp_A, tmp_B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, tmp_Q, tmp_Z, alpha, beta, ws, column_major_tag());
+
+        noalias(A) = tmp_A;
+        noalias(B) = tmp_B;
+        if (num_rows(Q) != num_rows(tmp_Q) || num_columns(Q) != num_columns(tmp_Q))
+        {
+            Q.resize(num_rows(tmp_Q), num_columns(tmp_Q), false);
         }
+        noalias(Q) = tmp_Q;
+        if (num_rows(Z) != num_rows(tmp_Z) || num_columns(Z) != num_columns(tmp_Z))
+        {
+            Z.resize(num_rows(tmp_Z), num_columns(tmp_Z), false);
+        }
+        noalias(Z) = tmp_Z;
     }
 
 
@@ -1150,6 +1494,29 @@ struct qz_decomposition_impl<true>
      */
     template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
         static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, column_major_tag)
+    {
+        qz_workspace<typename matrix_traits<AMatrixT>::value_type> ws;
+
+        decompose(A, B, eigvecs_side, want_eigvals, reorder_eigvals, eigvals_selector, Q, Z, alpha, beta, ws, column_major_tag());
+    }
+
+
+    /**
+     * \brief Compute the generalized Schur (QZ) factorization (column-major
+     *  case).
+     *
+     * Given two square matrices \a A and \a B of order \f$n\f$, computes the
+     * generalized eigenvalues \a alpha\ and \a beta, the generalized real Schur
+     * form (\a S,\a T), and the left and right matrices \a Q and \a Z of Schur
+     * vectors such that the generalized Schur (QZ) factorization holds:
+     * \f[ 
+     *  (A,B) = ( Q S Z^T, Q T Z^T )
+     * \f]
+     *
+     * The work arrays are taken from the given workspace \a ws.
+     */
+    template <typename AMatrixT, typename BMatrixT, typename QMatrixT, typename ZMatrixT, typename AlphaVectorT, typename BetaVectorT>
+        static void decompose(AMatrixT& A, BMatrixT& B, qz_schurvectors_side eigvecs_side, bool want_eigvals, bool reorder_eigvals, ::external_fp eigvals_selector, QMatrixT& Q, ZMatrixT& Z, AlphaVectorT& alpha, BetaVectorT& beta, qz_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, column_major_tag)
     {
         BOOST_UBLASX_SUPPRESS_UNUSED_VARIABLE_WARNING(want_eigvals);
 
@@ -1203,6 +1570,8 @@ struct qz_decomposition_impl<true>
             sort = 'N';
         }
 
+        ws.resize(n, jobvsl, jobvsr, sort);
+
         if (num_rows(Q) != n)
         {
             Q.resize(n, n, false);
@@ -1233,7 +1602,8 @@ struct qz_decomposition_impl<true>
             alpha,
             beta,
             Q,
-            Z
+            Z,
+            ::boost::numeric::bindings::lapack::workspace(ws.work(), ws.rwork(), ws.bwork())
         );
 
         if (want_eigvals)
@@ -1469,8 +1839,16 @@ class qz_decomposition
         // precondition: B is square
         BOOST_UBLAS_CHECK( num_rows(B) == num_columns(B), bad_size() );
 
-        S_ = A;
-        T_ = B;
+        if (num_rows(S_) != num_rows(A) || num_columns(S_) != num_columns(A))
+        {
+            S_.resize(num_rows(A), num_columns(A), false);
+        }
+        noalias(S_) = A;
+        if (num_rows(T_) != num_rows(B) || num_columns(T_) != num_columns(B))
+        {
+            T_.resize(num_rows(B), num_columns(B), false);
+        }
+        noalias(T_) = B;
 
         decompose(selection);
     }
@@ -1848,7 +2226,7 @@ class qz_decomposition
 
         detail::qz_decomposition_impl<
                 ::boost::is_complex<value_type>::value
-            >::template decompose(S_, T_, detail::both_qz_schurvectors, true, sort, selctg, Q_, Z_, alpha_, beta_, column_major_tag());
+            >::template decompose(S_, T_, detail::both_qz_schurvectors, true, sort, selctg, Q_, Z_, alpha_, beta_, ws_, column_major_tag());
     }
 
 
@@ -1864,6 +2242,8 @@ class qz_decomposition
     private: alpha_vector_type alpha_; // == diag(S_)
     /// The denominator of the generalized Schur eigenvalues.
     private: beta_vector_type beta_;
+    /// The workspace reused across decompositions.
+    private: qz_workspace<value_type> ws_;
 }; // qz_decomposition
 
 
@@ -1960,6 +2340,74 @@ void qz_decompose_inplace(AMatrixT& A, BMatrixT& B, QMatrixT& Q, ZMatrixT& Z, qz
 }
 
 
+/**
+ * \brief QZ decomposition of a matrix pair \f$(A,B)\f$ by means of a reusable
+ *  workspace.
+ *
+ * \tparam AMatrixT The type of the first input matrix.
+ * \tparam BMatrixT The type of the second input matrix.
+ * \tparam QMatrixT The type of the \a Q matrix.
+ * \tparam ZMatrixT The type of the \a Z matrix.
+ *
+ * \param A On entry, the first input matrix.
+ *  On exit, the generalized Schur form of matrix \a A.
+ * \param B On entry, the second input matrix.
+ *  On exit, the generalized Schur form of matrix \a B.
+ * \param Q An orthogonal (or unitary) matrix such that \f$QAZ=S\f$ and
+ *  \f$QBZ=T\f$.
+ * \param Z An orthogonal (or unitary) matrix such that \f$QAZ=S\f$ and
+ *  \f$QBZ=T\f$.
+ * \param selection The type of eigevalues selection to use for reordering.
+ * \param ws The workspace holding the LAPACK work arrays and the scratch
+ *  matrices; once sized, repeated decompositions of same-sized matrix pairs
+ *  do not allocate memory.
+ *
+ * \sa qz_decompose_inplace(AMatrixT&,BMatrixT&,QMatrixT&,ZMatrixT&,qz_eigenvalues_selection)
+ */
+template <
+    typename AMatrixT,
+    typename BMatrixT,
+    typename QMatrixT,
+    typename ZMatrixT
+>
+BOOST_UBLAS_INLINE
+void qz_decompose_inplace(AMatrixT& A, BMatrixT& B, QMatrixT& Q, ZMatrixT& Z, qz_eigenvalues_selection selection, qz_workspace<typename matrix_traits<AMatrixT>::value_type>& ws)
+{
+    typedef typename matrix_traits<AMatrixT>::value_type value_type;
+    typedef typename matrix_traits<AMatrixT>::orientation_category orientation_category;
+
+    // precondition: check that orientation category is the same for all the matrices
+    BOOST_MPL_ASSERT(
+        (::boost::mpl::and_<
+            ::boost::is_same<
+                orientation_category,
+                typename matrix_traits<BMatrixT>::orientation_category
+            >,
+            ::boost::mpl::and_<
+                ::boost::is_same<
+                    orientation_category,
+                    typename matrix_traits<QMatrixT>::orientation_category
+                >,
+                ::boost::is_same<
+                    orientation_category,
+                    typename matrix_traits<ZMatrixT>::orientation_category
+                >
+            >
+        >)
+    );
+    // precondition: A is square
+    BOOST_UBLAS_CHECK( num_rows(A) == num_columns(A), bad_size() );
+    // precondition: B is square
+    BOOST_UBLAS_CHECK( num_rows(B) == num_columns(B), bad_size() );
+
+    ::external_fp selctg = detail::create_qz_eigvals_selector<value_type>(selection);
+
+    detail::qz_decomposition_impl<
+            ::boost::is_complex<value_type>::value
+        >::template decompose(A, B, detail::both_qz_schurvectors, true, selctg != 0, selctg, Q, Z, ws.alpha(), ws.beta(), ws, orientation_category());
+}
+
+
 /**
  * \brief QZ decomposition of a matrix pair \f$(A,B)\f$.
  *
@@ -2012,6 +2460,56 @@ void qz_decompose(matrix_expression<AMatrixExprT> const& A, matrix_expression<BM
 }
 
 
+/**
+ * \brief QZ decomposition of a matrix pair \f$(A,B)\f$ by means of a reusable
+ *  workspace.
+ *
+ * \tparam AMatrixExprT The type of the first matrix expression.
+ * \tparam BMatrixExprT The type of the second matrix expression.
+ * \tparam SMatrixT The type of the matrix \a S.
+ * \tparam TMatrixT The type of the matrix \a T.
+ * \tparam QMatrixT The type of the matrix \a Q.
+ * \tparam ZMatrixT The type of the matrix \a Z.
+ *
+ * \param A The first matrix expression.
+ * \param B The second matrix expression.
+ * \param S The generalized Schur form of matrix \a A.
+ * \param T The generalized Schur form of matrix \a B.
+ * \param Q An orthogonal (or unitary) matrix such that \f$QAZ=S\f$ and
+ *  \f$QBZ=T\f$.
+ * \param Z An orthogonal (or unitary) matrix such that \f$QAZ=S\f$ and
+ *  \f$QBZ=T\f$.
+ * \param selection The type of eigevalues selection to use for reordering.
+ * \param ws The workspace holding the LAPACK work arrays and the scratch
+ *  matrices; once sized, repeated decompositions of same-sized matrix pairs
+ *  do not allocate memory.
+ */
+template <
+    typename AMatrixExprT,
+    typename BMatrixExprT,
+    typename SMatrixT,
+    typename TMatrixT,
+    typename QMatrixT,
+    typename ZMatrixT
+>
+BOOST_UBLAS_INLINE
+void qz_decompose(matrix_expression<AMatrixExprT> const& A, matrix_expression<BMatrixExprT> const& B, SMatrixT& S, TMatrixT& T, QMatrixT& Q, ZMatrixT& Z, qz_eigenvalues_selection selection, qz_workspace<typename matrix_traits<SMatrixT>::value_type>& ws)
+{
+    if (num_rows(S) != num_rows(A) || num_columns(S) != num_columns(A))
+    {
+        S.resize(num_rows(A), num_columns(A), false);
+    }
+    noalias(S) = A;
+    if (num_rows(T) != num_rows(B) || num_columns(T) != num_columns(B))
+    {
+        T.resize(num_rows(B), num_columns(B), false);
+    }
+    noalias(T) = B;
+
+    qz_decompose_inplace(S, T, Q, Z, selection, ws);
+}
+
+
 /**
  * \brief Reorder the QZ decomposition.
  *
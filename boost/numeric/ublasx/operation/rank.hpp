@@ -10,8 +10,11 @@
  * The \c rank function provides an estimate of the number of linearly
  * independent rows or columns of a matrix.
  * There are a number of ways to compute the rank of a matrix.
- * The currently adopted method is  based on the singular value decomposition
- * (SVD) which is the most time consuming, but also the most reliable.
+ * The default method is based on the singular value decomposition (SVD) which
+ * is the most time consuming, but also the most reliable.
+ * The QR decomposition with column pivoting (see \c qrcp_decomposition) is a
+ * cheaper alternative, which is reliable in practice even if it may fail to
+ * reveal the rank of a few pathological matrices (e.g., the Kahan matrix).
  *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
@@ -35,9 +38,12 @@
 #include <boost/numeric/ublasx/operation/max.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qrcp.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/operation/svd.hpp>
 #include <boost/numeric/ublasx/operation/which.hpp>
+#include <cstddef>
+#include <functional>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -45,6 +51,38 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief The factorization used to compute the rank of a matrix (and the
+ *  bases returned by \c null and \c orth).
+ */
+enum rank_method
+{
+    svd_rank_method, ///< Singular value decomposition (the most reliable).
+    qrcp_rank_method ///< QR decomposition with column pivoting (LAPACK \c geqp3), which is several times cheaper.
+};
+
+
+namespace detail {
+
+/// Count the singular values \a s of an \a m by \a n matrix that are
+/// greater than the default tolerance.
+template <typename VectorT>
+::std::size_t svd_rank(VectorT const& s, ::std::size_t m, ::std::size_t n)
+{
+    typedef typename vector_traits<VectorT>::value_type real_type;
+
+    if (size(s) == 0)
+    {
+        return 0;
+    }
+
+    real_type tol = ::std::max(m, n)*eps(max(s)); // note: max(s) == norm_2(A)
+    return size(which(s, ::std::bind2nd(::std::greater<real_type>(), tol)));
+}
+
+} // Namespace detail
+
+
 /**
  * \brief Estimate the rank as the number of singular values of \a A that are
  *  greater than a given tolerance.
@@ -52,16 +90,17 @@ using namespace ::boost::numeric::ublas;
  * \tparam RealT The floating-point type of the tolerance.
  * \param A The input matrix expression.
  * \param tol The tolerance.
+ * \param alg The LAPACK driver used to compute the singular values of \a A.
  * \return The number of singular values of \a A that are greater than \a tol.
  */
 template <typename MatrixExprT, typename RealT>
 BOOST_UBLAS_INLINE
-typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A, RealT tol)
+typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A, RealT tol, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename type_traits<value_type>::real_type real_type;
 
-    vector<real_type> s = svd_values(A);
+    vector<real_type> s = svd_values(A, alg);
     return size(which(s, ::std::bind2nd(::std::greater<real_type>(), tol)));
 }
 
@@ -71,6 +110,7 @@ typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExpr
  *  greater than the default tolerance.
  * \tparam MatrixExprT The type of the input matrix expression.
  * \param A The input matrix expression.
+ * \param alg The LAPACK driver used to compute the singular values of \a A.
  * \return The number of singular values of \a A that are greater than \a tol.
  *
  * The default tolerance is
@@ -83,14 +123,64 @@ typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExpr
  */
 template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
-typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A)
+typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
     typedef typename type_traits<value_type>::real_type real_type;
 
-    vector<real_type> s = svd_values(A);
-    real_type tol = ::std::max(num_rows(A), num_columns(A))*eps(max(s)); // note: max(s) == norm_2(A)
-    return size(which(s, ::std::bind2nd(::std::greater<real_type>(), tol)));
+    vector<real_type> s = svd_values(A, alg);
+    return detail::svd_rank(s, num_rows(A), num_columns(A));
+}
+
+
+/**
+ * \brief Estimate the rank of \a A as the number of singular values (or of
+ *  diagonal elements of \f$R\f$ of the QR decomposition with column pivoting)
+ *  that are greater than a given tolerance.
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam RealT The floating-point type of the tolerance.
+ * \param A The input matrix expression.
+ * \param tol The tolerance.
+ * \param method The factorization used to reveal the rank.
+ * \return The estimated rank of \a A.
+ */
+template <typename MatrixExprT, typename RealT>
+typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A, RealT tol, rank_method method)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    if (method == qrcp_rank_method)
+    {
+        return qrcp_decomposition<value_type>(A).rank(tol);
+    }
+
+    return rank(A, tol, auto_svd_algorithm);
+}
+
+
+/**
+ * \brief Estimate the rank of \a A by means of the given factorization and of
+ *  the default tolerance.
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \param A The input matrix expression.
+ * \param method The factorization used to reveal the rank.
+ * \return The estimated rank of \a A.
+ *
+ * The default tolerance is \f$\max(n,m) {\epsilon}(\|A\|_2)\f$ where, for the
+ * QR decomposition with column pivoting, \f$\|A\|_2\f$ is estimated by the
+ * largest diagonal element of \f$R\f$ in magnitude.
+ */
+template <typename MatrixExprT>
+typename matrix_traits<MatrixExprT>::size_type rank(matrix_expression<MatrixExprT> const& A, rank_method method)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    if (method == qrcp_rank_method)
+    {
+        return qrcp_decomposition<value_type>(A).rank();
+    }
+
+    return rank(A, auto_svd_algorithm);
 }
 
 }}} // Namespace boost::numeric::ublasx
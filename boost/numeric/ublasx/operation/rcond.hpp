@@ -46,6 +46,7 @@
 #include <boost/numeric/ublas/symmetric.hpp>
 #include <boost/numeric/ublas/triangular.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/qr.hpp>
@@ -739,6 +740,70 @@ typename type_traits<
 }
 
 
+namespace detail {
+
+/**
+ * \brief Reciprocal condition number estimate computed from an existing LU
+ *  decomposition by LAPACK \c gecon.
+ *
+ * \param lu The LU decomposition of a \e square matrix.
+ * \param norm The norm to use: \c 'O' for the 1-norm or \c 'I' for the
+ *  infinity norm.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+typename type_traits<ValueT>::real_type lu_rcond(lu_decomposition<ValueT> const& lu, char norm)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    // pre: A is square
+    BOOST_UBLAS_CHECK( num_rows(lu.LU()) == num_columns(lu.LU()), bad_size() );
+
+    if (lu.singular())
+    {
+        return real_type(0);
+    }
+    if (num_rows(lu.LU()) == 0)
+    {
+        return real_type(1);
+    }
+
+    real_type res(0);
+
+    ::boost::numeric::bindings::lapack::gecon(
+        norm,
+        lu.LU(),
+        (norm == 'I') ? lu.norm_inf() : lu.norm_1(),
+        res
+    );
+
+    return res;
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Matrix reciprocal condition number estimate based on 1-norm, computed
+ *  from an existing LU decomposition.
+ *
+ * \tparam ValueT The type of the elements of the decomposed matrix.
+ *
+ * \param lu The LU decomposition of a \e square matrix.
+ * \return The estimate of the reciprocal condition number of the decomposed
+ *  matrix.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ValueT>
+BOOST_UBLAS_INLINE
+typename type_traits<ValueT>::real_type rcond(lu_decomposition<ValueT> const& lu)
+{
+    return detail::lu_rcond(lu, 'O');
+}
+
+
 //FIXME: Does we also need this?
 ///**
 // * \brief Matrix reciprocal condition number estimate based on the matrix norm
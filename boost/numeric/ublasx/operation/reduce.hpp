@@ -0,0 +1,764 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/reduce.hpp
+ *
+ * \brief The \c reduce operation, which computes several statistics of a
+ *  vector or matrix expression in a single pass.
+ *
+ * The statistics to compute are selected by OR-ing together the values of the
+ * \c reduction::statistic enumeration (e.g.,
+ * <code>reduction::min | reduction::max | reduction::mean</code>).
+ * Each element of the expression is read exactly once, whatever the number of
+ * selected statistics, so that a lazy expression is evaluated only once.
+ *
+ * The statistics are defined as follows:
+ * - \c sum: the sum of the elements.
+ * - \c min, \c max: the minimum and maximum elements, with the same rules used
+ *   by the \c min and \c max operations (e.g., NaN values are ignored and
+ *   complex numbers are compared by modulus and then by phase angle).
+ * - \c argmin, \c argmax: the row and column index of the minimum and maximum
+ *   elements; among equal elements, the one visited first is taken (that is,
+ *   the one with the lowest index along the reduced dimension, or the first
+ *   in storage order when the whole matrix is reduced).
+ * - \c mean: the arithmetic mean of the elements.
+ * - \c variance: the sample variance (normalized by \f$n-1\f$) of the
+ *   elements, which is real also for complex elements (like in MATLAB).
+ * - \c count_nonzero: the number of nonzero elements.
+ * - \c any, \c all: tell if any or all the elements are nonzero.
+ * .
+ * Statistics which have not been selected are left to their default value
+ * (i.e., zero or \c false).
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_REDUCE_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_REDUCE_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/tags.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
+#include <boost/numeric/ublasx/operation/max.hpp>
+#include <boost/numeric/ublasx/operation/min.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+namespace reduction {
+
+/// The statistics that can be computed by the \c reduce operations.
+enum statistic
+{
+    sum = 1 << 0, ///< The sum of the elements.
+    min = 1 << 1, ///< The minimum element.
+    max = 1 << 2, ///< The maximum element.
+    argmin = 1 << 3, ///< The position of the minimum element.
+    argmax = 1 << 4, ///< The position of the maximum element.
+    mean = 1 << 5, ///< The mean of the elements.
+    variance = 1 << 6, ///< The sample variance of the elements.
+    count_nonzero = 1 << 7, ///< The number of nonzero elements.
+    any = 1 << 8, ///< Tell if any element is nonzero.
+    all = 1 << 9, ///< Tell if all the elements are nonzero.
+    all_statistics = (1 << 10) - 1 ///< All of the above statistics.
+};
+
+} // Namespace reduction
+
+
+/**
+ * \brief The statistics computed by the \c reduce operations.
+ * \tparam ValueT The type of the reduced elements.
+ * \tparam SizeT The size type.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename ValueT, typename SizeT = ::std::size_t>
+struct reduction_result
+{
+    typedef ValueT value_type;
+    typedef typename type_traits<ValueT>::real_type real_type;
+    typedef SizeT size_type;
+
+    reduction_result()
+    : count(0),
+      sum(0),
+      min(0),
+      max(0),
+      argmin_row(0),
+      argmin_column(0),
+      argmax_row(0),
+      argmax_column(0),
+      mean(0),
+      variance(0),
+      count_nonzero(0),
+      any(false),
+      all(false)
+    {
+    }
+
+    /// The number of reduced elements.
+    size_type count;
+    /// The sum of the elements.
+    value_type sum;
+    /// The minimum element.
+    value_type min;
+    /// The maximum element.
+    value_type max;
+    /// The row index of the minimum element.
+    size_type argmin_row;
+    /// The column index of the minimum element.
+    size_type argmin_column;
+    /// The row index of the maximum element.
+    size_type argmax_row;
+    /// The column index of the maximum element.
+    size_type argmax_column;
+    /// The mean of the elements.
+    value_type mean;
+    /// The sample variance of the elements.
+    real_type variance;
+    /// The number of nonzero elements.
+    size_type count_nonzero;
+    /// Tell if any element is nonzero.
+    bool any;
+    /// Tell if all the elements are nonzero.
+    bool all;
+};
+
+
+//@{ Declarations
+
+/**
+ * \brief Compute the selected statistics of the elements of the given vector
+ *  expression in a single pass.
+ * \tparam VectorExprT The type of the vector expression.
+ * \param ve The vector expression whose elements are reduced.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return The statistics of the elements of the vector expression; the
+ *  position of the minimum and maximum elements is given by their row index.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT>
+reduction_result<typename vector_traits<VectorExprT>::value_type, typename vector_traits<VectorExprT>::size_type> reduce(vector_expression<VectorExprT> const& ve, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of all the elements of the given
+ *  matrix expression in a single pass.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return The statistics of the elements of the matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> reduce_all(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of the elements over each column of
+ *  the given matrix expression in a single pass.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced by row.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return A vector containing the statistics of the elements over each column
+ *  in the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of the elements over each column of
+ *  the given matrix expression in a single pass.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced by row.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return A vector containing the statistics of the elements over each column
+ *  in the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_rows(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of the elements over each row of the
+ *  given matrix expression in a single pass.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced by column.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return A vector containing the statistics of the elements over each row in
+ *  the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_columns(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of the elements of the given matrix
+ *  expression along the given dimension in a single pass.
+ * \tparam Dim The dimension number (starting from 1).
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced by the given
+ *  dimension.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return A vector containing the statistics of the elements along the given
+ *  dimension in the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <std::size_t Dim, typename MatrixExprT>
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+
+/**
+ * \brief Compute the selected statistics of the elements of the given matrix
+ *  expression along the given dimension tag in a single pass.
+ * \tparam TagT The dimension tag type (e.g., tag::major).
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression whose elements are reduced by the given
+ *  dimension tag.
+ * \param what The statistics to compute, as a bitwise OR of
+ *  \c reduction::statistic values.
+ * \return A vector containing the statistics of the elements along the given
+ *  dimension tag in the given matrix expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename TagT, typename MatrixExprT>
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_by_tag(matrix_expression<MatrixExprT> const& me, unsigned int what = reduction::all_statistics);
+
+//@} Declarations
+
+
+namespace detail {
+
+//@{ Declarations
+
+/// Helper function for computing the squared modulus of a real number.
+template <typename T>
+T squared_abs(T x);
+
+/// Helper function for computing the squared modulus of a complex number.
+template <typename T>
+T squared_abs(::std::complex<T> const& x);
+
+/**
+ * \brief Single-pass accumulator of the statistics computed by the \c reduce
+ *  operations.
+ * \tparam ValueT The type of the reduced elements.
+ * \tparam SizeT The size type.
+ */
+template <typename ValueT, typename SizeT>
+class reduction_accumulator;
+
+/// Functor accumulating the visited matrix elements into a single
+/// accumulator.
+template <typename AccumulatorT>
+struct reduce_all_visitor;
+
+/// Functor accumulating each visited matrix element into the accumulator of
+/// its column.
+template <typename AccumulatorT>
+struct reduce_rows_visitor;
+
+/// Functor accumulating each visited matrix element into the accumulator of
+/// its row.
+template <typename AccumulatorT>
+struct reduce_columns_visitor;
+
+/**
+ * \brief Auxiliary class for computing statistics along the given dimension.
+ * \tparam Dim The dimension number (starting from 1).
+ */
+template <std::size_t Dim>
+struct reduce_by_dim_impl;
+
+/**
+ * \brief Auxiliary class for computing statistics along the given dimension
+ *  tag.
+ * \tparam TagT The dimension tag type (e.g., tag::major).
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ */
+template <typename TagT, typename OrientationT>
+struct reduce_by_tag_impl;
+
+//@} Declarations
+
+
+//@{ Definitions
+
+template <typename T>
+BOOST_UBLAS_INLINE
+T squared_abs(T x)
+{
+    return x*x;
+}
+
+
+template <typename T>
+BOOST_UBLAS_INLINE
+T squared_abs(::std::complex<T> const& x)
+{
+    return ::std::norm(x);
+}
+
+
+template <typename ValueT, typename SizeT>
+class reduction_accumulator
+{
+    public: typedef ValueT value_type;
+    public: typedef SizeT size_type;
+    public: typedef reduction_result<value_type,size_type> result_type;
+    public: typedef typename result_type::real_type real_type;
+
+
+    public: explicit reduction_accumulator(unsigned int what = reduction::all_statistics)
+    : what_(normalize(what)),
+      n_(0),
+      sum_(0),
+      min_(infinity<value_type>::value),
+      max_(minus_infinity<value_type>::value),
+      argmin_r_(0),
+      argmin_c_(0),
+      argmax_r_(0),
+      argmax_c_(0),
+      shift_(0),
+      shifted_sum_(0),
+      shifted_sumsq_(0),
+      nnz_(0)
+    {
+    }
+
+
+    public: void operator()(size_type r, size_type c, value_type const& x)
+    {
+        if (what_ & reduction::sum)
+        {
+            sum_ += x;
+        }
+        if ((what_ & reduction::min) && less_than_impl(x, min_))
+        {
+            min_ = x;
+            argmin_r_ = r;
+            argmin_c_ = c;
+        }
+        if ((what_ & reduction::max) && greater_than_impl(x, max_))
+        {
+            max_ = x;
+            argmax_r_ = r;
+            argmax_c_ = c;
+        }
+        if (what_ & reduction::variance)
+        {
+            // Accumulate the data shifted by the first element, which avoids
+            // the catastrophic cancellation of the textbook one-pass formula
+            // when the mean is large with respect to the standard deviation
+            if (n_ == 0)
+            {
+                shift_ = x;
+            }
+            value_type d = x-shift_;
+            shifted_sum_ += d;
+            shifted_sumsq_ += squared_abs(d);
+        }
+        if ((what_ & reduction::count_nonzero) && x != value_type(0))
+        {
+            ++nnz_;
+        }
+        ++n_;
+    }
+
+
+    public: result_type result() const
+    {
+        result_type res;
+
+        res.count = n_;
+        if (what_ & reduction::sum)
+        {
+            res.sum = sum_;
+        }
+        if (what_ & reduction::min)
+        {
+            res.min = min_;
+            res.argmin_row = argmin_r_;
+            res.argmin_column = argmin_c_;
+        }
+        if (what_ & reduction::max)
+        {
+            res.max = max_;
+            res.argmax_row = argmax_r_;
+            res.argmax_column = argmax_c_;
+        }
+        if (what_ & reduction::mean)
+        {
+            res.mean = (n_ > 0)
+                       ? value_type(sum_/value_type(n_))
+                       : value_type(::std::numeric_limits<real_type>::quiet_NaN());
+        }
+        if (what_ & reduction::variance)
+        {
+            if (n_ > 1)
+            {
+                real_type n(n_);
+                res.variance = (shifted_sumsq_-squared_abs(shifted_sum_)/n)/(n-1);
+            }
+            else if (n_ == 1)
+            {
+                res.variance = real_type(0);
+            }
+            else
+            {
+                res.variance = ::std::numeric_limits<real_type>::quiet_NaN();
+            }
+        }
+        if (what_ & reduction::count_nonzero)
+        {
+            res.count_nonzero = nnz_;
+            res.any = nnz_ > 0;
+            res.all = nnz_ == n_;
+        }
+
+        return res;
+    }
+
+
+    /// Add to the given statistics the ones they depend on.
+    private: static unsigned int normalize(unsigned int what)
+    {
+        if (what & reduction::argmin)
+        {
+            what |= reduction::min;
+        }
+        if (what & reduction::argmax)
+        {
+            what |= reduction::max;
+        }
+        if (what & reduction::mean)
+        {
+            what |= reduction::sum;
+        }
+        if (what & (reduction::any | reduction::all))
+        {
+            what |= reduction::count_nonzero;
+        }
+
+        return what;
+    }
+
+
+    private: unsigned int what_;
+    private: size_type n_;
+    private: value_type sum_;
+    private: value_type min_;
+    private: value_type max_;
+    private: size_type argmin_r_;
+    private: size_type argmin_c_;
+    private: size_type argmax_r_;
+    private: size_type argmax_c_;
+    private: value_type shift_;
+    private: value_type shifted_sum_;
+    private: real_type shifted_sumsq_;
+    private: size_type nnz_;
+};
+
+
+template <typename AccumulatorT>
+struct reduce_all_visitor
+{
+    typedef typename AccumulatorT::size_type size_type;
+    typedef typename AccumulatorT::value_type value_type;
+
+    BOOST_UBLAS_INLINE
+    explicit reduce_all_visitor(AccumulatorT& acc)
+    : acc(acc)
+    {
+    }
+
+    BOOST_UBLAS_INLINE
+    void operator()(size_type r, size_type c, value_type const& x)
+    {
+        acc(r, c, x);
+    }
+
+    AccumulatorT& acc;
+};
+
+
+template <typename AccumulatorT>
+struct reduce_rows_visitor
+{
+    typedef typename AccumulatorT::size_type size_type;
+    typedef typename AccumulatorT::value_type value_type;
+
+    BOOST_UBLAS_INLINE
+    explicit reduce_rows_visitor(::std::vector<AccumulatorT>& accs)
+    : accs(accs)
+    {
+    }
+
+    BOOST_UBLAS_INLINE
+    void operator()(size_type r, size_type c, value_type const& x)
+    {
+        accs[c](r, c, x);
+    }
+
+    ::std::vector<AccumulatorT>& accs;
+};
+
+
+template <typename AccumulatorT>
+struct reduce_columns_visitor
+{
+    typedef typename AccumulatorT::size_type size_type;
+    typedef typename AccumulatorT::value_type value_type;
+
+    BOOST_UBLAS_INLINE
+    explicit reduce_columns_visitor(::std::vector<AccumulatorT>& accs)
+    : accs(accs)
+    {
+    }
+
+    BOOST_UBLAS_INLINE
+    void operator()(size_type r, size_type c, value_type const& x)
+    {
+        accs[r](r, c, x);
+    }
+
+    ::std::vector<AccumulatorT>& accs;
+};
+
+
+template <>
+struct reduce_by_dim_impl<1>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static ::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > apply(matrix_expression<MatrixExprT> const& me, unsigned int what)
+    {
+        return reduce_rows(me, what);
+    }
+};
+
+
+template <>
+struct reduce_by_dim_impl<2>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static ::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > apply(matrix_expression<MatrixExprT> const& me, unsigned int what)
+    {
+        return reduce_columns(me, what);
+    }
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::major, row_major_tag>: reduce_by_dim_impl<1>
+{
+    // Empty
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::minor, row_major_tag>: reduce_by_dim_impl<2>
+{
+    // Empty
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::leading, row_major_tag>: reduce_by_dim_impl<2>
+{
+    // Empty
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::major, column_major_tag>: reduce_by_dim_impl<2>
+{
+    // Empty
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::minor, column_major_tag>: reduce_by_dim_impl<1>
+{
+    // Empty
+};
+
+
+template <>
+struct reduce_by_tag_impl<tag::leading, column_major_tag>: reduce_by_dim_impl<1>
+{
+    // Empty
+};
+
+
+template <typename TagT>
+struct reduce_by_tag_impl<TagT, unknown_orientation_tag>: reduce_by_tag_impl<TagT, row_major_tag>
+{
+    // Empty
+};
+
+//@} Definitions
+
+} // Namespace detail
+
+
+//@{ Definitions
+
+template <typename VectorExprT>
+BOOST_UBLAS_INLINE
+reduction_result<typename vector_traits<VectorExprT>::value_type, typename vector_traits<VectorExprT>::size_type> reduce(vector_expression<VectorExprT> const& ve, unsigned int what)
+{
+    typedef typename vector_traits<VectorExprT>::size_type size_type;
+    typedef typename vector_traits<VectorExprT>::value_type value_type;
+
+    size_type n = size(ve);
+
+    detail::reduction_accumulator<value_type,size_type> acc(what);
+    for (size_type i = 0; i < n; ++i)
+    {
+        acc(i, 0, ve()(i));
+    }
+
+    return acc.result();
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> reduce_all(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef detail::reduction_accumulator<value_type,size_type> accumulator_type;
+
+    accumulator_type acc(what);
+    detail::reduce_all_visitor<accumulator_type> visitor(acc);
+    detail::for_each_in_storage_order(me, visitor);
+
+    return acc.result();
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    return reduce_rows(me, what);
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_rows(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef detail::reduction_accumulator<value_type,size_type> accumulator_type;
+    typedef reduction_result<value_type,size_type> result_type;
+
+    size_type nc = num_columns(me);
+
+    // Visit the elements in storage order and accumulate each of them into
+    // the accumulator of its column.
+    ::std::vector<accumulator_type> accs(nc, accumulator_type(what));
+    detail::reduce_rows_visitor<accumulator_type> visitor(accs);
+    detail::for_each_in_storage_order(me, visitor);
+
+    ::std::vector<result_type> res(nc);
+    for (size_type c = 0; c < nc; ++c)
+    {
+        res[c] = accs[c].result();
+    }
+
+    return res;
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_columns(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+    typedef detail::reduction_accumulator<value_type,size_type> accumulator_type;
+    typedef reduction_result<value_type,size_type> result_type;
+
+    size_type nr = num_rows(me);
+
+    // Visit the elements in storage order and accumulate each of them into
+    // the accumulator of its row.
+    ::std::vector<accumulator_type> accs(nr, accumulator_type(what));
+    detail::reduce_columns_visitor<accumulator_type> visitor(accs);
+    detail::for_each_in_storage_order(me, visitor);
+
+    ::std::vector<result_type> res(nr);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        res[r] = accs[r].result();
+    }
+
+    return res;
+}
+
+
+template <std::size_t Dim, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    return detail::reduce_by_dim_impl<Dim>::apply(me, what);
+}
+
+
+template <typename TagT, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+::std::vector< reduction_result<typename matrix_traits<MatrixExprT>::value_type, typename matrix_traits<MatrixExprT>::size_type> > reduce_by_tag(matrix_expression<MatrixExprT> const& me, unsigned int what)
+{
+    return detail::reduce_by_tag_impl<TagT, typename matrix_traits<MatrixExprT>::orientation_category>::apply(me, what);
+}
+
+//@} Definitions
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_REDUCE_HPP
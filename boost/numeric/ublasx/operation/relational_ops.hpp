@@ -3,7 +3,8 @@
 /**
  * \file boost/numeric/ublasx/operation/relational_ops.hpp
  *
- * \brief Relational operators defined over matrix and vector expressions.
+ * \brief Relational operators defined over matrix and vector expressions, and
+ *  tolerance-based comparison of matrix and vector expressions.
  *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
@@ -23,9 +24,15 @@
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/predicate.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <limits>
 
 
 /// Equality operator for vector expressions.
@@ -51,16 +58,7 @@ bool operator==(::boost::numeric::ublas::vector_expression<VectorExpr1T> const&
         return false;
     }
 
-
-    for (size_type i = 0; i < n1; ++i)
-    {
-        if (static_cast<value_type>(ve1()(i)) != static_cast<value_type>(ve2()(i)))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return ::boost::numeric::ublasx::detail::all_of_pairs(ve1, ve2, ::std::equal_to<value_type>());
 }
 
 
@@ -99,30 +97,204 @@ bool operator==(::boost::numeric::ublas::matrix_expression<MatrixExpr1T> const&
         return false;
     }
 
+    return ::boost::numeric::ublasx::detail::all_of_pairs(me1, me2, ::std::equal_to<value_type>());
+}
+
+
+/// Inequality operator for matrix expressions.
+template <typename MatrixExpr1T, typename MatrixExpr2T>
+BOOST_UBLAS_INLINE
+bool operator!=(::boost::numeric::ublas::matrix_expression<MatrixExpr1T> const& me1,
+                ::boost::numeric::ublas::matrix_expression<MatrixExpr2T> const& me2)
+{
+    return !(me1 == me2);
+}
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
 
-    for (size_type r = 0; r < nr1; ++r)
+//@{ Declarations
+
+/**
+ * \brief Tell if two vector expressions have the same size and their elements
+ *  are equal within the given tolerances.
+ * \tparam VectorExpr1T The type of the first vector expression.
+ * \tparam VectorExpr2T The type of the second vector expression.
+ * \tparam RTolT The type of the relative tolerance.
+ * \tparam ATolT The type of the absolute tolerance.
+ * \param ve1 The first vector expression.
+ * \param ve2 The second vector expression.
+ * \param rtol The relative tolerance.
+ * \param atol The absolute tolerance.
+ *  Both tolerances are converted to the real type of the promoted value type
+ *  of the operands, so that their types may differ (e.g.,
+ *  <code>approx_equal(u, v, 1e-6, 0)</code>).
+ * \return \c true if, for each position \c i, either
+ *  <code>ve1(i) == ve2(i)</code> or
+ *  <code>|ve1(i)-ve2(i)| <= atol+rtol*max(|ve1(i)|,|ve2(i)|)</code>;
+ *  \c false otherwise (in particular if some element is a NaN).
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExpr1T, typename VectorExpr2T, typename RTolT, typename ATolT = RTolT>
+bool approx_equal(vector_expression<VectorExpr1T> const& ve1,
+                  vector_expression<VectorExpr2T> const& ve2,
+                  RTolT rtol,
+                  ATolT atol = 0);
+
+/**
+ * \brief Tell if two matrix expressions have the same size and their elements
+ *  are equal within the given tolerances.
+ * \tparam MatrixExpr1T The type of the first matrix expression.
+ * \tparam MatrixExpr2T The type of the second matrix expression.
+ * \tparam RTolT The type of the relative tolerance.
+ * \tparam ATolT The type of the absolute tolerance.
+ * \param me1 The first matrix expression.
+ * \param me2 The second matrix expression.
+ * \param rtol The relative tolerance.
+ * \param atol The absolute tolerance.
+ *  Both tolerances are converted to the real type of the promoted value type
+ *  of the operands, so that their types may differ (e.g.,
+ *  <code>approx_equal(u, v, 1e-6, 0)</code>).
+ * \return \c true if, for each position <code>(r,c)</code>, either
+ *  <code>me1(r,c) == me2(r,c)</code> or
+ *  <code>|me1(r,c)-me2(r,c)| <= atol+rtol*max(|me1(r,c)|,|me2(r,c)|)</code>;
+ *  \c false otherwise (in particular if some element is a NaN).
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExpr1T, typename MatrixExpr2T, typename RTolT, typename ATolT = RTolT>
+bool approx_equal(matrix_expression<MatrixExpr1T> const& me1,
+                  matrix_expression<MatrixExpr2T> const& me2,
+                  RTolT rtol,
+                  ATolT atol = 0);
+
+//@} Declarations
+
+
+namespace detail {
+
+/// Tell if two values are equal within a relative and an absolute tolerance.
+template <typename ValueT>
+struct approx_equal_to
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    approx_equal_to(real_type rtol, real_type atol)
+    : rtol_(rtol),
+      atol_(atol)
+    {
+    }
+
+    bool operator()(ValueT const& x, ValueT const& y) const
     {
-        for (size_type c = 0; c < nc1; ++c)
+        real_type abs_x = type_traits<ValueT>::type_abs(x);
+        real_type abs_y = type_traits<ValueT>::type_abs(y);
+
+        return x == y
+               || type_traits<ValueT>::type_abs(x-y) <= (atol_+rtol_*::std::max(abs_x, abs_y));
+    }
+
+    real_type rtol_;
+    real_type atol_;
+};
+
+
+/**
+ * \brief Tell if two complex values are equal within a relative and an
+ *  absolute tolerance.
+ *
+ * Moduli are compared through their squares, which saves the (slow) scaled
+ * computation of the moduli unless the squares overflow.
+ */
+template <typename T>
+struct approx_equal_to< ::std::complex<T> >
+{
+    typedef T real_type;
+
+    approx_equal_to(real_type rtol, real_type atol)
+    : rtol_(rtol),
+      atol_(atol)
+    {
+    }
+
+    bool operator()(::std::complex<T> const& x, ::std::complex<T> const& y) const
+    {
+        if (x == y)
         {
-            if (static_cast<value_type>(me1()(r,c)) != static_cast<value_type>(me2()(r,c)))
-            {
-                return false;
-            }
+            return true;
         }
+
+        real_type sqr_abs_xy = ::std::norm(x-y);
+        real_type sqr_abs_max = ::std::max(::std::norm(x), ::std::norm(y));
+
+        if (sqr_abs_xy <= ::std::numeric_limits<real_type>::max()
+            && sqr_abs_max <= ::std::numeric_limits<real_type>::max())
+        {
+            real_type tol = atol_+rtol_*::std::sqrt(sqr_abs_max);
+
+            return sqr_abs_xy <= tol*tol;
+        }
+
+        return ::std::abs(x-y) <= (atol_+rtol_*::std::max(::std::abs(x), ::std::abs(y)));
     }
 
-    return true;
+    real_type rtol_;
+    real_type atol_;
+};
+
+} // Namespace detail
+
+
+//@{ Definitions
+
+template <typename VectorExpr1T, typename VectorExpr2T, typename RTolT, typename ATolT>
+BOOST_UBLAS_INLINE
+bool approx_equal(vector_expression<VectorExpr1T> const& ve1,
+                  vector_expression<VectorExpr2T> const& ve2,
+                  RTolT rtol,
+                  ATolT atol)
+{
+    typedef typename promote_traits<
+            typename vector_traits<VectorExpr1T>::value_type,
+            typename vector_traits<VectorExpr2T>::value_type
+        >::promote_type value_type;
+
+    if (size(ve1) != size(ve2))
+    {
+        return false;
+    }
+
+    return detail::all_of_pairs(ve1, ve2, detail::approx_equal_to<value_type>(rtol, atol));
 }
 
 
-/// Inequality operator for matrix expressions.
-template <typename MatrixExpr1T, typename MatrixExpr2T>
+template <typename MatrixExpr1T, typename MatrixExpr2T, typename RTolT, typename ATolT>
 BOOST_UBLAS_INLINE
-bool operator!=(::boost::numeric::ublas::matrix_expression<MatrixExpr1T> const& me1,
-                ::boost::numeric::ublas::matrix_expression<MatrixExpr2T> const& me2)
+bool approx_equal(matrix_expression<MatrixExpr1T> const& me1,
+                  matrix_expression<MatrixExpr2T> const& me2,
+                  RTolT rtol,
+                  ATolT atol)
 {
-    return !(me1 == me2);
+    typedef typename promote_traits<
+            typename matrix_traits<MatrixExpr1T>::value_type,
+            typename matrix_traits<MatrixExpr2T>::value_type
+        >::promote_type value_type;
+
+    if (num_rows(me1) != num_rows(me2) || num_columns(me1) != num_columns(me2))
+    {
+        return false;
+    }
+
+    return detail::all_of_pairs(me1, me2, detail::approx_equal_to<value_type>(rtol, atol));
 }
 
+//@} Definitions
+
+}}} // Namespace boost::numeric::ublasx
+
 
 #endif // BOOST_NUMERIC_UBLASX_OPERATION_RELATIONAL_OPS_HPP
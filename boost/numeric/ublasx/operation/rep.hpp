@@ -26,9 +26,7 @@
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/traits.hpp>
-#include <boost/numeric/ublasx/operation/num_columns.hpp>
-#include <boost/numeric/ublasx/operation/num_rows.hpp>
-#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/expression/repeat_view.hpp>
 #include <cstddef>
 
 
@@ -37,51 +35,61 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief Tile \a nr by \a nc copies of the given matrix without copying its
+ *  elements.
+ * \return A view of the block matrix, whose elements are taken from \a me on
+ *  access.
+ */
 template <typename MatrixExprT>
-matrix<typename matrix_traits<MatrixExprT>::value_type> rep(matrix_expression<MatrixExprT> const& me, ::std::size_t nr, ::std::size_t nc)
+BOOST_UBLAS_INLINE
+repeat_view<MatrixExprT> lazy_rep(matrix_expression<MatrixExprT> const& me, ::std::size_t nr, ::std::size_t nc)
 {
-    typedef matrix<typename matrix_traits<MatrixExprT>::value_type> result_matrix_type;
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+    return repeat_view<MatrixExprT>(me(), nr, nc);
+}
 
-    size_type nr_me(num_rows(me));
-    size_type nc_me(num_columns(me));
 
-    result_matrix_type res(nr_me*nr, nc_me*nc);
+/**
+ * \brief Tile \a nr by \a nc copies of the given (column) vector without
+ *  copying its elements.
+ * \return A view of the block matrix, whose elements are taken from \a ve on
+ *  access.
+ */
+template <typename VectorExprT>
+BOOST_UBLAS_INLINE
+repeat_view<VectorExprT> lazy_rep(vector_expression<VectorExprT> const& ve, ::std::size_t nr, ::std::size_t nc)
+{
+    return repeat_view<VectorExprT>(ve(), nr, nc);
+}
 
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-            subrange(res, r*nr_me, (r+1)*nr_me, c*nc_me, (c+1)*nc_me) = me;
-        }
-    }
 
-    return res;
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+repeat_view<MatrixExprT> lazy_rep(matrix_expression<MatrixExprT> const& me, ::std::size_t n)
+{
+    return lazy_rep(me, n, n);
 }
 
 
 template <typename VectorExprT>
-matrix<typename vector_traits<VectorExprT>::value_type> rep(vector_expression<VectorExprT> const& ve, ::std::size_t nr, ::std::size_t nc)
+BOOST_UBLAS_INLINE
+repeat_view<VectorExprT> lazy_rep(vector_expression<VectorExprT> const& ve, ::std::size_t n)
 {
-    typedef matrix<typename vector_traits<VectorExprT>::value_type> result_matrix_type;
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
+    return lazy_rep(ve, n, n);
+}
 
-    size_type n_ve(size(ve));
 
-    result_matrix_type res(n_ve*nr, nc);
+template <typename MatrixExprT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> rep(matrix_expression<MatrixExprT> const& me, ::std::size_t nr, ::std::size_t nc)
+{
+    return lazy_rep(me, nr, nc).eval();
+}
 
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-            for (size_type i = 0; i < n_ve; ++i)
-            {
-                res(r*n_ve+i, c) = ve()(i);
-            }
-        }
-    }
 
-    return res;
+template <typename VectorExprT>
+matrix<typename vector_traits<VectorExprT>::value_type> rep(vector_expression<VectorExprT> const& ve, ::std::size_t nr, ::std::size_t nc)
+{
+    return lazy_rep(ve, nr, nc).eval();
 }
 
 
@@ -30,7 +30,9 @@
 #include <boost/numeric/ublas/fwd.hpp>
 #include <boost/numeric/ublas/tags.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/numeric/ublasx/detail/compiler.hpp>
+#include <boost/numeric/ublasx/expression/reshape_view.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
@@ -80,38 +82,7 @@ typename reshape_traits<VectorExprT>::result_type reshape_impl(vector_expression
                                                                ::std::size_t nr,
                                                                ::std::size_t nc)
 {
-    typedef typename reshape_traits<VectorExprT>::result_type result_matrix_type;
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
-
-    size_type n(size(ve));
-
-    // pre: to reshape, the number of elements must not change.
-    // NOTE: assertion used to mimic the MATLAB 'reshape' function.
-    BOOST_UBLAS_CHECK(
-            nr*nc == n,
-            bad_size()
-        );
-
-    // NOTE: this is needed to avoid this kind of warning when one compiles
-    //       without debug information.
-    BOOST_UBLASX_SUPPRESS_UNUSED_VARIABLE_WARNING( n );
-
-    result_matrix_type res(nr, nc);
-
-    size_type k(0);
-
-    // Work column-wise as done by the MATLAB/Octave reshape function
-    for (size_type j = 0; j < nc; ++j)
-    {
-        for (size_type i = 0; i < nr; ++i)
-        {
-            res(i,j) = ve()(k);
-
-            ++k;
-        }
-    }
-
-    return res;
+    return reshape_view<VectorExprT>(ve(), nr, nc).eval();
 }
 
 
@@ -131,64 +102,7 @@ typename reshape_traits<MatrixExprT>::result_type reshape_impl(matrix_expression
                                                                ::std::size_t nc,
                                                                bool colw)
 {
-    // pre: to reshape, the number of elements must not change.
-    // NOTE: assertion used to mimic the MATLAB 'reshape' function.
-    BOOST_UBLAS_CHECK(
-            nr*nc == num_rows(me)*num_columns(me),
-            bad_size()
-        );
-
-//  typedef typename matrix_temporary_traits<MatrixExprT>::type result_matrix_type;
-    typedef typename reshape_traits<MatrixExprT>::result_type result_matrix_type;
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-
-    result_matrix_type res(nr, nc);
-
-    size_type r(0);
-    size_type c(0);
-
-    if (colw)
-    {
-        // Reshape by taking the elements in a column-wise way.
-        size_type nr_me(num_rows(me));
-        for (size_type j = 0; j < nc; ++j)
-        {
-            for (size_type i = 0; i < nr; ++i)
-            {
-                if (r == nr_me)
-                {
-                    r = size_type/*zero*/();
-                    ++c;
-                }
-
-                res(i,j) = me()(r,c);
-
-                ++r;
-            }
-        }
-    }
-    else
-    {
-        // Reshape by taking the elements in a row-wise way.
-        size_type nc_me(num_columns(me));
-        for (size_type j = 0; j < nc; ++j)
-        {
-            for (size_type i = 0; i < nr; ++i)
-            {
-                if (c == nc_me)
-                {
-                    c = size_type/*zero*/();
-                    ++r;
-                }
-
-                res(i,j) = me()(r,c);
-
-                ++c;
-            }
-        }
-    }
-
-    return res;
+    return reshape_view<MatrixExprT>(me(), nr, nc, colw).eval();
 }
 
 
@@ -355,6 +269,64 @@ struct reshape_traits< matrix_expression<MatrixExprT> >
 };
 
 
+/**
+ * \brief Reshape the given vector without copying its elements.
+ * \tparam VectorExprT The type of the input vector expression.
+ * \param ve The input vector expression.
+ * \param nr The number of rows of the reshaped matrix.
+ * \param nc The number of columns of the reshaped matrix.
+ * \return A view of the reshaped matrix, whose elements are taken from \a ve
+ *  on access.
+ */
+template <typename VectorExprT>
+BOOST_UBLAS_INLINE
+reshape_view<VectorExprT> lazy_reshape(vector_expression<VectorExprT> const& ve,
+                                       ::std::size_t nr,
+                                       ::std::size_t nc)
+{
+    return reshape_view<VectorExprT>(ve(), nr, nc);
+}
+
+
+/**
+ * \brief Reshape the given matrix without copying its elements.
+ * \tparam Dim Tells if elements are taken from the input matrix either in a
+ *  column-wise way (\c 1 value) or in a row-wise way (\c 2 value).
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \param me The input matrix expression.
+ * \param nr The number of rows of the reshaped matrix.
+ * \param nc The number of columns of the reshaped matrix.
+ * \return A view of the reshaped matrix, whose elements are taken from \a me
+ *  on access.
+ */
+template <std::size_t Dim, typename MatrixExprT>
+BOOST_UBLAS_INLINE
+reshape_view<MatrixExprT> lazy_reshape(matrix_expression<MatrixExprT> const& me, ::std::size_t nr, ::std::size_t nc)
+{
+    BOOST_STATIC_ASSERT( Dim == 1 || Dim == 2 );
+
+    return reshape_view<MatrixExprT>(me(), nr, nc, Dim == 1);
+}
+
+
+/**
+ * \brief Reshape the given matrix without copying its elements, which are
+ *  taken in a column-wise way.
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \param me The input matrix expression.
+ * \param nr The number of rows of the reshaped matrix.
+ * \param nc The number of columns of the reshaped matrix.
+ * \return A view of the reshaped matrix, whose elements are taken from \a me
+ *  on access.
+ */
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+reshape_view<MatrixExprT> lazy_reshape(matrix_expression<MatrixExprT> const& me, ::std::size_t nr, ::std::size_t nc)
+{
+    return reshape_view<MatrixExprT>(me(), nr, nc, true);
+}
+
+
 template <typename VectorExprT>
 BOOST_UBLAS_INLINE
 typename reshape_traits<VectorExprT>::result_type reshape(vector_expression<VectorExprT> const& ve,
@@ -29,6 +29,7 @@
 #include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/expression/rot90_view.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
@@ -110,61 +111,25 @@ void rot90_inplace(vector_container<VectorT>& v, int k=1)
 }
 
 
-/// Rotate the given matrix counterclockwise by (a multiple of) 90 degrees
+/**
+ * \brief Rotate the given matrix counterclockwise by (a multiple of) 90 degrees
+ *  without copying its elements.
+ * \return A view of the rotated matrix, whose elements are taken from \a A on
+ *  access.
+ */
 template <typename MatrixT>
-typename detail::rot90_matrix_traits<MatrixT>::result_type rot90(matrix_expression<MatrixT> const& A, int k=1)
+BOOST_UBLAS_INLINE
+rot90_view<MatrixT> lazy_rot90(matrix_expression<MatrixT> const& A, int k=1)
 {
-    typedef typename detail::rot90_matrix_traits<MatrixT>::result_type result_type;
-    typedef typename matrix_traits<MatrixT>::size_type size_type;
-
-    size_type nr(ublasx::num_rows(A));
-    size_type nc(ublasx::num_columns(A));
-
-    result_type X;
-
-    // Make sure k \in {0, 1, 2, 3}
-    k %= 4;
-    if (k < 0)
-    {
-        k += 4;
-    }
-
-    if (k == 1)
-    {
-        X.resize(nc, nr, false);
-
-        for (size_type c = 0; c < nc; ++c)
-        {
-            row(X, nc-c-1) = column(A(), c);
-        }
-    }
-    else if (k == 2)
-    {
-        X.resize(nr, nc, false);
-
-        for (size_type r = 0; r < nr; ++r)
-        {
-            for (size_type c = 0; c < nc; ++c)
-            {
-                X(nr-r-1,nc-c-1) = A()(r,c);
-            }
-        }
-    }
-    else if (k == 3)
-    {
-        X.resize(nc, nr, false);
+    return rot90_view<MatrixT>(A(), k);
+}
 
-        for (size_type r = 0; r < nr; ++r)
-        {
-            column(X, nr-r-1) = row(A(), r);
-        }
-    }
-    else
-    {
-        X = A;
-    }
 
-    return X;
+/// Rotate the given matrix counterclockwise by (a multiple of) 90 degrees
+template <typename MatrixT>
+typename detail::rot90_matrix_traits<MatrixT>::result_type rot90(matrix_expression<MatrixT> const& A, int k=1)
+{
+    return lazy_rot90(A, k).eval();
 }
 
 /// Rotate the given matrix counterclockwise by (a multiple of) 90 degrees
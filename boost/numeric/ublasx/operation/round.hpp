@@ -24,6 +24,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 #include <complex>
 
@@ -43,15 +44,51 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+/// Auxiliary function used to replace ::std::round when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+T round(T x)
+{
+    return (x > 0.0) ? ::std::floor(x + 0.5) : ::std::ceil(x - 0.5);
+}
+
+/// Auxiliary function used to replace ::std::round when that is not available.
+template <typename T>
+BOOST_UBLAS_INLINE
+::std::complex<T> round(::std::complex<T> x)
+{
+    T r = (x.real() > 0.0) ? ::std::floor(x.real() + 0.5) : ::std::ceil(x.real() - 0.5);
+    T i = (x.imag() > 0.0) ? ::std::floor(x.imag() + 0.5) : ::std::ceil(x.imag() - 0.5);
+
+    return ::std::complex<T>(r,i);
+}
+
+
+/// Functor rounding its argument to the nearest integer.
+template <typename ArgT, typename ResT>
+struct round_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_round_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef round_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -64,34 +101,15 @@ struct matrix_round_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef round_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-/// Auxiliary function used to replace ::std::round when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-T round(T x)
-{
-    return (x > 0.0) ? ::std::floor(x + 0.5) : ::std::ceil(x - 0.5);
-}
-
-/// Auxiliary function used to replace ::std::round when that is not available.
-template <typename T>
-BOOST_UBLAS_INLINE
-::std::complex<T> round(::std::complex<T> x)
-{
-    T r = (x.real() > 0.0) ? ::std::floor(x.real() + 0.5) : ::std::ceil(x.real() - 0.5);
-    T i = (x.imag() > 0.0) ? ::std::floor(x.imag() + 0.5) : ::std::ceil(x.imag() - 0.5);
-
-    return ::std::complex<T>(r,i);
-}
-
 } // Namespace detail
 
 
@@ -111,14 +129,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_round_functor_traits<VectorExprT>::result_type round(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_round_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_round_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
-    typedef typename detail::vector_round_functor_traits<VectorExprT>::signature_result_type signature_result_type;
-
-//  return expression_type(ve(), BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round<signature_result_type>);
-//  signature_result_type (*)(ptr_round_fun)(signature_argument_type)(BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round); 
-    typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
-    fun_ptr_type ptr_round_fun(&BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round); 
-    return expression_type(ve(), ptr_round_fun);
+    typedef typename detail::vector_round_functor_traits<VectorExprT>::functor_type functor_type;
+
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -138,15 +151,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_round_functor_traits<MatrixExprT>::result_type round(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_round_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_round_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
-    typedef typename detail::matrix_round_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_round_functor_traits<MatrixExprT>::functor_type functor_type;
 
-//  return expression_type(me(), BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round<signature_result_type>(signature_argument_type));
-    typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
-    fun_ptr_type ptr_round_fun(&BOOST_NUMERIC_UBLASX_OPERATION_ROUND_NS_::round); 
-    return expression_type(me(), ptr_round_fun);
+    return expression_type(me(), functor_type());
 }
 
+
+// round(policy, e), which evaluates round(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(round)
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -0,0 +1,412 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/scan.hpp
+ *
+ * \brief Compute the cumulative reduction of an array by means of an
+ *  associative binary operation (inclusive scan).
+ *
+ * The i-th element of the scan of \f$(x_0, x_1, \ldots)\f$ by the operation
+ * \f$\oplus\f$ is \f$x_0 \oplus x_1 \oplus \cdots \oplus x_i\f$; for instance,
+ * the cumulative sum is the scan by \c std::plus.
+ * Dense \c vector and \c matrix containers are scanned through their storage
+ * array and, when they are long enough, by concurrent threads (see
+ * \c boost/numeric/ublasx/detail/parallel.hpp); in this case the result of a
+ * floating-point operation may differ by rounding from the one computed
+ * sequentially.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_SCAN_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_SCAN_HPP
+
+
+#include <boost/numeric/ublas/detail/config.hpp>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/scan.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cstddef>
+
+
+//FIXME: could not use boost::[matrix|vector]_temporary_traits for the result
+//type since some container type (e.g., zero_matrix) does not define such type.
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+//@{ Declarations
+
+/**
+ * \brief Scan in place the elements of the given vector container.
+ * \tparam VectorT The type of the vector container.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param v The vector container whose elements are replaced by their scan.
+ * \param op The associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorT, typename BinaryFunctorT>
+void scan_inplace(vector_container<VectorT>& v, BinaryFunctorT op);
+
+/**
+ * \brief Scan in place the elements over each column of the given matrix
+ *  container.
+ * \tparam MatrixT The type of the matrix container.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param A The matrix container whose elements are replaced by their scan over
+ *  each column.
+ * \param op The associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT, typename BinaryFunctorT>
+void scan_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op);
+
+/**
+ * \brief Scan in place the elements over each column of the given matrix
+ *  container.
+ * \tparam MatrixT The type of the matrix container.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param A The matrix container whose elements are replaced by their scan over
+ *  each column.
+ * \param op The associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT, typename BinaryFunctorT>
+void scan_rows_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op);
+
+/**
+ * \brief Scan in place the elements over each row of the given matrix
+ *  container.
+ * \tparam MatrixT The type of the matrix container.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param A The matrix container whose elements are replaced by their scan over
+ *  each row.
+ * \param op The associative binary operation.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixT, typename BinaryFunctorT>
+void scan_columns_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op);
+
+/**
+ * \brief Scan the elements of the given vector expression.
+ * \tparam VectorExprT The type of the vector expression.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param ve The vector expression whose elements are scanned.
+ * \param op The associative binary operation.
+ * \return The scan of the elements of the vector expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename VectorExprT, typename BinaryFunctorT>
+vector<typename vector_traits<VectorExprT>::value_type> scan(vector_expression<VectorExprT> const& ve, BinaryFunctorT op);
+
+/**
+ * \brief Scan the elements over each column of the given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param me The matrix expression whose elements are scanned over each column.
+ * \param op The associative binary operation.
+ * \return The scan of the elements over each column of the given matrix
+ *  expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename BinaryFunctorT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op);
+
+/**
+ * \brief Scan the elements over each column of the given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param me The matrix expression whose elements are scanned over each column.
+ * \param op The associative binary operation.
+ * \return The scan of the elements over each column of the given matrix
+ *  expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename BinaryFunctorT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan_rows(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op);
+
+/**
+ * \brief Scan the elements over each row of the given matrix expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam BinaryFunctorT The type of the associative binary operation.
+ * \param me The matrix expression whose elements are scanned over each row.
+ * \param op The associative binary operation.
+ * \return The scan of the elements over each row of the given matrix
+ *  expression.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename BinaryFunctorT>
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan_columns(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op);
+
+//@} Declarations
+
+
+namespace detail {
+
+//@{ Declarations
+
+/**
+ * \brief Auxiliary class for scanning in place a vector container.
+ * \tparam Contiguous Tells if the vector container stores its elements in a
+ *  single array.
+ */
+template <bool Contiguous>
+struct scan_vector_inplace_impl;
+
+/**
+ * \brief Auxiliary class for scanning in place a matrix container over the
+ *  given dimension.
+ * \tparam Dim The dimension number (starting from 1).
+ * \tparam Contiguous Tells if the matrix container stores its elements in a
+ *  single array.
+ */
+template <std::size_t Dim, bool Contiguous>
+struct scan_matrix_inplace_impl;
+
+//@} Declarations
+
+
+//@{ Definitions
+
+template <>
+struct scan_vector_inplace_impl<false>
+{
+    template <typename VectorT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(vector_container<VectorT>& v, BinaryFunctorT const& op)
+    {
+        typedef typename vector_traits<VectorT>::size_type size_type;
+
+        size_type n = size(v);
+
+        for (size_type i = 1; i < n; ++i)
+        {
+            v()(i) = op(v()(i-1), v()(i));
+        }
+    }
+};
+
+
+template <>
+struct scan_vector_inplace_impl<true>
+{
+    template <typename VectorT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(vector_container<VectorT>& v, BinaryFunctorT const& op)
+    {
+        typedef typename vector_traits<VectorT>::value_type value_type;
+
+        parallel_scan<value_type>(v().data().begin(), size(v), op);
+    }
+};
+
+
+template <>
+struct scan_matrix_inplace_impl<1, false>
+{
+    template <typename MatrixT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_container<MatrixT>& A, BinaryFunctorT const& op)
+    {
+        typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+        size_type nr = num_rows(A);
+        size_type nc = num_columns(A);
+
+        for (size_type r = 1; r < nr; ++r)
+        {
+            for (size_type c = 0; c < nc; ++c)
+            {
+                A()(r,c) = op(A()(r-1,c), A()(r,c));
+            }
+        }
+    }
+};
+
+
+template <>
+struct scan_matrix_inplace_impl<2, false>
+{
+    template <typename MatrixT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_container<MatrixT>& A, BinaryFunctorT const& op)
+    {
+        typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+        size_type nr = num_rows(A);
+        size_type nc = num_columns(A);
+
+        for (size_type r = 0; r < nr; ++r)
+        {
+            for (size_type c = 1; c < nc; ++c)
+            {
+                A()(r,c) = op(A()(r,c-1), A()(r,c));
+            }
+        }
+    }
+};
+
+
+template <>
+struct scan_matrix_inplace_impl<1, true>
+{
+    template <typename MatrixT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_container<MatrixT>& A, BinaryFunctorT const& op)
+    {
+        typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+        ::std::size_t nr = num_rows(A);
+        ::std::size_t nc = num_columns(A);
+
+        // Each column is a sequence of nr elements
+        if (::boost::is_same<typename matrix_traits<MatrixT>::orientation_category, column_major_tag>::value)
+        {
+            parallel_scan_lines<value_type>(A().data().begin(), nc, nr, nr, 1, op);
+        }
+        else
+        {
+            parallel_scan_lines<value_type>(A().data().begin(), nc, nr, 1, nc, op);
+        }
+    }
+};
+
+
+template <>
+struct scan_matrix_inplace_impl<2, true>
+{
+    template <typename MatrixT, typename BinaryFunctorT>
+    BOOST_UBLAS_INLINE
+    static void apply(matrix_container<MatrixT>& A, BinaryFunctorT const& op)
+    {
+        typedef typename matrix_traits<MatrixT>::value_type value_type;
+
+        ::std::size_t nr = num_rows(A);
+        ::std::size_t nc = num_columns(A);
+
+        // Each row is a sequence of nc elements
+        if (::boost::is_same<typename matrix_traits<MatrixT>::orientation_category, column_major_tag>::value)
+        {
+            parallel_scan_lines<value_type>(A().data().begin(), nr, nc, 1, nr, op);
+        }
+        else
+        {
+            parallel_scan_lines<value_type>(A().data().begin(), nr, nc, nc, 1, op);
+        }
+    }
+};
+
+//@} Definitions
+
+} // Namespace detail
+
+
+//@{ Definitions
+
+template <typename VectorT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+void scan_inplace(vector_container<VectorT>& v, BinaryFunctorT op)
+{
+    detail::scan_vector_inplace_impl<detail::has_contiguous_storage<VectorT>::value>::apply(v, op);
+}
+
+
+template <typename MatrixT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+void scan_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op)
+{
+    scan_rows_inplace(A, op);
+}
+
+
+template <typename MatrixT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+void scan_rows_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op)
+{
+    detail::scan_matrix_inplace_impl<1, detail::has_contiguous_storage<MatrixT>::value>::apply(A, op);
+}
+
+
+template <typename MatrixT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+void scan_columns_inplace(matrix_container<MatrixT>& A, BinaryFunctorT op)
+{
+    detail::scan_matrix_inplace_impl<2, detail::has_contiguous_storage<MatrixT>::value>::apply(A, op);
+}
+
+
+template <typename VectorExprT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+vector<typename vector_traits<VectorExprT>::value_type> scan(vector_expression<VectorExprT> const& ve, BinaryFunctorT op)
+{
+    vector<typename vector_traits<VectorExprT>::value_type> s(ve);
+
+    scan_inplace(s, op);
+
+    return s;
+}
+
+
+template <typename MatrixExprT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op)
+{
+    return scan_rows(me, op);
+}
+
+
+template <typename MatrixExprT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan_rows(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op)
+{
+    matrix<typename matrix_traits<MatrixExprT>::value_type> s(me);
+
+    scan_rows_inplace(s, op);
+
+    return s;
+}
+
+
+template <typename MatrixExprT, typename BinaryFunctorT>
+BOOST_UBLAS_INLINE
+matrix<typename matrix_traits<MatrixExprT>::value_type> scan_columns(matrix_expression<MatrixExprT> const& me, BinaryFunctorT op)
+{
+    matrix<typename matrix_traits<MatrixExprT>::value_type> s(me);
+
+    scan_columns_inplace(s, op);
+
+    return s;
+}
+
+//@} Definitions
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_SCAN_HPP
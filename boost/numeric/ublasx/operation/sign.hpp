@@ -41,6 +41,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <boost/type_traits/is_complex.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <cmath>
@@ -54,35 +55,6 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
-template <typename VectorExprT>
-struct vector_sign_functor_traits
-{
-    typedef VectorExprT input_expression_type;
-    typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
-    typedef typename type_traits<signature_argument_type>::value_type signature_result_type;
-    typedef vector_unary_functor_traits<
-                input_expression_type,
-                signature_result_type (signature_argument_type)
-            > unary_functor_expression_type;
-    typedef typename unary_functor_expression_type::result_type result_type;
-    typedef typename unary_functor_expression_type::expression_type expression_type;
-};
-
-
-template <typename MatrixExprT>
-struct matrix_sign_functor_traits
-{
-    typedef MatrixExprT input_expression_type;
-    typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
-    typedef typename type_traits<signature_argument_type>::value_type signature_result_type;
-    typedef matrix_unary_functor_traits<
-                input_expression_type,
-                signature_result_type (signature_argument_type)
-            > unary_functor_expression_type;
-    typedef typename unary_functor_expression_type::result_type result_type;
-    typedef typename unary_functor_expression_type::expression_type expression_type;
-};
-
 /// Auxiliary function for real types: sign(x) = 1 if x > 0, 0 if x == 0, -1 otherwise.
 template <typename T>
 BOOST_UBLAS_INLINE
@@ -118,6 +90,52 @@ typename ::boost::enable_if<
 //}
 
 
+/// Functor computing the sign of its argument.
+template <typename ArgT, typename ResT>
+struct sign_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return sign_impl<result_type>(x);
+    }
+};
+
+
+template <typename VectorExprT>
+struct vector_sign_functor_traits
+{
+    typedef VectorExprT input_expression_type;
+    typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
+    typedef typename type_traits<signature_argument_type>::value_type signature_result_type;
+    typedef sign_functor<signature_argument_type,signature_result_type> functor_type;
+    typedef vector_unary_functor_traits<
+                input_expression_type,
+                functor_type
+            > unary_functor_expression_type;
+    typedef typename unary_functor_expression_type::result_type result_type;
+    typedef typename unary_functor_expression_type::expression_type expression_type;
+};
+
+
+template <typename MatrixExprT>
+struct matrix_sign_functor_traits
+{
+    typedef MatrixExprT input_expression_type;
+    typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
+    typedef typename type_traits<signature_argument_type>::value_type signature_result_type;
+    typedef sign_functor<signature_argument_type,signature_result_type> functor_type;
+    typedef matrix_unary_functor_traits<
+                input_expression_type,
+                functor_type
+            > unary_functor_expression_type;
+    typedef typename unary_functor_expression_type::result_type result_type;
+    typedef typename unary_functor_expression_type::expression_type expression_type;
+};
+
 } // Namespace detail
 
 
@@ -137,9 +155,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_sign_functor_traits<VectorExprT>::result_type sign(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_sign_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_sign_functor_traits<VectorExprT>::signature_result_type signature_result_type;
+    typedef typename detail::vector_sign_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::sign_impl<signature_result_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -159,11 +177,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_sign_functor_traits<MatrixExprT>::result_type sign(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_sign_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_sign_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_sign_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::sign_impl<signature_result_type>);
+    return expression_type(me(), functor_type());
 }
 
+
+// sign(policy, e), which evaluates sign(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(sign)
+
 }}} // Namespace boost::numeric::ublasx
 
 
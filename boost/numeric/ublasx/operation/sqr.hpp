@@ -23,6 +23,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -31,15 +32,39 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+template <typename T>
+BOOST_UBLAS_INLINE
+T sqr_impl(T x)
+{
+    return x*x;
+}
+
+
+/// Functor computing the square of its argument.
+template <typename ArgT, typename ResT>
+struct sqr_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return sqr_impl<argument_type>(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_sqr_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef sqr_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -52,22 +77,15 @@ struct matrix_sqr_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef sqr_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-template <typename T>
-BOOST_UBLAS_INLINE
-T sqr_impl(T x)
-{
-    return x*x;
-}
-
 } // Namespace detail
 
 
@@ -87,9 +105,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_sqr_functor_traits<VectorExprT>::result_type sqr(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_sqr_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_sqr_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::vector_sqr_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::sqr_impl<signature_argument_type>);
+    return expression_type(ve(), functor_type());
 //  return expression_type(ve(), detail::sqr_impl<signature_result_type>);
 //  typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
 //  fun_ptr_type ptr_sqr_fun(&detail::sqr_impl); 
@@ -113,15 +131,19 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_sqr_functor_traits<MatrixExprT>::result_type sqr(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_sqr_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_sqr_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::matrix_sqr_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::sqr_impl<signature_argument_type>);
+    return expression_type(me(), functor_type());
 //  return expression_type(me(), detail::sqr_impl<signature_result_type>(signature_argument_type));
 //  typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
 //  fun_ptr_type ptr_sqr_fun(&detail::sqr_impl); 
 //  return expression_type(me(), ptr_sqr_fun);
 }
 
+
+// sqr(policy, e), which evaluates sqr(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(sqr)
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -23,6 +23,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 //#include <complex>
 
@@ -33,15 +34,43 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+// Note: this wrapper is needed since we have both templated and non-templated
+//       overloaded versions of the 'sqrt' function.
+//       So whithout this wrapper, the the compiler is not able to infer what
+//       overloaded function to use.
+template <typename T>
+BOOST_UBLAS_INLINE
+T sqrt_impl(T const& x)
+{
+    return ::std::sqrt(x);
+}
+
+
+/// Functor computing the square root of its argument.
+template <typename ArgT, typename ResT>
+struct sqrt_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return sqrt_impl<argument_type>(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_sqrt_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef sqrt_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -54,25 +83,15 @@ struct matrix_sqrt_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef sqrt_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-// Note: this wrapper is needed since we have both templated and non-templated
-//       overloaded versions of the 'sqrt' function.
-//       So whithout this wrapper, the the compiler is not able to infer what
-//       overloaded function to use.
-template <typename T>
-BOOST_UBLAS_INLINE
-T sqrt_impl(T const& x)
-{
-    return ::std::sqrt(x);
-}
-
 } // Namespace detail
 
 
@@ -92,9 +111,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_sqrt_functor_traits<VectorExprT>::result_type sqrt(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_sqrt_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_sqrt_functor_traits<VectorExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::vector_sqrt_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::sqrt_impl<signature_argument_type>);
+    return expression_type(ve(), functor_type());
 //  return expression_type(ve(), ::std::sqrt<signature_argument_type>);
 //  return expression_type(ve(), ::std::sqrt<signature_result_type>);
 //  typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
@@ -120,9 +139,9 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_sqrt_functor_traits<MatrixExprT>::result_type sqrt(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_sqrt_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_sqrt_functor_traits<MatrixExprT>::signature_argument_type signature_argument_type;
+    typedef typename detail::matrix_sqrt_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::sqrt_impl<signature_argument_type>);
+    return expression_type(me(), functor_type());
 //  return expression_type(me(), ::std::sqrt<signature_argument_type>);
 //  return expression_type(me(), ::std::sqrt<signature_result_type>);
 //  typedef signature_result_type(*fun_ptr_type)(signature_argument_type);
@@ -131,6 +150,10 @@ typename detail::matrix_sqrt_functor_traits<MatrixExprT>::result_type sqrt(matri
 //  return expression_type(me(), (signature_result_type (*)(signature_argument_type))&::std::sqrt);
 }
 
+
+// sqrt(policy, e), which evaluates sqrt(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(sqrt)
+
 }}} // Namespace boost::numeric::ublasx
 
 
@@ -29,6 +29,8 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublasx/detail/summation.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
 #include <cstddef>
 
 
@@ -147,11 +149,259 @@ struct sum_by_dim_impl;
 template <typename TagT, typename CategoryT, typename OrientationT>
 struct sum_by_tag_impl;
 
+/// Functor accumulating the visited matrix elements into a single sum.
+template <typename ValueT>
+struct sum_all_accumulator;
+
+/// Functor accumulating each visited matrix element into the sum of its
+/// column.
+template <typename VectorT>
+struct sum_rows_accumulator;
+
+/// Functor accumulating each visited matrix element into the sum of its row.
+template <typename VectorT>
+struct sum_columns_accumulator;
+
+/**
+ * \brief Auxiliary class for computing the sum of all the elements of a vector
+ *  or matrix expression.
+ * \tparam Contiguous Tells if the expression is a dense container whose
+ *  elements can be summed through its storage array.
+ */
+template <bool Contiguous>
+struct sum_all_impl;
+
+/**
+ * \brief Auxiliary class for computing the sum of the elements over each
+ *  column of a matrix expression.
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ * \tparam Contiguous Tells if the matrix expression is a dense container whose
+ *  elements can be summed through its storage array.
+ */
+template <typename OrientationT, bool Contiguous>
+struct sum_rows_impl;
+
+/**
+ * \brief Auxiliary class for computing the sum of the elements over each row
+ *  of a matrix expression.
+ * \tparam OrientationT The orientation category type (e.g., row_major_tag).
+ * \tparam Contiguous Tells if the matrix expression is a dense container whose
+ *  elements can be summed through its storage array.
+ */
+template <typename OrientationT, bool Contiguous>
+struct sum_columns_impl;
+
 //@} Declarations
 
 
 //@{ Definitions
 
+template <typename ValueT>
+struct sum_all_accumulator
+{
+    BOOST_UBLAS_INLINE
+    sum_all_accumulator()
+    : s(0)
+    {
+    }
+
+    template <typename SizeT, typename T>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT, T const& x)
+    {
+        s += x;
+    }
+
+    ValueT s;
+};
+
+
+template <typename VectorT>
+struct sum_rows_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit sum_rows_accumulator(VectorT& s)
+    : s(s)
+    {
+    }
+
+    template <typename SizeT, typename T>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT, SizeT c, T const& x)
+    {
+        s(c) += x;
+    }
+
+    VectorT& s;
+};
+
+
+template <typename VectorT>
+struct sum_columns_accumulator
+{
+    BOOST_UBLAS_INLINE
+    explicit sum_columns_accumulator(VectorT& s)
+    : s(s)
+    {
+    }
+
+    template <typename SizeT, typename T>
+    BOOST_UBLAS_INLINE
+    void operator()(SizeT r, SizeT, T const& x)
+    {
+        s(r) += x;
+    }
+
+    VectorT& s;
+};
+
+
+template <>
+struct sum_all_impl<false>
+{
+    template <typename VectorExprT>
+    BOOST_UBLAS_INLINE
+    static typename vector_traits<VectorExprT>::value_type apply(vector_expression<VectorExprT> const& ve)
+    {
+        return sum(ve);
+    }
+
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static typename matrix_traits<MatrixExprT>::value_type apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+        sum_all_accumulator<value_type> acc;
+        for_each_in_storage_order(me, acc);
+
+        return acc.s;
+    }
+};
+
+
+template <>
+struct sum_all_impl<true>
+{
+    template <typename VectorExprT>
+    BOOST_UBLAS_INLINE
+    static typename vector_traits<VectorExprT>::value_type apply(vector_expression<VectorExprT> const& ve)
+    {
+        typedef typename vector_traits<VectorExprT>::value_type value_type;
+
+        return pairwise_sum<value_type>(ve().data().begin(), ve().size());
+    }
+
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static typename matrix_traits<MatrixExprT>::value_type apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+        size_type n = num_rows(me)*num_columns(me);
+
+        return pairwise_sum<value_type>(me().data().begin(), n);
+    }
+};
+
+
+template <typename OrientationT, bool Contiguous>
+struct sum_rows_impl
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static vector<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef vector<value_type> result_type;
+
+        // Visit the elements in storage order and accumulate each of them
+        // into the output element of its column.
+        result_type s(num_columns(me), value_type(0));
+        sum_rows_accumulator<result_type> acc(s);
+        for_each_in_storage_order(me, acc);
+
+        return s;
+    }
+};
+
+
+template <>
+struct sum_rows_impl<column_major_tag, true>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static vector<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename MatrixExprT::array_type::const_iterator iterator_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        // Each column is stored contiguously
+        vector<value_type> s(nc);
+        iterator_type it = me().data().begin();
+        for (size_type c = 0; c < nc; ++c, it += nr)
+        {
+            s(c) = pairwise_sum<value_type>(it, nr);
+        }
+
+        return s;
+    }
+};
+
+
+template <typename OrientationT, bool Contiguous>
+struct sum_columns_impl
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static vector<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef vector<value_type> result_type;
+
+        // Visit the elements in storage order and accumulate each of them
+        // into the output element of its row.
+        result_type s(num_rows(me), value_type(0));
+        sum_columns_accumulator<result_type> acc(s);
+        for_each_in_storage_order(me, acc);
+
+        return s;
+    }
+};
+
+
+template <>
+struct sum_columns_impl<row_major_tag, true>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static vector<typename matrix_traits<MatrixExprT>::value_type> apply(matrix_expression<MatrixExprT> const& me)
+    {
+        typedef typename matrix_traits<MatrixExprT>::size_type size_type;
+        typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename MatrixExprT::array_type::const_iterator iterator_type;
+
+        size_type nr = num_rows(me);
+        size_type nc = num_columns(me);
+
+        // Each row is stored contiguously
+        vector<value_type> s(nr);
+        iterator_type it = me().data().begin();
+        for (size_type r = 0; r < nr; ++r, it += nc)
+        {
+            s(r) = pairwise_sum<value_type>(it, nc);
+        }
+
+        return s;
+    }
+};
+
+
 template <>
 struct sum_by_dim_impl<1, vector_tag>
 {
@@ -163,7 +413,7 @@ struct sum_by_dim_impl<1, vector_tag>
 
         vector<value_type> res(1);
 
-        res(0) = sum(ve);
+        res(0) = sum_all_impl<has_contiguous_storage<VectorExprT>::value>::apply(ve);
 
         return res;
     }
@@ -303,22 +553,7 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 typename matrix_traits<MatrixExprT>::value_type sum_all(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
-
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    value_type s = 0;
-    for (size_type r = 0; r < nr; ++r)
-    {
-        for (size_type c = 0; c < nc; ++c)
-        {
-            s += me()(r,c);
-        }
-    }
-
-    return s;
+    return detail::sum_all_impl<detail::has_contiguous_storage<MatrixExprT>::value>::apply(me);
 }
 
 
@@ -334,27 +569,10 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> sum_rows(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
-
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> s(nc);
-    size_type j = 0;
-    for (size_type c = 0; c < nc; ++c)
-    {
-        //s(j++) = sum(column(me, c)); //FIXME: don't work
-
-        value_type cs = 0;
-        for (size_type r = 0; r < nr; ++r)
-        {
-            cs += me()(r,c);
-        }
-        s(j++) = cs;
-    }
-
-    return s;
+    return detail::sum_rows_impl<
+                typename matrix_traits<MatrixExprT>::orientation_category,
+                detail::has_contiguous_storage<MatrixExprT>::value
+            >::apply(me);
 }
 
 
@@ -362,27 +580,10 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 vector<typename matrix_traits<MatrixExprT>::value_type> sum_columns(matrix_expression<MatrixExprT> const& me)
 {
-    typedef typename matrix_traits<MatrixExprT>::size_type size_type;
-    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
-
-    size_type nr = num_rows(me);
-    size_type nc = num_columns(me);
-
-    vector<value_type> s(nr);
-    size_type j = 0;
-    for (size_type r = 0; r < nr; ++r)
-    {
-        //s(j++) = sum(row(me, r)); // FIXME don't work
-
-        value_type rs = 0;
-        for (size_type c = 0; c < nc; ++c)
-        {
-            rs += me()(r,c);
-        }
-        s(j++) = rs;
-    }
-
-    return s;
+    return detail::sum_columns_impl<
+                typename matrix_traits<MatrixExprT>::orientation_category,
+                detail::has_contiguous_storage<MatrixExprT>::value
+            >::apply(me);
 }
 
 
@@ -47,19 +47,26 @@
 
 
 #include <algorithm>
+#include <boost/numeric/bindings/lapack/driver/gesdd.hpp>
 #include <boost/numeric/bindings/lapack/driver/gesvd.hpp>
+#include <boost/numeric/bindings/lapack/workspace.hpp>
 #include <boost/numeric/bindings/ublas.hpp>
+#include <boost/numeric/ublas/exception.hpp>
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublasx/detail/lapack.hpp>
 #include <boost/numeric/ublasx/operation/diag.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
 #include <boost/numeric/ublasx/traits/layout_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/type_traits/is_complex.hpp>
 #include <boost/utility/enable_if.hpp>
+#include <complex>
+#include <cstddef>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -67,6 +74,374 @@ namespace boost { namespace numeric { namespace ublasx {
 using namespace ::boost::numeric::ublas;
 
 
+/**
+ * \brief The LAPACK driver used to compute the SVD.
+ *
+ * The QR-iteration driver (\c gesvd) is the most economical one for small
+ * matrices and for computing the singular values only, while the
+ * divide-and-conquer driver (\c gesdd) is typically several times faster
+ * when singular vectors are wanted for large matrices, at the price of a
+ * larger workspace.
+ */
+enum svd_algorithm
+{
+    auto_svd_algorithm, ///< Select the driver by matrix size and by the requested singular vectors.
+    gesvd_svd_algorithm, ///< QR-iteration driver (LAPACK \c gesvd).
+    gesdd_svd_algorithm ///< Divide-and-conquer driver (LAPACK \c gesdd).
+};
+
+
+namespace detail {
+
+/// The minimum value of \f$\min(m,n)\f$ for which \c auto_svd_algorithm
+/// selects \c gesdd.
+static const ::std::size_t svd_gesdd_min_size = 32;
+
+
+/**
+ * \brief Resolve the driver to use for the SVD of a \a m by \a n matrix.
+ *
+ * LAPACK \c gesdd computes either both or none of the sets of singular
+ * vectors, all in full or all in economy mode; for any other combination of
+ * requested singular vectors \c gesvd is used, whatever \a alg is.
+ * \c auto_svd_algorithm selects \c gesdd only when singular vectors are
+ * wanted and \f$\min(m,n)\f$ is at least \c svd_gesdd_min_size, since for
+ * the singular values alone both drivers run the same bidiagonal QR
+ * iteration.
+ */
+inline svd_algorithm select_svd_algorithm(svd_algorithm alg, ::std::size_t m, ::std::size_t n, bool want_U, bool full_U, bool want_VT, bool full_VT)
+{
+    if (want_U != want_VT || (want_U && full_U != full_VT))
+    {
+        return gesvd_svd_algorithm;
+    }
+    if (alg == auto_svd_algorithm)
+    {
+        return (want_U && ::std::min(m, n) >= svd_gesdd_min_size) ? gesdd_svd_algorithm : gesvd_svd_algorithm;
+    }
+    return alg;
+}
+
+
+/// Optimal workspace query of LAPACK \c gesvd for real matrices.
+template <typename ValueT, typename RWorkVectorT>
+void gesvd_query(char jobu, char jobvt, ::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t lda, ::fortran_int_t ldu, ::fortran_int_t ldvt, ValueT* opt_work, RWorkVectorT&, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::detail::gesvd(jobu, jobvt, m, n, 0, lda, 0, 0, ldu, 0, ldvt, opt_work, -1);
+}
+
+
+/// Optimal workspace query of LAPACK \c gesvd for complex matrices.
+template <typename ValueT, typename RWorkVectorT>
+void gesvd_query(char jobu, char jobvt, ::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t lda, ::fortran_int_t ldu, ::fortran_int_t ldvt, ValueT* opt_work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::detail::gesvd(jobu, jobvt, m, n, 0, lda, 0, 0, ldu, 0, ldvt, opt_work, -1, &rwork[0]);
+}
+
+
+/// LAPACK \c gesvd with user-supplied workspace for real matrices.
+template <typename AMatrixT, typename SVectorT, typename UMatrixT, typename VTMatrixT, typename WorkVectorT, typename RWorkVectorT>
+void gesvd(char jobu, char jobvt, AMatrixT& A, SVectorT& s, UMatrixT& U, VTMatrixT& VT, WorkVectorT& work, RWorkVectorT&, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::gesvd(
+        jobu,
+        jobvt,
+        A,
+        s,
+        U,
+        VT,
+        ::boost::numeric::bindings::lapack::workspace(work)
+    );
+}
+
+
+/// LAPACK \c gesvd with user-supplied workspace for complex matrices.
+template <typename AMatrixT, typename SVectorT, typename UMatrixT, typename VTMatrixT, typename WorkVectorT, typename RWorkVectorT>
+void gesvd(char jobu, char jobvt, AMatrixT& A, SVectorT& s, UMatrixT& U, VTMatrixT& VT, WorkVectorT& work, RWorkVectorT& rwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::gesvd(
+        jobu,
+        jobvt,
+        A,
+        s,
+        U,
+        VT,
+        ::boost::numeric::bindings::lapack::workspace(work, rwork)
+    );
+}
+
+
+/// Optimal workspace query of LAPACK \c gesdd for real matrices.
+template <typename ValueT, typename RWorkVectorT, typename IWorkVectorT>
+void gesdd_query(char jobz, ::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t lda, ::fortran_int_t ldu, ::fortran_int_t ldvt, ValueT* opt_work, RWorkVectorT&, IWorkVectorT& iwork, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::detail::gesdd(jobz, m, n, 0, lda, 0, 0, ldu, 0, ldvt, opt_work, -1, &iwork[0]);
+}
+
+
+/// Optimal workspace query of LAPACK \c gesdd for complex matrices.
+template <typename ValueT, typename RWorkVectorT, typename IWorkVectorT>
+void gesdd_query(char jobz, ::fortran_int_t m, ::fortran_int_t n, ::fortran_int_t lda, ::fortran_int_t ldu, ::fortran_int_t ldvt, ValueT* opt_work, RWorkVectorT& rwork, IWorkVectorT& iwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::detail::gesdd(jobz, m, n, 0, lda, 0, 0, ldu, 0, ldvt, opt_work, -1, &rwork[0], &iwork[0]);
+}
+
+
+/// LAPACK \c gesdd with user-supplied workspace for real matrices.
+template <typename AMatrixT, typename SVectorT, typename UMatrixT, typename VTMatrixT, typename WorkVectorT, typename RWorkVectorT, typename IWorkVectorT>
+void gesdd(char jobz, AMatrixT& A, SVectorT& s, UMatrixT& U, VTMatrixT& VT, WorkVectorT& work, RWorkVectorT&, IWorkVectorT& iwork, ::boost::false_type)
+{
+    ::boost::numeric::bindings::lapack::gesdd(
+        jobz,
+        A,
+        s,
+        U,
+        VT,
+        ::boost::numeric::bindings::lapack::workspace(work, iwork)
+    );
+}
+
+
+/// LAPACK \c gesdd with user-supplied workspace for complex matrices.
+template <typename AMatrixT, typename SVectorT, typename UMatrixT, typename VTMatrixT, typename WorkVectorT, typename RWorkVectorT, typename IWorkVectorT>
+void gesdd(char jobz, AMatrixT& A, SVectorT& s, UMatrixT& U, VTMatrixT& VT, WorkVectorT& work, RWorkVectorT& rwork, IWorkVectorT& iwork, ::boost::true_type)
+{
+    ::boost::numeric::bindings::lapack::gesdd(
+        jobz,
+        A,
+        s,
+        U,
+        VT,
+        ::boost::numeric::bindings::lapack::workspace(work, rwork, iwork)
+    );
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Workspace for the SVD drivers.
+ *
+ * Owns the work arrays needed by LAPACK \c gesvd and \c gesdd together with
+ * the scratch matrices used to hold a copy of the input matrix (which is
+ * overwritten by LAPACK) and, for row-major or unwanted outputs, the singular
+ * vectors.
+ * The optimal size of the work arrays is queried (\c lwork=-1) only when the
+ * problem size, the kind of requested singular vectors or the driver change,
+ * so that repeated decompositions of same-sized matrices do not allocate
+ * memory.
+ *
+ * \tparam ValueT The type of the elements of the matrices to decompose.
+ */
+template <typename ValueT>
+class svd_workspace
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef ::std::size_t size_type;
+    public: typedef matrix<value_type, column_major> work_matrix_type;
+    public: typedef vector<value_type> work_vector_type;
+    public: typedef vector<real_type> real_work_vector_type;
+    public: typedef vector< ::fortran_int_t > integer_work_vector_type;
+
+
+    /// Default constructor.
+    public: svd_workspace()
+        : m_(0),
+          n_(0),
+          jobu_('N'),
+          jobvt_('N'),
+          alg_(gesvd_svd_algorithm),
+          queried_(false)
+    {
+    }
+
+
+    /// Create a workspace for the full SVD of \a m by \a n matrices computed
+    /// by the given driver.
+    public: svd_workspace(size_type m, size_type n, svd_algorithm alg = auto_svd_algorithm)
+        : m_(0),
+          n_(0),
+          jobu_('N'),
+          jobvt_('N'),
+          alg_(gesvd_svd_algorithm),
+          queried_(false)
+    {
+        resize(m, n, 'A', 'A', detail::select_svd_algorithm(alg, m, n, true, true, true, true));
+    }
+
+
+    /**
+     * \brief Prepare the workspace for the SVD of \a m by \a n matrices.
+     *
+     * \param m The number of rows of the matrix to decompose.
+     * \param n The number of columns of the matrix to decompose.
+     * \param jobu The LAPACK option for the left singular vectors (i.e., 'A',
+     *  'S' or 'N').
+     * \param jobvt The LAPACK option for the right singular vectors (i.e.,
+     *  'A', 'S' or 'N').
+     * \param alg The driver, either \c gesvd_svd_algorithm or
+     *  \c gesdd_svd_algorithm; in the latter case \a jobu and \a jobvt must
+     *  be equal.
+     */
+    public: void resize(size_type m, size_type n, char jobu, char jobvt, svd_algorithm alg = gesvd_svd_algorithm)
+    {
+        BOOST_UBLAS_CHECK( alg != auto_svd_algorithm, bad_argument() );
+        BOOST_UBLAS_CHECK( alg != gesdd_svd_algorithm || jobu == jobvt, bad_argument() );
+
+        if (queried_ && m == m_ && n == n_ && jobu == jobu_ && jobvt == jobvt_ && alg == alg_)
+        {
+            return;
+        }
+
+        const size_type k = ::std::min(m, n);
+        const size_type mx = ::std::max(m, n);
+
+        ::fortran_int_t ldu = 1;
+        if (jobu == 'A' || jobu == 'S')
+        {
+            ldu = static_cast< ::fortran_int_t >(::std::max(m, size_type(1)));
+        }
+        ::fortran_int_t ldvt = 1;
+        if (jobvt == 'A')
+        {
+            ldvt = static_cast< ::fortran_int_t >(::std::max(n, size_type(1)));
+        }
+        else if (jobvt == 'S')
+        {
+            ldvt = static_cast< ::fortran_int_t >(::std::max(k, size_type(1)));
+        }
+
+        value_type opt_work = 0;
+        if (alg == gesdd_svd_algorithm)
+        {
+            if (::boost::is_complex<value_type>::value)
+            {
+                size_type nrwork = 7*k;
+                if (jobu != 'N')
+                {
+                    nrwork = ::std::max(5*k*k+7*k, 2*mx*k+2*k*k+k);
+                }
+                rwork_.resize(::std::max(nrwork, size_type(1)), false);
+            }
+            iwork_.resize(::std::max(8*k, size_type(1)), false);
+
+            detail::gesdd_query(jobu,
+                                static_cast< ::fortran_int_t >(m),
+                                static_cast< ::fortran_int_t >(n),
+                                static_cast< ::fortran_int_t >(::std::max(m, size_type(1))),
+                                ldu,
+                                ldvt,
+                                &opt_work,
+                                rwork_,
+                                iwork_,
+                                ::boost::is_complex<value_type>());
+        }
+        else
+        {
+            if (::boost::is_complex<value_type>::value)
+            {
+                rwork_.resize(::std::max(5*k, size_type(1)), false);
+            }
+
+            detail::gesvd_query(jobu,
+                                jobvt,
+                                static_cast< ::fortran_int_t >(m),
+                                static_cast< ::fortran_int_t >(n),
+                                static_cast< ::fortran_int_t >(::std::max(m, size_type(1))),
+                                ldu,
+                                ldvt,
+                                &opt_work,
+                                rwork_,
+                                ::boost::is_complex<value_type>());
+        }
+        work_.resize(::std::max(static_cast<size_type>(::std::real(opt_work)), size_type(1)), false);
+
+        m_ = m;
+        n_ = n;
+        jobu_ = jobu;
+        jobvt_ = jobvt;
+        alg_ = alg;
+        queried_ = true;
+    }
+
+
+    /// Return the driver this workspace is prepared for.
+    public: svd_algorithm algorithm() const
+    {
+        return alg_;
+    }
+
+
+    /// Return the scratch matrix for the copy of the matrix to decompose.
+    public: work_matrix_type& work_matrix()
+    {
+        return A_;
+    }
+
+
+    /// Return the scratch matrix for the left singular vectors.
+    public: work_matrix_type& U()
+    {
+        return U_;
+    }
+
+
+    /// Return the scratch matrix for the right singular vectors.
+    public: work_matrix_type& VT()
+    {
+        return VT_;
+    }
+
+
+    /// Return the work array.
+    public: work_vector_type& work()
+    {
+        return work_;
+    }
+
+
+    /// Return the real work array (used for complex matrices only).
+    public: real_work_vector_type& rwork()
+    {
+        return rwork_;
+    }
+
+
+    /// Return the integer work array (used by \c gesdd only).
+    public: integer_work_vector_type& iwork()
+    {
+        return iwork_;
+    }
+
+
+    /// The number of rows of the matrices this workspace is prepared for.
+    private: size_type m_;
+    /// The number of columns of the matrices this workspace is prepared for.
+    private: size_type n_;
+    /// The option for the left singular vectors this workspace is prepared for.
+    private: char jobu_;
+    /// The option for the right singular vectors this workspace is prepared for.
+    private: char jobvt_;
+    /// The driver this workspace is prepared for.
+    private: svd_algorithm alg_;
+    /// Tell if the optimal workspace size has been queried.
+    private: bool queried_;
+    /// The scratch matrix for the copy of the matrix to decompose.
+    private: work_matrix_type A_;
+    /// The scratch matrix for the left singular vectors.
+    private: work_matrix_type U_;
+    /// The scratch matrix for the right singular vectors.
+    private: work_matrix_type VT_;
+    /// The work array.
+    private: work_vector_type work_;
+    /// The real work array.
+    private: real_work_vector_type rwork_;
+    /// The integer work array.
+    private: integer_work_vector_type iwork_;
+};
+
+
 namespace detail {
 
 template <
@@ -75,11 +450,11 @@ template <
     typename UMatrixT,
     typename VTMatrixT
 >
-void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT& U, bool want_VT, bool full_VT, VTMatrixT& VT, column_major_tag)
+void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT& U, bool want_VT, bool full_VT, VTMatrixT& VT, svd_algorithm alg, svd_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, column_major_tag)
 {
     typedef typename matrix_traits<AMatrixT>::value_type value_type;
     typedef typename matrix_traits<AMatrixT>::size_type size_type;
-    typedef matrix<value_type, column_major> work_matrix_type;
+    typedef typename svd_workspace<value_type>::work_matrix_type work_matrix_type;
 
     char jobu = 'N';
     char jobvt = 'N';
@@ -133,16 +508,26 @@ void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT
         VT.resize(VT_nr, VT_nc, false);
     }
 
-    work_matrix_type tmp_A(A);
+    alg = select_svd_algorithm(alg, m, n, want_U, full_U, want_VT, full_VT);
 
-    ::boost::numeric::bindings::lapack::gesvd(
-        jobu,
-        jobvt,
-        tmp_A,
-        s,
-        U,
-        VT
-    );
+    ws.resize(m, n, jobu, jobvt, alg);
+
+    // LAPACK GESVD and GESDD overwrite the input matrix
+    work_matrix_type& tmp_A = ws.work_matrix();
+    if (num_rows(tmp_A) != m || num_columns(tmp_A) != n)
+    {
+        tmp_A.resize(m, n, false);
+    }
+    noalias(tmp_A) = A;
+
+    if (alg == gesdd_svd_algorithm)
+    {
+        detail::gesdd(jobu, tmp_A, s, U, VT, ws.work(), ws.rwork(), ws.iwork(), ::boost::is_complex<value_type>());
+    }
+    else
+    {
+        detail::gesvd(jobu, jobvt, tmp_A, s, U, VT, ws.work(), ws.rwork(), ::boost::is_complex<value_type>());
+    }
 }
 
 
@@ -152,28 +537,46 @@ template <
     typename UMatrixT,
     typename VTMatrixT
 >
-void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT& U, bool want_VT, bool full_VT, VTMatrixT& VT, row_major_tag)
+void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT& U, bool want_VT, bool full_VT, VTMatrixT& VT, svd_algorithm alg, svd_workspace<typename matrix_traits<AMatrixT>::value_type>& ws, row_major_tag)
 {
-    typedef typename matrix_traits<AMatrixT>::value_type value_type;
-    typedef matrix<value_type, column_major> colmaj_matrix_type;
-
-    colmaj_matrix_type tmp_A(A);
-    colmaj_matrix_type tmp_U;
-    colmaj_matrix_type tmp_VT;
-
-    svd_impl(tmp_A, s, want_U, full_U, tmp_U, want_VT, full_VT, tmp_VT, column_major_tag());
+    svd_impl(A, s, want_U, full_U, ws.U(), want_VT, full_VT, ws.VT(), alg, ws, column_major_tag());
 
     if (want_U)
     {
-        U = tmp_U;
+        if (num_rows(U) != num_rows(ws.U()) || num_columns(U) != num_columns(ws.U()))
+        {
+            U.resize(num_rows(ws.U()), num_columns(ws.U()), false);
+        }
+        noalias(U) = ws.U();
     }
     if (want_VT)
     {
-        VT = tmp_VT;
+        if (num_rows(VT) != num_rows(ws.VT()) || num_columns(VT) != num_columns(ws.VT()))
+        {
+            VT.resize(num_rows(ws.VT()), num_columns(ws.VT()), false);
+        }
+        noalias(VT) = ws.VT();
     }
 }
 
 
+template <
+    typename AMatrixT,
+    typename SVectorT,
+    typename UMatrixT,
+    typename VTMatrixT,
+    typename OrientationT
+>
+void svd_impl(AMatrixT const& A, SVectorT& s, bool want_U, bool full_U, UMatrixT& U, bool want_VT, bool full_VT, VTMatrixT& VT, svd_algorithm alg, OrientationT orientation)
+{
+    typedef typename matrix_traits<AMatrixT>::value_type value_type;
+
+    svd_workspace<value_type> ws;
+
+    svd_impl(A, s, want_U, full_U, U, want_VT, full_VT, VT, alg, ws, orientation);
+}
+
+
 template <typename MatrixT>
 typename ::boost::enable_if<
     ::boost::is_complex<typename matrix_traits<MatrixT>::value_type>,
@@ -217,6 +620,9 @@ typename ::boost::disable_if<
  * that, if \f$k=\min(m.n)\f$, \f$\Sigma\f$ is a k-by-k diagonal matrix,
  * \f$U\f$ is an m-by-k unitary matrix and \f$V\f$ is an n-by-k unitary matrix.
  *
+ * The LAPACK driver is chosen by means of an \c svd_algorithm value; by
+ * default it is selected automatically (see \c auto_svd_algorithm).
+ *
  * \author Marco Guazzone, marco.guazzoe@gmail.com
  */
 template <typename ValueT>
@@ -242,15 +648,15 @@ class svd_decomposition
 
     /// A constructor.
     public: template <typename MatrixExprT>
-        svd_decomposition(matrix_expression<MatrixExprT> const& A, bool full = true)
+        svd_decomposition(matrix_expression<MatrixExprT> const& A, bool full = true, svd_algorithm alg = auto_svd_algorithm)
     {
-        decompose(A, full);
+        decompose(A, full, alg);
     }
 
 
     /// Compute the SVD \f$A=U \Sigma V^H\f$
     public: template <typename MatrixExprT>
-        void decompose(matrix_expression<MatrixExprT> const& A, bool full = true)
+        void decompose(matrix_expression<MatrixExprT> const& A, bool full = true, svd_algorithm alg = auto_svd_algorithm)
     {
         // Cache some values (useful for later info retrieval)
         full_ = full;
@@ -258,7 +664,7 @@ class svd_decomposition
         n_ = num_columns(A);
         k_ = ::std::min(m_, n_);
 
-        detail::svd_impl(A(), s_, true, full, U_, true, full, VH_, column_major_tag());
+        detail::svd_impl(A(), s_, true, full, U_, true, full, VH_, alg, ws_, column_major_tag());
     }
 
 
@@ -380,16 +786,18 @@ class svd_decomposition
     private: matrix_type U_;
     /// The matrix containing the right singular vectors.
     private: matrix_type VH_;
+    /// The workspace reused by subsequent decompositions.
+    private: svd_workspace<value_type> ws_;
 };
 
 
-/// Compute the singular values of matrix \a A.
+/// Compute the singular values of matrix \a A by means of the given driver.
 template <typename MatrixExprT>
 vector<
     typename type_traits<
         typename matrix_traits<MatrixExprT>::value_type
     >::real_type
-> svd_values(matrix_expression<MatrixExprT> const& A)
+> svd_values(matrix_expression<MatrixExprT> const& A, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
@@ -402,19 +810,34 @@ vector<
     work_matrix_type dummy_U;
     work_matrix_type dummy_VT;
 
-    detail::svd_impl(A(), s, false, false, dummy_U, false, false, dummy_VT, orientation_category());
+    detail::svd_impl(A(), s, false, false, dummy_U, false, false, dummy_VT, alg, orientation_category());
 
     return s;
 }
 
 
-/// Compute the singular value decomposition of matrix \a A.
+/**
+ * \brief Compute the singular values of matrix \a A by means of the given
+ *  workspace.
+ *
+ * No memory is allocated when the workspace and the output vector \a s are
+ * already sized for a matrix with the same size of \a A.
+ */
+template <typename MatrixExprT, typename VectorT>
+void svd_values(matrix_expression<MatrixExprT> const& A, vector_container<VectorT>& s, svd_workspace<typename matrix_traits<MatrixExprT>::value_type>& ws, svd_algorithm alg = auto_svd_algorithm)
+{
+    detail::svd_impl(A(), s(), false, false, ws.U(), false, false, ws.VT(), alg, ws, column_major_tag());
+}
+
+
+/// Compute the singular value decomposition of matrix \a A by means of the
+/// given driver.
 template <typename MatrixExprT>
-svd_decomposition<typename matrix_traits<MatrixExprT>::value_type> svd_decompose(matrix_expression<MatrixExprT> const& A, bool full = true)
+svd_decomposition<typename matrix_traits<MatrixExprT>::value_type> svd_decompose(matrix_expression<MatrixExprT> const& A, bool full = true, svd_algorithm alg = auto_svd_algorithm)
 {
     typedef typename matrix_traits<MatrixExprT>::value_type value_type;
 
-    return svd_decomposition<value_type>(A, full);
+    return svd_decomposition<value_type>(A, full, alg);
 }
 
 }}} // Namespace boost::numeric::ublasx
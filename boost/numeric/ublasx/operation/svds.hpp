@@ -0,0 +1,626 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file boost/numeric/ublasx/operation/svds.hpp
+ *
+ * \brief Truncated Singular Value Decomposition.
+ *
+ * The <em>truncated singular value decomposition</em> of rank \f$k\f$ of a
+ * m-by-n real/complex matrix \f$A\f$ is:
+ * \f[
+ *   A_k = U_k \Sigma_k V_k^{H}
+ * \f]
+ * where \f$\Sigma_k\f$ is the k-by-k diagonal matrix of the \f$k\f$ largest
+ * singular values of \f$A\f$ (in descending order), and \f$U_k\f$ and
+ * \f$V_k\f$ are the m-by-k and n-by-k matrices of the associated left and
+ * right singular vectors.
+ * \f$A_k\f$ is the best rank-\f$k\f$ approximation of \f$A\f$ in both the
+ * 2-norm and the Frobenius norm.
+ *
+ * The leading singular triplets are approximated without computing the whole
+ * SVD, by projecting \f$A\f$ onto a subspace of dimension \f$l=k+p\f$ (where
+ * \f$p\f$ is the <em>oversampling</em>) and computing the SVD of the small
+ * projected matrix.
+ * Two methods are available to build the subspace:
+ * - the <em>randomized range finder</em> (Halko, Martinsson and Tropp), which
+ *   orthonormalizes \f$(AA^H)^q A \Omega\f$ for a random n-by-l Gaussian
+ *   matrix \f$\Omega\f$ and \f$q\f$ <em>power iterations</em>;
+ * - the <em>Golub-Kahan-Lanczos bidiagonalization</em> with full
+ *   reorthogonalization, which builds the Krylov subspaces generated by
+ *   \f$AA^H\f$ and \f$A^HA\f$ starting from a random vector.
+ *
+ * The matrix \f$A\f$ is only accessed through matrix-vector products with
+ * \f$A\f$ and \f$A^H\f$, so that it can be any matrix expression, including
+ * sparse matrices.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_OPERATION_SVDS_HPP
+#define BOOST_NUMERIC_UBLASX_OPERATION_SVDS_HPP
+
+
+#include <algorithm>
+#include <boost/numeric/ublas/expression_types.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/operation.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublas/vector_proxy.hpp>
+#include <boost/numeric/ublasx/operation/diag.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qr.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/operation/svd.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/normal_distribution.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_complex.hpp>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+using namespace ::boost::numeric::ublas;
+
+
+/// The methods to build the subspace the truncated SVD is computed on.
+enum svds_method
+{
+    randomized_svds_method, ///< Randomized range finder with power iterations.
+    lanczos_svds_method ///< Golub-Kahan-Lanczos bidiagonalization.
+};
+
+
+namespace detail {
+
+/// Draw a sample of the standard normal distribution (real case).
+template <typename ValueT, typename RNGT>
+ValueT svds_randn(RNGT& rng, ::boost::false_type)
+{
+    ::boost::random::normal_distribution<ValueT> dist;
+
+    return dist(rng);
+}
+
+
+/// Draw a sample of the standard complex normal distribution (complex case).
+template <typename ValueT, typename RNGT>
+ValueT svds_randn(RNGT& rng, ::boost::true_type)
+{
+    typedef typename type_traits<ValueT>::real_type real_type;
+
+    ::boost::random::normal_distribution<real_type> dist;
+
+    real_type re = dist(rng);
+    real_type im = dist(rng);
+
+    return ValueT(re, im);
+}
+
+
+/// Fill matrix \a X with samples of the standard normal distribution.
+template <typename MatrixT, typename RNGT>
+void svds_randn(MatrixT& X, RNGT& rng)
+{
+    typedef typename matrix_traits<MatrixT>::value_type value_type;
+    typedef typename matrix_traits<MatrixT>::size_type size_type;
+
+    for (size_type j = 0; j < num_columns(X); ++j)
+    {
+        for (size_type i = 0; i < num_rows(X); ++i)
+        {
+            X(i,j) = svds_randn<value_type>(rng, ::boost::is_complex<value_type>());
+        }
+    }
+}
+
+
+/**
+ * \brief Compute \f$Y = M X\f$ for a row-major matrix \a M.
+ *
+ * Each element of \f$Y\f$ is the inner product of a row of \a M with a
+ * column of \a X, so that \a M is traversed in its storage order.
+ */
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT, typename OrientationT>
+void svds_prod(MatrixExprT const& M, XMatrixT const& X, YMatrixT& Y, OrientationT)
+{
+    noalias(Y) = prod(M, X);
+}
+
+
+/**
+ * \brief Compute \f$Y = M X\f$ for a column-major matrix \a M.
+ *
+ * \f$Y\f$ is accumulated with the outer products of the columns of \a M
+ * with the rows of \a X, so that \a M is traversed in its storage order.
+ */
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT>
+void svds_prod(MatrixExprT const& M, XMatrixT const& X, YMatrixT& Y, column_major_tag)
+{
+    axpy_prod(M, X, Y, true);
+}
+
+
+/// Compute \f$Y = M X\f$ by traversing \a M in its storage order.
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT>
+void svds_prod(MatrixExprT const& M, XMatrixT const& X, YMatrixT& Y)
+{
+    typedef typename matrix_traits<MatrixExprT>::orientation_category orientation_category;
+
+    svds_prod(M, X, Y, orientation_category());
+}
+
+
+/// Compute \f$Y = A^H X\f$ (real case).
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT>
+void svds_prod_herm(MatrixExprT const& A, XMatrixT const& X, YMatrixT& Y, ::boost::false_type)
+{
+    svds_prod(trans(A), X, Y);
+}
+
+
+/// Compute \f$Y = A^H X\f$ (complex case).
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT>
+void svds_prod_herm(MatrixExprT const& A, XMatrixT const& X, YMatrixT& Y, ::boost::true_type)
+{
+    svds_prod(herm(A), X, Y);
+}
+
+
+/// Compute \f$Y = A^H X\f$.
+template <typename MatrixExprT, typename XMatrixT, typename YMatrixT>
+void svds_prod_herm(MatrixExprT const& A, XMatrixT const& X, YMatrixT& Y)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    svds_prod_herm(A, X, Y, ::boost::is_complex<value_type>());
+}
+
+
+/**
+ * \brief Orthogonalize vector \a x against the first \a j columns of \a Q
+ *  (which must be orthonormal).
+ *
+ * Classical Gram-Schmidt is applied twice, which is enough to keep the
+ * orthogonality to the working precision.
+ * The first \a j elements of \a h are used as scratch space.
+ */
+template <typename MatrixT, typename VectorT, typename WorkVectorT>
+void svds_orthogonalize(MatrixT const& Q, ::std::size_t j, VectorT& x, WorkVectorT& h)
+{
+    if (j == 0)
+    {
+        return;
+    }
+
+    const ::std::size_t m = num_rows(Q);
+    vector_range<WorkVectorT> hj(h, range(0, j));
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        noalias(hj) = prod(herm(subrange(Q, 0, m, 0, j)), x);
+        noalias(x) -= prod(subrange(Q, 0, m, 0, j), hj);
+    }
+}
+
+
+/**
+ * \brief Overwrite vector \a x with a random unit vector orthogonal to the
+ *  first \a j columns of \a Q (which must be orthonormal).
+ */
+template <typename MatrixT, typename VectorT, typename WorkVectorT, typename RNGT>
+void svds_random_orthonormal(MatrixT const& Q, ::std::size_t j, VectorT& x, WorkVectorT& h, RNGT& rng)
+{
+    typedef typename vector_traits<VectorT>::value_type value_type;
+    typedef typename vector_traits<VectorT>::size_type size_type;
+
+    for (size_type i = 0; i < size(x); ++i)
+    {
+        x(i) = svds_randn<value_type>(rng, ::boost::is_complex<value_type>());
+    }
+    svds_orthogonalize(Q, j, x, h);
+    x /= norm_2(x);
+}
+
+} // Namespace detail
+
+
+/**
+ * \brief Computes the truncated singular value decomposition of a matrix.
+ *
+ * Computes an approximation of the \f$k\f$ largest singular values of a
+ * m-by-n matrix \f$A\f$, together with the associated left and right
+ * singular vectors, such that:
+ * \f[
+ *   A \approx U \Sigma V^{H}
+ * \f]
+ * where \f$U\f$ is a m-by-k matrix, \f$\Sigma\f$ is a k-by-k diagonal matrix,
+ * and \f$V\f$ is a n-by-k matrix.
+ *
+ * The accuracy of the approximation increases with the oversampling (the
+ * number of extra dimensions of the subspace the SVD is computed on) and, for
+ * the randomized method, with the number of power iterations; it is exact
+ * (to the working precision) when \f$k\f$ plus the oversampling is not less
+ * than \f$\min(m,n)\f$ or the rank of \f$A\f$.
+ * The random numbers are drawn from a generator seeded at each decomposition
+ * with the given seed, so that repeated decompositions give the same result.
+ *
+ * \tparam ValueT The type of the elements of the matrix to decompose.
+ */
+template <typename ValueT>
+class svds_decomposition
+{
+    public: typedef ValueT value_type;
+    public: typedef typename type_traits<value_type>::real_type real_type;
+    public: typedef vector<real_type> vector_type;
+    public: typedef matrix<value_type, column_major> matrix_type;
+    public: typedef matrix<real_type, column_major> real_matrix_type;
+    public: typedef ::std::size_t size_type;
+    private: typedef vector<value_type> work_vector_type;
+    private: typedef ::boost::random::mt19937 random_generator_type;
+
+
+    /// Default constructor
+    public: svds_decomposition()
+        : oversampling_(10),
+          power_iterations_(2),
+          seed_(5489UL)
+    {
+    }
+
+
+    /// A constructor.
+    public: template <typename MatrixExprT>
+        svds_decomposition(matrix_expression<MatrixExprT> const& A, size_type k, svds_method method = randomized_svds_method)
+        : oversampling_(10),
+          power_iterations_(2),
+          seed_(5489UL)
+    {
+        decompose(A, k, method);
+    }
+
+
+    /// Set the number of extra dimensions of the subspace the SVD is computed
+    /// on (default: 10).
+    public: void oversampling(size_type p)
+    {
+        oversampling_ = p;
+    }
+
+
+    /// Return the number of extra dimensions of the subspace the SVD is
+    /// computed on.
+    public: size_type oversampling() const
+    {
+        return oversampling_;
+    }
+
+
+    /// Set the number of power iterations of the randomized method (default:
+    /// 2).
+    public: void power_iterations(size_type q)
+    {
+        power_iterations_ = q;
+    }
+
+
+    /// Return the number of power iterations of the randomized method.
+    public: size_type power_iterations() const
+    {
+        return power_iterations_;
+    }
+
+
+    /// Set the seed of the random number generator.
+    public: void seed(unsigned long s)
+    {
+        seed_ = s;
+    }
+
+
+    /// Return the seed of the random number generator.
+    public: unsigned long seed() const
+    {
+        return seed_;
+    }
+
+
+    /**
+     * \brief Compute the truncated SVD \f$A \approx U \Sigma V^H\f$ of rank
+     *  \a k.
+     *
+     * \param A The matrix to decompose.
+     * \param k The number of singular triplets to compute; it is reduced to
+     *  \f$\min(m,n)\f$ if greater.
+     * \param method The method used to build the subspace the SVD is computed
+     *  on.
+     */
+    public: template <typename MatrixExprT>
+        void decompose(matrix_expression<MatrixExprT> const& A, size_type k, svds_method method = randomized_svds_method)
+    {
+        const size_type m = num_rows(A);
+        const size_type n = num_columns(A);
+        const size_type r = ::std::min(m, n);
+
+        k = ::std::min(k, r);
+
+        if (k == 0)
+        {
+            s_.resize(0, false);
+            U_.resize(m, 0, false);
+            VH_.resize(0, n, false);
+            return;
+        }
+
+        const size_type l = ::std::min(k+oversampling_, r);
+
+        rng_.seed(static_cast<random_generator_type::result_type>(seed_));
+
+        if (method == lanczos_svds_method)
+        {
+            lanczos(A(), l);
+        }
+        else
+        {
+            randomized(A(), l);
+        }
+
+        // Truncate the SVD of the projected matrix and lift it to the
+        // original spaces
+        matrix_type const& small_U = small_svd_.U();
+        matrix_type const& small_VH = small_svd_.VH();
+
+        s_ = subrange(small_svd_.s(), 0, k);
+        U_.resize(m, k, false);
+        noalias(U_) = prod(Q_, subrange(small_U, 0, num_rows(small_U), 0, k));
+        VH_.resize(k, n, false);
+        if (method == lanczos_svds_method)
+        {
+            noalias(VH_) = prod(subrange(small_VH, 0, k, 0, l), herm(Z_));
+        }
+        else
+        {
+            noalias(VH_) = subrange(small_VH, 0, k, 0, n);
+        }
+    }
+
+
+    /// Return the U matrix of the truncated SVD \f$U \Sigma V^H\f$.
+    public: matrix_type const& U() const
+    {
+        return U_;
+    }
+
+
+    /// Return the \f$\operatorname{diag}(\Sigma)\f$ vector of the truncated
+    /// SVD \f$U \Sigma V^H\f$.
+    public: vector_type const& s() const
+    {
+        return s_;
+    }
+
+
+    /// Return the \f$\Sigma\f$ matrix of the truncated SVD
+    /// \f$U \Sigma V^H\f$.
+    public: real_matrix_type S() const
+    {
+        return diag<vector_type,column_major>(s_, size(s_), size(s_));
+    }
+
+
+    /// Return the \f$V^H\f$ matrix (\f$V^T\f$ for real types) of the
+    /// truncated SVD \f$U \Sigma V^H\f$.
+    public: matrix_type const& VH() const
+    {
+        return VH_;
+    }
+
+
+    /// Return the \f$V\f$ matrix of the truncated SVD \f$U \Sigma V^H\f$.
+    public: matrix_type V() const
+    {
+        return detail::make_V(VH_);
+    }
+
+
+    /**
+     * \brief Randomized range finder.
+     *
+     * On exit, \c Q_ is a m-by-l orthonormal basis of the range of
+     * \f$(AA^H)^q A \Omega\f$ and \c small_svd_ holds the SVD of
+     * \f$Q^H A\f$.
+     */
+    private: template <typename MatrixExprT>
+        void randomized(MatrixExprT const& A, size_type l)
+    {
+        const size_type m = num_rows(A);
+        const size_type n = num_columns(A);
+
+        Z_.resize(n, l, false);
+        Y_.resize(m, l, false);
+
+        detail::svds_randn(Z_, rng_);
+        detail::svds_prod(A, Z_, Y_);
+        qr_decompose(Y_, Q_, R_, false, qr_ws_);
+        for (size_type i = 0; i < power_iterations_; ++i)
+        {
+            detail::svds_prod_herm(A, Q_, Z_);
+            qr_decompose(Z_, W_, R_, false, qr_ws_);
+            detail::svds_prod(A, W_, Y_);
+            qr_decompose(Y_, Q_, R_, false, qr_ws_);
+        }
+
+        // Q^H A = (A^H Q)^H
+        detail::svds_prod_herm(A, Q_, Z_);
+        small_svd_.decompose(herm(Z_), false);
+    }
+
+
+    /**
+     * \brief Golub-Kahan-Lanczos bidiagonalization with full
+     *  reorthogonalization.
+     *
+     * On exit, \c Q_ and \c Z_ are the m-by-l and n-by-l orthonormal bases
+     * such that \f$A Z = Q B\f$, with \f$B\f$ upper bidiagonal, and
+     * \c small_svd_ holds the SVD of \f$B\f$.
+     * When an invariant subspace is found, the process is continued with a
+     * random vector orthogonal to the current basis.
+     */
+    private: template <typename MatrixExprT>
+        void lanczos(MatrixExprT const& A, size_type l)
+    {
+        const size_type m = num_rows(A);
+        const size_type n = num_columns(A);
+        const real_type eps = ::std::numeric_limits<real_type>::epsilon();
+
+        Q_.resize(m, l, false);
+        Z_.resize(n, l, false);
+        R_.resize(l, l, false);
+        R_.clear();
+        if (size(h_) < l)
+        {
+            h_.resize(l, false);
+        }
+
+        real_type anorm = 0;
+
+        if (l > 0)
+        {
+            matrix_column<matrix_type> v0(Z_, 0);
+            detail::svds_random_orthonormal(Z_, 0, v0, h_, rng_);
+        }
+        for (size_type j = 0; j < l; ++j)
+        {
+            matrix_column<matrix_type> u(Q_, j);
+            matrix_column<matrix_type> v(Z_, j);
+            // The same columns seen as matrices, for the products with A
+            matrix_range<matrix_type> Uj(Q_, range(0, m), range(j, j+1));
+            matrix_range<matrix_type> Vj(Z_, range(0, n), range(j, j+1));
+
+            // u_j = A v_j - beta_{j-1} u_{j-1}
+            detail::svds_prod(A, Vj, Uj);
+            if (j > 0)
+            {
+                noalias(u) -= R_(j-1,j)*column(Q_, j-1);
+            }
+            detail::svds_orthogonalize(Q_, j, u, h_);
+            real_type alpha = norm_2(u);
+            anorm = ::std::max(anorm, alpha);
+            if (alpha <= eps*anorm)
+            {
+                alpha = 0;
+                detail::svds_random_orthonormal(Q_, j, u, h_, rng_);
+            }
+            else
+            {
+                u /= alpha;
+            }
+            R_(j,j) = alpha;
+
+            if (j+1 < l)
+            {
+                // v_{j+1} = A^H u_j - alpha_j v_j
+                matrix_column<matrix_type> w(Z_, j+1);
+                matrix_range<matrix_type> Wj(Z_, range(0, n), range(j+1, j+2));
+
+                detail::svds_prod_herm(A, Uj, Wj);
+                noalias(w) -= alpha*v;
+                detail::svds_orthogonalize(Z_, j+1, w, h_);
+                real_type beta = norm_2(w);
+                anorm = ::std::max(anorm, beta);
+                if (beta <= eps*anorm)
+                {
+                    beta = 0;
+                    detail::svds_random_orthonormal(Z_, j+1, w, h_, rng_);
+                }
+                else
+                {
+                    w /= beta;
+                }
+                R_(j,j+1) = beta;
+            }
+        }
+
+        small_svd_.decompose(R_, false);
+    }
+
+
+    /// The number of extra dimensions of the projection subspace.
+    private: size_type oversampling_;
+    /// The number of power iterations of the randomized method.
+    private: size_type power_iterations_;
+    /// The seed of the random number generator.
+    private: unsigned long seed_;
+    /// The random number generator.
+    private: random_generator_type rng_;
+    /// The vector of singular values.
+    private: vector_type s_;
+    /// The matrix containing the left singular vectors.
+    private: matrix_type U_;
+    /// The matrix containing the right singular vectors.
+    private: matrix_type VH_;
+    /// The orthonormal basis of the left subspace.
+    private: matrix_type Q_;
+    /// The scratch matrix for the random test matrix, the products with
+    /// \f$A^H\f$ and the right Lanczos vectors.
+    private: matrix_type Z_;
+    /// The scratch matrix for the products with \f$A\f$.
+    private: matrix_type Y_;
+    /// The scratch matrix for the orthonormal basis of the range of
+    /// \f$A^H Q\f$ (randomized method).
+    private: matrix_type W_;
+    /// The scratch matrix for the R factors of the QR decompositions and for
+    /// the Lanczos bidiagonal matrix.
+    private: matrix_type R_;
+    /// The scratch vector for the reorthogonalization coefficients.
+    private: work_vector_type h_;
+    /// The workspace of the QR decompositions.
+    private: qr_workspace<value_type> qr_ws_;
+    /// The SVD of the projected matrix.
+    private: svd_decomposition<value_type> small_svd_;
+};
+
+
+/// Compute the \a k largest singular values of matrix \a A.
+template <typename MatrixExprT>
+vector<
+    typename type_traits<
+        typename matrix_traits<MatrixExprT>::value_type
+    >::real_type
+> svds_values(matrix_expression<MatrixExprT> const& A, ::std::size_t k, svds_method method = randomized_svds_method)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    svds_decomposition<value_type> svds(A, k, method);
+
+    return svds.s();
+}
+
+
+/// Compute the truncated singular value decomposition of rank \a k of matrix
+/// \a A.
+template <typename MatrixExprT>
+svds_decomposition<typename matrix_traits<MatrixExprT>::value_type> svds_decompose(matrix_expression<MatrixExprT> const& A, ::std::size_t k, svds_method method = randomized_svds_method)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return svds_decomposition<value_type>(A, k, method);
+}
+
+}}} // Namespace boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_OPERATION_SVDS_HPP
@@ -22,6 +22,7 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
 #include <cmath>
 
 
@@ -31,15 +32,39 @@ using namespace ::boost::numeric::ublas;
 
 namespace detail {
 
+template <typename T>
+BOOST_UBLAS_INLINE
+T tanh(T x)
+{
+    return ::std::tanh(x);
+}
+
+
+/// Functor computing the hyperbolic tangent of its argument.
+template <typename ArgT, typename ResT>
+struct tanh_functor
+{
+    typedef ArgT argument_type;
+    typedef ResT result_type;
+
+    BOOST_UBLAS_INLINE
+    result_type operator()(argument_type const& x) const
+    {
+        return detail::tanh<result_type>(x);
+    }
+};
+
+
 template <typename VectorExprT>
 struct vector_tanh_functor_traits
 {
     typedef VectorExprT input_expression_type;
     typedef typename vector_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef tanh_functor<signature_argument_type,signature_result_type> functor_type;
     typedef vector_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
@@ -52,22 +77,15 @@ struct matrix_tanh_functor_traits
     typedef MatrixExprT input_expression_type;
     typedef typename matrix_traits<input_expression_type>::value_type signature_argument_type;
     typedef signature_argument_type signature_result_type;
+    typedef tanh_functor<signature_argument_type,signature_result_type> functor_type;
     typedef matrix_unary_functor_traits<
                 input_expression_type,
-                signature_result_type (signature_argument_type)
+                functor_type
             > unary_functor_expression_type;
     typedef typename unary_functor_expression_type::result_type result_type;
     typedef typename unary_functor_expression_type::expression_type expression_type;
 };
 
-
-template <typename T>
-BOOST_UBLAS_INLINE
-T tanh(T x)
-{
-    return ::std::tanh(x);
-}
-
 } // Namespace detail
 
 
@@ -88,9 +106,9 @@ BOOST_UBLAS_INLINE
 typename detail::vector_tanh_functor_traits<VectorExprT>::result_type tanh(vector_expression<VectorExprT> const& ve)
 {
     typedef typename detail::vector_tanh_functor_traits<VectorExprT>::expression_type expression_type;
-    typedef typename detail::vector_tanh_functor_traits<VectorExprT>::signature_result_type signature_result_type;
+    typedef typename detail::vector_tanh_functor_traits<VectorExprT>::functor_type functor_type;
 
-    return expression_type(ve(), detail::tanh<signature_result_type>);
+    return expression_type(ve(), functor_type());
 }
 
 
@@ -111,11 +129,15 @@ BOOST_UBLAS_INLINE
 typename detail::matrix_tanh_functor_traits<MatrixExprT>::result_type tanh(matrix_expression<MatrixExprT> const& me)
 {
     typedef typename detail::matrix_tanh_functor_traits<MatrixExprT>::expression_type expression_type;
-    typedef typename detail::matrix_tanh_functor_traits<MatrixExprT>::signature_result_type signature_result_type;
+    typedef typename detail::matrix_tanh_functor_traits<MatrixExprT>::functor_type functor_type;
 
-    return expression_type(me(), detail::tanh<signature_result_type>);
+    return expression_type(me(), functor_type());
 }
 
+
+// tanh(policy, e), which evaluates tanh(e) immediately
+BOOST_UBLASX_DEFINE_EXECUTION_POLICY_OVERLOADS(tanh)
+
 }}} // Namespace boost::numeric::ublasx
 
 
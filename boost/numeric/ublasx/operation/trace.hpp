@@ -23,8 +23,11 @@
 #include <algorithm>
 #include <boost/numeric/ublas/detail/config.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublasx/detail/summation.hpp>
+#include <boost/numeric/ublasx/detail/traversal.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 
 namespace boost { namespace numeric { namespace ublasx {
@@ -32,6 +35,60 @@ namespace boost { namespace numeric { namespace ublasx {
 namespace ublas = ::boost::numeric::ublas;
 
 
+namespace detail {
+
+/**
+ * \brief Auxiliary class for computing the trace of a matrix expression.
+ * \tparam Contiguous Tells if the matrix expression is a dense container whose
+ *  diagonal can be summed through its storage array.
+ */
+template <bool Contiguous>
+struct trace_impl
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static typename ublas::matrix_traits<MatrixExprT>::value_type apply(ublas::matrix_expression<MatrixExprT> const& A)
+    {
+        typedef typename ublas::matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename ublas::matrix_traits<MatrixExprT>::size_type size_type;
+
+        size_type n = ::std::min(num_rows(A), num_columns(A));
+        value_type res = 0;
+
+        for (size_type i = 0; i < n; ++i)
+        {
+            res += A()(i,i);
+        }
+
+        return res;
+    }
+};
+
+
+template <>
+struct trace_impl<true>
+{
+    template <typename MatrixExprT>
+    BOOST_UBLAS_INLINE
+    static typename ublas::matrix_traits<MatrixExprT>::value_type apply(ublas::matrix_expression<MatrixExprT> const& A)
+    {
+        typedef typename ublas::matrix_traits<MatrixExprT>::value_type value_type;
+        typedef typename ublas::matrix_traits<MatrixExprT>::size_type size_type;
+
+        size_type nr = num_rows(A);
+        size_type nc = num_columns(A);
+        size_type n = ::std::min(nr, nc);
+
+        // Two consecutive diagonal elements are one row and one column apart
+        size_type stride = (::boost::is_same<typename ublas::matrix_traits<MatrixExprT>::orientation_category, ublas::column_major_tag>::value ? nr : nc)+1;
+
+        return pairwise_sum<value_type>(A().data().begin(), n, stride);
+    }
+};
+
+} // Namespace detail
+
+
 /**
  * \brief Compute the trace of a given matrix.
  *
@@ -50,18 +107,7 @@ template <typename MatrixExprT>
 BOOST_UBLAS_INLINE
 typename ublas::matrix_traits<MatrixExprT>::value_type trace(ublas::matrix_expression<MatrixExprT> const& A)
 {
-    typedef typename ublas::matrix_traits<MatrixExprT>::value_type value_type;
-    typedef typename ublas::matrix_traits<MatrixExprT>::size_type size_type;
-
-    size_type n = ::std::min(num_rows(A), num_columns(A));
-    value_type res = 0;
-
-    for (size_type i = 0; i < n; ++i)
-    {
-        res += A()(i,i);
-    }
-
-    return res;
+    return detail::trace_impl<detail::has_contiguous_storage<MatrixExprT>::value>::apply(A);
 }
 
 }}} // Namespace boost::numeric::ublasx
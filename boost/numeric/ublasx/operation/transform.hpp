@@ -26,6 +26,9 @@
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublasx/expression/matrix_unary_functor.hpp>
 #include <boost/numeric/ublasx/expression/vector_unary_functor.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
+#include <boost/numeric/ublasx/traits/is_execution_policy.hpp>
+#include <boost/utility/enable_if.hpp>
 //#include <boost/shared_ptr.hpp>//FIXME
 //#include <boost/function.hpp>//FIXME
 
@@ -68,7 +71,9 @@ using namespace ::boost::numeric::ublas;
  * \brief Apply a function to each element of a given vector expression.
  *
  * \tparam VectorExprT The type of the input vector expression.
- * \tparam UnaryFunctorT The type of the unary functor.
+ * \tparam UnaryFunctorT The type of the unary functor; it must define the
+ *  \c result_type typedef and it is called directly (i.e., without any
+ *  type-erasure), so that it can be inlined.
  *
  * \param ve The input vector expression.
  * \param f The unary functor to be applied to each vector element.
@@ -81,12 +86,12 @@ template <typename VectorExprT, typename UnaryFunctorT>
 BOOST_UBLAS_INLINE
 typename vector_unary_functor_traits<
     VectorExprT,
-    typename UnaryFunctorT::result_type (typename UnaryFunctorT::argument_type)
+    UnaryFunctorT
 >::result_type transform(vector_expression<VectorExprT> const& ve, UnaryFunctorT const& f)
 {
     typedef typename vector_unary_functor_traits<
                 VectorExprT,
-                typename UnaryFunctorT::result_type (typename UnaryFunctorT::argument_type)
+                UnaryFunctorT
             >::expression_type expression_type;
 
     return expression_type(ve(), f);
@@ -97,7 +102,9 @@ typename vector_unary_functor_traits<
  * \brief Apply a function to each element of a given matrix expression.
  *
  * \tparam MatrixExprT The type of the input matrix expression.
- * \tparam UnaryFunctorT The type of the unary functor.
+ * \tparam UnaryFunctorT The type of the unary functor; it must define the
+ *  \c result_type typedef and it is called directly (i.e., without any
+ *  type-erasure), so that it can be inlined.
  *
  * \param me The input matrix expression.
  * \param f The unary functor to be applied to each matrix element.
@@ -110,8 +117,7 @@ template <typename MatrixExprT, typename UnaryFunctorT>
 BOOST_UBLAS_INLINE
 typename matrix_unary_functor_traits<
     MatrixExprT,
-//  UnaryFunctorT
-    typename UnaryFunctorT::result_type (typename UnaryFunctorT::argument_type)
+    UnaryFunctorT
 //  detail::scalar_unary_generic<
 //      typename matrix_traits<MatrixExprT>::value_type,
 //      UnaryFunctorT
@@ -126,13 +132,87 @@ typename matrix_unary_functor_traits<
     typedef typename matrix_unary_functor_traits<
             MatrixExprT,
 //          wrapper_functor_type
-            typename UnaryFunctorT::result_type (typename UnaryFunctorT::argument_type)
+            UnaryFunctorT
         >::expression_type expression_type;
 
     //return expression_type(me(), wrapper_functor_type(f));
     return expression_type(me(), f);
 }
 
+
+/**
+ * \brief Apply a function to each element of a given vector expression,
+ *  according to the given execution policy.
+ *
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam VectorExprT The type of the input vector expression.
+ * \tparam UnaryFunctorT The type of the unary functor; it must define the
+ *  \c result_type typedef.
+ *
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param ve The input vector expression.
+ * \param f The unary functor to be applied to each vector element; under a
+ *  parallel policy, it may be called concurrently by several threads.
+ * \return A vector containing the application of \a f to each element of
+ *  \a ve.
+ *
+ * Unlike the other \c transform functions, the result is evaluated
+ * immediately.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExecutionPolicyT, typename VectorExprT, typename UnaryFunctorT>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::vector_eval_traits<
+        typename vector_unary_functor_traits<
+            VectorExprT,
+            UnaryFunctorT
+        >::expression_type
+    >::result_type
+>::type transform(ExecutionPolicyT const& policy, vector_expression<VectorExprT> const& ve, UnaryFunctorT const& f)
+{
+    return detail::evaluate(policy, transform(ve, f));
+}
+
+
+/**
+ * \brief Apply a function to each element of a given matrix expression,
+ *  according to the given execution policy.
+ *
+ * \tparam ExecutionPolicyT The type of the execution policy.
+ * \tparam MatrixExprT The type of the input matrix expression.
+ * \tparam UnaryFunctorT The type of the unary functor; it must define the
+ *  \c result_type typedef.
+ *
+ * \param policy The execution policy (see \c execution.hpp).
+ * \param me The input matrix expression.
+ * \param f The unary functor to be applied to each matrix element; under a
+ *  parallel policy, it may be called concurrently by several threads.
+ * \return A matrix, with the same layout of \a me, containing the
+ *  application of \a f to each element of \a me.
+ *
+ * Unlike the other \c transform functions, the result is evaluated
+ * immediately.
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+template <typename ExecutionPolicyT, typename MatrixExprT, typename UnaryFunctorT>
+BOOST_UBLAS_INLINE
+typename ::boost::enable_if<
+    is_execution_policy<ExecutionPolicyT>,
+    typename detail::matrix_eval_traits<
+        typename matrix_unary_functor_traits<
+            MatrixExprT,
+            UnaryFunctorT
+        >::expression_type
+    >::result_type
+>::type transform(ExecutionPolicyT const& policy, matrix_expression<MatrixExprT> const& me, UnaryFunctorT const& f)
+{
+    return detail::evaluate(policy, transform(me, f));
+}
+
 }}} // Namespace boost::numeric::ublasx
 
 
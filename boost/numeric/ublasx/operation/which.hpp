@@ -25,13 +25,14 @@
 #include <boost/numeric/ublas/expression_types.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/match.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
-#include <functional>
-
-
-//TODO: implement the 'which' operation for matrix expressions
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
 
 namespace boost { namespace numeric { namespace ublasx {
 
@@ -76,30 +77,105 @@ vector<typename vector_traits<VectorExprT>::size_type> which(vector_expression<V
 template <typename VectorExprT>
 vector<typename vector_traits<VectorExprT>::size_type> which(vector_expression<VectorExprT> const& ve);
 
+/**
+ * \brief Find the positions of the elments of the given matrix expression
+ *  which satisfy the given unary predicate.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \tparam UnaryPredicateT The type of the unary predicate functor.
+ * \param me The matrix expression over which check for the predicate.
+ * \param p The unary predicate functor: must accept one argument and return
+ *  a boolean value.
+ * \return A vector of (row, column) pairs of the elements of the given matrix
+ *  expression which satisfy the given predicate, in column-major order (i.e.,
+ *  column by column and, within a column, by increasing row, whatever the
+ *  storage layout of the matrix expression); an empty vector, if no element
+ *  satisfies the given predicate.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT, typename UnaryPredicateT>
+vector< ::std::pair<typename matrix_traits<MatrixExprT>::size_type, typename matrix_traits<MatrixExprT>::size_type> > which(matrix_expression<MatrixExprT> const& me, UnaryPredicateT p);
+
+/**
+ * \brief Find the positions of the non-zero elments of the given matrix
+ *  expression.
+ * \tparam MatrixExprT The type of the matrix expression.
+ * \param me The matrix expression over which check for existence of non-zero
+ *  elements.
+ * \return A vector of (row, column) pairs of the non-zero elements of the
+ *  given matrix expression, in column-major order (i.e., column by column and,
+ *  within a column, by increasing row, whatever the storage layout of the
+ *  matrix expression); an empty vector, if no non-zero element is found.
+ *
+ * \author Marco Guazzone, &lt;marco.guazzone@gmail.com&gt;
+ */
+template <typename MatrixExprT>
+vector< ::std::pair<typename matrix_traits<MatrixExprT>::size_type, typename matrix_traits<MatrixExprT>::size_type> > which(matrix_expression<MatrixExprT> const& me);
+
 //@} Declarations
 
 
+namespace detail {
+
+/// Collect the positions of the visited elements.
+template <typename SizeT>
+struct which_collector
+{
+    template <typename ValueT>
+    void operator()(SizeT i, ValueT const&)
+    {
+        positions.push_back(i);
+    }
+
+    vector<SizeT> result() const
+    {
+        vector<SizeT> res(positions.size());
+        ::std::copy(positions.begin(), positions.end(), res.begin());
+        return res;
+    }
+
+    // The buffer grows geometrically, so that collecting the positions takes
+    // linear time; the result is then allocated only once.
+    ::std::vector<SizeT> positions;
+};
+
+
+/// Collect the (row, column) positions of the visited elements.
+template <typename SizeT>
+struct which_matrix_collector
+{
+    typedef ::std::pair<SizeT,SizeT> position_type;
+
+    template <typename ValueT>
+    void operator()(SizeT r, SizeT c, ValueT const&)
+    {
+        positions.push_back(position_type(r, c));
+    }
+
+    vector<position_type> result() const
+    {
+        vector<position_type> res(positions.size());
+        ::std::copy(positions.begin(), positions.end(), res.begin());
+        return res;
+    }
+
+    ::std::vector<position_type> positions;
+};
+
+} // Namespace detail
+
+
 //@{ Definitions
 
 template <typename VectorExprT, typename UnaryPredicateT>
 BOOST_UBLAS_INLINE
 vector<typename vector_traits<VectorExprT>::size_type> which(vector_expression<VectorExprT> const& ve, UnaryPredicateT p)
 {
-    typedef typename vector_traits<VectorExprT>::size_type size_type;
+    detail::which_collector<typename vector_traits<VectorExprT>::size_type> collector;
 
-    vector<size_type> res;
-    size_type n = size(ve);
-    size_type j = 0;
-    for (size_type i = 0; i < n; ++i)
-    {
-        if (p(ve()(i)))
-        {
-            res.resize(res.size()+1);
-            res(j++) = i;
-        }
-    }
+    detail::for_each_match(ve, p, collector);
 
-    return res;
+    return collector.result();
 }
 
 
@@ -109,7 +185,29 @@ vector<typename vector_traits<VectorExprT>::size_type> which(vector_expression<V
 {
     typedef typename vector_traits<VectorExprT>::value_type value_type;
 
-    return which(ve, ::std::bind2nd(::std::not_equal_to<value_type>(), 0));
+    return which(ve, detail::nonzero_predicate<value_type>());
+}
+
+
+template <typename MatrixExprT, typename UnaryPredicateT>
+BOOST_UBLAS_INLINE
+vector< ::std::pair<typename matrix_traits<MatrixExprT>::size_type, typename matrix_traits<MatrixExprT>::size_type> > which(matrix_expression<MatrixExprT> const& me, UnaryPredicateT p)
+{
+    detail::which_matrix_collector<typename matrix_traits<MatrixExprT>::size_type> collector;
+
+    detail::for_each_match(me, p, collector);
+
+    return collector.result();
+}
+
+
+template <typename MatrixExprT>
+BOOST_UBLAS_INLINE
+vector< ::std::pair<typename matrix_traits<MatrixExprT>::size_type, typename matrix_traits<MatrixExprT>::size_type> > which(matrix_expression<MatrixExprT> const& me)
+{
+    typedef typename matrix_traits<MatrixExprT>::value_type value_type;
+
+    return which(me, detail::nonzero_predicate<value_type>());
 }
 
 //@} Definitions
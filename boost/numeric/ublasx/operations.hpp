@@ -29,6 +29,7 @@
 #include <boost/numeric/ublasx/operation/cat.hpp>
 #include <boost/numeric/ublasx/operation/cholesky.hpp>
 #include <boost/numeric/ublasx/operation/cond.hpp>
+#include <boost/numeric/ublasx/operation/cumprod.hpp>
 #include <boost/numeric/ublasx/operation/cumsum.hpp>
 #include <boost/numeric/ublasx/operation/diag.hpp>
 #include <boost/numeric/ublasx/operation/dot.hpp>
@@ -68,11 +69,13 @@
 #include <boost/numeric/ublasx/operation/rank.hpp>
 #include <boost/numeric/ublasx/operation/rcond.hpp>
 #include <boost/numeric/ublasx/operation/realmin.hpp>
+#include <boost/numeric/ublasx/operation/reduce.hpp>
 #include <boost/numeric/ublasx/operation/relational_ops.hpp>
 #include <boost/numeric/ublasx/operation/rep.hpp>
 #include <boost/numeric/ublasx/operation/reshape.hpp>
 #include <boost/numeric/ublasx/operation/rot90.hpp>
 #include <boost/numeric/ublasx/operation/round.hpp>
+#include <boost/numeric/ublasx/operation/scan.hpp>
 #include <boost/numeric/ublasx/operation/seq.hpp>
 #include <boost/numeric/ublasx/operation/sign.hpp>
 #include <boost/numeric/ublasx/operation/size.hpp>
@@ -0,0 +1,76 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ *
+ * \file boost/numeric/ublasx/traits/is_execution_policy.hpp
+ *
+ * \brief Traits types for determining if a given type is an execution policy,
+ *  and if it allows several threads.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_TRAITS_IS_EXECUTION_POLICY_HPP
+#define BOOST_NUMERIC_UBLASX_TRAITS_IS_EXECUTION_POLICY_HPP
+
+#include <boost/numeric/ublasx/execution.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+
+
+namespace boost { namespace numeric { namespace ublasx {
+
+template <typename T>
+struct is_execution_policy: ::boost::integral_constant<bool,false>
+{
+    // empty
+};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy>: ::boost::integral_constant<bool,true>
+{
+    // empty
+};
+
+template <>
+struct is_execution_policy<execution::parallel_policy>: ::boost::integral_constant<bool,true>
+{
+    // empty
+};
+
+template <>
+struct is_execution_policy<execution::parallel_unsequenced_policy>: ::boost::integral_constant<bool,true>
+{
+    // empty
+};
+
+
+template <typename T>
+struct is_parallel_execution_policy: ::boost::integral_constant<bool,false>
+{
+    // empty
+};
+
+template <>
+struct is_parallel_execution_policy<execution::parallel_policy>: ::boost::integral_constant<bool,true>
+{
+    // empty
+};
+
+template <>
+struct is_parallel_execution_policy<execution::parallel_unsequenced_policy>: ::boost::integral_constant<bool,true>
+{
+    // empty
+};
+
+}}} // boost::numeric::ublasx
+
+
+#endif // BOOST_NUMERIC_UBLASX_TRAITS_IS_EXECUTION_POLICY_HPP
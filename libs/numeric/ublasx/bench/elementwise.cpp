@@ -0,0 +1,229 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/bench/elementwise.cpp
+ *
+ * \brief Benchmark suite for element-wise operations.
+ *
+ * Every element-wise operation is nominally counted as one floating-point
+ * operation per element, so that the reported GFLOP/s are comparable across
+ * operations (i.e., they are giga-elements per second).
+ *
+ * <hr/>
+ *
+ *  Copyright (c) 2009-2012, Marco Guazzone
+ *
+ *  Distributed under the Boost Software License, Version 1.0. (See
+ *  accompanying file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
+#include <boost/numeric/ublasx/operation/abs.hpp>
+#include <boost/numeric/ublasx/operation/arithmetic_ops.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
+#include <boost/numeric/ublasx/operation/exp.hpp>
+#include <boost/numeric/ublasx/operation/for_each.hpp>
+#include <boost/numeric/ublasx/operation/hold.hpp>
+#include <boost/numeric/ublasx/operation/isfinite.hpp>
+#include <boost/numeric/ublasx/operation/isinf.hpp>
+#include <boost/numeric/ublasx/operation/log.hpp>
+#include <boost/numeric/ublasx/operation/log10.hpp>
+#include <boost/numeric/ublasx/operation/log2.hpp>
+#include <boost/numeric/ublasx/operation/pow.hpp>
+#include <boost/numeric/ublasx/operation/pow2.hpp>
+#include <boost/numeric/ublasx/operation/relational_ops.hpp>
+#include <boost/numeric/ublasx/operation/round.hpp>
+#include <boost/numeric/ublasx/operation/sign.hpp>
+#include <boost/numeric/ublasx/operation/sqr.hpp>
+#include <boost/numeric/ublasx/operation/sqrt.hpp>
+#include <boost/numeric/ublasx/operation/tanh.hpp>
+#include <boost/numeric/ublasx/operation/transform.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/bench/utils.hpp"
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+namespace bench = ::boost::numeric::ublasx::bench;
+
+
+template <typename T>
+struct abs_functor
+{
+    typedef T argument_type;
+    typedef T result_type;
+
+    T operator()(T const& x) const
+    {
+        return ::std::abs(x);
+    }
+};
+
+
+template <typename T>
+struct accumulate_functor
+{
+    explicit accumulate_functor(T& s)
+    : s_(s)
+    {
+    }
+
+    void operator()(T const& x)
+    {
+        s_ += x;
+    }
+
+    T& s_;
+};
+
+
+template <typename MatrixT, typename ExprT>
+static void eval(MatrixT& B, ExprT const& e)
+{
+    ublas::noalias(B) = e;
+    bench::do_not_optimize(B);
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_common(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+
+    const double nn = static_cast<double>(n)*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type A2 = A;
+    matrix_type P(n, n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            P(i,j) = ::std::abs(A(i,j)) + ValueT(0.5);
+        }
+    }
+    matrix_type B(n, n);
+
+    r.run<ValueT,LayoutT>("abs", n, n, nn, [&] () { eval(B, ublasx::abs(A)); });
+    r.run<ValueT,LayoutT>("sqr", n, n, nn, [&] () { eval(B, ublasx::sqr(A)); });
+    r.run<ValueT,LayoutT>("sqrt", n, n, nn, [&] () { eval(B, ublasx::sqrt(P)); });
+    r.run<ValueT,LayoutT>("exp", n, n, nn, [&] () { eval(B, ublasx::exp(A)); });
+    r.run<ValueT,LayoutT>("log", n, n, nn, [&] () { eval(B, ublasx::log(P)); });
+    r.run<ValueT,LayoutT>("tanh", n, n, nn, [&] () { eval(B, ublasx::tanh(A)); });
+    r.run<ValueT,LayoutT>("scalar_div", n, n, nn, [&] () { eval(B, ValueT(1)/P); });
+    r.run<ValueT,LayoutT>("transform", n, n, nn, [&] () { eval(B, ublasx::transform(A, abs_functor<ValueT>())); });
+    r.run<ValueT,LayoutT>("abs_plus", n, n, nn, [&] () { eval(B, ublasx::abs(A)+A2); });
+    r.run<ValueT,LayoutT>("assign_fast_abs", n, n, nn, [&] () {
+            ublasx::assign_fast(B, ublasx::abs(A));
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("assign_fast_abs_plus", n, n, nn, [&] () {
+            ublasx::assign_fast(B, ublasx::abs(A)+A2);
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("assign_fast_exp_seq", n, n, nn, [&] () {
+            ublasx::assign_fast(ublasx::execution::seq, B, ublasx::exp(A));
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("assign_fast_exp_par", n, n, nn, [&] () {
+            ublasx::assign_fast(ublasx::execution::par, B, ublasx::exp(A));
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("assign_fast_exp_trans_par", n, n, nn, [&] () {
+            ublasx::assign_fast(ublasx::execution::par, B, ublasx::exp(ublas::trans(A)));
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("exp_par", n, n, nn, [&] () {
+            B = ublasx::exp(ublasx::execution::par, A);
+            bench::do_not_optimize(B);
+        });
+    r.run<ValueT,LayoutT>("for_each", n, n, nn, [&] () {
+            ValueT s(0);
+            ublasx::for_each(A, accumulate_functor<ValueT>(s));
+            bench::do_not_optimize(s);
+        });
+    r.run<ValueT,LayoutT>("equal", n, n, nn, [&] () {
+            bool eq = (A == A2);
+            bench::do_not_optimize(eq);
+        });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_real(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+
+    const double nn = static_cast<double>(n)*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type P = ublasx::abs(A);
+    P += ublas::scalar_matrix<ValueT>(n, n, 0.5);
+    matrix_type B(n, n);
+    ublas::matrix<int,LayoutT> I(n, n);
+    ublas::matrix<bool,LayoutT> H(n, n);
+
+    r.run<ValueT,LayoutT>("log2", n, n, nn, [&] () { eval(B, ublasx::log2(P)); });
+    r.run<ValueT,LayoutT>("log10", n, n, nn, [&] () { eval(B, ublasx::log10(P)); });
+    r.run<ValueT,LayoutT>("pow", n, n, nn, [&] () { eval(B, ublasx::pow(P, ValueT(1.5))); });
+    r.run<ValueT,LayoutT>("pow2", n, n, nn, [&] () { eval(B, ublasx::pow2(A)); });
+    r.run<ValueT,LayoutT>("round", n, n, nn, [&] () { eval(B, ublasx::round(A)); });
+    r.run<ValueT,LayoutT>("sign", n, n, nn, [&] () { eval(B, ublasx::sign(A)); });
+    r.run<ValueT,LayoutT>("isfinite", n, n, nn, [&] () { eval(I, ublasx::isfinite(A)); });
+    r.run<ValueT,LayoutT>("isinf", n, n, nn, [&] () { eval(I, ublasx::isinf(A)); });
+    r.run<ValueT,LayoutT>("hold", n, n, nn, [&] () { eval(H, ublasx::hold(A)); });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_vector(bench::runner& r, std::size_t n)
+{
+    typedef ublas::vector<ValueT> vector_type;
+
+    const std::size_t nn = n*n;
+
+    vector_type v = bench::make_vector<ValueT>(nn);
+    vector_type w(nn);
+
+    r.run<ValueT,LayoutT>("vector_abs", nn, 1, nn, [&] () { eval(w, ublasx::abs(v)); });
+    r.run<ValueT,LayoutT>("vector_exp", nn, 1, nn, [&] () { eval(w, ublasx::exp(v)); });
+    r.run<ValueT,LayoutT>("vector_transform", nn, 1, nn, [&] () { eval(w, ublasx::transform(v, abs_functor<ValueT>())); });
+    r.run<ValueT,LayoutT>("vector_assign_fast_abs", nn, 1, nn, [&] () {
+            ublasx::assign_fast(w, ublasx::abs(v));
+            bench::do_not_optimize(w);
+        });
+}
+
+
+int main(int argc, char* argv[])
+{
+    bench::runner r("elementwise", argc, argv, {64, 256, 1024});
+
+    for (std::size_t i = 0; i < r.sizes().size(); ++i)
+    {
+        const std::size_t n = r.sizes()[i];
+
+        bench_common<float,ublas::row_major>(r, n);
+        bench_common<float,ublas::column_major>(r, n);
+        bench_common<double,ublas::row_major>(r, n);
+        bench_common<double,ublas::column_major>(r, n);
+        bench_common<std::complex<double>,ublas::row_major>(r, n);
+        bench_common<std::complex<double>,ublas::column_major>(r, n);
+
+        bench_real<float,ublas::row_major>(r, n);
+        bench_real<float,ublas::column_major>(r, n);
+        bench_real<double,ublas::row_major>(r, n);
+        bench_real<double,ublas::column_major>(r, n);
+
+        bench_vector<float,void>(r, n);
+        bench_vector<double,void>(r, n);
+        bench_vector<std::complex<double>,void>(r, n);
+    }
+}
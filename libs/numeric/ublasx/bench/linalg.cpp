@@ -0,0 +1,436 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/bench/linalg.cpp
+ *
+ * \brief Benchmark suite for dense linear algebra operations (factorizations,
+ *  solvers, condition numbers and spectral decompositions).
+ *
+ * The flop models are the classical (LAPACK Working Note 41) operation counts
+ * for square \f$n \times n\f$ problems; they are nominal and do not depend on
+ * the algorithm actually implemented, so that the reported GFLOP/s can be
+ * compared across implementations.
+ *
+ * <hr/>
+ *
+ *  Copyright (c) 2009-2012, Marco Guazzone
+ *
+ *  Distributed under the Boost Software License, Version 1.0. (See
+ *  accompanying file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#include <algorithm>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/symmetric.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/balance.hpp>
+#include <boost/numeric/ublasx/operation/cholesky.hpp>
+#include <boost/numeric/ublasx/operation/cond.hpp>
+#include <boost/numeric/ublasx/operation/eigen.hpp>
+#include <boost/numeric/ublasx/operation/eigs.hpp>
+#include <boost/numeric/ublasx/operation/expm.hpp>
+#include <boost/numeric/ublasx/operation/expmv.hpp>
+#include <boost/numeric/ublasx/operation/illcond.hpp>
+#include <boost/numeric/ublasx/operation/inv.hpp>
+#include <boost/numeric/ublasx/operation/lsq.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
+#include <boost/numeric/ublasx/operation/mldivide.hpp>
+#include <boost/numeric/ublasx/operation/mpow.hpp>
+#include <boost/numeric/ublasx/operation/null.hpp>
+#include <boost/numeric/ublasx/operation/orth.hpp>
+#include <boost/numeric/ublasx/operation/ql.hpp>
+#include <boost/numeric/ublasx/operation/qr.hpp>
+#include <boost/numeric/ublasx/operation/qrcp.hpp>
+#include <boost/numeric/ublasx/operation/qr_update.hpp>
+#include <boost/numeric/ublasx/operation/qz.hpp>
+#include <boost/numeric/ublasx/operation/rank.hpp>
+#include <boost/numeric/ublasx/operation/rcond.hpp>
+#include <boost/numeric/ublasx/operation/svd.hpp>
+#include <boost/numeric/ublasx/operation/svds.hpp>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/bench/utils.hpp"
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+namespace bench = ::boost::numeric::ublasx::bench;
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_solvers(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+    typedef ublas::vector<ValueT> vector_type;
+
+    const double n3 = static_cast<double>(n)*n*n;
+    const double n2 = static_cast<double>(n)*n;
+
+    matrix_type A = bench::make_nonsingular_matrix<ValueT,LayoutT>(n);
+    matrix_type B = bench::make_matrix<ValueT,LayoutT>(n, n, 1234UL);
+    vector_type b = bench::make_vector<ValueT>(n);
+    matrix_type LS = bench::make_matrix<ValueT,LayoutT>(2*n, n);
+    vector_type ls_b = bench::make_vector<ValueT>(2*n);
+    vector_type x(n);
+    matrix_type X(n, n);
+    ublasx::inv_workspace<ValueT> inv_ws(n);
+    ublasx::lu_decomposition<ValueT> lu(A);
+    ublasx::llsq_workspace<ValueT> llsq_ws;
+    vector_type ls_x;
+
+    r.run<ValueT,LayoutT>("lu_decompose", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () {
+            matrix_type LU(A);
+            ublasx::lu_decompose_inplace(LU);
+            bench::do_not_optimize(LU);
+        });
+    r.run<ValueT,LayoutT>("lu_decomposition_solve_vector", n, n, bench::scaled_flops<ValueT>(2*n2), [&] () {
+            ublas::noalias(x) = lu.solve(b);
+            bench::do_not_optimize(x);
+        });
+    r.run<ValueT,LayoutT>("lu_solve_vector", n, n, bench::scaled_flops<ValueT>(2*n3/3+2*n2), [&] () {
+            ublasx::lu_solve(A, b, x);
+            bench::do_not_optimize(x);
+        });
+    r.run<ValueT,LayoutT>("mldivide_vector", n, n, bench::scaled_flops<ValueT>(2*n3/3+2*n2), [&] () {
+            ublasx::mldivide(A, b, x);
+            bench::do_not_optimize(x);
+        });
+    r.run<ValueT,LayoutT>("mldivide_matrix", n, n, bench::scaled_flops<ValueT>(2*n3/3+2*n3), [&] () {
+            ublasx::mldivide(A, B, X);
+            bench::do_not_optimize(X);
+        });
+    r.run<ValueT,LayoutT>("inv", n, n, bench::scaled_flops<ValueT>(2*n3), [&] () { bench::do_not_optimize(ublasx::inv(A)); });
+    r.run<ValueT,LayoutT>("inv_inplace", n, n, bench::scaled_flops<ValueT>(2*n3), [&] () {
+            matrix_type Ai(A);
+            ublasx::inv_inplace(Ai);
+            bench::do_not_optimize(Ai);
+        });
+    r.run<ValueT,LayoutT>("inv_inplace_workspace", n, n, bench::scaled_flops<ValueT>(2*n3), [&] () {
+            matrix_type Ai(A);
+            ublasx::inv_inplace(Ai, inv_ws);
+            bench::do_not_optimize(Ai);
+        });
+    // Three squarings by binary exponentiation
+    r.run<ValueT,LayoutT>("mpow_8", n, n, bench::scaled_flops<ValueT>(3*2*n3), [&] () { bench::do_not_optimize(ublasx::mpow(A, 8)); });
+    r.run<ValueT,LayoutT>("rcond", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () { bench::do_not_optimize(ublasx::rcond(A)); });
+    r.run<ValueT,LayoutT>("illcond", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () { bench::do_not_optimize(ublasx::illcond(A)); });
+    r.run<ValueT,LayoutT>("cond_1", n, n, bench::scaled_flops<ValueT>(2*n3), [&] () { bench::do_not_optimize(ublasx::cond_1(A)); });
+    r.run<ValueT,LayoutT>("cond_inf", n, n, bench::scaled_flops<ValueT>(2*n3), [&] () { bench::do_not_optimize(ublasx::cond_inf(A)); });
+    r.run<ValueT,LayoutT>("cond_2", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () { bench::do_not_optimize(ublasx::cond_2(A)); });
+    r.run<ValueT,LayoutT>("cond_1_estimate", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () { bench::do_not_optimize(ublasx::cond_1(A, ublasx::estimate_cond_method)); });
+    r.run<ValueT,LayoutT>("cond_inf_estimate", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () { bench::do_not_optimize(ublasx::cond_inf(A, ublasx::estimate_cond_method)); });
+    r.run<ValueT,LayoutT>("cond_2_estimate", n, n, bench::scaled_flops<ValueT>(2*n3/3), [&] () { bench::do_not_optimize(ublasx::cond_2(A, ublasx::estimate_cond_method)); });
+    r.run<ValueT,LayoutT>("rank", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () { bench::do_not_optimize(ublasx::rank(B)); });
+    r.run<ValueT,LayoutT>("rank_qrcp", n, n, bench::scaled_flops<ValueT>(4*n3/3), [&] () { bench::do_not_optimize(ublasx::rank(B, ublasx::qrcp_rank_method)); });
+    // Overdetermined 2n-by-n system
+    r.run<ValueT,LayoutT>("llsq_qr", 2*n, n, bench::scaled_flops<ValueT>(2*2*n3-2*n3/3), [&] () { bench::do_not_optimize(ublasx::llsq_qr(LS, ls_b)); });
+    r.run<ValueT,LayoutT>("llsq_qr_workspace", 2*n, n, bench::scaled_flops<ValueT>(2*2*n3-2*n3/3), [&] () {
+            ls_x = ls_b;
+            ublasx::llsq_qr_inplace(LS, ls_x, llsq_ws);
+            bench::do_not_optimize(ls_x);
+        });
+    r.run<ValueT,LayoutT>("llsq_svd", 2*n, n, -1, [&] () { bench::do_not_optimize(ublasx::llsq_svd(LS, ls_b)); });
+    r.run<ValueT,LayoutT>("llsq_svd_workspace", 2*n, n, -1, [&] () {
+            ls_x = ls_b;
+            ublasx::llsq_svd_inplace(LS, ls_x, llsq_ws);
+            bench::do_not_optimize(ls_x);
+        });
+    r.run<ValueT,LayoutT>("llsq_svd_workspace_gelss", 2*n, n, -1, [&] () {
+            ls_x = ls_b;
+            ublasx::llsq_svd_inplace(LS, ls_x, llsq_ws, ublasx::gesvd_svd_algorithm);
+            bench::do_not_optimize(ls_x);
+        });
+    r.run<ValueT,LayoutT>("llsq_svd_workspace_gelsd", 2*n, n, -1, [&] () {
+            ls_x = ls_b;
+            ublasx::llsq_svd_inplace(LS, ls_x, llsq_ws, ublasx::gesdd_svd_algorithm);
+            bench::do_not_optimize(ls_x);
+        });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_decompositions(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+
+    const double n3 = static_cast<double>(n)*n*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type Q;
+    matrix_type R;
+    ublas::vector<typename ublas::type_traits<ValueT>::real_type> s;
+    ublasx::qr_workspace<ValueT> qr_ws;
+    ublasx::ql_workspace<ValueT> ql_ws;
+    ublasx::svd_workspace<ValueT> svd_ws;
+
+    // geqrf + orgqr
+    r.run<ValueT,LayoutT>("qr_decompose", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () {
+            ublasx::qr_decompose(A, Q, R);
+            bench::do_not_optimize(Q);
+            bench::do_not_optimize(R);
+        });
+    r.run<ValueT,LayoutT>("qr_decompose_workspace", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () {
+            ublasx::qr_decompose(A, Q, R, true, qr_ws);
+            bench::do_not_optimize(Q);
+            bench::do_not_optimize(R);
+        });
+    r.run<ValueT,LayoutT>("qr_decomposition", n, n, bench::scaled_flops<ValueT>(4*n3/3), [&] () {
+            ublasx::qr_decomposition<ValueT> qr(A);
+            bench::do_not_optimize(qr);
+        });
+    // Sliding window over the economy factors of a tall matrix: one row in,
+    // one row out
+    {
+        matrix_type W = bench::make_matrix<ValueT,LayoutT>(2*n, n);
+        matrix_type QW;
+        matrix_type RW;
+        ublasx::qr_decompose(W, QW, RW, false);
+        ublas::vector<ValueT> w(ublas::row(W, 0));
+        r.run<ValueT,LayoutT>("qr_insert_delete_row", 2*n, n, -1, [&] () {
+                ublasx::qr_insert_row(QW, RW, 2*n, w);
+                ublasx::qr_delete_row(QW, RW, 0);
+                bench::do_not_optimize(RW);
+            });
+    }
+    // geqp3
+    r.run<ValueT,LayoutT>("qrcp_decompose", n, n, bench::scaled_flops<ValueT>(4*n3/3), [&] () { bench::do_not_optimize(ublasx::qrcp_decompose(A)); });
+    {
+        ublasx::qrcp_decomposition<ValueT> qrcp;
+        r.run<ValueT,LayoutT>("qrcp_decomposition_reuse", n, n, bench::scaled_flops<ValueT>(4*n3/3), [&] () {
+                qrcp.decompose(A);
+                bench::do_not_optimize(qrcp);
+            });
+    }
+    // Bases of the range and of the null space of a wide n-by-2n matrix
+    {
+        matrix_type W = bench::make_matrix<ValueT,LayoutT>(n, 2*n);
+        r.run<ValueT,LayoutT>("orth", n, 2*n, -1, [&] () { bench::do_not_optimize(ublasx::orth(W)); });
+        r.run<ValueT,LayoutT>("orth_qrcp", n, 2*n, -1, [&] () { bench::do_not_optimize(ublasx::orth(W, ublasx::qrcp_rank_method)); });
+        r.run<ValueT,LayoutT>("null", n, 2*n, -1, [&] () { bench::do_not_optimize(ublasx::null(W)); });
+        r.run<ValueT,LayoutT>("null_qrcp", n, 2*n, -1, [&] () { bench::do_not_optimize(ublasx::null(W, ublasx::qrcp_rank_method)); });
+    }
+    r.run<ValueT,LayoutT>("ql_decompose", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () {
+            ublasx::ql_decompose(A, Q, R);
+            bench::do_not_optimize(Q);
+            bench::do_not_optimize(R);
+        });
+    r.run<ValueT,LayoutT>("ql_decompose_workspace", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () {
+            ublasx::ql_decompose(A, Q, R, true, ql_ws);
+            bench::do_not_optimize(Q);
+            bench::do_not_optimize(R);
+        });
+    r.run<ValueT,LayoutT>("svd_values", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () { bench::do_not_optimize(ublasx::svd_values(A)); });
+    r.run<ValueT,LayoutT>("svd_values_workspace", n, n, bench::scaled_flops<ValueT>(8*n3/3), [&] () {
+            ublasx::svd_values(A, s, svd_ws);
+            bench::do_not_optimize(s);
+        });
+    r.run<ValueT,LayoutT>("svd_decompose", n, n, bench::scaled_flops<ValueT>(22*n3), [&] () {
+            ublasx::svd_decomposition<ValueT> svd(A);
+            bench::do_not_optimize(svd);
+        });
+    r.run<ValueT,LayoutT>("svd_decompose_gesvd", n, n, bench::scaled_flops<ValueT>(22*n3), [&] () {
+            ublasx::svd_decomposition<ValueT> svd(A, true, ublasx::gesvd_svd_algorithm);
+            bench::do_not_optimize(svd);
+        });
+    r.run<ValueT,LayoutT>("svd_decompose_gesdd", n, n, bench::scaled_flops<ValueT>(22*n3), [&] () {
+            ublasx::svd_decomposition<ValueT> svd(A, true, ublasx::gesdd_svd_algorithm);
+            bench::do_not_optimize(svd);
+        });
+
+    // Top-10 singular triplets of a tall matrix
+    matrix_type T = bench::make_matrix<ValueT,LayoutT>(8*n, n);
+    ublasx::svds_decomposition<ValueT> svds;
+    r.run<ValueT,LayoutT>("svds_full_svd", 8*n, n, -1, [&] () {
+            ublasx::svd_decomposition<ValueT> svd(T, false);
+            bench::do_not_optimize(svd);
+        });
+    r.run<ValueT,LayoutT>("svds_randomized", 8*n, n, -1, [&] () {
+            svds.decompose(T, 10, ublasx::randomized_svds_method);
+            bench::do_not_optimize(svds);
+        });
+    r.run<ValueT,LayoutT>("svds_lanczos", 8*n, n, -1, [&] () {
+            svds.decompose(T, 10, ublasx::lanczos_svds_method);
+            bench::do_not_optimize(svds);
+        });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_spectral(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+    typedef ublas::matrix<std::complex<double>,LayoutT> complex_matrix_type;
+    typedef ublas::vector<std::complex<double> > complex_vector_type;
+
+    const double n3 = static_cast<double>(n)*n*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type B = bench::make_nonsingular_matrix<ValueT,LayoutT>(n, 1234UL);
+    complex_vector_type w;
+    complex_matrix_type LV;
+    complex_matrix_type RV;
+    matrix_type S;
+    matrix_type T;
+    matrix_type Q;
+    matrix_type Z;
+    ublasx::eigen_workspace<ValueT> eigen_ws;
+    ublasx::qz_workspace<ValueT> qz_ws;
+
+    r.run<ValueT,LayoutT>("eigenvalues", n, n, bench::scaled_flops<ValueT>(10*n3), [&] () {
+            ublasx::eigenvalues(A, w);
+            bench::do_not_optimize(w);
+        });
+    r.run<ValueT,LayoutT>("eigenvalues_workspace", n, n, bench::scaled_flops<ValueT>(10*n3), [&] () {
+            ublasx::eigenvalues(A, w, eigen_ws);
+            bench::do_not_optimize(w);
+        });
+    r.run<ValueT,LayoutT>("eigen", n, n, bench::scaled_flops<ValueT>(25*n3), [&] () {
+            ublasx::eigen(A, w, LV, RV);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(RV);
+        });
+    r.run<ValueT,LayoutT>("eigen_workspace", n, n, bench::scaled_flops<ValueT>(25*n3), [&] () {
+            ublasx::eigen(A, w, LV, RV, eigen_ws);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(RV);
+        });
+    r.run<ValueT,LayoutT>("balance", n, n, -1, [&] () { bench::do_not_optimize(ublasx::balance(A)); });
+    r.run<ValueT,LayoutT>("qz_decompose", n, n, bench::scaled_flops<ValueT>(66*n3), [&] () {
+            matrix_type S;
+            matrix_type T;
+            matrix_type Q;
+            matrix_type Z;
+            ublasx::qz_decompose(A, B, S, T, Q, Z);
+            bench::do_not_optimize(S);
+            bench::do_not_optimize(T);
+        });
+    r.run<ValueT,LayoutT>("qz_decompose_workspace", n, n, bench::scaled_flops<ValueT>(66*n3), [&] () {
+            ublasx::qz_decompose(A, B, S, T, Q, Z, ublasx::all_qz_eigenvalues, qz_ws);
+            bench::do_not_optimize(S);
+            bench::do_not_optimize(T);
+        });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_symmetric(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+    typedef ublas::symmetric_matrix<ValueT,ublas::lower,LayoutT> symmetric_matrix_type;
+    typedef ublas::vector<ValueT> vector_type;
+
+    const double n3 = static_cast<double>(n)*n*n;
+
+    matrix_type A = bench::make_spd_matrix<ValueT,LayoutT>(n);
+    symmetric_matrix_type S(A);
+    vector_type w;
+    matrix_type V;
+    ublasx::eigen_workspace<ValueT> eigen_ws;
+
+    r.run<ValueT,LayoutT>("cholesky_decompose", n, n, n3/3, [&] () {
+            matrix_type L(A);
+            ublasx::cholesky_decompose(L);
+            bench::do_not_optimize(L);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigenvalues", n, n, 4*n3/3, [&] () {
+            ublasx::eigenvalues(S, w);
+            bench::do_not_optimize(w);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigen", n, n, 9*n3, [&] () {
+            ublasx::eigen(S, w, V);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigen_workspace", n, n, 9*n3, [&] () {
+            ublasx::eigen(S, w, V, eigen_ws);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigen_syev", n, n, 9*n3, [&] () {
+            ublasx::eigen(S, w, V, eigen_ws, ublasx::syev_eigen_algorithm);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigen_syevd", n, n, 9*n3, [&] () {
+            ublasx::eigen(S, w, V, eigen_ws, ublasx::syevd_eigen_algorithm);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    r.run<ValueT,LayoutT>("symmetric_eigen_syevr", n, n, 9*n3, [&] () {
+            ublasx::eigen(S, w, V, eigen_ws, ublasx::syevr_eigen_algorithm);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    // The 20 smallest eigenpairs
+    const std::size_t k = std::min(n, std::size_t(20));
+    r.run<ValueT,LayoutT>("symmetric_eigen_by_index", n, n, 4*n3/3, [&] () {
+            ublasx::eigen_by_index(S, 0, k-1, w, V, eigen_ws);
+            bench::do_not_optimize(w);
+            bench::do_not_optimize(V);
+        });
+    // The 10 largest eigenpairs, through products with the matrix only
+    ublasx::eigsh_decomposition<ValueT> eigsh;
+    r.run<ValueT,LayoutT>("symmetric_eigsh", n, n, -1, [&] () {
+            eigsh.decompose(S, 10, ublasx::largest_magnitude_eigs);
+            bench::do_not_optimize(eigsh);
+        });
+}
+
+
+template <typename LayoutT>
+static void bench_expm(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<double,LayoutT> matrix_type;
+
+    matrix_type A = bench::make_matrix<double,LayoutT>(n, n);
+
+    r.run<double,LayoutT>("expm_pad", n, n, -1, [&] () { bench::do_not_optimize(ublasx::expm_pad(A)); });
+    r.run<double,LayoutT>("expm", n, n, -1, [&] () { bench::do_not_optimize(ublasx::expm(A)); });
+
+    ublasx::expm_workspace<double> ws(n);
+    matrix_type E(n, n);
+    r.run<double,LayoutT>("expm_workspace", n, n, -1, [&] () {
+            ublasx::expm(A, E, ws);
+            bench::do_not_optimize(E);
+        });
+
+    ublas::vector<double> v(n, 1);
+    r.run<double,LayoutT>("expmv", n, n, -1, [&] () { bench::do_not_optimize(ublasx::expmv(A, v)); });
+}
+
+
+int main(int argc, char* argv[])
+{
+    bench::runner r("linalg", argc, argv, {16, 64, 256});
+
+    for (std::size_t i = 0; i < r.sizes().size(); ++i)
+    {
+        const std::size_t n = r.sizes()[i];
+
+        bench_solvers<float,ublas::row_major>(r, n);
+        bench_solvers<float,ublas::column_major>(r, n);
+        bench_solvers<double,ublas::row_major>(r, n);
+        bench_solvers<double,ublas::column_major>(r, n);
+        bench_solvers<std::complex<double>,ublas::row_major>(r, n);
+        bench_solvers<std::complex<double>,ublas::column_major>(r, n);
+
+        bench_decompositions<float,ublas::row_major>(r, n);
+        bench_decompositions<float,ublas::column_major>(r, n);
+        bench_decompositions<double,ublas::row_major>(r, n);
+        bench_decompositions<double,ublas::column_major>(r, n);
+        bench_decompositions<std::complex<double>,ublas::row_major>(r, n);
+        bench_decompositions<std::complex<double>,ublas::column_major>(r, n);
+
+        bench_spectral<double,ublas::row_major>(r, n);
+        bench_spectral<double,ublas::column_major>(r, n);
+
+        bench_symmetric<double,ublas::row_major>(r, n);
+        bench_symmetric<double,ublas::column_major>(r, n);
+
+        bench_expm<ublas::row_major>(r, n);
+        bench_expm<ublas::column_major>(r, n);
+    }
+}
@@ -0,0 +1,184 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/bench/reductions.cpp
+ *
+ * \brief Benchmark suite for reduction and scan operations.
+ *
+ * Reductions and scans are nominally counted as one floating-point operation
+ * per visited element (two for \c dot).
+ *
+ * <hr/>
+ *
+ *  Copyright (c) 2009-2012, Marco Guazzone
+ *
+ *  Distributed under the Boost Software License, Version 1.0. (See
+ *  accompanying file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/all.hpp>
+#include <boost/numeric/ublasx/operation/any.hpp>
+#include <boost/numeric/ublasx/operation/cumprod.hpp>
+#include <boost/numeric/ublasx/operation/cumsum.hpp>
+#include <boost/numeric/ublasx/operation/dot.hpp>
+#include <boost/numeric/ublasx/operation/find.hpp>
+#include <boost/numeric/ublasx/operation/max.hpp>
+#include <boost/numeric/ublasx/operation/min.hpp>
+#include <boost/numeric/ublasx/operation/reduce.hpp>
+#include <boost/numeric/ublasx/operation/scan.hpp>
+#include <boost/numeric/ublasx/operation/relational_ops.hpp>
+#include <boost/numeric/ublasx/operation/sum.hpp>
+#include <boost/numeric/ublasx/operation/trace.hpp>
+#include <boost/numeric/ublasx/operation/which.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/bench/utils.hpp"
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+namespace bench = ::boost::numeric::ublasx::bench;
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_matrix(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+
+    const double nn = static_cast<double>(n)*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type B = bench::make_matrix<ValueT,LayoutT>(n, n, 1234UL);
+    matrix_type Z = ublas::zero_matrix<ValueT>(n, n);
+    matrix_type C(A);
+
+    r.run<ValueT,LayoutT>("sum_all", n, n, nn, [&] () { bench::do_not_optimize(ublasx::sum_all(A)); });
+    r.run<ValueT,LayoutT>("sum_rows", n, n, nn, [&] () { bench::do_not_optimize(ublasx::sum_rows(A)); });
+    r.run<ValueT,LayoutT>("sum_columns", n, n, nn, [&] () { bench::do_not_optimize(ublasx::sum_columns(A)); });
+    r.run<ValueT,LayoutT>("cumsum_rows", n, n, nn, [&] () { bench::do_not_optimize(ublasx::cumsum_rows(A)); });
+    r.run<ValueT,LayoutT>("cumsum_columns", n, n, nn, [&] () { bench::do_not_optimize(ublasx::cumsum_columns(A)); });
+    r.run<ValueT,LayoutT>("cumsum_rows_inplace", n, n, nn, [&] () { ublasx::cumsum_rows_inplace(C); bench::do_not_optimize(C); });
+    r.run<ValueT,LayoutT>("cumsum_columns_inplace", n, n, nn, [&] () { ublasx::cumsum_columns_inplace(C); bench::do_not_optimize(C); });
+    r.run<ValueT,LayoutT>("cumprod_rows", n, n, nn, [&] () { bench::do_not_optimize(ublasx::cumprod_rows(A)); });
+    r.run<ValueT,LayoutT>("cumprod_columns", n, n, nn, [&] () { bench::do_not_optimize(ublasx::cumprod_columns(A)); });
+    r.run<ValueT,LayoutT>("dot_rows", n, n, 2*nn, [&] () { bench::do_not_optimize(ublasx::dot<1>(A, B)); });
+    r.run<ValueT,LayoutT>("dot_columns", n, n, 2*nn, [&] () { bench::do_not_optimize(ublasx::dot<2>(A, B)); });
+    r.run<ValueT,LayoutT>("trace", n, n, n, [&] () { bench::do_not_optimize(ublasx::trace(A)); });
+    // Worst cases: the whole matrix must be visited
+    r.run<ValueT,LayoutT>("all", n, n, nn, [&] () { bench::do_not_optimize(ublasx::all(A)); });
+    r.run<ValueT,LayoutT>("any", n, n, nn, [&] () { bench::do_not_optimize(ublasx::any(Z)); });
+    C = A;
+    r.run<ValueT,LayoutT>("equal", n, n, nn, [&] () { bench::do_not_optimize(A == C); });
+}
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_matrix_real(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+
+    const double nn = static_cast<double>(n)*n;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+
+    r.run<ValueT,LayoutT>("scan_rows_max", n, n, nn, [&] () { bench::do_not_optimize(ublasx::scan_rows(A, [] (ValueT x, ValueT y) { return std::max(x, y); })); });
+    r.run<ValueT,LayoutT>("scan_columns_max", n, n, nn, [&] () { bench::do_not_optimize(ublasx::scan_columns(A, [] (ValueT x, ValueT y) { return std::max(x, y); })); });
+    r.run<ValueT,LayoutT>("max_all", n, n, nn, [&] () { bench::do_not_optimize(ublasx::max(A)); });
+    r.run<ValueT,LayoutT>("max_rows", n, n, nn, [&] () { bench::do_not_optimize(ublasx::max_rows(A)); });
+    r.run<ValueT,LayoutT>("max_columns", n, n, nn, [&] () { bench::do_not_optimize(ublasx::max_columns(A)); });
+    r.run<ValueT,LayoutT>("min_all", n, n, nn, [&] () { bench::do_not_optimize(ublasx::min(A)); });
+    r.run<ValueT,LayoutT>("min_rows", n, n, nn, [&] () { bench::do_not_optimize(ublasx::min_rows(A)); });
+    r.run<ValueT,LayoutT>("min_columns", n, n, nn, [&] () { bench::do_not_optimize(ublasx::min_columns(A)); });
+    // Fused reduction vs. separate passes computing the same statistics
+    r.run<ValueT,LayoutT>("reduce_min_max_sum", n, n, 3*nn, [&] () { bench::do_not_optimize(ublasx::reduce_all(A, ublasx::reduction::min | ublasx::reduction::max | ublasx::reduction::mean)); });
+    r.run<ValueT,LayoutT>("separate_min_max_sum", n, n, 3*nn, [&] () { bench::do_not_optimize(ublasx::min(A)); bench::do_not_optimize(ublasx::max(A)); bench::do_not_optimize(ublasx::sum_all(A)); });
+    r.run<ValueT,LayoutT>("reduce_rows_min_max_sum", n, n, 3*nn, [&] () { bench::do_not_optimize(ublasx::reduce_rows(A, ublasx::reduction::min | ublasx::reduction::max | ublasx::reduction::mean)); });
+    r.run<ValueT,LayoutT>("reduce_expr_min_max_sum", n, n, 3*nn, [&] () { bench::do_not_optimize(ublasx::reduce_all(2*A+A, ublasx::reduction::min | ublasx::reduction::max | ublasx::reduction::mean)); });
+    r.run<ValueT,LayoutT>("separate_expr_min_max_sum", n, n, 3*nn, [&] () { bench::do_not_optimize(ublasx::min(2*A+A)); bench::do_not_optimize(ublasx::max(2*A+A)); bench::do_not_optimize(ublasx::sum_all(2*A+A)); });
+}
+
+
+template <typename ValueT>
+static void bench_vector(bench::runner& r, std::size_t n)
+{
+    typedef ublas::vector<ValueT> vector_type;
+
+    const std::size_t nn = n*n;
+
+    vector_type v = bench::make_vector<ValueT>(nn);
+    vector_type w = bench::make_vector<ValueT>(nn, 1234UL);
+    vector_type u(v);
+    vector_type x(v);
+    vector_type p(v);
+    // Sparsely populated vector (about one nonzero every 16 elements)
+    vector_type s(nn, ValueT(0));
+    for (std::size_t i = 0; i < nn; i += 16)
+    {
+        s(i) = v(i);
+    }
+
+    r.run<ValueT,void>("vector_sum", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::sum(v)); });
+    r.run<ValueT,void>("vector_cumsum", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::cumsum(v)); });
+    r.run<ValueT,void>("vector_cumsum_inplace", nn, 1, nn, [&] () { ublasx::cumsum_inplace(u); bench::do_not_optimize(u); });
+    r.run<ValueT,void>("vector_cumprod", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::cumprod(v)); });
+    // Restart from the same operand, as repeated products would underflow
+    r.run<ValueT,void>("vector_cumprod_inplace", nn, 1, nn, [&] () { ublas::noalias(p) = v; ublasx::cumprod_inplace(p); bench::do_not_optimize(p); });
+    r.run<ValueT,void>("vector_dot", nn, 1, 2*nn, [&] () { bench::do_not_optimize(ublasx::dot(v, w)); });
+    r.run<ValueT,void>("vector_all", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::all(v)); });
+    r.run<ValueT,void>("vector_any", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::any(s)); });
+    r.run<ValueT,void>("vector_equal", nn, 1, nn, [&] () { bench::do_not_optimize(v == x); });
+    r.run<ValueT,void>("vector_approx_equal", nn, 1, 4*nn, [&] () { bench::do_not_optimize(ublasx::approx_equal(v, x, 1.0e-6, 1.0e-12)); });
+    r.run<ValueT,void>("vector_find", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::find(s)); });
+    r.run<ValueT,void>("vector_which", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::which(s)); });
+}
+
+
+template <typename ValueT>
+static void bench_vector_real(bench::runner& r, std::size_t n)
+{
+    typedef ublas::vector<ValueT> vector_type;
+
+    const std::size_t nn = n*n;
+
+    vector_type v = bench::make_vector<ValueT>(nn);
+
+    r.run<ValueT,void>("vector_max", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::max(v)); });
+    r.run<ValueT,void>("vector_scan_max", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::scan(v, [] (ValueT x, ValueT y) { return std::max(x, y); })); });
+    r.run<ValueT,void>("vector_min", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::min(v)); });
+}
+
+
+int main(int argc, char* argv[])
+{
+    bench::runner r("reductions", argc, argv, {64, 256, 1024});
+
+    for (std::size_t i = 0; i < r.sizes().size(); ++i)
+    {
+        const std::size_t n = r.sizes()[i];
+
+        bench_matrix<float,ublas::row_major>(r, n);
+        bench_matrix<float,ublas::column_major>(r, n);
+        bench_matrix<double,ublas::row_major>(r, n);
+        bench_matrix<double,ublas::column_major>(r, n);
+        bench_matrix<std::complex<double>,ublas::row_major>(r, n);
+        bench_matrix<std::complex<double>,ublas::column_major>(r, n);
+
+        bench_matrix_real<float,ublas::row_major>(r, n);
+        bench_matrix_real<float,ublas::column_major>(r, n);
+        bench_matrix_real<double,ublas::row_major>(r, n);
+        bench_matrix_real<double,ublas::column_major>(r, n);
+
+        bench_vector<float>(r, n);
+        bench_vector<double>(r, n);
+        bench_vector<std::complex<double> >(r, n);
+
+        bench_vector_real<float>(r, n);
+        bench_vector_real<double>(r, n);
+    }
+}
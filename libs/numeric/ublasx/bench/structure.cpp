@@ -0,0 +1,120 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/bench/structure.cpp
+ *
+ * \brief Benchmark suite for structural (data movement) operations and
+ *  matrix/vector generators.
+ *
+ * These operations perform no arithmetic, so no flop model is given and the
+ * reported GFLOP/s is \c null.
+ *
+ * <hr/>
+ *
+ *  Copyright (c) 2009-2012, Marco Guazzone
+ *
+ *  Distributed under the Boost Software License, Version 1.0. (See
+ *  accompanying file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/cat.hpp>
+#include <boost/numeric/ublasx/operation/diag.hpp>
+#include <boost/numeric/ublasx/operation/eye.hpp>
+#include <boost/numeric/ublasx/operation/hilb.hpp>
+#include <boost/numeric/ublasx/operation/linspace.hpp>
+#include <boost/numeric/ublasx/operation/logspace.hpp>
+#include <boost/numeric/ublasx/operation/rep.hpp>
+#include <boost/numeric/ublasx/operation/reshape.hpp>
+#include <boost/numeric/ublasx/operation/rot90.hpp>
+#include <boost/numeric/ublasx/operation/seq.hpp>
+#include <boost/numeric/ublasx/operation/tril.hpp>
+#include <boost/numeric/ublasx/operation/triu.hpp>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/bench/utils.hpp"
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+namespace bench = ::boost::numeric::ublasx::bench;
+
+
+template <typename ValueT, typename LayoutT>
+static void bench_matrix(bench::runner& r, std::size_t n)
+{
+    typedef ublas::matrix<ValueT,LayoutT> matrix_type;
+    typedef ublas::vector<ValueT> vector_type;
+
+    matrix_type A = bench::make_matrix<ValueT,LayoutT>(n, n);
+    matrix_type B = bench::make_matrix<ValueT,LayoutT>(n, n, 1234UL);
+    vector_type v = bench::make_vector<ValueT>(n);
+    matrix_type C(n, n);
+    vector_type d(n);
+
+    r.run<ValueT,LayoutT>("cat_rows", n, n, -1, [&] () { bench::do_not_optimize(ublasx::cat_rows(A, B)); });
+    r.run<ValueT,LayoutT>("cat_columns", n, n, -1, [&] () { bench::do_not_optimize(ublasx::cat_columns(A, B)); });
+    r.run<ValueT,LayoutT>("cat_block", n, n, -1, [&] () { bench::do_not_optimize(ublasx::cat_columns(ublasx::cat_rows(A, B), ublasx::cat_rows(B, A))); });
+    r.run<ValueT,LayoutT>("lazy_cat_block", n, n, -1, [&] () { bench::do_not_optimize(ublasx::lazy_cat_columns(ublasx::lazy_cat_rows(A, B), ublasx::lazy_cat_rows(B, A)).eval()); });
+    r.run<ValueT,LayoutT>("rep", n, n, -1, [&] () { bench::do_not_optimize(ublasx::rep(A, 2, 2)); });
+    r.run<ValueT,LayoutT>("reshape", n, n, -1, [&] () { bench::do_not_optimize(ublasx::reshape(A, n/2, 2*n)); });
+    r.run<ValueT,LayoutT>("rot90", n, n, -1, [&] () { bench::do_not_optimize(ublasx::rot90(A, 1)); });
+    r.run<ValueT,LayoutT>("rot90_inplace", n, n, -1, [&] () {
+            ublasx::rot90_inplace(C, 1);
+            bench::do_not_optimize(C);
+        });
+    r.run<ValueT,LayoutT>("tril", n, n, -1, [&] () { bench::do_not_optimize(ublasx::tril(A)); });
+    r.run<ValueT,LayoutT>("triu", n, n, -1, [&] () { bench::do_not_optimize(ublasx::triu(A)); });
+    r.run<ValueT,LayoutT>("diag_matrix", n, n, -1, [&] () {
+            ublas::noalias(d) = ublasx::diag(A);
+            bench::do_not_optimize(d);
+        });
+    r.run<ValueT,LayoutT>("diag_vector", n, n, -1, [&] () {
+            ublas::noalias(C) = ublasx::diag(v, 0, LayoutT());
+            bench::do_not_optimize(C);
+        });
+    r.run<ValueT,LayoutT>("eye", n, n, -1, [&] () {
+            ublas::noalias(C) = ublasx::eye<ValueT>(n);
+            bench::do_not_optimize(C);
+        });
+}
+
+
+template <typename ValueT>
+static void bench_generators(bench::runner& r, std::size_t n)
+{
+    const std::size_t nn = n*n;
+
+    r.run<ValueT,void>("linspace", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::linspace<ValueT>(0, 1, nn)); });
+    r.run<ValueT,void>("logspace", nn, 1, nn, [&] () { bench::do_not_optimize(ublasx::logspace<ValueT>(0, 1, nn)); });
+    r.run<ValueT,void>("seq", nn, 1, -1, [&] () {
+            ublas::vector<ValueT> s(ublasx::seq<ValueT>(0, nn));
+            bench::do_not_optimize(s);
+        });
+    r.run<ValueT,void>("hilb", n, n, static_cast<double>(n)*n, [&] () { bench::do_not_optimize(ublasx::hilb<ValueT>(n)); });
+}
+
+
+int main(int argc, char* argv[])
+{
+    bench::runner r("structure", argc, argv, {64, 256, 1024});
+
+    for (std::size_t i = 0; i < r.sizes().size(); ++i)
+    {
+        const std::size_t n = r.sizes()[i];
+
+        bench_matrix<float,ublas::row_major>(r, n);
+        bench_matrix<float,ublas::column_major>(r, n);
+        bench_matrix<double,ublas::row_major>(r, n);
+        bench_matrix<double,ublas::column_major>(r, n);
+        bench_matrix<std::complex<double>,ublas::row_major>(r, n);
+        bench_matrix<std::complex<double>,ublas::column_major>(r, n);
+
+        bench_generators<float>(r, n);
+        bench_generators<double>(r, n);
+    }
+}
@@ -0,0 +1,542 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/bench/utils.hpp
+ *
+ * \brief Utility classes/functions for benchmarking purpose.
+ *
+ * Basic usage:
+ * <pre>
+ * template <typename ValueT, typename LayoutT>
+ * void bench_my_op(ublasx::bench::runner& r, std::size_t n)
+ * {
+ *   ublas::matrix<ValueT,LayoutT> A = ublasx::bench::make_matrix<ValueT,LayoutT>(n, n);
+ *
+ *   r.run<ValueT,LayoutT>("my_op", n, n, n*n, [&] () {
+ *       ublasx::bench::do_not_optimize(my_op(A));
+ *   });
+ * }
+ *
+ * int main(int argc, char* argv[])
+ * {
+ *   ublasx::bench::runner r("My Suite", argc, argv, {64, 256});
+ *
+ *   for (std::size_t i = 0; i < r.sizes().size(); ++i)
+ *   {
+ *     bench_my_op<double,ublas::row_major>(r, r.sizes()[i]);
+ *     // ...
+ *   }
+ * }
+ * </pre>
+ *
+ * Each measure is written on the standard output as a single line JSON object
+ * with the following fields:
+ * - \c suite: the name of the benchmark suite,
+ * - \c bench: the name of the benchmarked operation,
+ * - \c value_type: the value type of the operands,
+ * - \c layout: the storage layout of the operands (\c row_major, \c column_major or \c none),
+ * - \c rows, \c cols: the size of the main operand,
+ * - \c iterations: the number of timed calls,
+ * - \c ns_per_op: the mean wall-clock time per call (in nanoseconds),
+ * - \c gflops: the nominal GFLOP/s rate (\c null if no flop model is given),
+ * - \c bytes_per_op: the mean number of bytes dynamically allocated per call,
+ * - \c allocs_per_op: the mean number of dynamic allocations per call.
+ * Diagnostic messages go to the standard error.
+ *
+ * Command line arguments, if any, are the problem sizes to use in place of the
+ * suite defaults.
+ * The following environment variables are also taken into account:
+ * - \c BOOST_UBLASX_BENCH_MIN_TIME: the minimum time (in seconds) to spend for
+ *   each measure (default to 0.1),
+ * - \c BOOST_UBLASX_BENCH_FILTER: only run benchmarks whose name contains the
+ *   given string.
+ *
+ * Allocations are tracked by replacing the global \c operator \c new and
+ * \c operator \c delete.
+ * Since replacement functions must be defined exactly once in a program, this
+ * header must be included by a single translation unit (which is the case of
+ * every benchmark in this directory); define
+ * \c BOOST_UBLASX_BENCH_NO_ALLOC_HOOK to disable this feature.
+ *
+ * <hr/>
+ *
+ *  Copyright (c) 2009-2012, Marco Guazzone
+ *
+ *  Distributed under the Boost Software License, Version 1.0. (See
+ *  accompanying file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * \author Marco Guazzone, marco.guazzone@gmail.com
+ */
+
+#ifndef BOOST_NUMERIC_UBLASX_BENCH_UTILS_HPP
+#define BOOST_NUMERIC_UBLASX_BENCH_UTILS_HPP
+
+
+#include <boost/numeric/ublas/functional.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace numeric { namespace ublasx { namespace bench {
+
+namespace detail {
+
+/**
+ * \brief Counters of dynamic memory allocations.
+ *
+ * Allocations may come from the worker threads of parallel operations, hence
+ * the atomic counters; relaxed increments are enough since the counters are
+ * only read between timed runs.
+ */
+struct alloc_counters
+{
+    ::std::atomic< ::std::size_t > bytes;
+    ::std::atomic< ::std::size_t > count;
+};
+
+
+/// Snapshot of the allocation counters.
+struct alloc_snapshot
+{
+    ::std::size_t bytes;
+    ::std::size_t count;
+};
+
+
+/// Return the process-wide allocation counters.
+inline
+alloc_counters& global_alloc_counters()
+{
+    static alloc_counters counters = {{0}, {0}};
+
+    return counters;
+}
+
+
+/// Read the process-wide allocation counters.
+inline
+alloc_snapshot global_alloc_snapshot()
+{
+    alloc_counters const& counters = global_alloc_counters();
+    alloc_snapshot snapshot = {counters.bytes.load(::std::memory_order_relaxed),
+                               counters.count.load(::std::memory_order_relaxed)};
+
+    return snapshot;
+}
+
+} // Namespace detail
+
+
+/// Traits class that gives a printable name to value types.
+template <typename T>
+struct value_type_name;
+
+template <>
+struct value_type_name<float>
+{
+    static char const* get() { return "float"; }
+};
+
+template <>
+struct value_type_name<double>
+{
+    static char const* get() { return "double"; }
+};
+
+template <>
+struct value_type_name< ::std::complex<float> >
+{
+    static char const* get() { return "complex<float>"; }
+};
+
+template <>
+struct value_type_name< ::std::complex<double> >
+{
+    static char const* get() { return "complex<double>"; }
+};
+
+
+/// Traits class that gives a printable name to storage layouts.
+template <typename LayoutT>
+struct layout_name
+{
+    static char const* get() { return "none"; }
+};
+
+template <>
+struct layout_name< ::boost::numeric::ublas::row_major >
+{
+    static char const* get() { return "row_major"; }
+};
+
+template <>
+struct layout_name< ::boost::numeric::ublas::column_major >
+{
+    static char const* get() { return "column_major"; }
+};
+
+
+/**
+ * \brief Prevent the compiler from optimizing away the computation of \a x.
+ */
+template <typename T>
+inline
+void do_not_optimize(T const& x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__ ("" : : "g"(&x) : "memory");
+#else
+    static volatile char const* sink;
+    sink = reinterpret_cast<volatile char const*>(&x);
+#endif // __GNUC__
+}
+
+
+namespace detail {
+
+template <typename ValueT>
+struct flops_factor
+{
+    static double get() { return 1; }
+};
+
+template <typename T>
+struct flops_factor< ::std::complex<T> >
+{
+    static double get() { return 4; }
+};
+
+
+/// Deterministic (LCG-based) pseudo-random numbers in [-1,1).
+class random_generator
+{
+    public: explicit random_generator(unsigned long seed = 5489UL)
+    : state_(seed)
+    {
+    }
+
+    public: double operator()()
+    {
+        state_ = (state_*6364136223846793005ULL + 1442695040888963407ULL);
+        return static_cast<double>(state_ >> 11)/static_cast<double>(1ULL << 52) - 1.0;
+    }
+
+    private: unsigned long long state_;
+};
+
+
+template <typename T>
+struct random_value
+{
+    static T get(random_generator& rng)
+    {
+        return static_cast<T>(rng());
+    }
+};
+
+template <typename T>
+struct random_value< ::std::complex<T> >
+{
+    static ::std::complex<T> get(random_generator& rng)
+    {
+        T re = static_cast<T>(rng());
+        T im = static_cast<T>(rng());
+        return ::std::complex<T>(re, im);
+    }
+};
+
+} // Namespace detail
+
+
+/**
+ * \brief Scale the nominal number of real floating-point operations \a f
+ *  according to the value type \a ValueT.
+ *
+ * A complex multiply-add costs about four times its real counterpart.
+ */
+template <typename ValueT>
+inline
+double scaled_flops(double f)
+{
+    return detail::flops_factor<ValueT>::get()*f;
+}
+
+
+/**
+ * \brief Make a \a nr by \a nc matrix filled with reproducible pseudo-random
+ *  values in [-1,1).
+ */
+template <typename ValueT, typename LayoutT>
+::boost::numeric::ublas::matrix<ValueT,LayoutT> make_matrix(::std::size_t nr, ::std::size_t nc, unsigned long seed = 5489UL)
+{
+    detail::random_generator rng(seed);
+
+    ::boost::numeric::ublas::matrix<ValueT,LayoutT> A(nr, nc);
+    for (::std::size_t r = 0; r < nr; ++r)
+    {
+        for (::std::size_t c = 0; c < nc; ++c)
+        {
+            A(r,c) = detail::random_value<ValueT>::get(rng);
+        }
+    }
+
+    return A;
+}
+
+
+/**
+ * \brief Make a \a n by \a n well-conditioned (strictly diagonally dominant)
+ *  pseudo-random matrix.
+ */
+template <typename ValueT, typename LayoutT>
+::boost::numeric::ublas::matrix<ValueT,LayoutT> make_nonsingular_matrix(::std::size_t n, unsigned long seed = 5489UL)
+{
+    ::boost::numeric::ublas::matrix<ValueT,LayoutT> A = make_matrix<ValueT,LayoutT>(n, n, seed);
+    for (::std::size_t i = 0; i < n; ++i)
+    {
+        A(i,i) += static_cast<ValueT>(n);
+    }
+
+    return A;
+}
+
+
+/**
+ * \brief Make a \a n by \a n symmetric positive definite pseudo-random matrix.
+ */
+template <typename ValueT, typename LayoutT>
+::boost::numeric::ublas::matrix<ValueT,LayoutT> make_spd_matrix(::std::size_t n, unsigned long seed = 5489UL)
+{
+    ::boost::numeric::ublas::matrix<ValueT,LayoutT> A = make_matrix<ValueT,LayoutT>(n, n, seed);
+    for (::std::size_t r = 0; r < n; ++r)
+    {
+        for (::std::size_t c = 0; c < r; ++c)
+        {
+            A(c,r) = A(r,c);
+        }
+        A(r,r) = ::std::abs(A(r,r)) + static_cast<ValueT>(n);
+    }
+
+    return A;
+}
+
+
+/**
+ * \brief Make a vector of size \a n filled with reproducible pseudo-random
+ *  values in [-1,1).
+ */
+template <typename ValueT>
+::boost::numeric::ublas::vector<ValueT> make_vector(::std::size_t n, unsigned long seed = 5489UL)
+{
+    detail::random_generator rng(seed);
+
+    ::boost::numeric::ublas::vector<ValueT> v(n);
+    for (::std::size_t i = 0; i < n; ++i)
+    {
+        v(i) = detail::random_value<ValueT>::get(rng);
+    }
+
+    return v;
+}
+
+
+/// Result of a single benchmark measure.
+struct measure
+{
+    ::std::size_t iterations;
+    double ns_per_op;
+    double gflops; ///< Negative if unknown.
+    double bytes_per_op;
+    double allocs_per_op;
+};
+
+
+/**
+ * \brief Run benchmarks and report measures in JSON-lines format.
+ */
+class runner
+{
+    public: runner(::std::string const& suite, int argc, char* argv[], ::std::vector< ::std::size_t > const& default_sizes)
+    : suite_(suite),
+      sizes_(default_sizes),
+      min_time_(0.1)
+    {
+        if (argc > 1)
+        {
+            sizes_.clear();
+            for (int i = 1; i < argc; ++i)
+            {
+                ::std::size_t n = static_cast< ::std::size_t >(::std::strtoul(argv[i], 0, 10));
+                if (n > 0)
+                {
+                    sizes_.push_back(n);
+                }
+            }
+        }
+
+        char const* env = ::std::getenv("BOOST_UBLASX_BENCH_MIN_TIME");
+        if (env && ::std::atof(env) > 0)
+        {
+            min_time_ = ::std::atof(env);
+        }
+        env = ::std::getenv("BOOST_UBLASX_BENCH_FILTER");
+        if (env)
+        {
+            filter_ = env;
+        }
+
+        ::std::cerr << "--- Benchmark Suite: " << suite_ << " ---" << ::std::endl;
+    }
+
+    /// The problem sizes to run.
+    public: ::std::vector< ::std::size_t > const& sizes() const
+    {
+        return sizes_;
+    }
+
+    /**
+     * \brief Time the callable \a f and output the resulting measure.
+     *
+     * \param name The name of the benchmark.
+     * \param nr The number of rows of the main operand.
+     * \param nc The number of columns of the main operand.
+     * \param flops The nominal number of floating-point operations performed
+     *  by a call to \a f, or a negative number if unknown.
+     * \param f The callable to benchmark.
+     */
+    public: template <typename ValueT, typename LayoutT, typename FuncT>
+        void run(::std::string const& name, ::std::size_t nr, ::std::size_t nc, double flops, FuncT f)
+    {
+        if (!filter_.empty() && name.find(filter_) == ::std::string::npos)
+        {
+            return;
+        }
+
+        measure m = time(f, flops);
+
+        ::std::ostringstream oss;
+        oss.precision(::std::numeric_limits<double>::digits10);
+        oss << "{\"suite\":\"" << suite_ << "\""
+            << ",\"bench\":\"" << name << "\""
+            << ",\"value_type\":\"" << value_type_name<ValueT>::get() << "\""
+            << ",\"layout\":\"" << layout_name<LayoutT>::get() << "\""
+            << ",\"rows\":" << nr
+            << ",\"cols\":" << nc
+            << ",\"iterations\":" << m.iterations
+            << ",\"ns_per_op\":" << m.ns_per_op
+            << ",\"gflops\":";
+        if (m.gflops < 0)
+        {
+            oss << "null";
+        }
+        else
+        {
+            oss << m.gflops;
+        }
+        oss << ",\"bytes_per_op\":" << m.bytes_per_op
+            << ",\"allocs_per_op\":" << m.allocs_per_op
+            << "}";
+
+        ::std::cout << oss.str() << ::std::endl;
+    }
+
+    /// Calibrate the number of iterations and time the callable \a f.
+    private: template <typename FuncT>
+        measure time(FuncT& f, double flops) const
+    {
+        typedef ::std::chrono::steady_clock clock_type;
+
+        // Warm up (caches, lazily allocated workspaces, ...)
+        f();
+
+        measure m;
+        ::std::size_t niters = 1;
+        while (true)
+        {
+            detail::alloc_snapshot start_alloc = detail::global_alloc_snapshot();
+            clock_type::time_point start_time = clock_type::now();
+            for (::std::size_t i = 0; i < niters; ++i)
+            {
+                f();
+            }
+            double elapsed = ::std::chrono::duration<double>(clock_type::now()-start_time).count();
+            detail::alloc_snapshot stop_alloc = detail::global_alloc_snapshot();
+
+            if (elapsed >= min_time_ || niters >= (::std::numeric_limits< ::std::size_t >::max() >> 1))
+            {
+                m.iterations = niters;
+                m.ns_per_op = elapsed*1.0e9/niters;
+                m.gflops = (flops >= 0 && elapsed > 0) ? flops*niters/elapsed*1.0e-9 : -1;
+                m.bytes_per_op = static_cast<double>(stop_alloc.bytes-start_alloc.bytes)/niters;
+                m.allocs_per_op = static_cast<double>(stop_alloc.count-start_alloc.count)/niters;
+                break;
+            }
+
+            // Estimate the number of iterations needed to reach the minimum time
+            ::std::size_t next = (elapsed > 0) ? static_cast< ::std::size_t >(niters*1.4*min_time_/elapsed) : niters*10;
+            niters = ::std::max(niters*2, ::std::min(next, niters*100));
+        }
+
+        return m;
+    }
+
+
+    private: ::std::string suite_;
+    private: ::std::vector< ::std::size_t > sizes_;
+    private: double min_time_;
+    private: ::std::string filter_;
+};
+
+}}}} // Namespace boost::numeric::ublasx::bench
+
+
+#ifndef BOOST_UBLASX_BENCH_NO_ALLOC_HOOK
+
+void* operator new(::std::size_t n)
+{
+    ::boost::numeric::ublasx::bench::detail::alloc_counters& counters = ::boost::numeric::ublasx::bench::detail::global_alloc_counters();
+    counters.bytes.fetch_add(n, ::std::memory_order_relaxed);
+    counters.count.fetch_add(1, ::std::memory_order_relaxed);
+
+    void* p = ::std::malloc(n > 0 ? n : 1);
+    if (!p)
+    {
+        throw ::std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](::std::size_t n)
+{
+    return ::operator new(n);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+// Not inlined to prevent spurious new/free mismatch warnings at call sites
+__attribute__((noinline))
+#endif // __GNUC__
+void operator delete(void* p) noexcept
+{
+    ::std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    ::operator delete(p);
+}
+
+#endif // BOOST_UBLASX_BENCH_NO_ALLOC_HOOK
+
+#endif // BOOST_NUMERIC_UBLASX_BENCH_UTILS_HPP
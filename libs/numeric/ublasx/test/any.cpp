@@ -346,6 +346,65 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_long_containers )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Containers" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    // Longer than a few blocks of the block-wise kernels, with a length which
+    // is not a multiple of the block size
+
+    const ::std::size_t n(1000);
+    const ::std::size_t pos[] = {0, 63, 64, 700, 999};
+    const ::std::size_t npos(sizeof(pos)/sizeof(pos[0]));
+
+    bool expect(false);
+    bool res(false);
+
+    vector_type v(n, 0);
+    matrix_type A(40, 25, 0);
+
+    // any(0)
+    expect = false;
+    res = ublasx::any(v);
+    BOOST_UBLASX_DEBUG_TRACE( "any(zeros(" << n << ")) = " << ::std::boolalpha << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+    res = ublasx::any(A);
+    BOOST_UBLASX_DEBUG_TRACE( "any(zeros(40,25)) = " << ::std::boolalpha << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+    res = ublasx::any(ublas::trans(A));
+    BOOST_UBLASX_DEBUG_TRACE( "any(zeros(40,25)') = " << ::std::boolalpha << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    // any(v) with a single nonzero element
+    for (::std::size_t k = 0; k < npos; ++k)
+    {
+        v(pos[k]) = 1;
+        A(pos[k] % 40, pos[k] / 40) = 1;
+
+        expect = true;
+        res = ublasx::any(v);
+        BOOST_UBLASX_DEBUG_TRACE( "any(e_" << pos[k] << ") = " << ::std::boolalpha << res << " ==> " << expect );
+        BOOST_UBLASX_TEST_CHECK( res == expect );
+        res = ublasx::any(v + v);
+        BOOST_UBLASX_DEBUG_TRACE( "any(e_" << pos[k] << " + e_" << pos[k] << ") = " << ::std::boolalpha << res << " ==> " << expect );
+        BOOST_UBLASX_TEST_CHECK( res == expect );
+        res = ublasx::any(A);
+        BOOST_UBLASX_DEBUG_TRACE( "any(E_" << pos[k] << ") = " << ::std::boolalpha << res << " ==> " << expect );
+        BOOST_UBLASX_TEST_CHECK( res == expect );
+        res = ublasx::any(ublas::trans(A));
+        BOOST_UBLASX_DEBUG_TRACE( "any(E_" << pos[k] << "') = " << ::std::boolalpha << res << " ==> " << expect );
+        BOOST_UBLASX_TEST_CHECK( res == expect );
+
+        v(pos[k]) = 0;
+        A(pos[k] % 40, pos[k] / 40) = 0;
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'any' operation");
@@ -359,6 +418,7 @@ int main()
     BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
     BOOST_UBLASX_TEST_DO( test_matrix_expression );
     BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_long_containers );
 
     BOOST_UBLASX_TEST_END();
 }
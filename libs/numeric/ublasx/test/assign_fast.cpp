@@ -0,0 +1,399 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/assign_fast.cpp
+ *
+ * \brief Test suite for the \c assign_fast operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
+#include <boost/numeric/ublasx/operation/abs.hpp>
+#include <boost/numeric/ublasx/operation/assign_fast.hpp>
+#include <boost/numeric/ublasx/operation/pow.hpp>
+#include <boost/numeric/ublasx/operation/sqr.hpp>
+#include <boost/numeric/ublasx/operation/transform.hpp>
+#include <boost/static_assert.hpp>
+#include <complex>
+#include <cstddef>
+#include <stdexcept>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+
+
+static const double tol = 1.0e-5;
+
+
+/// Throw on negative arguments.
+template <typename T>
+struct throw_on_negative
+{
+    typedef T argument_type;
+    typedef T result_type;
+
+    T operator()(T const& x) const
+    {
+        if (x < 0)
+        {
+            throw std::domain_error("Negative argument");
+        }
+        return x;
+    }
+};
+
+
+/// Count its calls (non-const call operator).
+template <typename T>
+struct call_counter
+{
+    typedef T argument_type;
+    typedef T result_type;
+
+    call_counter()
+    : count_(0)
+    {
+    }
+
+    T operator()(T const& /*x*/)
+    {
+        return count_++;
+    }
+
+    T count_;
+};
+
+
+BOOST_UBLASX_TEST_DEF( test_row_major_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Row-major Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    matrix_type A(2,3);
+    A(0,0) = -1; A(0,1) =  2; A(0,2) = -3;
+    A(1,0) =  4; A(1,1) = -5; A(1,2) =  6;
+
+    matrix_type B(2,3);
+    B(0,0) =  1; B(0,1) =  1; B(0,2) =  1;
+    B(1,0) =  2; B(1,1) =  2; B(1,2) =  2;
+
+    // The expressions below have a flat evaluator
+    BOOST_STATIC_ASSERT((
+        ublasx::detail::flat_evaluator<
+            ublas::matrix_binary<
+                ublasx::matrix_unary_functor_traits<matrix_type, ublasx::detail::abs_functor<value_type,value_type> >::result_type,
+                matrix_type,
+                ublas::scalar_plus<value_type,value_type>
+            >,
+            ublas::row_major_tag
+        >::value
+    ));
+
+    matrix_type expect_X(2,3);
+    matrix_type X(2,3);
+
+    // Functor expression and uBLAS binary expression
+    expect_X(0,0) = 2; expect_X(0,1) = 3; expect_X(0,2) = 4;
+    expect_X(1,0) = 6; expect_X(1,1) = 7; expect_X(1,2) = 8;
+    ublasx::assign_fast(X, ublasx::abs(A)+B);
+    BOOST_UBLASX_DEBUG_TRACE( "abs(A)+B = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+
+    // Binary functor expressions with a scalar operand, and uBLAS unary expression
+    expect_X(0,0) =  -1; expect_X(0,1) =  -4; expect_X(0,2) =  -9;
+    expect_X(1,0) = -16; expect_X(1,1) = -25; expect_X(1,2) = -36;
+    ublasx::assign_fast(X, -ublasx::pow(A, 2.0));
+    BOOST_UBLASX_DEBUG_TRACE( "-pow(A,2) = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+
+    expect_X(0,0) = 0.5; expect_X(0,1) =   4; expect_X(0,2) = 0.125;
+    expect_X(1,0) =  16; expect_X(1,1) = 1.0/32.0; expect_X(1,2) = 64;
+    ublasx::assign_fast(X, ublasx::pow(2.0, A));
+    BOOST_UBLASX_DEBUG_TRACE( "pow(2,A) = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+
+    // The destination as an element-wise operand
+    expect_X(0,0) =  1; expect_X(0,1) =  4; expect_X(0,2) =  9;
+    expect_X(1,0) = 16; expect_X(1,1) = 25; expect_X(1,2) = 36;
+    X = A;
+    ublasx::assign_fast(X, ublasx::sqr(X));
+    BOOST_UBLASX_DEBUG_TRACE( "sqr(A) = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_column_major_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Column-major Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+
+    matrix_type A(2,3);
+    A(0,0) = -1; A(0,1) =  2; A(0,2) = -3;
+    A(1,0) =  4; A(1,1) = -5; A(1,2) =  6;
+
+    row_major_matrix_type B(2,3);
+    B(0,0) =  1; B(0,1) =  1; B(0,2) =  1;
+    B(1,0) =  2; B(1,1) =  2; B(1,2) =  2;
+
+    matrix_type expect_X(2,3);
+    expect_X(0,0) = 2; expect_X(0,1) = 3; expect_X(0,2) = 4;
+    expect_X(1,0) = 6; expect_X(1,1) = 7; expect_X(1,2) = 8;
+
+    matrix_type X(2,3);
+
+    ublasx::assign_fast(X, ublasx::abs(A)+matrix_type(B));
+    BOOST_UBLASX_DEBUG_TRACE( "abs(A)+B = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+
+    // Operands with different orientations are assigned by uBLAS
+    BOOST_STATIC_ASSERT((
+        !ublasx::detail::flat_evaluator<row_major_matrix_type, ublas::column_major_tag>::value
+    ));
+
+    ublasx::assign_fast(X, ublasx::abs(A)+B);
+    BOOST_UBLASX_DEBUG_TRACE( "abs(A)+B = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 3, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_not_flat_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Matrix - Not Flat Expressions" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::compressed_matrix<value_type> sparse_matrix_type;
+
+    matrix_type A(2,2);
+    A(0,0) = -1; A(0,1) =  2;
+    A(1,0) =  4; A(1,1) = -5;
+
+    matrix_type expect_X(2,2);
+    expect_X(0,0) = 1; expect_X(0,1) = 4;
+    expect_X(1,0) = 2; expect_X(1,1) = 5;
+
+    // Transposed operand
+    matrix_type X(2,2);
+    ublasx::assign_fast(X, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_DEBUG_TRACE( "abs(A') = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, 2, 2, tol );
+
+    // Sparse destination
+    sparse_matrix_type S(2,2);
+    ublasx::assign_fast(S, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_DEBUG_TRACE( "abs(A') = " << S );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( S, expect_X, 2, 2, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Vector" );
+
+    typedef std::complex<double> value_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    vector_type v(3);
+    v(0) = value_type(3,4); v(1) = value_type(0,-2); v(2) = value_type(-1,0);
+
+    vector_type expect_w(3);
+    expect_w(0) = value_type(-5,0); expect_w(1) = value_type(-2,0); expect_w(2) = value_type(-1,0);
+
+    vector_type w(3);
+
+    ublasx::assign_fast(w, -ublasx::abs(v));
+    BOOST_UBLASX_DEBUG_TRACE( "-abs(v) = " << w );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, 3, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Long Matrix" );
+
+    // Long enough to be split among several threads
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef std::size_t size_type;
+
+    const size_type nr(701);
+    const size_type nc(503);
+
+    matrix_type A(nr,nc);
+    matrix_type B(nr,nc);
+    matrix_type expect_X(nr,nc);
+    for (size_type i = 0; i < nr; ++i)
+    {
+        for (size_type j = 0; j < nc; ++j)
+        {
+            A(i,j) = (i % 2) ? -value_type(i+j) : value_type(i*j);
+            B(i,j) = value_type(j);
+            expect_X(i,j) = ((i % 2) ? value_type(i+j) : value_type(i*j)) + value_type(j);
+        }
+    }
+
+    matrix_type X(nr,nc);
+
+    ublasx::assign_fast(ublasx::execution::par, X, ublasx::abs(A)+B);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, nr, nc, tol );
+
+    X = ublas::zero_matrix<value_type>(nr, nc);
+    ublasx::assign_fast(X, ublasx::abs(A)+B);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, nr, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_vector_mutable_functor )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Long Vector - Functor with a Non-const Call Operator" );
+
+    // Without execution policy, the functor is called sequentially, in
+    // storage order, even for containers long enough to be split among
+    // several threads
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef std::size_t size_type;
+
+    const size_type n(300007);
+
+    vector_type v(n, 0);
+    vector_type expect_w(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        expect_w(i) = value_type(i);
+    }
+
+    vector_type w(n);
+
+    ublasx::assign_fast(w, ublasx::transform(v, call_counter<value_type>()));
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( w, expect_w, n );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_policy_long_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Long Matrix - Execution Policy" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::compressed_matrix<value_type> sparse_matrix_type;
+    typedef std::size_t size_type;
+
+    const size_type nr(701);
+    const size_type nc(503);
+
+    matrix_type A(nc,nr);
+    matrix_type expect_X(nr,nc);
+    for (size_type i = 0; i < nr; ++i)
+    {
+        for (size_type j = 0; j < nc; ++j)
+        {
+            A(j,i) = (i % 2) ? -value_type(i+j) : value_type(i*j);
+            expect_X(i,j) = (i % 2) ? value_type(i+j) : value_type(i*j);
+        }
+    }
+
+    matrix_type X(nr,nc);
+
+    // Flat loop
+    ublasx::assign_fast(ublasx::execution::seq, X, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, nr, nc, tol );
+
+    // Blocks of rows
+    X = ublas::zero_matrix<value_type>(nr, nc);
+    ublasx::assign_fast(ublasx::execution::par, X, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, nr, nc, tol );
+
+    X = ublas::zero_matrix<value_type>(nr, nc);
+    ublasx::assign_fast(ublasx::execution::par_unseq, X, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, nr, nc, tol );
+
+    // Sparse destinations are assigned by uBLAS
+    sparse_matrix_type S(nr,nc);
+    ublasx::assign_fast(ublasx::execution::par, S, ublasx::abs(ublas::trans(A)));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( S, expect_X, nr, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_policy_exception )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Execution Policy - Exception" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef std::size_t size_type;
+
+    const size_type n(300007);
+
+    vector_type v(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = value_type(i);
+    }
+    v(n-1) = -1;
+
+    vector_type w(n);
+
+    bool thrown(false);
+    try
+    {
+        ublasx::assign_fast(ublasx::execution::par, w, ublasx::transform(v, throw_on_negative<value_type>()));
+    }
+    catch (std::domain_error const&)
+    {
+        thrown = true;
+    }
+    BOOST_UBLASX_TEST_CHECK( thrown );
+
+    // The threads are still usable
+    v(n-1) = value_type(n-1);
+    ublasx::assign_fast(ublasx::execution::par, w, ublasx::transform(v, throw_on_negative<value_type>()));
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, v, n, tol );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'assign_fast' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( test_row_major_matrix );
+    BOOST_UBLASX_TEST_DO( test_column_major_matrix );
+    BOOST_UBLASX_TEST_DO( test_not_flat_matrix );
+    BOOST_UBLASX_TEST_DO( test_vector );
+    BOOST_UBLASX_TEST_DO( test_long_matrix );
+    BOOST_UBLASX_TEST_DO( test_long_vector_mutable_functor );
+    BOOST_UBLASX_TEST_DO( test_policy_long_matrix );
+    BOOST_UBLASX_TEST_DO( test_policy_exception );
+
+    BOOST_UBLASX_TEST_END();
+}
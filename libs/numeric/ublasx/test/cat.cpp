@@ -21,6 +21,7 @@
 #include <boost/numeric/ublas/fwd.hpp>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublasx/operation/cat.hpp>
 #include <boost/numeric/ublasx/operation/num_columns.hpp>
 #include <boost/numeric/ublasx/operation/num_rows.hpp>
@@ -378,6 +379,95 @@ BOOST_UBLASX_TEST_DEF( test_columns_dense_matrix_row_major_diff_dim )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_lazy_nested_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Lazy Concatenation - Nested Views - Dense Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A(2,2);
+    A(0,0) =  1; A(0,1) =  2;
+    A(1,0) =  3; A(1,1) =  4;
+
+    matrix_type B(2,1);
+    B(0,0) =  5;
+    B(1,0) =  6;
+
+    matrix_type C(1,3);
+    C(0,0) =  7; C(0,1) =  8; C(0,2) = 9;
+
+    matrix_type D(2,2);
+    D(0,0) = 10; D(0,1) = 11;
+    D(1,0) = 12; D(1,1) = 13;
+
+    matrix_type expect_R(5,3);
+    expect_R(0,0) =  1; expect_R(0,1) =  2; expect_R(0,2) = 5;
+    expect_R(1,0) =  3; expect_R(1,1) =  4; expect_R(1,2) = 6;
+    expect_R(2,0) =  7; expect_R(2,1) =  8; expect_R(2,2) = 9;
+    expect_R(3,0) = 10; expect_R(3,1) = 11; expect_R(3,2) = 0;
+    expect_R(4,0) = 12; expect_R(4,1) = 13; expect_R(4,2) = 0;
+
+    matrix_type R;
+
+    // Evaluation
+    R = ublasx::lazy_cat_columns(ublasx::lazy_cat_columns(ublasx::lazy_cat_rows(A, B), C), D).eval();
+
+    BOOST_UBLASX_DEBUG_TRACE( "[[A B]; C; D] = " << R );
+    BOOST_UBLASX_DEBUG_TRACE( "expect [[A B]; C; D] = " << expect_R );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == ublasx::num_rows(expect_R) );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == ublasx::num_columns(expect_R) );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, ublasx::num_rows(expect_R), ublasx::num_columns(expect_R), tol );
+
+    // Element access
+    R = ublasx::lazy_cat<1>(ublasx::lazy_cat<1>(ublasx::lazy_cat<2>(A, B), C), D);
+
+    BOOST_UBLASX_DEBUG_TRACE( "[[A B]; C; D] = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, ublasx::num_rows(expect_R), ublasx::num_columns(expect_R), tol );
+
+    // Use inside an expression
+    R = 2*ublasx::lazy_cat_columns(ublasx::lazy_cat_columns(ublasx::lazy_cat_rows(A, B), C), D) - expect_R;
+
+    BOOST_UBLASX_DEBUG_TRACE( "2*[[A B]; C; D]-[[A B]; C; D] = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, ublasx::num_rows(expect_R), ublasx::num_columns(expect_R), tol );
+
+    // Eager version
+    R = ublasx::cat_columns(ublasx::cat_columns(ublasx::cat_rows(A, B), C), D);
+
+    BOOST_UBLASX_DEBUG_TRACE( "[[A B]; C; D] = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, ublasx::num_rows(expect_R), ublasx::num_columns(expect_R), tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_lazy_assign_to_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Lazy Concatenation - Assign to Matrix Block - Dense Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    matrix_type A(2,2);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+
+    matrix_type B(1,1);
+    B(0,0) = 5;
+
+    matrix_type expect_R(3,4, 9);
+    expect_R(0,1) = 1; expect_R(0,2) = 2; expect_R(0,3) = 5;
+    expect_R(1,1) = 3; expect_R(1,2) = 4; expect_R(1,3) = 0;
+
+    matrix_type R(3,4, 9);
+
+    ublas::matrix_range<matrix_type> R_blk(R, ublas::range(0,2), ublas::range(1,4));
+    ublasx::lazy_cat_rows(A, B).assign_to(R_blk);
+
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+    BOOST_UBLASX_DEBUG_TRACE( "expect R = " << expect_R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, ublasx::num_rows(expect_R), ublasx::num_columns(expect_R), tol );
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'cat' operations");
@@ -392,6 +482,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_rows_dense_matrix_row_major_same_dim );
     BOOST_UBLASX_TEST_DO( test_rows_dense_matrix_column_major_diff_dim );
     BOOST_UBLASX_TEST_DO( test_rows_dense_matrix_row_major_diff_dim );
+    BOOST_UBLASX_TEST_DO( test_lazy_nested_dense_matrix );
+    BOOST_UBLASX_TEST_DO( test_lazy_assign_to_dense_matrix );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -1762,6 +1762,263 @@ BOOST_UBLASX_TEST_DEF( norm_frobenius_complex_rectangular_dense_matrix_row_major
 }
 
 
+BOOST_UBLASX_TEST_DEF( estimate_1_real_square_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: 1-Norm Estimate - Real Square Dense Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 0;
+    A(1,0) = 3; A(1,1) = 1; A(1,2) = 4;
+    A(2,0) = 0; A(2,1) = 5; A(2,2) = 1;
+
+    result_type res;
+    result_type expect_res;
+
+    // ```octave
+    // A=[1 2 0; 3 1 4; 0 5 1]
+    // cond(A,1)
+    // ```
+    expect_res = 11.84;
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    res = ublasx::cond_1(A, ublasx::exact_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("exact = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, tol );
+    // The estimate is a lower bound which is usually within a factor of 3
+    res = ublasx::cond_1(A, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("estimate = " << res);
+    BOOST_UBLASX_TEST_CHECK( res <= expect_res*(1+tol) );
+    BOOST_UBLASX_TEST_CHECK( res >= expect_res/3 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_inf_real_square_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Infinity Norm Estimate - Real Square Dense Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::row_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 0;
+    A(1,0) = 3; A(1,1) = 1; A(1,2) = 4;
+    A(2,0) = 0; A(2,1) = 5; A(2,2) = 1;
+
+    result_type res;
+    result_type expect_res;
+
+    // ```octave
+    // A=[1 2 0; 3 1 4; 0 5 1]
+    // cond(A,inf)
+    // ```
+    expect_res = 9.28;
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    res = ublasx::cond_inf(A, ublasx::exact_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("exact = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, tol );
+    // The estimate is a lower bound which is usually within a factor of 3
+    res = ublasx::cond_inf(A, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("estimate = " << res);
+    BOOST_UBLASX_TEST_CHECK( res <= expect_res*(1+tol) );
+    BOOST_UBLASX_TEST_CHECK( res >= expect_res/3 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_from_lu_decomposition )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: 1-Norm and Infinity Norm Estimates - LU Decomposition");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 0;
+    A(1,0) = 3; A(1,1) = 1; A(1,2) = 4;
+    A(2,0) = 0; A(2,1) = 5; A(2,2) = 1;
+
+    // The LU factors of A are reused: the estimates must be the same as the
+    // ones computed from A
+    ublasx::lu_decomposition<value_type> lu(A);
+
+    result_type res;
+    result_type expect_res;
+
+    expect_res = ublasx::cond_1(A, ublasx::estimate_cond_method);
+    res = ublasx::cond_1(lu);
+    BOOST_UBLASX_DEBUG_TRACE("cond_1(lu) = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, tol );
+
+    expect_res = ublasx::cond_inf(A, ublasx::estimate_cond_method);
+    res = ublasx::cond_inf(lu);
+    BOOST_UBLASX_DEBUG_TRACE("cond_inf(lu) = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_2_real_square_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: 2-Norm Estimate - Real Square Dense Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+    const real_type est_tol = 1.0e-2;
+
+    matrix_type Well(n,n);
+    Well(0,0) =  2; Well(0,1) = -1; Well(0,2) =  0;
+    Well(1,0) = -1; Well(1,1) =  3; Well(1,2) = -1;
+    Well(2,0) =  0; Well(2,1) = -1; Well(2,2) =  2;
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 0;
+    A(1,0) = 3; A(1,1) = 1; A(1,2) = 4;
+    A(2,0) = 0; A(2,1) = 5; A(2,2) = 1;
+
+    result_type res;
+    result_type expect_res;
+
+    // ```octave
+    // A=[2 -1 0; -1 3 -1; 0 -1 2]
+    // cond(A,2)
+    // ```
+    expect_res = 4;
+    BOOST_UBLASX_DEBUG_TRACE("Matrix = " << Well);
+    res = ublasx::cond_2(Well, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("estimate = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, est_tol );
+    BOOST_UBLASX_TEST_CHECK( res <= expect_res*(1+tol) );
+
+    // ```octave
+    // A=[1 2 0; 3 1 4; 0 5 1]
+    // cond(A,2)
+    // ```
+    expect_res = 6.45788444617270;
+    BOOST_UBLASX_DEBUG_TRACE("Matrix = " << A);
+    res = ublasx::cond(A, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("estimate = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, est_tol );
+    BOOST_UBLASX_TEST_CHECK( res <= expect_res*(1+tol) );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_2_complex_square_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: 2-Norm Estimate - Complex Square Dense Matrix");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::row_major> matrix_type;
+
+    const std::size_t n = 3;
+    const real_type est_tol = 1.0e-2;
+
+    matrix_type A(n,n);
+    A(0,0) = value_type(5, 1.0); A(0,1) = value_type(1, 0.3); A(0,2) = value_type( 2,-0.4);
+    A(1,0) = value_type(3, 1.7); A(1,1) = value_type(9, 1.0); A(1,2) = value_type( 5, 0.3);
+    A(2,0) = value_type(6, 2.4); A(2,1) = value_type(7, 1.7); A(2,2) = value_type(13, 1.0);
+
+    result_type res;
+    result_type expect_res;
+
+    // ```octave
+    // A=[5+1i 1+0.3i 2-0.4i; 3+1.7i 9+1i 5+0.3i; 6+2.4i 7+1.7i 13+1i]
+    // cond(A,2)
+    // ```
+    expect_res = 5.52092139288004;
+    BOOST_UBLASX_DEBUG_TRACE("Matrix = " << A);
+    res = ublasx::cond_2(A, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("estimate = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, est_tol );
+    BOOST_UBLASX_TEST_CHECK( res <= expect_res*(1+tol) );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_2_real_rectangular_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: 2-Norm Estimate - Real Rectangular Dense Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef real_type result_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    const std::size_t nr = 4;
+    const std::size_t nc = 3;
+
+    matrix_type A(nr,nc);
+    A(0,0) =  2; A(0,1) = -1; A(0,2) =  0;
+    A(1,0) = -1; A(1,1) =  3; A(1,2) = -1;
+    A(2,0) =  0; A(2,1) = -1; A(2,2) =  2;
+    A(3,0) =  1; A(3,1) =  2; A(3,2) = -1;
+
+    result_type res;
+    result_type expect_res;
+
+    // No estimate for rectangular matrices: the exact value is returned
+    // ```octave
+    // A=[2 -1 0; -1 3 -1; 0 -1 2; 1 2 -1]
+    // cond(A,2)
+    // ```
+    expect_res = 3.41990480101429;
+    BOOST_UBLASX_DEBUG_TRACE("Matrix = " << A);
+    res = ublasx::cond_2(A, ublasx::estimate_cond_method);
+    BOOST_UBLASX_DEBUG_TRACE("res = " << res);
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect_res, tol );
+
+    // Only the 2-norm is available for rectangular matrices
+    bool thrown;
+    try
+    {
+        ublasx::cond_1(A, ublasx::estimate_cond_method);
+        thrown = false;
+    }
+    catch (...)
+    {
+        thrown = true;
+    }
+    BOOST_UBLASX_TEST_CHECK( thrown );
+}
+
+
+BOOST_UBLASX_TEST_DEF( estimate_singular_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Estimates - Singular Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    const std::size_t n = 2;
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 2; A(1,1) = 4;
+
+    BOOST_UBLASX_DEBUG_TRACE("Matrix = " << A);
+    BOOST_UBLASX_TEST_CHECK( std::isinf(ublasx::cond_1(A, ublasx::estimate_cond_method)) );
+    BOOST_UBLASX_TEST_CHECK( std::isinf(ublasx::cond_inf(A, ublasx::estimate_cond_method)) );
+    BOOST_UBLASX_TEST_CHECK( std::isinf(ublasx::cond_2(A, ublasx::estimate_cond_method)) );
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'cond' operation");
@@ -1804,5 +2061,13 @@ int main()
     BOOST_UBLASX_TEST_DO( norm_frobenius_complex_rectangular_dense_matrix_column_major );
     BOOST_UBLASX_TEST_DO( norm_frobenius_complex_rectangular_dense_matrix_row_major );
 
+    BOOST_UBLASX_TEST_DO( estimate_1_real_square_dense_matrix );
+    BOOST_UBLASX_TEST_DO( estimate_inf_real_square_dense_matrix );
+    BOOST_UBLASX_TEST_DO( estimate_from_lu_decomposition );
+    BOOST_UBLASX_TEST_DO( estimate_2_real_square_dense_matrix );
+    BOOST_UBLASX_TEST_DO( estimate_2_complex_square_dense_matrix );
+    BOOST_UBLASX_TEST_DO( estimate_2_real_rectangular_dense_matrix );
+    BOOST_UBLASX_TEST_DO( estimate_singular_matrix );
+
     BOOST_UBLASX_TEST_END();
 }
@@ -0,0 +1,237 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/cumprod.cpp
+ *
+ * \brief Test suite for the \c cumprod operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ * 
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/cumprod.hpp>
+#include <boost/numeric/ublasx/tags.hpp>
+#include <cstddef>
+#include <iostream>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+
+
+BOOST_UBLASX_TEST_DEF( test_vector_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Vector Container" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n(5);
+
+    vector_type v(n);
+
+    v(0) = 1.5;
+    v(1) = -2.0;
+    v(2) = 0.5;
+    v(3) = 3.0;
+    v(4) = 0.25;
+
+    vector_type expect(n);
+    expect(0) = v(0);
+    expect(1) = v(0)*v(1);
+    expect(2) = v(0)*v(1)*v(2);
+    expect(3) = v(0)*v(1)*v(2)*v(3);
+    expect(4) = v(0)*v(1)*v(2)*v(3)*v(4);
+
+    vector_type res;
+
+
+    // cumprod(v)
+    res = ublasx::cumprod(v);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod(" << v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+
+    // cumprod<1>(v)
+    res = ublasx::cumprod<1>(v);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod<1>(" << v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+
+    // cumprod(-v)
+    res = ublasx::cumprod(-v);
+    for (size_type i = 0; i < n; i += 2)
+    {
+        expect(i) = -expect(i);
+    }
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod(" << -v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+
+    // cumprod_inplace(v)
+    res = -v;
+    ublasx::cumprod_inplace(res);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_inplace(" << -v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+}
+
+
+template <typename MatrixT>
+static void test_matrix_container_impl(::std::size_t& test_fails__)
+{
+    typedef MatrixT matrix_type;
+    typedef typename ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    size_type nr = 3;
+    size_type nc = 2;
+
+    matrix_type A(nr, nc);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+    A(2,0) = 5; A(2,1) = 6;
+
+    matrix_type cumprod_rows(nr, nc);
+    cumprod_rows(0,0) =  1; cumprod_rows(0,1) =  2;
+    cumprod_rows(1,0) =  3; cumprod_rows(1,1) =  8;
+    cumprod_rows(2,0) = 15; cumprod_rows(2,1) = 48;
+
+    matrix_type cumprod_cols(nr, nc);
+    cumprod_cols(0,0) = 1; cumprod_cols(0,1) =  2;
+    cumprod_cols(1,0) = 3; cumprod_cols(1,1) = 12;
+    cumprod_cols(2,0) = 5; cumprod_cols(2,1) = 30;
+
+    matrix_type res;
+
+
+    // cumprod(A)
+    res = ublasx::cumprod(A);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod(" << A << ") = " << res << " ==> " << cumprod_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_rows, nr, nc, tol );
+
+    // cumprod_rows(A)
+    res = ublasx::cumprod_rows(A);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_rows(" << A << ") = " << res << " ==> " << cumprod_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_rows, nr, nc, tol );
+
+    // cumprod_columns(A)
+    res = ublasx::cumprod_columns(A);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_columns(" << A << ") = " << res << " ==> " << cumprod_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_cols, nr, nc, tol );
+
+    // cumprod<1>(A)
+    res = ublasx::cumprod<1>(A);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod<1>(" << A << ") = " << res << " ==> " << cumprod_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_rows, nr, nc, tol );
+
+    // cumprod<2>(A)
+    res = ublasx::cumprod<2>(A);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod<2>(" << A << ") = " << res << " ==> " << cumprod_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_cols, nr, nc, tol );
+
+    // cumprod(A')
+    res = ublasx::cumprod(ublas::trans(A));
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod(" << ublas::trans(A) << ") = " << res << " ==> " << ublas::trans(cumprod_cols) );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, ublas::trans(cumprod_cols), nc, nr, tol );
+
+    // cumprod_inplace(A)
+    res = A;
+    ublasx::cumprod_inplace(res);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_inplace(" << A << ") = " << res << " ==> " << cumprod_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_rows, nr, nc, tol );
+
+    // cumprod_rows_inplace(A)
+    res = A;
+    ublasx::cumprod_rows_inplace(res);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_rows_inplace(" << A << ") = " << res << " ==> " << cumprod_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_rows, nr, nc, tol );
+
+    // cumprod_columns_inplace(A)
+    res = A;
+    ublasx::cumprod_columns_inplace(res);
+    BOOST_UBLASX_DEBUG_TRACE( "cumprod_columns_inplace(" << A << ") = " << res << " ==> " << cumprod_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, cumprod_cols, nr, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_row_major_matrix_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major Matrix Container" );
+
+    test_matrix_container_impl< ublas::matrix<double, ublas::row_major> >(test_fails__);
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Column-major Matrix Container" );
+
+    test_matrix_container_impl< ublas::matrix<double, ublas::column_major> >(test_fails__);
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_vector_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Vector Container" );
+
+    // Long enough to be split among several threads, with values +1 and -1,
+    // so that products are exact whatever the order they are computed.
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n = 300007;
+
+    vector_type v(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = (i % 3 == 0) ? -1 : 1;
+    }
+
+    vector_type expect(v);
+    for (size_type i = 1; i < n; ++i)
+    {
+        expect(i) *= expect(i-1);
+    }
+
+    // cumprod(v)
+    vector_type res = ublasx::cumprod(v);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
+
+    // cumprod_inplace(v)
+    ublasx::cumprod_inplace(v);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( v, expect, n );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'cumprod' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( test_vector_container );
+    BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_long_vector_container );
+
+    BOOST_UBLASX_TEST_END();
+}
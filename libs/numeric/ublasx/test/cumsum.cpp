@@ -16,15 +16,22 @@
  * http://www.boost.org/LICENSE_1_0.txt)
  */
 
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
 #include <boost/numeric/ublas/fwd.hpp>
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
 #include <boost/numeric/ublasx/operation/cumsum.hpp>
 #include <boost/numeric/ublasx/tags.hpp>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include "libs/numeric/ublasx/test/utils.hpp"
@@ -636,6 +643,183 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_inplace )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST In-place" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::bounded_vector<value_type, 5> bounded_vector_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n = 5;
+    size_type nr = 3;
+    size_type nc = 2;
+
+    vector_type v(n);
+    v(0) = 0.0; v(1) = 0.108929; v(2) = 0.0; v(3) = 0.0; v(4) = 1.023787;
+
+    vector_type expect_v = ublasx::cumsum(v);
+
+    row_major_matrix_type A(nr, nc);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+    A(2,0) = 5; A(2,1) = 6;
+
+    row_major_matrix_type expect_rows(nr, nc);
+    expect_rows(0,0) = 1; expect_rows(0,1) =  2;
+    expect_rows(1,0) = 4; expect_rows(1,1) =  6;
+    expect_rows(2,0) = 9; expect_rows(2,1) = 12;
+
+    row_major_matrix_type expect_cols(nr, nc);
+    expect_cols(0,0) = 1; expect_cols(0,1) =  3;
+    expect_cols(1,0) = 3; expect_cols(1,1) =  7;
+    expect_cols(2,0) = 5; expect_cols(2,1) = 11;
+
+
+    // cumsum_inplace(v)
+    vector_type x(v);
+    ublasx::cumsum_inplace(x);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_inplace(" << v << ") = " << x << " ==> " << expect_v );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_v, n, tol );
+
+    // cumsum_inplace(bounded v)
+    bounded_vector_type bx(v);
+    ublasx::cumsum_inplace(bx);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_inplace(" << v << ") = " << bx << " ==> " << expect_v );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( bx, expect_v, n, tol );
+
+    // cumsum_inplace(A)
+    row_major_matrix_type X(A);
+    ublasx::cumsum_inplace(X);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_inplace(" << A << ") = " << X << " ==> " << expect_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_rows, nr, nc, tol );
+
+    // cumsum_rows_inplace(A)
+    X = A;
+    ublasx::cumsum_rows_inplace(X);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_rows_inplace(" << A << ") = " << X << " ==> " << expect_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_rows, nr, nc, tol );
+
+    // cumsum_columns_inplace(A)
+    X = A;
+    ublasx::cumsum_columns_inplace(X);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_columns_inplace(" << A << ") = " << X << " ==> " << expect_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_cols, nr, nc, tol );
+
+    // cumsum_rows_inplace(col-major A)
+    col_major_matrix_type Y(A);
+    ublasx::cumsum_rows_inplace(Y);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_rows_inplace(" << A << ") = " << Y << " ==> " << expect_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( Y, expect_rows, nr, nc, tol );
+
+    // cumsum_columns_inplace(col-major A)
+    Y = A;
+    ublasx::cumsum_columns_inplace(Y);
+    BOOST_UBLASX_DEBUG_TRACE( "cumsum_columns_inplace(" << A << ") = " << Y << " ==> " << expect_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( Y, expect_cols, nr, nc, tol );
+}
+
+
+template <typename MatrixT>
+static void test_long_matrix_impl(MatrixT const& A, ::std::size_t& test_fails__)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::size_type size_type;
+
+    size_type nr = A.size1();
+    size_type nc = A.size2();
+
+    MatrixT expect_rows(A);
+    for (size_type r = 1; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            expect_rows(r,c) += expect_rows(r-1,c);
+        }
+    }
+    MatrixT expect_cols(A);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 1; c < nc; ++c)
+        {
+            expect_cols(r,c) += expect_cols(r,c-1);
+        }
+    }
+
+    MatrixT X(A);
+    ublasx::cumsum_rows_inplace(X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( X, expect_rows, nr, nc );
+
+    X = A;
+    ublasx::cumsum_columns_inplace(X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( X, expect_cols, nr, nc );
+
+    X = ublasx::cumsum_rows(A);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( X, expect_rows, nr, nc );
+
+    X = ublasx::cumsum_columns(A);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( X, expect_cols, nr, nc );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_containers )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Containers" );
+
+    // Long enough to be split among several threads, with small integral
+    // values, so that sums are exact whatever the order they are computed.
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n = 300007;
+
+    vector_type v(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = static_cast<value_type>(i % 7) - 3;
+    }
+
+    vector_type expect(v);
+    for (size_type i = 1; i < n; ++i)
+    {
+        expect(i) += expect(i-1);
+    }
+
+    // cumsum(v)
+    vector_type res = ublasx::cumsum(v);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
+
+    // cumsum_inplace(v)
+    ublasx::cumsum_inplace(v);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( v, expect, n );
+
+    size_type nr = 601;
+    size_type nc = 403;
+
+    row_major_matrix_type A(nr, nc);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            A(r,c) = static_cast<value_type>((r*nc+c) % 5) - 2;
+        }
+    }
+
+    test_long_matrix_impl(A, test_fails__);
+    test_long_matrix_impl(col_major_matrix_type(A), test_fails__);
+
+    // Single row and single column matrices are scanned as a vector
+    test_long_matrix_impl(row_major_matrix_type(ublas::subrange(A, 0, 1, 0, nc)), test_fails__);
+    test_long_matrix_impl(col_major_matrix_type(ublas::trans(row_major_matrix_type(1, n, 1))), test_fails__);
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'cumsum' operation");
@@ -649,6 +833,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
     BOOST_UBLASX_TEST_DO( test_matrix_expression );
     BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_inplace );
+    BOOST_UBLASX_TEST_DO( test_long_containers );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -68,6 +68,36 @@ BOOST_UBLASX_TEST_DEF( test_vector_container )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_long_vector_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Vector Container" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    // Long enough to be split in several blocks, with a remainder
+    size_type n(1003);
+
+    vector_type v1(n);
+    vector_type v2(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v1(i) = i;
+        v2(i) = 2;
+    }
+
+    value_type expect(0);
+    value_type res(0);
+
+    // dot(v1,v2)
+    expect = value_type(n*(n-1));
+    res = ublasx::dot(v1, v2);
+    BOOST_UBLASX_DEBUG_TRACE( "dot(v1,v2) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect, tol );
+}
+
+
 BOOST_UBLASX_TEST_DEF( test_vector_expression )
 {
     BOOST_UBLASX_DEBUG_TRACE( "TEST Vector Expression" );
@@ -351,6 +381,7 @@ int main()
     BOOST_UBLASX_TEST_BEGIN();
 
     BOOST_UBLASX_TEST_DO( test_vector_container );
+    BOOST_UBLASX_TEST_DO( test_long_vector_container );
     BOOST_UBLASX_TEST_DO( test_vector_expression );
     BOOST_UBLASX_TEST_DO( test_vector_reference );
     BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
@@ -480,17 +480,17 @@ BOOST_UBLASX_TEST_DEF( test_double_matrix_row_major_only_vectors )
     BOOST_UBLASX_DEBUG_TRACE( "Left Eigenvectors = " << LV );
     BOOST_UBLASX_DEBUG_TRACE( "Right Eigenvectors = " << RV );
 
-    expect_LV(0,0) = out_value_type( 0.04441241171439061 , 0.2879188413627367  ); expect_LV(0,1) = out_value_type( 0.04441241171439061 ,-0.2879188413627367  ); expect_LV(0,2) = out_value_type(-0.1325612054004949  ,-0.32728512393077713 ); expect_LV(0,3) = out_value_type(-0.1325612054004949  , 0.32728512393077713 ); expect_LV(0,4) = out_value_type(-0.0408372696405638 , 0.00000);
-    expect_LV(1,0) = out_value_type( 0.6181643032364803  , 0.0                 ); expect_LV(1,1) = out_value_type( 0.6181643032364803  , 0.                  ); expect_LV(1,2) = out_value_type( 0.6868696010430648  , 0.0                 ); expect_LV(1,3) = out_value_type( 0.6868696010430648  , 0.00                ); expect_LV(1,4) = out_value_type(-0.5599544102049594 , 0.00000);
-    expect_LV(2,0) = out_value_type(-0.035757599312428556,-0.5771114592618123  ); expect_LV(2,1) = out_value_type(-0.035757599312428556, 0.5771114592618123  ); expect_LV(2,2) = out_value_type(-0.39032805246732794 ,-0.07486636968983368 ); expect_LV(2,3) = out_value_type(-0.39032805246732794 , 0.07486636968983368 ); expect_LV(2,4) = out_value_type( 0.12850028050038304, 0.00000);
-    expect_LV(3,0) = out_value_type( 0.2837261355713329  , 0.011354678505118251); expect_LV(3,1) = out_value_type( 0.2837261355713329  ,-0.011354678505118251); expect_LV(3,2) = out_value_type(-0.018200866392540004,-0.1872688637882381  ); expect_LV(3,3) = out_value_type(-0.018200866392540004, 0.1872688637882381  ); expect_LV(3,4) = out_value_type( 0.7966991560727732 , 0.00000);
-    expect_LV(4,0) = out_value_type(-0.044953359596348524, 0.3406122092484726  ); expect_LV(4,1) = out_value_type(-0.044953359596348524,-0.3406122092484726  ); expect_LV(4,2) = out_value_type(-0.40321802640401727 , 0.2181180599737777  ); expect_LV(4,3) = out_value_type(-0.40321802640401727 ,-0.2181180599737777  ); expect_LV(4,4) = out_value_type(-0.18314340972192725, 0.00000);
+    expect_LV(0,0) = out_value_type( 0.04441241171439061 , 0.2879188413627367  ); expect_LV(0,1) = out_value_type( 0.04441241171439061 ,-0.2879188413627367  ); expect_LV(0,2) = out_value_type(-0.1325612054004949  ,-0.32728512393077713 ); expect_LV(0,3) = out_value_type(-0.1325612054004949  , 0.32728512393077713 ); expect_LV(0,4) = out_value_type( 0.0408372696405638 , 0.00000);
+    expect_LV(1,0) = out_value_type( 0.6181643032364803  , 0.0                 ); expect_LV(1,1) = out_value_type( 0.6181643032364803  , 0.                  ); expect_LV(1,2) = out_value_type( 0.6868696010430648  , 0.0                 ); expect_LV(1,3) = out_value_type( 0.6868696010430648  , 0.00                ); expect_LV(1,4) = out_value_type( 0.5599544102049594 , 0.00000);
+    expect_LV(2,0) = out_value_type(-0.035757599312428556,-0.5771114592618123  ); expect_LV(2,1) = out_value_type(-0.035757599312428556, 0.5771114592618123  ); expect_LV(2,2) = out_value_type(-0.39032805246732794 ,-0.07486636968983368 ); expect_LV(2,3) = out_value_type(-0.39032805246732794 , 0.07486636968983368 ); expect_LV(2,4) = out_value_type(-0.12850028050038304, 0.00000);
+    expect_LV(3,0) = out_value_type( 0.2837261355713329  , 0.011354678505118251); expect_LV(3,1) = out_value_type( 0.2837261355713329  ,-0.011354678505118251); expect_LV(3,2) = out_value_type(-0.018200866392540004,-0.1872688637882381  ); expect_LV(3,3) = out_value_type(-0.018200866392540004, 0.1872688637882381  ); expect_LV(3,4) = out_value_type(-0.7966991560727732 , 0.00000);
+    expect_LV(4,0) = out_value_type(-0.044953359596348524, 0.3406122092484726  ); expect_LV(4,1) = out_value_type(-0.044953359596348524,-0.3406122092484726  ); expect_LV(4,2) = out_value_type(-0.40321802640401727 , 0.2181180599737777  ); expect_LV(4,3) = out_value_type(-0.40321802640401727 ,-0.2181180599737777  ); expect_LV(4,4) = out_value_type( 0.18314340972192725, 0.00000);
 
-    expect_RV(0,0) = out_value_type(0.10806479130135167, 0.1686483435010072); expect_RV(0,1) = out_value_type(0.10806479130135167,-0.1686483435010072); expect_RV(0,2) = out_value_type( 0.7322339897837211  , 0.0                 ); expect_RV(0,3) = out_value_type( 0.7322339897837211  , 0.0                ); expect_RV(0,4) = out_value_type(-0.4606464366271303, 0.00000);
-    expect_RV(1,0) = out_value_type(0.40631288132267446,-0.2590097689205323); expect_RV(1,1) = out_value_type(0.40631288132267446, 0.2590097689205323); expect_RV(1,2) = out_value_type(-0.026463011089022395,-0.01694675437857112 ); expect_RV(1,3) = out_value_type(-0.026463011089022395, 0.01694675437857112); expect_RV(1,4) = out_value_type(-0.3377038282859721, 0.00000);
-    expect_RV(2,0) = out_value_type(0.10235768506156454,-0.5088023141787094); expect_RV(2,1) = out_value_type(0.10235768506156454, 0.5088023141787094); expect_RV(2,2) = out_value_type( 0.191648728080536   ,-0.2925659954756119  ); expect_RV(2,3) = out_value_type( 0.191648728080536   , 0.2925659954756119 ); expect_RV(2,4) = out_value_type(-0.3087439418541303, 0.00000);
-    expect_RV(3,0) = out_value_type(0.39863109808413577,-0.0913334523695411); expect_RV(3,1) = out_value_type(0.39863109808413577, 0.0913334523695411); expect_RV(3,2) = out_value_type(-0.07901106298430906 ,-0.07807593642682402 ); expect_RV(3,3) = out_value_type(-0.07901106298430906 , 0.07807593642682402); expect_RV(3,4) = out_value_type( 0.7438458375310733, 0.00000);
-    expect_RV(4,0) = out_value_type(0.5395350560474126 , 0.00000           ); expect_RV(4,1) = out_value_type(0.5395350560474126 , 0.00000           ); expect_RV(4,2) = out_value_type(-0.291604754325538   ,-0.493102293052802   ); expect_RV(4,3) = out_value_type(-0.291604754325538   , 0.493102293052802  ); expect_RV(4,4) = out_value_type(-0.1585292816478885, 0.00000);
+    expect_RV(0,0) = out_value_type(0.10806479130135167, 0.1686483435010072); expect_RV(0,1) = out_value_type(0.10806479130135167,-0.1686483435010072); expect_RV(0,2) = out_value_type( 0.7322339897837211  , 0.0                 ); expect_RV(0,3) = out_value_type( 0.7322339897837211  , 0.0                ); expect_RV(0,4) = out_value_type( 0.4606464366271303, 0.00000);
+    expect_RV(1,0) = out_value_type(0.40631288132267446,-0.2590097689205323); expect_RV(1,1) = out_value_type(0.40631288132267446, 0.2590097689205323); expect_RV(1,2) = out_value_type(-0.026463011089022395,-0.01694675437857112 ); expect_RV(1,3) = out_value_type(-0.026463011089022395, 0.01694675437857112); expect_RV(1,4) = out_value_type( 0.3377038282859721, 0.00000);
+    expect_RV(2,0) = out_value_type(0.10235768506156454,-0.5088023141787094); expect_RV(2,1) = out_value_type(0.10235768506156454, 0.5088023141787094); expect_RV(2,2) = out_value_type( 0.191648728080536   ,-0.2925659954756119  ); expect_RV(2,3) = out_value_type( 0.191648728080536   , 0.2925659954756119 ); expect_RV(2,4) = out_value_type( 0.3087439418541303, 0.00000);
+    expect_RV(3,0) = out_value_type(0.39863109808413577,-0.0913334523695411); expect_RV(3,1) = out_value_type(0.39863109808413577, 0.0913334523695411); expect_RV(3,2) = out_value_type(-0.07901106298430906 ,-0.07807593642682402 ); expect_RV(3,3) = out_value_type(-0.07901106298430906 , 0.07807593642682402); expect_RV(3,4) = out_value_type(-0.7438458375310733, 0.00000);
+    expect_RV(4,0) = out_value_type(0.5395350560474126 , 0.00000           ); expect_RV(4,1) = out_value_type(0.5395350560474126 , 0.00000           ); expect_RV(4,2) = out_value_type(-0.291604754325538   ,-0.493102293052802   ); expect_RV(4,3) = out_value_type(-0.291604754325538   , 0.493102293052802  ); expect_RV(4,4) = out_value_type( 0.1585292816478885, 0.00000);
 
     BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(LV) == n );
     BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(LV) == n );
@@ -2077,6 +2077,346 @@ BOOST_UBLASX_TEST_DEF( test_complex_upper_herm_matrix_pair_row_major_both )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_double_matrix_row_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Matrix - Row Major - Reused Workspace");
+
+    typedef double value_type;
+    typedef value_type in_value_type;
+    typedef ::std::complex<value_type> out_value_type;
+    typedef ublas::matrix<in_value_type, ublas::row_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::row_major> out_matrix_type;
+    typedef ublas::vector<out_value_type> out_vector_type;
+
+    const std::size_t n(5);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) = -1.01; A(0,1) =  0.86; A(0,2) = -4.60; A(0,3) =  3.31; A(0,4) = -4.81;
+    A(1,0) =  3.98; A(1,1) =  0.53; A(1,2) = -7.04; A(1,3) =  5.29; A(1,4) =  3.55;
+    A(2,0) =  3.30; A(2,1) =  8.26; A(2,2) = -3.89; A(2,3) =  8.20; A(2,4) = -1.51;
+    A(3,0) =  4.43; A(3,1) =  4.96; A(3,2) = -7.66; A(3,3) = -7.33; A(3,4) =  6.18;
+    A(4,0) =  7.31; A(4,1) = -6.43; A(4,2) = -6.16; A(4,3) =  2.47; A(4,4) =  5.58;
+
+    ublasx::eigen_workspace<in_value_type> ws;
+    out_vector_type w;
+    out_matrix_type LV;
+    out_matrix_type RV;
+    out_matrix_type D(n,n);
+
+    for (std::size_t k = 1; k <= 3; ++k)
+    {
+        in_matrix_type B(A*value_type(k));
+
+        ublasx::eigen(B, w, LV, RV, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+        BOOST_UBLASX_DEBUG_TRACE( "Left Eigenvectors = " << LV );
+        BOOST_UBLASX_DEBUG_TRACE( "Right Eigenvectors = " << RV );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(RV) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(RV) == n );
+        D = ublasx::diag<out_vector_type,ublas::row_major>(w);
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(B, RV), ublas::prod(RV, D), n, n, tol*k );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(ublas::herm(LV), B), ublas::prod(D, ublas::herm(LV)), n, n, tol*k );
+
+        out_vector_type v;
+        ublasx::eigenvalues(B, v, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << v );
+
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( v, w, n, tol*k );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_upper_sym_matrix_column_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Upper Symmetric Matrix - Column Major - Reused Workspace");
+
+    typedef double value_type;
+    typedef value_type in_value_type;
+    typedef value_type out_value_type;
+    typedef ublas::symmetric_matrix<in_value_type, ublas::upper, ublas::column_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::column_major> out_matrix_type;
+    typedef ublas::vector<out_value_type> out_vector_type;
+
+    const std::size_t n(5);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) =  1.96; A(0,1) = -6.49; A(0,2) = -0.47; A(0,3) = -7.20; A(0,4) = -0.65;
+                    A(1,1) =  3.80; A(1,2) = -6.39; A(1,3) =  1.50; A(1,4) = -6.34;
+                                    A(2,2) =  4.17; A(2,3) = -1.51; A(2,4) =  2.67;
+                                                    A(3,3) =  5.70; A(3,4) =  1.80;
+                                                                    A(4,4) = -7.10;
+
+    ublasx::eigen_workspace<in_value_type> ws;
+    out_vector_type w;
+    out_matrix_type V;
+    out_matrix_type D(n,n);
+
+    for (std::size_t k = 1; k <= 3; ++k)
+    {
+        in_matrix_type B(A*value_type(k));
+
+        ublasx::eigen(B, w, V, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvectors = " << V );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == n );
+        D = ublasx::diag<out_vector_type,ublas::column_major>(w);
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(B, V), ublas::prod(V, D), n, n, tol*k );
+
+        out_vector_type v;
+        ublasx::eigenvalues(B, v, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << v );
+
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( v, w, n, tol*k );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_upper_sym_matrix_column_major_algorithms )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Upper Symmetric Matrix - Column Major - Eigenvalue Algorithms");
+
+    typedef double value_type;
+    typedef value_type in_value_type;
+    typedef value_type out_value_type;
+    typedef ublas::symmetric_matrix<in_value_type, ublas::upper, ublas::column_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::column_major> out_matrix_type;
+    typedef ublas::vector<out_value_type> out_vector_type;
+
+    const std::size_t n(5);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) =  1.96; A(0,1) = -6.49; A(0,2) = -0.47; A(0,3) = -7.20; A(0,4) = -0.65;
+                    A(1,1) =  3.80; A(1,2) = -6.39; A(1,3) =  1.50; A(1,4) = -6.34;
+                                    A(2,2) =  4.17; A(2,3) = -1.51; A(2,4) =  2.67;
+                                                    A(3,3) =  5.70; A(3,4) =  1.80;
+                                                                    A(4,4) = -7.10;
+
+    out_vector_type expect_w(n);
+
+    expect_w(0) = -11.065575263268382;
+    expect_w(1) =  -6.228746932398537;
+    expect_w(2) =   0.864027975272064;
+    expect_w(3) =   8.865457108365522;
+    expect_w(4) =  16.094837112029339;
+
+    const ublasx::eigen_algorithm algs[] = { ublasx::auto_eigen_algorithm,
+                                             ublasx::syev_eigen_algorithm,
+                                             ublasx::syevd_eigen_algorithm,
+                                             ublasx::syevr_eigen_algorithm };
+
+    ublasx::eigen_workspace<in_value_type> ws;
+    out_vector_type w;
+    out_matrix_type V;
+    out_matrix_type D(n,n);
+
+    for (std::size_t k = 0; k < sizeof(algs)/sizeof(algs[0]); ++k)
+    {
+        ublasx::eigen(A, w, V, ws, algs[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE( "Algorithm = " << algs[k] );
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvectors = " << V );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == n );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, n, tol );
+        D = ublasx::diag<out_vector_type,ublas::column_major>(w);
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(A, V), ublas::prod(V, D), n, n, tol );
+
+        ublasx::eigenvalues(A, w, algs[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << w );
+
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, n, tol );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_upper_sym_matrix_row_major_by_index )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Upper Symmetric Matrix - Row Major - Eigenvalues by Index");
+
+    typedef double value_type;
+    typedef value_type in_value_type;
+    typedef value_type out_value_type;
+    typedef ublas::symmetric_matrix<in_value_type, ublas::upper, ublas::row_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::row_major> out_matrix_type;
+    typedef ublas::vector<out_value_type> out_vector_type;
+
+    const std::size_t n(5);
+    const std::size_t il(1);
+    const std::size_t iu(3);
+    const std::size_t m(iu-il+1);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) =  1.96; A(0,1) = -6.49; A(0,2) = -0.47; A(0,3) = -7.20; A(0,4) = -0.65;
+                    A(1,1) =  3.80; A(1,2) = -6.39; A(1,3) =  1.50; A(1,4) = -6.34;
+                                    A(2,2) =  4.17; A(2,3) = -1.51; A(2,4) =  2.67;
+                                                    A(3,3) =  5.70; A(3,4) =  1.80;
+                                                                    A(4,4) = -7.10;
+
+    out_vector_type w;
+    out_matrix_type V;
+    out_vector_type expect_w(m);
+
+    expect_w(0) =  -6.228746932398537;
+    expect_w(1) =   0.864027975272064;
+    expect_w(2) =   8.865457108365522;
+
+    ublasx::eigen_by_index(A, il, iu, w, V);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvectors = " << V );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+    out_matrix_type D(m,m);
+    D = ublasx::diag<out_vector_type,ublas::row_major>(w);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(A, V), ublas::prod(V, D), n, m, tol );
+
+    ublasx::eigenvalues_by_index(A, il, iu, w);
+
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << w );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_upper_sym_matrix_column_major_by_value )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Upper Symmetric Matrix - Column Major - Eigenvalues by Value");
+
+    typedef double value_type;
+    typedef value_type in_value_type;
+    typedef value_type out_value_type;
+    typedef ublas::symmetric_matrix<in_value_type, ublas::upper, ublas::column_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::column_major> out_matrix_type;
+    typedef ublas::vector<out_value_type> out_vector_type;
+
+    const std::size_t n(5);
+    const std::size_t m(2);
+    const value_type vl(-7);
+    const value_type vu(5);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) =  1.96; A(0,1) = -6.49; A(0,2) = -0.47; A(0,3) = -7.20; A(0,4) = -0.65;
+                    A(1,1) =  3.80; A(1,2) = -6.39; A(1,3) =  1.50; A(1,4) = -6.34;
+                                    A(2,2) =  4.17; A(2,3) = -1.51; A(2,4) =  2.67;
+                                                    A(3,3) =  5.70; A(3,4) =  1.80;
+                                                                    A(4,4) = -7.10;
+
+    ublasx::eigen_workspace<in_value_type> ws;
+    out_vector_type w;
+    out_matrix_type V;
+    out_vector_type expect_w(m);
+
+    expect_w(0) =  -6.228746932398537;
+    expect_w(1) =   0.864027975272064;
+
+    ublasx::eigen_by_value(A, vl, vu, w, V, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvectors = " << V );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+    out_matrix_type D(m,m);
+    D = ublasx::diag<out_vector_type,ublas::column_major>(w);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(A, V), ublas::prod(V, D), n, m, tol );
+
+    ublasx::eigenvalues_by_value(A, vl, vu, w, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << w );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+
+    // The same workspace serves the full eigendecomposition
+    ublasx::eigen(A, w, V, ws);
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == n );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_upper_herm_matrix_column_major_by_index )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Upper Hermitian Matrix - Column Major - Eigenvalues by Index");
+
+    typedef double value_type;
+    typedef ::std::complex<value_type> in_value_type;
+    typedef ::std::complex<value_type> out_value_type;
+    typedef ublas::hermitian_matrix<in_value_type, ublas::upper, ublas::column_major> in_matrix_type;
+    typedef ublas::matrix<out_value_type, ublas::column_major> out_matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
+
+    const std::size_t n(4);
+    const std::size_t il(0);
+    const std::size_t iu(1);
+    const std::size_t m(iu-il+1);
+
+    in_matrix_type A(n,n);
+
+    A(0,0) = out_value_type(9.14,0.00); A(0,1) = out_value_type(-4.37,-9.22); A(0,2) = out_value_type(-1.98,-1.72); A(0,3) = out_value_type(-8.96,-9.50);
+                                        A(1,1) = out_value_type(-3.35, 0.00); A(1,2) = out_value_type( 2.25,-9.51); A(1,3) = out_value_type( 2.57, 2.40);
+                                                                              A(2,2) = out_value_type(-4.82, 0.00); A(2,3) = out_value_type(-3.24, 2.04);
+                                                                                                                    A(3,3) = out_value_type( 8.44, 0.00);
+
+    out_vector_type w;
+    out_matrix_type V;
+    out_vector_type expect_w(m);
+
+    expect_w(0) = -16.00474647209476;
+    expect_w(1) = - 6.76497015479332;
+
+    ublasx::eigen_by_index(A, il, iu, w, V);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues = " << w );
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvectors = " << V );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(V) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(V) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+    out_matrix_type D(m,m);
+    D = ublasx::diag<out_vector_type,ublas::column_major>(w);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(A, V), ublas::prod(V, D), n, m, tol );
+
+    ublasx::eigenvalues_by_value(A, value_type(-20), value_type(0), w);
+
+    BOOST_UBLASX_DEBUG_TRACE( "Eigenvalues (only values) = " << w );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == m );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( w, expect_w, m, tol );
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'eigen' operations");
@@ -2107,9 +2447,12 @@ int main()
     BOOST_UBLASX_TEST_DO( test_complex_matrix_row_major_only_values );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_row_major_only_vectors );
 
+    BOOST_UBLASX_TEST_DO( test_double_matrix_row_major_workspace );
+
     BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major );
     BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major_only_values );
     //BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major_only_vectors );//TODO
+    BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major_workspace );
 
     BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_row_major );
     BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_row_major_only_values );
@@ -2143,5 +2486,10 @@ int main()
     BOOST_UBLASX_TEST_DO( test_complex_upper_herm_matrix_pair_column_major_both );
     BOOST_UBLASX_TEST_DO( test_complex_upper_herm_matrix_pair_row_major_both );
 
+    BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major_algorithms );
+    BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_row_major_by_index );
+    BOOST_UBLASX_TEST_DO( test_double_upper_sym_matrix_column_major_by_value );
+    BOOST_UBLASX_TEST_DO( test_double_upper_herm_matrix_column_major_by_index );
+
     BOOST_UBLASX_TEST_END();
 }
@@ -0,0 +1,327 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/eigs.cpp
+ *
+ * \brief Test suite for the iterative eigensolvers.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/operation/eigs.hpp>
+#include <boost/numeric/ublasx/operation/eye.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+const double tol = 1.0e-8;
+
+
+/// Computes y = L x, where L is the Laplacian of the path graph.
+struct path_laplacian
+{
+    void operator()(ublas::vector<double> const& x, ublas::vector<double>& y) const
+    {
+        const std::size_t n = ublasx::size(x);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            double d = 0;
+            y(i) = 0;
+            if (i > 0)
+            {
+                y(i) -= x(i-1);
+                d += 1;
+            }
+            if (i+1 < n)
+            {
+                y(i) -= x(i+1);
+                d += 1;
+            }
+            y(i) += d*x(i);
+        }
+    }
+};
+
+
+BOOST_UBLASX_TEST_DEF( eigsh_sparse_laplacian )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Lanczos Eigensolver - Sparse Laplacian - Fiedler Vector");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> sparse_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t n(100);
+    const std::size_t k(2);
+    const real_type pi = 4*std::atan(real_type(1));
+
+    // Laplacian of the path graph, whose eigenvalues are 2-2cos(pi*i/n)
+    sparse_matrix_type L(n,n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        L(i,i) = (i == 0 || i == n-1) ? 1 : 2;
+        if (i+1 < n)
+        {
+            L(i,i+1) = -1;
+            L(i+1,i) = -1;
+        }
+    }
+
+    ublasx::eigsh_decomposition<value_type> eigsh;
+    eigsh.subspace_size(30);
+    eigsh.decompose(L, k, ublasx::smallest_real_eigs);
+
+    vector_type w = eigsh.eigenvalues();
+    matrix_type X = eigsh.eigenvectors();
+
+    BOOST_UBLASX_DEBUG_TRACE("w = " << w);
+    BOOST_UBLASX_TEST_CHECK( eigsh.num_converged() == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(X) == n && ublasx::num_columns(X) == k );
+    BOOST_UBLASX_TEST_CHECK( std::abs(w(0)) <= tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( w(1), 2-2*std::cos(pi/n), tol );
+
+    // The Fiedler vector is cos(pi*(i+1/2)/n), up to the sign
+    vector_type fiedler(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        fiedler(i) = std::cos(pi*(i+0.5)/n);
+    }
+    fiedler /= ublas::norm_2(fiedler);
+    BOOST_UBLASX_TEST_CHECK( std::abs(std::abs(ublas::inner_prod(fiedler, ublas::column(X, 1))) - 1) <= tol );
+
+    matrix_type I = ublasx::eye<value_type>(k);
+    matrix_type Y;
+    Y = ublas::prod(ublas::trans(X), X);
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(Y-I) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( eigsh_function )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Lanczos Eigensolver - User Function");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t n(200);
+    const std::size_t k(3);
+    const real_type pi = 4*std::atan(real_type(1));
+
+    ublasx::eigsh_decomposition<value_type> eigsh;
+    eigsh.decompose(path_laplacian(), n, k, ublasx::largest_magnitude_eigs);
+
+    vector_type w = eigsh.eigenvalues();
+    matrix_type X = eigsh.eigenvectors();
+
+    BOOST_UBLASX_DEBUG_TRACE("w = " << w);
+    BOOST_UBLASX_TEST_CHECK( eigsh.num_converged() == k );
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK_CLOSE( w(i), 2-2*std::cos(pi*(n-1-i)/n), tol );
+
+        vector_type x = ublas::column(X, i);
+        vector_type y(n);
+        path_laplacian()(x, y);
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_2(y-w(i)*x) <= tol*std::abs(w(i)) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( eigsh_complex_row_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Lanczos Eigensolver - Complex Hermitian Matrix - Row Major");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t n(60);
+    const std::size_t k(4);
+
+    matrix_type A(n,n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i,i) = real_type(i+1);
+        for (std::size_t j = i+1; j < n; ++j)
+        {
+            A(i,j) = value_type(1, 0.5)/real_type(j-i+1);
+            A(j,i) = std::conj(A(i,j));
+        }
+    }
+
+    vector_type expect_w;
+    ublasx::eigenvalues(ublas::hermitian_matrix<value_type, ublas::lower, ublas::column_major>(A), expect_w);
+
+    vector_type w = ublasx::eigsh_values(A, k, ublasx::largest_real_eigs);
+
+    BOOST_UBLASX_DEBUG_TRACE("w = " << w);
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == k );
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK_CLOSE( w(i), expect_w(n-1-i), tol );
+    }
+
+    ublasx::eigsh_decomposition<value_type> eigsh = ublasx::eigsh_decompose(A, k, ublasx::smallest_real_eigs);
+
+    matrix_type X = eigsh.eigenvectors();
+    matrix_type Y;
+    Y = ublas::prod(ublas::herm(X), X);
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(Y-ublasx::eye<value_type>(k)) <= tol );
+    Y = ublas::prod(A, X);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK_CLOSE( eigsh.eigenvalues()(i), expect_w(i), tol );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_2(ublas::column(Y, i)-eigsh.eigenvalues()(i)*ublas::column(X, i)) <= tol*ublas::norm_frobenius(A) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( eigs_real_column_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Arnoldi Eigensolver - Real Matrix - Column Major");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef std::complex<real_type> complex_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix<complex_type, ublas::column_major> complex_matrix_type;
+    typedef ublas::vector<complex_type> complex_vector_type;
+
+    const std::size_t n(80);
+    const std::size_t k(4);
+
+    // Nonsymmetric matrix with complex conjugate eigenvalues
+    matrix_type A(n,n, 0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i,i) = real_type(i+1)/n;
+        if (i+1 < n)
+        {
+            A(i,i+1) = 1;
+        }
+        A(i,(i+7) % n) += real_type(0.5);
+        A((i+3) % n,i) -= real_type(0.25);
+    }
+
+    ublasx::eigs_decomposition<value_type> eigs(A, k);
+
+    complex_vector_type w = eigs.eigenvalues();
+    complex_matrix_type X = eigs.eigenvectors();
+
+    BOOST_UBLASX_DEBUG_TRACE("w = " << w);
+    BOOST_UBLASX_TEST_CHECK( eigs.num_converged() == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(w) == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(X) == n && ublasx::num_columns(X) == k );
+
+    complex_vector_type expect_w;
+    ublasx::eigenvalues(A, expect_w);
+    real_type max_abs = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        max_abs = std::max(max_abs, std::abs(expect_w(i)));
+    }
+    BOOST_UBLASX_TEST_CHECK_CLOSE( std::abs(w(0)), max_abs, tol );
+
+    complex_matrix_type Y;
+    Y = ublas::prod(A, X);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( std::abs(ublas::norm_2(ublas::column(X, i)) - 1) <= tol );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_2(ublas::column(Y, i)-w(i)*ublas::column(X, i)) <= tol*std::abs(w(i)) );
+        if (i > 0)
+        {
+            BOOST_UBLASX_TEST_CHECK( std::abs(w(i)) <= std::abs(w(i-1))*(1+tol) );
+        }
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( eigs_complex_sparse )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Arnoldi Eigensolver - Complex Sparse Matrix");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> sparse_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(120);
+    const std::size_t k(3);
+
+    sparse_matrix_type A(n,n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i,i) = value_type(real_type(i)/n, std::sin(real_type(i)));
+        A(i,(i+1) % n) = value_type(0, 0.3);
+        A(i,(5*i+2) % n) += value_type(0.2, 0);
+    }
+
+    vector_type expect_w;
+    ublasx::eigenvalues(matrix_type(A), expect_w);
+    real_type max_re = expect_w(0).real();
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        max_re = std::max(max_re, expect_w(i).real());
+    }
+
+    ublasx::eigs_decomposition<value_type> eigs = ublasx::eigs_decompose(A, k, ublasx::largest_real_eigs);
+
+    vector_type w = eigs.eigenvalues();
+    matrix_type X = eigs.eigenvectors();
+
+    BOOST_UBLASX_DEBUG_TRACE("w = " << w);
+    BOOST_UBLASX_TEST_CHECK( eigs.num_converged() == k );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( w(0).real(), max_re, tol );
+
+    matrix_type Y;
+    Y = ublas::prod(A, X);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_2(ublas::column(Y, i)-w(i)*ublas::column(X, i)) <= tol*std::abs(w(i)) );
+    }
+}
+
+
+int main()
+{
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( eigsh_sparse_laplacian );
+    BOOST_UBLASX_TEST_DO( eigsh_function );
+    BOOST_UBLASX_TEST_DO( eigsh_complex_row_major );
+    BOOST_UBLASX_TEST_DO( eigs_real_column_major );
+    BOOST_UBLASX_TEST_DO( eigs_complex_sparse );
+
+    BOOST_UBLASX_TEST_END();
+}
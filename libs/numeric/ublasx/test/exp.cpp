@@ -17,6 +17,7 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
 #include <boost/numeric/ublasx/operation/exp.hpp>
 #include <cmath>
 #include <complex>
@@ -213,6 +214,48 @@ BOOST_UBLASX_TEST_DEF( test_complex_matrix )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_matrix_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real - Matrix - Execution Policy" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type nr(3);
+    const size_type nc(2);
+
+    matrix_type A(nr,nc);
+
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+    A(2,0) = 5; A(2,1) = 6;
+
+    matrix_type expect_R(nr,nc);
+
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            expect_R(r,c) = std::exp(A(r,c));
+        }
+    }
+
+    matrix_type R;
+
+    R = ublasx::exp(ublasx::execution::seq, A);
+    BOOST_UBLASX_DEBUG_TRACE( "exp(seq,A) = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, nr, nc, tol );
+
+    R = ublasx::exp(ublasx::execution::par, A);
+    BOOST_UBLASX_DEBUG_TRACE( "exp(par,A) = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, nr, nc, tol );
+
+    R = ublasx::exp(ublasx::execution::par_unseq, ublas::trans(ublas::trans(A)));
+    BOOST_UBLASX_DEBUG_TRACE( "exp(par_unseq,A'') = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, nr, nc, tol );
+}
+
 int main()
 {
 
@@ -225,6 +268,7 @@ int main()
     BOOST_UBLASX_TEST_DO( test_complex_vector );
     BOOST_UBLASX_TEST_DO( test_real_matrix );
     BOOST_UBLASX_TEST_DO( test_complex_matrix );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_policy );
 
     BOOST_UBLASX_TEST_END();
 }
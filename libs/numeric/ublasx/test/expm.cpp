@@ -1,9 +1,9 @@
 /* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
 
 /**
- * \file libs/numeric/ublasx/test/cond.cpp
+ * \file libs/numeric/ublasx/test/expm.cpp
  *
- * \brief Test suite for the \c cond operation.
+ * \brief Test suite for the \c expm operation.
  *
  * \author Marco Guazzone (marco.guazzone@gmail.com)
  *
@@ -33,9 +33,9 @@ namespace ublasx = ::boost::numeric::ublasx;
 static const double tol = 1.0e-5;
 
 
-BOOST_UBLASX_TEST_DEF( complex_dense_matrix )
+BOOST_UBLASX_TEST_DEF( pade_complex_dense_matrix )
 {
-    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Dense Matrix");
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Pade - Complex Dense Matrix");
 
     typedef std::complex<double> value_type;
     typedef ublas::matrix<value_type> matrix_type;
@@ -47,7 +47,7 @@ BOOST_UBLASX_TEST_DEF( complex_dense_matrix )
 
     matrix_type gen(nr,nc);  // Generator of rotaion around z aix in group theory
 
-    gen(0,0) = 0  ; gen(0,1) = -img; gen(0,2) = 0;
+    gen(0,0) = 0  ; gen(0,1) = img ; gen(0,2) = 0;
     gen(1,0) = img; gen(1,1) = 0   ; gen(1,2) = 0;
     gen(2,0) = 0  ; gen(2,1) = 0   ; gen(2,2) = 0;
 
@@ -82,12 +82,203 @@ BOOST_UBLASX_TEST_DEF( complex_dense_matrix )
 }
 
 
+BOOST_UBLASX_TEST_DEF( real_dense_matrix_row_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix - Row Major");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    const std::size_t n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+
+    // Results obtained with Octave: expm([1 2; 3 4])
+    matrix_type expect_res(n,n);
+    expect_res(0,0) =  51.968956198705; expect_res(0,1) =  74.736564567003;
+    expect_res(1,0) = 112.104846850505; expect_res(1,1) = 164.073803049210;
+
+    matrix_type res = ublasx::expm(A);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("expm(A) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_REL_CLOSE( res, expect_res, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_dense_matrix_column_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix - Column Major");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(2);
+
+    // Needs several squarings (from Moler and Van Loan)
+    matrix_type A(n,n);
+    A(0,0) = -49; A(0,1) = 24;
+    A(1,0) = -64; A(1,1) = 31;
+
+    // Results obtained with Octave: expm([-49 24; -64 31])
+    matrix_type expect_res(n,n);
+    expect_res(0,0) = -0.735758758144742; expect_res(0,1) = 0.551819099658089;
+    expect_res(1,0) = -1.471517599088239; expect_res(1,1) = 1.103638240716674;
+
+    matrix_type res = ublasx::expm(A);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("expm(A) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_REL_CLOSE( res, expect_res, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_dense_matrix_degrees )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix - Pade Degrees");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t n(3);
+
+    // A nilpotent part plus a diagonal, so that the exact exponential is
+    // known: the 1-norm of the scaled matrices selects every degree.
+    const value_type scales[] = {1.0e-3, 1.0e-1, 0.4, 0.5, 2.0, 30.0};
+
+    ublasx::expm_workspace<value_type> ws;
+
+    for (std::size_t k = 0; k < sizeof(scales)/sizeof(scales[0]); ++k)
+    {
+        const value_type a(scales[k]);
+
+        matrix_type A(n,n,0);
+        A(0,0) = a; A(1,1) = a; A(2,2) = -a;
+        A(0,1) = a;
+
+        matrix_type expect_res(n,n,0);
+        expect_res(0,0) = std::exp(a); expect_res(0,1) = a*std::exp(a);
+        expect_res(1,1) = std::exp(a);
+        expect_res(2,2) = std::exp(-a);
+
+        matrix_type res;
+        ublasx::expm(A, res, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("expm(A) = " << res);
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, expect_res, n, n, tol*std::exp(a)*(1+a) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_dense_matrix_zero )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix - Zero");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t n(4);
+
+    matrix_type A = ublas::zero_matrix<value_type>(n,n);
+    matrix_type expect_res = ublas::identity_matrix<value_type>(n);
+
+    matrix_type res = ublasx::expm(A);
+
+    BOOST_UBLASX_DEBUG_TRACE("expm(0) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, expect_res, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( float_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Float Dense Matrix");
+
+    typedef float value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+
+    matrix_type expect_res(n,n);
+    expect_res(0,0) =  51.968956198705f; expect_res(0,1) =  74.736564567003f;
+    expect_res(1,0) = 112.104846850505f; expect_res(1,1) = 164.073803049210f;
+
+    matrix_type res = ublasx::expm(A);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("expm(A) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_REL_CLOSE( res, expect_res, n, n, 1.0e-4 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Dense Matrix");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t n(3);
+
+    const value_type img(0,1);
+
+    matrix_type gen(n,n);
+
+    gen(0,0) = 0  ; gen(0,1) = img ; gen(0,2) = 0;
+    gen(1,0) = img; gen(1,1) = 0   ; gen(1,2) = 0;
+    gen(2,0) = 0  ; gen(2,1) = 0   ; gen(2,2) = 0;
+
+    matrix_type A(n,n);
+    A = img * value_type(1.5) * gen;
+
+    matrix_type expect_res(n,n);
+    expect_res(0,0) = value_type( 2.352409615243247,0); expect_res(0,1) = value_type(-2.129279455094817,0); expect_res(0,2) = value_type(0.000000000000000,0);
+    expect_res(1,0) = value_type(-2.129279455094817,0); expect_res(1,1) = value_type( 2.352409615243247,0); expect_res(1,2) = value_type(0.000000000000000,0);
+    expect_res(2,0) = value_type( 0.000000000000000,0); expect_res(2,1) = value_type( 0.000000000000000,0); expect_res(2,2) = value_type(1.000000000000000,0);
+
+    ublasx::expm_workspace<value_type> ws(n);
+    matrix_type res = ublasx::expm(A, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("expm(A) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, expect_res, n, n, tol );
+
+    // Rotation: exp(i*theta*[0 1; -1 0]) = [cos(theta) i*sin(theta); i*sin(theta) cos(theta)]
+    matrix_type B(2,2);
+    B(0,0) = 0; B(0,1) = img*value_type(4);
+    B(1,0) = img*value_type(4); B(1,1) = 0;
+
+    matrix_type expect_res2(2,2);
+    expect_res2(0,0) = std::cos(4.0); expect_res2(0,1) = img*std::sin(4.0);
+    expect_res2(1,0) = img*std::sin(4.0); expect_res2(1,1) = std::cos(4.0);
+
+    // Reuse the workspace for a matrix of another order
+    res = ublasx::expm(B, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE("B = " << B);
+    BOOST_UBLASX_DEBUG_TRACE("expm(B) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, expect_res2, 2, 2, tol );
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'expm' operation");
 
     BOOST_UBLASX_TEST_BEGIN();
 
+    BOOST_UBLASX_TEST_DO( pade_complex_dense_matrix );
+    BOOST_UBLASX_TEST_DO( real_dense_matrix_row_major );
+    BOOST_UBLASX_TEST_DO( real_dense_matrix_column_major );
+    BOOST_UBLASX_TEST_DO( real_dense_matrix_degrees );
+    BOOST_UBLASX_TEST_DO( real_dense_matrix_zero );
+    BOOST_UBLASX_TEST_DO( float_dense_matrix );
     BOOST_UBLASX_TEST_DO( complex_dense_matrix );
 
     BOOST_UBLASX_TEST_END();
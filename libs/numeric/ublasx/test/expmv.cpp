@@ -0,0 +1,317 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/expmv.cpp
+ *
+ * \brief Test suite for the \c expmv operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/operation/expm.hpp>
+#include <boost/numeric/ublasx/operation/expmv.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+static const double tol = 1.0e-8;
+
+
+BOOST_UBLASX_TEST_DEF( real_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+
+    vector_type v(n, 1);
+
+    // Results obtained with Octave: expm([1 2; 3 4])*[1; 1]
+    vector_type expect_res(n);
+    expect_res(0) = 126.705520765708;
+    expect_res(1) = 276.178649899715;
+
+    vector_type res = ublasx::expmv(A, v);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("v = " << v);
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_REL_CLOSE( res, expect_res, n, tol );
+
+    // Needs several steps (from Moler and Van Loan)
+    A(0,0) = -49; A(0,1) = 24;
+    A(1,0) = -64; A(1,1) = 31;
+
+    v(0) = 1; v(1) = 0;
+
+    // Results obtained with Octave: expm([-49 24; -64 31])*[1; 0]
+    expect_res(0) = -0.735758758144742;
+    expect_res(1) = -1.471517599088239;
+
+    res = ublasx::expmv(A, v, 1.0);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("v = " << v);
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_REL_CLOSE( res, expect_res, n, 1.0e-6 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_dense_matrix_large_time )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Dense Matrix - Large Time");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(3);
+
+    // A rate matrix (columns sum to zero) with a small 1-norm, so that the
+    // 1-norm of t*A is much larger than the one of A
+    matrix_type A(n,n);
+    A(0,0) = -1.0; A(0,1) =  0.5; A(0,2) =  0.2;
+    A(1,0) =  0.6; A(1,1) = -0.9; A(1,2) =  0.3;
+    A(2,0) =  0.4; A(2,1) =  0.4; A(2,2) = -0.5;
+
+    vector_type v(n);
+    v(0) = 1; v(1) = 0; v(2) = 0;
+
+    const value_type t(50);
+
+    vector_type expect_res = ublas::prod(ublasx::expm(matrix_type(t*A)), v);
+
+    vector_type res = ublasx::expmv(A, v, t);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("v = " << v);
+    BOOST_UBLASX_DEBUG_TRACE("t = " << t);
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v,t) = " << res << " ==> " << expect_res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_REL_CLOSE( res, expect_res, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_sparse_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Sparse Matrix");
+
+    typedef double value_type;
+    typedef ublas::compressed_matrix<value_type> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(100);
+    const value_type lambda(-1);
+    const value_type t(40);
+
+    // A = lambda*I + N, with N the upper shift matrix, so that
+    // exp(t*A)*e_{n-1} = exp(lambda*t)*sum_k t^k/k!*e_{n-1-k}
+    matrix_type A(n,n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i,i) = lambda;
+        if (i+1 < n)
+        {
+            A(i,i+1) = 1;
+        }
+    }
+
+    vector_type v(n, 0);
+    v(n-1) = 1;
+
+    vector_type expect_res(n);
+    value_type c = std::exp(lambda*t);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        expect_res(n-1-k) = c;
+        c *= t/value_type(k+1);
+    }
+
+    vector_type res = ublasx::expmv(A, v, t);
+
+    // The error is relative to the norm of the result, so that the smallest
+    // elements have a larger relative error
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v,t) = " << res);
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_inf(res-expect_res) <= tol*ublas::norm_inf(expect_res) );
+
+    // Same with a column-major sparse matrix
+    ublas::compressed_matrix<value_type, ublas::column_major> B(A);
+
+    res = ublasx::expmv(B, v, t);
+
+    BOOST_UBLASX_DEBUG_TRACE("expmv(B,v,t) = " << res);
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_inf(res-expect_res) <= tol*ublas::norm_inf(expect_res) );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_sparse_matrix_times )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Sparse Matrix - Multiple Times");
+
+    typedef double value_type;
+    typedef ublas::compressed_matrix<value_type> matrix_type;
+    typedef ublas::matrix<value_type> result_matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(2);
+    const value_type a(3);
+    const value_type b(0.5);
+
+    // The transposed generator of a two-state Markov chain, whose transient
+    // probabilities are p_0(t) = (b + a*exp(-(a+b)*t))/(a+b) when starting
+    // from state 0
+    matrix_type Q(n,n);
+    Q(0,0) = -a; Q(0,1) =  b;
+    Q(1,0) =  a; Q(1,1) = -b;
+
+    vector_type p0(n, 0);
+    p0(0) = 1;
+
+    const std::size_t nt(5);
+    vector_type t(nt);
+    t(0) = 0; t(1) = 0.5; t(2) = 1; t(3) = 2; t(4) = 10;
+
+    result_matrix_type expect_res(n,nt);
+    for (std::size_t k = 0; k < nt; ++k)
+    {
+        expect_res(0,k) = (b + a*std::exp(-(a+b)*t(k)))/(a+b);
+        expect_res(1,k) = 1-expect_res(0,k);
+    }
+
+    result_matrix_type res = ublasx::expmv(Q, p0, t);
+
+    BOOST_UBLASX_DEBUG_TRACE("Q = " << Q);
+    BOOST_UBLASX_DEBUG_TRACE("t = " << t);
+    BOOST_UBLASX_DEBUG_TRACE("expmv(Q,p0,t) = " << res);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, expect_res, n, nt, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_zero )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Zero Matrix and Zero Time");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(3);
+
+    vector_type v(n);
+    v(0) = 1; v(1) = -2; v(2) = 3;
+
+    matrix_type Z(n,n,0);
+    vector_type res = ublasx::expmv(Z, v, 5.0);
+
+    BOOST_UBLASX_DEBUG_TRACE("expmv(0,v,5) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, v, n, tol );
+
+    matrix_type A(n,n,1);
+    res = ublasx::expmv(A, v, 0.0);
+
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v,0) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, v, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( float_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Float Dense Matrix");
+
+    typedef float value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+
+    vector_type v(n, 1);
+
+    vector_type expect_res(n);
+    expect_res(0) = 126.705520765708f;
+    expect_res(1) = 276.178649899715f;
+
+    vector_type res = ublasx::expmv(A, v);
+
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_REL_CLOSE( res, expect_res, n, 1.0e-4 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_dense_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Dense Matrix");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const std::size_t n(2);
+    const double t(2.5);
+    const value_type img(0,1);
+
+    // Rotation: exp(t*[0 i; i 0]) = [cos(t) i*sin(t); i*sin(t) cos(t)]
+    matrix_type A(n,n);
+    A(0,0) = 0;   A(0,1) = img;
+    A(1,0) = img; A(1,1) = 0;
+
+    vector_type v(n);
+    v(0) = 1; v(1) = value_type(2,-1);
+
+    vector_type expect_res(n);
+    expect_res(0) = std::cos(t)*v(0) + img*std::sin(t)*v(1);
+    expect_res(1) = img*std::sin(t)*v(0) + std::cos(t)*v(1);
+
+    vector_type res = ublasx::expmv(A, v, t);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("v = " << v);
+    BOOST_UBLASX_DEBUG_TRACE("expmv(A,v,t) = " << res);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect_res, n, tol );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'expmv' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( real_dense_matrix );
+    BOOST_UBLASX_TEST_DO( real_dense_matrix_large_time );
+    BOOST_UBLASX_TEST_DO( real_sparse_matrix );
+    BOOST_UBLASX_TEST_DO( real_sparse_matrix_times );
+    BOOST_UBLASX_TEST_DO( real_zero );
+    BOOST_UBLASX_TEST_DO( float_dense_matrix );
+    BOOST_UBLASX_TEST_DO( complex_dense_matrix );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -20,9 +20,12 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublas/vector_sparse.hpp>
 #include <boost/numeric/ublasx/operation/find.hpp>
 #include <boost/numeric/ublasx/tags.hpp>
 #include <functional>
@@ -80,14 +83,14 @@ BOOST_UBLASX_TEST_DEF( test_vector_container )
     val = 0.5;
     expect = out_vector_type(1);
     expect(0) = 1.023787;
-    res = ublasx::find(v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 1 );
 
     // find(v, > -.1)
     val = -0.1;
     expect = v;
-    res = ublasx::find(v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
@@ -131,14 +134,14 @@ BOOST_UBLASX_TEST_DEF( test_vector_expression )
     expect(1) = -0.108929;
     expect(2) = 0.0;
     expect(3) = 0.0;
-    res = ublasx::find(-v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(-v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << -v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
 
     // find(-v, > -1.5)
     val = -1.5;
     expect = -v;
-    res = ublasx::find(-v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(-v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << -v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
@@ -180,27 +183,26 @@ BOOST_UBLASX_TEST_DEF( test_vector_reference )
     val = 0.5;
     expect = out_vector_type(1);
     expect(0) = 1.023787;
-    res = ublasx::find(vector_reference_type(v), ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(vector_reference_type(v), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << vector_reference_type(v) << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 1 );
 
     // find(ref(v), > -.1)
     val = -0.1;
     expect = v;
-    res = ublasx::find(vector_reference_type(v), ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::find(vector_reference_type(v), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "find(" << vector_reference_type(v) << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
 
 
-/*
 BOOST_UBLASX_TEST_DEF( test_row_major_matrix_container )
 {
     BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major Matrix Container" );
 
     typedef double value_type;
     typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
-    typedef ublas::zero_matrix<value_type> zero_matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -210,38 +212,48 @@ BOOST_UBLASX_TEST_DEF( test_row_major_matrix_container )
     A(3,0) = 0.0;      A(3,1) = 0.675382; A(3,2) = 0.0;      A(3,3) = 0.450332;
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
-    zero_matrix_type Z(5, 4);
-
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
+    out_vector_type expect;
+    out_vector_type res;
 
-    // all(Z)
-    expect = false;
-    res = ublasx::all(Z);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << Z << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
 
-    // all(A)
-    expect = false;
-    res = ublasx::all(A);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > .5)
+    // find(A)
+    expect = out_vector_type(10);
+    expect(0) = 0.108929;
+    expect(1) = 1.023787;
+    expect(2) = 0.274690;
+    expect(3) = 0.675382;
+    expect(4) = 1.0;
+    expect(5) = 0.891726;
+    expect(6) = 1.231751;
+    expect(7) = 0.798938;
+    expect(8) = 0.450332;
+    expect(9) = 1.0;
+    res = ublasx::find(A);
+    BOOST_UBLASX_DEBUG_TRACE( "find(A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 10 );
+
+    // find(A, > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > -.1)
-    val = -0.1;
-    expect = true;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = 1.023787;
+    expect(1) = 0.675382;
+    expect(2) = 1.0;
+    expect(3) = 0.891726;
+    expect(4) = 1.231751;
+    expect(5) = 0.798938;
+    expect(6) = 1.0;
+    res = ublasx::find(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A, > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 7 );
+
+    // find(A, > 2)
+    val = 2;
+    res = ublasx::find(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A, > " << val << ") = " << res << " ==> []" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), 0 );
 }
 
 
@@ -251,6 +263,7 @@ BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
 
     typedef double value_type;
     typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -261,29 +274,47 @@ BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
+    out_vector_type expect;
+    out_vector_type res;
 
-    // all(A)
-    expect = false;
-    res = ublasx::all(A);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
 
-    // all(A, > .5)
+    // find(A)
+    expect = out_vector_type(10);
+    expect(0) = 0.108929;
+    expect(1) = 1.023787;
+    expect(2) = 0.274690;
+    expect(3) = 0.675382;
+    expect(4) = 1.0;
+    expect(5) = 0.891726;
+    expect(6) = 1.231751;
+    expect(7) = 0.798938;
+    expect(8) = 0.450332;
+    expect(9) = 1.0;
+    res = ublasx::find(A);
+    BOOST_UBLASX_DEBUG_TRACE( "find(A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 10 );
+
+    // find(A, > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = 1.023787;
+    expect(1) = 0.675382;
+    expect(2) = 1.0;
+    expect(3) = 0.891726;
+    expect(4) = 1.231751;
+    expect(5) = 0.798938;
+    expect(6) = 1.0;
+    res = ublasx::find(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A, > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 7 );
+
+    // find(A, > 2)
+    val = 2;
+    res = ublasx::find(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A, > " << val << ") = " << res << " ==> []" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), 0 );
 }
 
 
@@ -292,7 +323,8 @@ BOOST_UBLASX_TEST_DEF( test_matrix_expression )
     BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Expression" );
 
     typedef double value_type;
-    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -303,29 +335,47 @@ BOOST_UBLASX_TEST_DEF( test_matrix_expression )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
-
-    // all(A')
-    expect = false;
-    res = ublasx::all(ublas::trans(A));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "') = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A', > .5)
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // find(A')
+    expect = out_vector_type(10);
+    expect(0) = 0.274690;
+    expect(1) = 0.798938;
+    expect(2) = 0.108929;
+    expect(3) = 0.891726;
+    expect(4) = 0.675382;
+    expect(5) = 0.450332;
+    expect(6) = 1.023787;
+    expect(7) = 1.0;
+    expect(8) = 1.231751;
+    expect(9) = 1.0;
+    res = ublasx::find(ublas::trans(A));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A') = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 10 );
+
+    // find(A', > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(ublas::trans(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "', > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A', > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(ublas::trans(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "', > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = 0.798938;
+    expect(1) = 0.891726;
+    expect(2) = 0.675382;
+    expect(3) = 1.023787;
+    expect(4) = 1.0;
+    expect(5) = 1.231751;
+    expect(6) = 1.0;
+    res = ublasx::find(ublas::trans(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A', > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 7 );
+
+    // find(A', > 2)
+    val = 2;
+    res = ublasx::find(ublas::trans(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(A', > " << val << ") = " << res << " ==> []" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), 0 );
 }
 
 
@@ -334,8 +384,8 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
     BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Reference" );
 
     typedef double value_type;
-    typedef ublas::matrix<value_type> matrix_type;
-    typedef ublas::matrix_reference<matrix_type> matrix_reference_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -346,31 +396,235 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // find(ref(A))
+    expect = out_vector_type(10);
+    expect(0) = 0.108929;
+    expect(1) = 1.023787;
+    expect(2) = 0.274690;
+    expect(3) = 0.675382;
+    expect(4) = 1.0;
+    expect(5) = 0.891726;
+    expect(6) = 1.231751;
+    expect(7) = 0.798938;
+    expect(8) = 0.450332;
+    expect(9) = 1.0;
+    res = ublasx::find(ublas::matrix_reference<matrix_type>(A));
+    BOOST_UBLASX_DEBUG_TRACE( "find(ref(A)) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 10 );
+
+    // find(ref(A), > .5)
+    val = 0.5;
+    expect = out_vector_type(7);
+    expect(0) = 1.023787;
+    expect(1) = 0.675382;
+    expect(2) = 1.0;
+    expect(3) = 0.891726;
+    expect(4) = 1.231751;
+    expect(5) = 0.798938;
+    expect(6) = 1.0;
+    res = ublasx::find(ublas::matrix_reference<matrix_type>(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(ref(A), > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 7 );
+
+    // find(ref(A), > 2)
+    val = 2;
+    res = ublasx::find(ublas::matrix_reference<matrix_type>(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(ref(A), > " << val << ") = " << res << " ==> []" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), 0 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_sparse_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Sparse Vector" );
+
+    typedef double value_type;
+    typedef ublas::compressed_vector<value_type> vector_type;
+    typedef ublas::vector<value_type> out_vector_type;
+
+    vector_type v(6);
+
+    v(1) = 0.108929;
+    v(3) = -0.5;
+    v(4) = 1.023787;
+
+    value_type val(0);
+    out_vector_type expect;
+    out_vector_type res;
 
 
-    // all(ref(A))
-    expect = false;
-    res = ublasx::all(matrix_reference_type(A));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << ")) = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    // find(v)
+    expect = out_vector_type(3);
+    expect(0) = 0.108929;
+    expect(1) = -0.5;
+    expect(2) = 1.023787;
+    res = ublasx::find(v);
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 3 );
 
-    // all(ref(A), > .5)
+    // find(2*v, > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(matrix_reference_type(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << "), > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(1);
+    expect(0) = 2*1.023787;
+    res = ublasx::find(2*v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << 2*v << ", > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 1 );
 
-    // all(ref(A), > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(matrix_reference_type(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << "), > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    // find(v, < .5): elements which are not stored satisfy the predicate
+    val = 0.5;
+    expect = out_vector_type(5);
+    expect(0) = 0;
+    expect(1) = 0.108929;
+    expect(2) = 0;
+    expect(3) = -0.5;
+    expect(4) = 0;
+    res = ublasx::find(v, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << v << ", < " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 5 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_sparse_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Sparse Matrix" );
+
+    typedef double value_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
+
+    matrix_type A(3,3);
+
+    A(0,1) = 0.274690;
+    A(1,0) = 0.108929;
+    A(1,2) = 0.891726;
+    A(2,1) = 1.0;
+
+    col_major_matrix_type B(A);
+
+    value_type val(0);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // find(A)
+    expect = out_vector_type(4);
+    expect(0) = 0.108929;
+    expect(1) = 0.274690;
+    expect(2) = 1.0;
+    expect(3) = 0.891726;
+    res = ublasx::find(A);
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << A << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
+
+    // find(col-major A)
+    expect = out_vector_type(4);
+    expect(0) = 0.108929;
+    expect(1) = 0.274690;
+    expect(2) = 1.0;
+    expect(3) = 0.891726;
+    res = ublasx::find(B);
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << B << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
+
+    // find(A, < .5): elements which are not stored satisfy the predicate
+    val = 0.5;
+    expect = out_vector_type(7);
+    expect(0) = 0;
+    expect(1) = 0.108929;
+    expect(2) = 0;
+    expect(3) = 0.274690;
+    expect(4) = 0;
+    expect(5) = 0;
+    expect(6) = 0;
+    res = ublasx::find(A, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(" << A << ", < " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 7 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_storage_layout )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major and Column-major Storage Layouts" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> row_major_sparse_matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::column_major> col_major_sparse_matrix_type;
+    typedef ublas::vector<value_type> out_vector_type;
+
+    row_major_matrix_type A(3,4);
+
+    A(0,0) = 0.0;      A(0,1) = 0.274690; A(0,2) = 0.0;      A(0,3) = 0.798938;
+    A(1,0) = 0.108929; A(1,1) = 0.0;      A(1,2) = 0.891726; A(1,3) = 0.0;
+    A(2,0) = 0.0;      A(2,1) = 0.675382; A(2,2) = 1.231751; A(2,3) = 0.0;
+
+    col_major_matrix_type B(A);
+    row_major_sparse_matrix_type C(A);
+    col_major_sparse_matrix_type D(A);
+
+    value_type val(0.5);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // find(A) is the same for every storage layout
+    expect = out_vector_type(6);
+    expect(0) = 0.108929;
+    expect(1) = 0.274690;
+    expect(2) = 0.675382;
+    expect(3) = 0.891726;
+    expect(4) = 1.231751;
+    expect(5) = 0.798938;
+    res = ublasx::find(A);
+    BOOST_UBLASX_DEBUG_TRACE( "find(row-major A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 6 );
+    res = ublasx::find(B);
+    BOOST_UBLASX_DEBUG_TRACE( "find(col-major A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 6 );
+    res = ublasx::find(C);
+    BOOST_UBLASX_DEBUG_TRACE( "find(row-major sparse A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 6 );
+    res = ublasx::find(D);
+    BOOST_UBLASX_DEBUG_TRACE( "find(col-major sparse A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 6 );
+
+    // find(A, > .5)
+    expect = out_vector_type(4);
+    expect(0) = 0.675382;
+    expect(1) = 0.891726;
+    expect(2) = 1.231751;
+    expect(3) = 0.798938;
+    res = ublasx::find(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(row-major A, > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
+    res = ublasx::find(C, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(row-major sparse A, > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
+    res = ublasx::find(D, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "find(col-major sparse A, > " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
 }
-*/
 
 
 int main()
@@ -382,10 +636,13 @@ int main()
     BOOST_UBLASX_TEST_DO( test_vector_container );
     BOOST_UBLASX_TEST_DO( test_vector_expression );
     BOOST_UBLASX_TEST_DO( test_vector_reference );
-//  BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
-//  BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
-//  BOOST_UBLASX_TEST_DO( test_matrix_expression );
-//  BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_matrix_expression );
+    BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_sparse_vector );
+    BOOST_UBLASX_TEST_DO( test_sparse_matrix );
+    BOOST_UBLASX_TEST_DO( test_storage_layout );
 
     BOOST_UBLASX_TEST_END();
 }
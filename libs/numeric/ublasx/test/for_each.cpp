@@ -16,10 +16,18 @@
  * http://www.boost.org/LICENSE_1_0.txt)
  */
 
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
 #include <boost/bind.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
 #include <boost/numeric/ublasx/operation/for_each.hpp>
 #include <boost/numeric/ublasx/tags.hpp>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <iostream>
@@ -67,6 +75,26 @@ struct my_adder
 };
 
 
+/// Count the visited (integral) elements and sum them, possibly from several threads.
+struct my_atomic_adder
+{
+    my_atomic_adder(std::atomic<long>& count, std::atomic<long>& sum)
+    : count_(&count),
+      sum_(&sum)
+    {
+    }
+
+    void operator()(double x) const
+    {
+        ++*count_;
+        *sum_ += static_cast<long>(x);
+    }
+
+    std::atomic<long>* count_;
+    std::atomic<long>* sum_;
+};
+
+
 BOOST_UBLASX_TEST_DEF( test_vector_function )
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Case: Vector - Function");
@@ -443,6 +471,92 @@ BOOST_UBLASX_TEST_DEF( test_matrix_functor_dim_minor )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_vector_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Vector - Execution Policy");
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    // Long enough to be split among several threads
+    const size_type n(300007);
+
+    vector_type v(n);
+    long expect_sum(0);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = (i % 2) ? -value_type(i % 100) : value_type(i % 10);
+        expect_sum += static_cast<long>(v(i));
+    }
+
+    std::atomic<long> count(0);
+    std::atomic<long> sum(0);
+
+    ublasx::for_each(ublasx::execution::seq, v, my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(n) );
+    BOOST_UBLASX_TEST_CHECK( sum == expect_sum );
+
+    count = 0;
+    sum = 0;
+    ublasx::for_each(ublasx::execution::par, v, my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(n) );
+    BOOST_UBLASX_TEST_CHECK( sum == expect_sum );
+
+    count = 0;
+    sum = 0;
+    ublasx::for_each(ublasx::execution::par_unseq, -v, my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(n) );
+    BOOST_UBLASX_TEST_CHECK( sum == -expect_sum );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_matrix_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Matrix - Execution Policy");
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    // Long enough to be split among several threads
+    const size_type nr(701);
+    const size_type nc(503);
+
+    matrix_type A(nr,nc);
+    long expect_sum(0);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            A(r,c) = (r % 2) ? -value_type(c % 100) : value_type(r % 10);
+            expect_sum += static_cast<long>(A(r,c));
+        }
+    }
+
+    std::atomic<long> count(0);
+    std::atomic<long> sum(0);
+
+    ublasx::for_each(ublasx::execution::seq, A, my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(nr*nc) );
+    BOOST_UBLASX_TEST_CHECK( sum == expect_sum );
+
+    // Storage order
+    count = 0;
+    sum = 0;
+    ublasx::for_each(ublasx::execution::par, A, my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(nr*nc) );
+    BOOST_UBLASX_TEST_CHECK( sum == expect_sum );
+
+    // Blocks of rows
+    count = 0;
+    sum = 0;
+    ublasx::for_each(ublasx::execution::par_unseq, ublas::trans(A), my_atomic_adder(count, sum));
+    BOOST_UBLASX_TEST_CHECK( count == static_cast<long>(nr*nc) );
+    BOOST_UBLASX_TEST_CHECK( sum == expect_sum );
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'for_each' operation");
@@ -465,6 +579,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_vector_bound_functor );
     BOOST_UBLASX_TEST_DO( test_matrix_bound_function );
     BOOST_UBLASX_TEST_DO( test_matrix_bound_functor );
+    BOOST_UBLASX_TEST_DO( test_vector_policy );
+    BOOST_UBLASX_TEST_DO( test_matrix_policy );
 
     BOOST_UBLASX_TEST_END();
 }
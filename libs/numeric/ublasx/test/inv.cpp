@@ -28,6 +28,8 @@
 #include <boost/numeric/ublasx/detail/debug.hpp>
 #include <boost/numeric/ublasx/operation/hilb.hpp>
 #include <boost/numeric/ublasx/operation/inv.hpp>
+#include <boost/numeric/ublasx/operation/rcond.hpp>
+#include <complex>
 #include <exception>
 #include "libs/numeric/ublasx/test/utils.hpp"
 
@@ -237,6 +239,198 @@ BOOST_UBLASX_TEST_DEF( singular_matrix )
 }
 
 
+BOOST_UBLASX_TEST_DEF( workspace_inplace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: In place Inversion with Workspace");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n(4);
+
+    matrix_type A(n,n);
+    A(0,0) =  1.80; A(0,1) =  2.88; A(0,2) =  2.05; A(0,3) = -0.89;
+    A(1,0) =  5.25; A(1,1) = -2.95; A(1,2) = -0.95; A(1,3) = -3.80;
+    A(2,0) =  1.58; A(2,1) = -2.69; A(2,2) = -2.90; A(2,3) = -1.04;
+    A(3,0) = -1.11; A(3,1) = -0.66; A(3,2) = -0.59; A(3,3) =  0.80;
+
+    matrix_type expect(n,n);
+    expect(0,0) = 1.771998173034358; expect(0,1) =  0.575690823228768; expect(0,2) =  0.084325372165000; expect(0,3) =  4.815502361651872;
+    expect(1,0) =-0.117466074066139; expect(1,1) = -0.445615014196196; expect(1,2) =  0.411362607935861; expect(1,3) = -1.712580934513892;
+    expect(2,0) = 0.179856389553414; expect(2,1) =  0.452662043400721; expect(2,2) = -0.667565300509907; expect(2,3) =  1.482400048868720;
+    expect(3,0) = 2.494382041276250; expect(3,1) =  0.764976887526086; expect(3,2) = -0.035953803700033; expect(3,3) =  7.611900291858691;
+
+    const value_type expect_rcond = ublasx::rcond(A);
+
+    ublasx::inv_workspace<value_type> ws;
+
+    // The same workspace is reused for several inversions
+    for (size_type k = 0; k < 3; ++k)
+    {
+        matrix_type B(A);
+
+        ublasx::inv_info<value_type> info = ublasx::inv_inplace(B, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << B);
+        BOOST_UBLASX_DEBUG_TRACE("rcond(A) = " << info.rcond);
+        BOOST_UBLASX_TEST_CHECK( !info.singular );
+        BOOST_UBLASX_TEST_CHECK( !info.illcond );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( info.rcond, expect_rcond, tol );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( B, expect, n, n, tol );
+    }
+    BOOST_UBLASX_TEST_CHECK( ws.size() == n );
+
+    // A workspace sized for a different order is resized
+    matrix_type C(2,2);
+    C(0,0) = 4; C(0,1) = 7;
+    C(1,0) = 2; C(1,1) = 6;
+
+    ublasx::inv_info<value_type> info = ublasx::inv_inplace(C, ws);
+
+    matrix_type expect_C(2,2);
+    expect_C(0,0) =  0.6; expect_C(0,1) = -0.7;
+    expect_C(1,0) = -0.2; expect_C(1,1) =  0.4;
+
+    BOOST_UBLASX_DEBUG_TRACE("C^{-1} = " << C);
+    BOOST_UBLASX_TEST_CHECK( !info.singular );
+    BOOST_UBLASX_TEST_CHECK( ws.size() == 2 );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( C, expect_C, 2, 2, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( row_major_matrix_info )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Row-major Matrix - Inversion with Info");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n(4);
+
+    matrix_type A(n,n);
+    A(0,0) =  1.80; A(0,1) =  2.88; A(0,2) =  2.05; A(0,3) = -0.89;
+    A(1,0) =  5.25; A(1,1) = -2.95; A(1,2) = -0.95; A(1,3) = -3.80;
+    A(2,0) =  1.58; A(2,1) = -2.69; A(2,2) = -2.90; A(2,3) = -1.04;
+    A(3,0) = -1.11; A(3,1) = -0.66; A(3,2) = -0.59; A(3,3) =  0.80;
+
+    matrix_type expect(n,n);
+    expect(0,0) = 1.771998173034358; expect(0,1) =  0.575690823228768; expect(0,2) =  0.084325372165000; expect(0,3) =  4.815502361651872;
+    expect(1,0) =-0.117466074066139; expect(1,1) = -0.445615014196196; expect(1,2) =  0.411362607935861; expect(1,3) = -1.712580934513892;
+    expect(2,0) = 0.179856389553414; expect(2,1) =  0.452662043400721; expect(2,2) = -0.667565300509907; expect(2,3) =  1.482400048868720;
+    expect(3,0) = 2.494382041276250; expect(3,1) =  0.764976887526086; expect(3,2) = -0.035953803700033; expect(3,3) =  7.611900291858691;
+
+    ublasx::inv_info<value_type> info;
+    matrix_type B;
+
+    B = ublasx::inv(A, info);
+
+    BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << B);
+    BOOST_UBLASX_DEBUG_TRACE("rcond(A) = " << info.rcond);
+    BOOST_UBLASX_TEST_CHECK( !info.singular );
+    BOOST_UBLASX_TEST_CHECK( !info.illcond );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( info.rcond, ublasx::rcond(A), tol );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( B, expect, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Matrix");
+
+    typedef double real_type;
+    typedef ::std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = value_type(1, 1); A(0,1) = value_type(2, 0);
+    A(1,0) = value_type(0, 1); A(1,1) = value_type(3,-1);
+
+    ublasx::inv_workspace<value_type> ws;
+    ublasx::inv_info<real_type> info;
+    matrix_type B(A);
+
+    info = ublasx::inv_inplace(B, ws);
+
+    // inv(A) = [A(1,1) -A(0,1); -A(1,0) A(0,0)]/det(A), with det(A) = 4
+    matrix_type expect(n,n);
+    expect(0,0) = value_type( 0.75 ,-0.25); expect(0,1) = value_type(-0.5 , 0   );
+    expect(1,0) = value_type( 0    ,-0.25); expect(1,1) = value_type( 0.25, 0.25);
+
+    BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << B);
+    BOOST_UBLASX_DEBUG_TRACE("rcond(A) = " << info.rcond);
+    BOOST_UBLASX_TEST_CHECK( !info.singular );
+    BOOST_UBLASX_TEST_CHECK( !info.illcond );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( info.rcond, ublasx::rcond(A), tol );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( B, expect, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( singular_matrix_info )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Singular Matrix - Inversion with Info");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n(2);
+
+    matrix_type A(n,n);
+    A(0,0) =  1.00; A(0,1) = 2.00;
+    A(1,0) =  1.00; A(1,1) = 2.00;
+
+    ublasx::inv_workspace<value_type> ws(n);
+    ublasx::inv_info<value_type> info;
+    matrix_type expect;
+
+    info = ublasx::inv_inplace(A, ws);
+    expect = ublas::scalar_matrix<value_type>(n,n, ::std::numeric_limits<value_type>::infinity());
+
+    BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << A);
+    BOOST_UBLASX_TEST_CHECK( info.singular );
+    BOOST_UBLASX_TEST_CHECK( info.illcond );
+    BOOST_UBLASX_TEST_CHECK( info.rcond == 0 );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( A, expect, n, n );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lu_decomposition_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Inversion from an LU Decomposition");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ::std::size_t size_type;
+
+    const size_type n(4);
+
+    matrix_type A(n,n);
+    A(0,0) =  1.80; A(0,1) =  2.88; A(0,2) =  2.05; A(0,3) = -0.89;
+    A(1,0) =  5.25; A(1,1) = -2.95; A(1,2) = -0.95; A(1,3) = -3.80;
+    A(2,0) =  1.58; A(2,1) = -2.69; A(2,2) = -2.90; A(2,3) = -1.04;
+    A(3,0) = -1.11; A(3,1) = -0.66; A(3,2) = -0.59; A(3,3) =  0.80;
+
+    matrix_type expect(n,n);
+    expect(0,0) = 1.771998173034358; expect(0,1) =  0.575690823228768; expect(0,2) =  0.084325372165000; expect(0,3) =  4.815502361651872;
+    expect(1,0) =-0.117466074066139; expect(1,1) = -0.445615014196196; expect(1,2) =  0.411362607935861; expect(1,3) = -1.712580934513892;
+    expect(2,0) = 0.179856389553414; expect(2,1) =  0.452662043400721; expect(2,2) = -0.667565300509907; expect(2,3) =  1.482400048868720;
+    expect(3,0) = 2.494382041276250; expect(3,1) =  0.764976887526086; expect(3,2) = -0.035953803700033; expect(3,3) =  7.611900291858691;
+
+    ublasx::lu_decomposition<value_type> lu(A);
+    matrix_type B;
+
+    B = ublasx::inv(lu);
+
+    BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << B);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( B, expect, n, n, tol );
+}
+
+
 BOOST_UBLASX_TEST_DEF( illconditioned_matrix )
 {
 
@@ -277,6 +471,14 @@ BOOST_UBLASX_TEST_DEF( illconditioned_matrix )
     BOOST_UBLASX_DEBUG_TRACE("A^{-1} = " << B);
 //  BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( B, expect, n, n, tol );
     BOOST_UBLASX_TEST_CHECK( true ); // Just avoid unused variable warnings from the compiler
+
+    ublasx::inv_info<value_type> info;
+
+    B = ublasx::inv(A, info);
+
+    BOOST_UBLASX_DEBUG_TRACE("rcond(A) = " << info.rcond);
+    BOOST_UBLASX_TEST_CHECK( !info.singular );
+    BOOST_UBLASX_TEST_CHECK( info.illcond );
 }
 
 //#define BOOST_UBLAS_TYPE_CHECK 1
@@ -294,6 +496,11 @@ int main()
     BOOST_UBLASX_TEST_DO( col_major_matrix );
     BOOST_UBLASX_TEST_DO( rectangular_matrix );
     BOOST_UBLASX_TEST_DO( singular_matrix );
+    BOOST_UBLASX_TEST_DO( workspace_inplace );
+    BOOST_UBLASX_TEST_DO( row_major_matrix_info );
+    BOOST_UBLASX_TEST_DO( complex_matrix );
+    BOOST_UBLASX_TEST_DO( singular_matrix_info );
+    BOOST_UBLASX_TEST_DO( lu_decomposition_matrix );
     BOOST_UBLASX_TEST_DO( illconditioned_matrix );
 
     BOOST_UBLASX_TEST_END();
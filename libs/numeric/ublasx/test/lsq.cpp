@@ -585,6 +585,234 @@ BOOST_UBLASX_TEST_DEF( test_complex_matrix_row_major_lls )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_double_matrix_row_major_lls_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Matrix - Row Major - LLS - Reused Workspace");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t nr(6);
+    const ::std::size_t nc(5);
+    const ::std::size_t n(nr);
+
+    matrix_type A(nr,nc);
+    A(0,0) = -0.09; A(0,1) =  0.14; A(0,2) = -0.46; A(0,3) =  0.68; A(0,4) =  1.29;
+    A(1,0) = -1.56; A(1,1) =  0.20; A(1,2) =  0.29; A(1,3) =  1.09; A(1,4) =  0.51;
+    A(2,0) = -1.48; A(2,1) = -0.43; A(2,2) =  0.89; A(2,3) = -0.71; A(2,4) = -0.96;
+    A(3,0) = -1.09; A(3,1) =  0.84; A(3,2) =  0.77; A(3,3) =  2.11; A(3,4) = -1.27;
+    A(4,0) =  0.08; A(4,1) =  0.55; A(4,2) = -1.13; A(4,3) =  0.14; A(4,4) =  1.74;
+    A(5,0) = -1.59; A(5,1) = -0.72; A(5,2) =  1.06; A(5,3) =  1.24; A(5,4) =  0.34;
+
+    vector_type b(n);
+    b(0) =  7.4;
+    b(1) =  4.2;
+    b(2) = -8.3;
+    b(3) =  1.8;
+    b(4) =  8.6;
+    b(5) =  2.1;
+
+    vector_type expect_x(nc);
+    expect_x(0) = -0.79974;
+    expect_x(1) = -3.28796;
+    expect_x(2) = -7.47498;
+    expect_x(3) =  4.93927;
+    expect_x(4) =  0.76783;
+
+    ublasx::llsq_workspace<value_type> ws;
+    vector_type x;
+
+    // QR method, repeated with the same workspace
+    for (::std::size_t k = 1; k <= 2; ++k)
+    {
+        x = b*value_type(k);
+        ublasx::llsq_qr_inplace(A, x, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-" << k << "*b||_2 --> x = " << x );
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x*value_type(k), nc, tol*k );
+    }
+
+    // SVD method with the same workspace
+    for (::std::size_t k = 1; k <= 2; ++k)
+    {
+        x = b*value_type(k);
+        ublasx::llsq_svd_inplace(A, x, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-" << k << "*b||_2 --> x = " << x );
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x*value_type(k), nc, tol*k );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_matrix_column_major_lls_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Matrix - Column Major - LLS - Reused Workspace");
+
+    typedef double real_type;
+    typedef ::std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t nr(5);
+    const ::std::size_t nc(4);
+    const ::std::size_t n(5);
+
+    matrix_type A(nr,nc);
+    A(0,0) = value_type( 0.47,-0.34); A(0,1) = value_type(-0.40, 0.54); A(0,2) = value_type( 0.60, 0.01); A(0,3) = value_type( 0.80,-1.02);
+    A(1,0) = value_type(-0.32,-0.23); A(1,1) = value_type(-0.05, 0.20); A(1,2) = value_type(-0.26,-0.44); A(1,3) = value_type(-0.43, 0.17);
+    A(2,0) = value_type( 0.35,-0.60); A(2,1) = value_type(-0.52,-0.34); A(2,2) = value_type( 0.87,-0.11); A(2,3) = value_type(-0.34,-0.09);
+    A(3,0) = value_type( 0.89, 0.71); A(3,1) = value_type(-0.45,-0.45); A(3,2) = value_type(-0.02,-0.57); A(3,3) = value_type( 1.14,-0.78);
+    A(4,0) = value_type(-0.19, 0.06); A(4,1) = value_type( 0.11,-0.85); A(4,2) = value_type( 1.44, 0.80); A(4,3) = value_type( 0.07, 1.14);
+
+    vector_type b(n);
+    b(0) = value_type(-1.08,-2.59);
+    b(1) = value_type(-2.61,-1.49);
+    b(2) = value_type( 3.13,-3.61);
+    b(3) = value_type( 7.33,-8.01);
+    b(4) = value_type( 9.12, 7.63);
+
+    vector_type expect_x(nc);
+    expect_x(0) = value_type(18.79221131415766,  9.58842519277362);
+    expect_x(1) = value_type(19.15428710640874,  2.12745817492880);
+    expect_x(2) = value_type( 2.79395045513666, 10.27260222931818);
+    expect_x(3) = value_type( 7.14260392345630,-11.39648999358683);
+
+    ublasx::llsq_workspace<value_type> ws;
+    vector_type x;
+
+    for (::std::size_t k = 1; k <= 2; ++k)
+    {
+        x = b*value_type(k);
+        ublasx::llsq_svd_inplace(A, x, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-" << k << "*b||_2 --> x = " << x );
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x*value_type(k), nc, tol*k );
+    }
+
+    x = b;
+    ublasx::llsq_qr_inplace(A, x, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-b||_2 --> x = " << x );
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_double_matrix_row_major_lls_svd_gesdd )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Double Matrix - Row Major - LLS - SVD - Divide-and-Conquer Driver");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t nr(6);
+    const ::std::size_t nc(5);
+    const ::std::size_t n(nr);
+
+    matrix_type A(nr,nc);
+    A(0,0) = -0.09; A(0,1) =  0.14; A(0,2) = -0.46; A(0,3) =  0.68; A(0,4) =  1.29;
+    A(1,0) = -1.56; A(1,1) =  0.20; A(1,2) =  0.29; A(1,3) =  1.09; A(1,4) =  0.51;
+    A(2,0) = -1.48; A(2,1) = -0.43; A(2,2) =  0.89; A(2,3) = -0.71; A(2,4) = -0.96;
+    A(3,0) = -1.09; A(3,1) =  0.84; A(3,2) =  0.77; A(3,3) =  2.11; A(3,4) = -1.27;
+    A(4,0) =  0.08; A(4,1) =  0.55; A(4,2) = -1.13; A(4,3) =  0.14; A(4,4) =  1.74;
+    A(5,0) = -1.59; A(5,1) = -0.72; A(5,2) =  1.06; A(5,3) =  1.24; A(5,4) =  0.34;
+
+    vector_type b(n);
+    b(0) =  7.4;
+    b(1) =  4.2;
+    b(2) = -8.3;
+    b(3) =  1.8;
+    b(4) =  8.6;
+    b(5) =  2.1;
+
+    vector_type expect_x(nc);
+    expect_x(0) = -0.79974;
+    expect_x(1) = -3.28796;
+    expect_x(2) = -7.47498;
+    expect_x(3) =  4.93927;
+    expect_x(4) =  0.76783;
+
+    vector_type x;
+
+    x = ublasx::llsq_svd(A, b, ublasx::gesdd_svd_algorithm);
+
+    BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-b||_2 --> x = " << x );
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x, nc, tol );
+
+    // Switch driver with the same workspace
+    ublasx::llsq_workspace<value_type> ws;
+    for (::std::size_t k = 1; k <= 4; ++k)
+    {
+        x = b*value_type(k);
+        ublasx::llsq_svd_inplace(A, x, ws, (k % 2) ? ublasx::gesdd_svd_algorithm : ublasx::gesvd_svd_algorithm);
+
+        BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-" << k << "*b||_2 --> x = " << x );
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x*value_type(k), nc, tol*k );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_matrix_column_major_lls_svd_gesdd )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Matrix - Column Major - LLS - SVD - Divide-and-Conquer Driver");
+
+    typedef double real_type;
+    typedef ::std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t nr(5);
+    const ::std::size_t nc(4);
+    const ::std::size_t n(5);
+
+    matrix_type A(nr,nc);
+    A(0,0) = value_type( 0.47,-0.34); A(0,1) = value_type(-0.40, 0.54); A(0,2) = value_type( 0.60, 0.01); A(0,3) = value_type( 0.80,-1.02);
+    A(1,0) = value_type(-0.32,-0.23); A(1,1) = value_type(-0.05, 0.20); A(1,2) = value_type(-0.26,-0.44); A(1,3) = value_type(-0.43, 0.17);
+    A(2,0) = value_type( 0.35,-0.60); A(2,1) = value_type(-0.52,-0.34); A(2,2) = value_type( 0.87,-0.11); A(2,3) = value_type(-0.34,-0.09);
+    A(3,0) = value_type( 0.89, 0.71); A(3,1) = value_type(-0.45,-0.45); A(3,2) = value_type(-0.02,-0.57); A(3,3) = value_type( 1.14,-0.78);
+    A(4,0) = value_type(-0.19, 0.06); A(4,1) = value_type( 0.11,-0.85); A(4,2) = value_type( 1.44, 0.80); A(4,3) = value_type( 0.07, 1.14);
+
+    vector_type b(n);
+    b(0) = value_type(-1.08,-2.59);
+    b(1) = value_type(-2.61,-1.49);
+    b(2) = value_type( 3.13,-3.61);
+    b(3) = value_type( 7.33,-8.01);
+    b(4) = value_type( 9.12, 7.63);
+
+    vector_type expect_x(nc);
+    expect_x(0) = value_type(18.79221131415766,  9.58842519277362);
+    expect_x(1) = value_type(19.15428710640874,  2.12745817492880);
+    expect_x(2) = value_type( 2.79395045513666, 10.27260222931818);
+    expect_x(3) = value_type( 7.14260392345630,-11.39648999358683);
+
+    vector_type x;
+
+    x = ublasx::llsq_svd(A, b, ublasx::gesdd_svd_algorithm);
+
+    BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-b||_2 --> x = " << x );
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x, nc, tol );
+
+    ublasx::llsq_workspace<value_type> ws;
+    for (::std::size_t k = 1; k <= 2; ++k)
+    {
+        x = b*value_type(k);
+        ublasx::llsq_svd_inplace(A, x, ws, ublasx::gesdd_svd_algorithm);
+
+        BOOST_UBLASX_DEBUG_TRACE( "min_x ||Ax-" << k << "*b||_2 --> x = " << x );
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(x) == nc );
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x*value_type(k), nc, tol*k );
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'llsq' operation");
@@ -603,6 +831,10 @@ int main()
     BOOST_UBLASX_TEST_DO( test_double_matrix_row_major_lls );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_column_major_lls );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_row_major_lls );
+    BOOST_UBLASX_TEST_DO( test_double_matrix_row_major_lls_workspace );
+    BOOST_UBLASX_TEST_DO( test_complex_matrix_column_major_lls_workspace );
+    BOOST_UBLASX_TEST_DO( test_double_matrix_row_major_lls_svd_gesdd );
+    BOOST_UBLASX_TEST_DO( test_complex_matrix_column_major_lls_svd_gesdd );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -21,9 +21,16 @@
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/inv.hpp>
 #include <boost/numeric/ublasx/operation/lu.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/rcond.hpp>
+#include <algorithm>
+#include <complex>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include "libs/numeric/ublasx/test/utils.hpp"
 
 
@@ -134,12 +141,334 @@ BOOST_UBLASX_TEST_DEF( lu_solve_square_row_major )
 }
 
 
+BOOST_UBLASX_TEST_DEF( lu_decomposition_real )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Real Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const size_type n(3);
+
+    matrix_type A(n,n);
+    A(0,0) =  2; A(0,1) =  1; A(0,2) = 1;
+    A(1,0) =  4; A(1,1) = -6; A(1,2) = 0;
+    A(2,0) = -2; A(2,1) =  7; A(2,2) = 2;
+
+    ublasx::lu_decomposition<value_type> lu(A);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "LU = " << lu.LU() );
+    BOOST_UBLASX_TEST_CHECK( lu.info() == 0 );
+    BOOST_UBLASX_TEST_CHECK( !lu.singular() );
+
+    // P*A == L*U
+    matrix_type PA(A);
+    ublas::swap_rows(lu.P(), PA);
+    matrix_type LU = ublas::prod(lu.L(), lu.U());
+    BOOST_UBLASX_DEBUG_TRACE( "L = " << lu.L() );
+    BOOST_UBLASX_DEBUG_TRACE( "U = " << lu.U() );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( LU, PA, n, n, TOL );
+
+    // Solve with several right-hand sides without refactorizing
+    vector_type b(n);
+    b(0) = 5; b(1) = -2; b(2) = 9;
+    vector_type expect_x(n);
+    expect_x(0) = 1; expect_x(1) = 1; expect_x(2) = 2;
+
+    vector_type x = lu.solve(b);
+    BOOST_UBLASX_DEBUG_TRACE( "Ax = b ==> x = " << x );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x, n, TOL );
+
+    lu.solve_inplace(b);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( b, expect_x, n, TOL );
+
+    matrix_type B(n,2);
+    B(0,0) = 1; B(0,1) = 2;
+    B(1,0) = 3; B(1,1) = 4;
+    B(2,0) = 5; B(2,1) = 6;
+    matrix_type expect_X(n,2);
+    expect_X(0,0) = -33.0/16.0; expect_X(0,1) = -2;
+    expect_X(1,0) = -15.0/8.0; expect_X(1,1) = -2;
+    expect_X(2,0) =  7; expect_X(2,1) =  8;
+
+    matrix_type X = lu.solve(B);
+    BOOST_UBLASX_DEBUG_TRACE( "AX = B ==> X = " << X );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, expect_X, n, 2, TOL );
+
+    // Determinant
+    BOOST_UBLASX_DEBUG_TRACE( "det(A) = " << lu.det() );
+    BOOST_UBLASX_DEBUG_TRACE( "log|det(A)| = " << lu.logdet() );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( lu.det(), -16.0, TOL );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( lu.logdet(), ::std::log(16.0), TOL );
+
+    // Reciprocal condition number
+    BOOST_UBLASX_DEBUG_TRACE( "rcond(A) = " << ublasx::rcond(lu) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( ublasx::rcond(lu), ublasx::rcond(A), TOL );
+
+    // Inverse
+    matrix_type expect_inv(n,n);
+    expect_inv(0,0) =  12; expect_inv(0,1) = -5; expect_inv(0,2) = -6;
+    expect_inv(1,0) =   8; expect_inv(1,1) = -6; expect_inv(1,2) = -4;
+    expect_inv(2,0) = -16; expect_inv(2,1) = 16; expect_inv(2,2) = 16;
+    expect_inv /= 16.0;
+
+    matrix_type invA = ublasx::inv(lu);
+    BOOST_UBLASX_DEBUG_TRACE( "inv(A) = " << invA );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( invA, expect_inv, n, n, TOL );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lu_decomposition_complex )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Complex Matrix" );
+
+    typedef double real_type;
+    typedef ::std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const size_type n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = value_type(1, 1); A(0,1) = value_type(2, 0);
+    A(1,0) = value_type(0, 1); A(1,1) = value_type(3,-1);
+
+    ublasx::lu_decomposition<value_type> lu;
+    lu.decompose(A);
+
+    // det(A) = (1+i)(3-i) - 2i = 4
+    BOOST_UBLASX_DEBUG_TRACE( "det(A) = " << lu.det() );
+    BOOST_UBLASX_TEST_CHECK( !lu.singular() );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( lu.det(), value_type(4,0), TOL );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( lu.logdet(), ::std::log(4.0), TOL );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( ublasx::rcond(lu), ublasx::rcond(A), TOL );
+
+    vector_type b(n);
+    b(0) = value_type(3, 1);
+    b(1) = value_type(3, 0);
+    vector_type expect_x(n);
+    expect_x(0) = value_type(1, 0);
+    expect_x(1) = value_type(1, 0);
+
+    vector_type x = lu.solve(b);
+    BOOST_UBLASX_DEBUG_TRACE( "Ax = b ==> x = " << x );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect_x, n, TOL );
+
+    matrix_type expect_inv(n,n);
+    expect_inv(0,0) = value_type( 0.75,-0.25); expect_inv(0,1) = value_type(-0.5 , 0   );
+    expect_inv(1,0) = value_type( 0   ,-0.25); expect_inv(1,1) = value_type( 0.25, 0.25);
+
+    matrix_type invA = ublasx::inv(lu);
+    BOOST_UBLASX_DEBUG_TRACE( "inv(A) = " << invA );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( invA, expect_inv, n, n, TOL );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lu_decomposition_singular )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Singular Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const size_type n(2);
+
+    matrix_type A(n,n);
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 1; A(1,1) = 2;
+
+    ublasx::lu_decomposition<value_type> lu(A);
+
+    matrix_type invA = ublasx::inv(lu);
+    matrix_type expect_inv = ublas::scalar_matrix<value_type>(n, n, ::std::numeric_limits<value_type>::infinity());
+
+    BOOST_UBLASX_DEBUG_TRACE( "info = " << lu.info() );
+    BOOST_UBLASX_TEST_CHECK( lu.singular() );
+    BOOST_UBLASX_TEST_CHECK( lu.info() == 2 );
+    BOOST_UBLASX_TEST_CHECK( lu.det() == 0 );
+    BOOST_UBLASX_TEST_CHECK( lu.logdet() == -::std::numeric_limits<value_type>::infinity() );
+    BOOST_UBLASX_TEST_CHECK( ublasx::rcond(lu) == 0 );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_EQ( invA, expect_inv, n, n );
+}
+
+
+namespace detail { namespace /*<unnamed>*/ {
+
+/// Fill \a A with a deterministic matrix having no special structure.
+template <typename MatrixT>
+void fill_pseudo_random(MatrixT& A)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::size_type size_type;
+    typedef typename ublas::matrix_traits<MatrixT>::value_type value_type;
+
+    // Linear congruential generator, to get the same matrix everywhere
+    unsigned long seed = 12345UL;
+
+    const size_type nr = ublasx::num_rows(A);
+    const size_type nc = ublasx::num_columns(A);
+    for (size_type i = 0; i < nr; ++i)
+    {
+        for (size_type j = 0; j < nc; ++j)
+        {
+            seed = (1103515245UL*seed + 12345UL) % 2147483648UL;
+            A(i,j) = static_cast<value_type>(static_cast<double>(seed)/2147483648.0 - 0.5);
+        }
+    }
+}
+
+
+/// Check that \f$PA = LU\f$ for the LU factors stored in \a LU.
+template <typename MatrixT, typename LUMatrixT, typename PermutationMatrixT>
+bool check_plu(MatrixT const& A, LUMatrixT const& LU, PermutationMatrixT const& P, double tol)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::size_type size_type;
+    typedef typename ublas::matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = ublasx::num_rows(A);
+    const size_type nc = ublasx::num_columns(A);
+    const size_type k = ::std::min(nr, nc);
+
+    MatrixT PA(A);
+    ublas::swap_rows(P, PA);
+
+    for (size_type i = 0; i < nr; ++i)
+    {
+        for (size_type j = 0; j < nc; ++j)
+        {
+            value_type x = 0;
+            for (size_type p = 0; p <= ::std::min(i, j) && p < k; ++p)
+            {
+                x += (p == i ? value_type(1) : LU(i,p))*LU(p,j);
+            }
+            if (::std::abs(x-PA(i,j)) > tol)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+}} // Namespace detail::<unnamed>
+
+
+BOOST_UBLASX_TEST_DEF( lu_decompose_layouts )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Row-major vs. Column-major vs. Extended precision" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<value_type,ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<long double,ublas::row_major> long_matrix_type;
+    typedef ublas::permutation_matrix<ublas::matrix_traits<row_major_matrix_type>::size_type> permutation_matrix_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+
+    const size_type sizes[][2] = {{100,100}, {70,37}, {37,70}, {1,5}, {5,1}};
+
+    for (size_type t = 0; t < sizeof(sizes)/sizeof(sizes[0]); ++t)
+    {
+        const size_type nr = sizes[t][0];
+        const size_type nc = sizes[t][1];
+
+        BOOST_UBLASX_DEBUG_TRACE( "Size: " << nr << "x" << nc );
+
+        row_major_matrix_type A(nr,nc);
+        detail::fill_pseudo_random(A);
+
+        // LAPACK path
+        column_major_matrix_type LU_cm(A);
+        permutation_matrix_type P_cm(nr);
+        size_type info_cm = ublasx::lu_decompose_inplace(LU_cm, P_cm);
+
+        // Blocked recursive path
+        row_major_matrix_type LU_rm(A);
+        permutation_matrix_type P_rm(nr);
+        size_type info_rm = ublasx::lu_decompose_inplace(LU_rm, P_rm);
+
+        // Blocked recursive path (LAPACK unavailable for this value type)
+        long_matrix_type LU_ld(A);
+        permutation_matrix_type P_ld(nr);
+        size_type info_ld = ublasx::lu_decompose_inplace(LU_ld, P_ld);
+
+        BOOST_UBLASX_TEST_CHECK( info_rm == info_cm );
+        BOOST_UBLASX_TEST_CHECK( info_ld == info_cm );
+        for (size_type i = 0; i < nr; ++i)
+        {
+            BOOST_UBLASX_TEST_CHECK( P_rm(i) == P_cm(i) );
+            BOOST_UBLASX_TEST_CHECK( P_ld(i) == P_cm(i) );
+        }
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( LU_rm, LU_cm, nr, nc, TOL );
+
+        // Reference ublas factorization (its debug checks only allow square matrices)
+        if (nr == nc)
+        {
+            row_major_matrix_type LU_ref(A);
+            permutation_matrix_type P_ref(nr);
+            size_type info_ref = ublas::lu_factorize(LU_ref, P_ref);
+
+            BOOST_UBLASX_TEST_CHECK( info_cm == info_ref );
+            for (size_type i = 0; i < nr; ++i)
+            {
+                BOOST_UBLASX_TEST_CHECK( P_cm(i) == P_ref(i) );
+            }
+            BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( LU_cm, LU_ref, nr, nc, TOL );
+        }
+        BOOST_UBLASX_TEST_CHECK( detail::check_plu(A, LU_cm, P_cm, 1.0e-10) );
+        BOOST_UBLASX_TEST_CHECK( detail::check_plu(A, LU_rm, P_rm, 1.0e-10) );
+        BOOST_UBLASX_TEST_CHECK( detail::check_plu(A, LU_ld, P_ld, 1.0e-10) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( lu_decompose_singular_layouts )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Singular Matrix - Row-major vs. Column-major" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<value_type,ublas::row_major> row_major_matrix_type;
+    typedef ublas::permutation_matrix<ublas::matrix_traits<row_major_matrix_type>::size_type> permutation_matrix_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+
+    const size_type n(40);
+
+    // The 21st column is zero, hence the 21st pivot is exactly zero
+    row_major_matrix_type A(n,n);
+    detail::fill_pseudo_random(A);
+    ublas::column(A, 20) = ublas::zero_vector<value_type>(n);
+
+    column_major_matrix_type LU_cm(A);
+    permutation_matrix_type P_cm(n);
+    size_type info_cm = ublasx::lu_decompose_inplace(LU_cm, P_cm);
+
+    row_major_matrix_type LU_rm(A);
+    permutation_matrix_type P_rm(n);
+    size_type info_rm = ublasx::lu_decompose_inplace(LU_rm, P_rm);
+
+    BOOST_UBLASX_DEBUG_TRACE( "info (column-major) = " << info_cm );
+    BOOST_UBLASX_DEBUG_TRACE( "info (row-major) = " << info_rm );
+    BOOST_UBLASX_TEST_CHECK( info_cm == 21 );
+    BOOST_UBLASX_TEST_CHECK( info_rm == 21 );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
 
     BOOST_UBLASX_TEST_DO( lu_solve_square_column_major );
     BOOST_UBLASX_TEST_DO( lu_solve_square_row_major );
+    BOOST_UBLASX_TEST_DO( lu_decomposition_real );
+    BOOST_UBLASX_TEST_DO( lu_decomposition_complex );
+    BOOST_UBLASX_TEST_DO( lu_decomposition_singular );
+    BOOST_UBLASX_TEST_DO( lu_decompose_layouts );
+    BOOST_UBLASX_TEST_DO( lu_decompose_singular_layouts );
 
     BOOST_UBLASX_TEST_END();
 }
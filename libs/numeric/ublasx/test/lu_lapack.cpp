@@ -0,0 +1,243 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/lu_lapack.cpp
+ *
+ * \brief Test suite for the LAPACK-based LU decomposition.
+ *
+ * The LAPACK path (\c getrf and \c getrs) is only compiled when the
+ * \c BOOST_UBLASX_USE_LAPACK macro is defined, and is only taken for dense
+ * column-major matrices: its results are compared with the ones of the
+ * blocked recursive path, which is taken for row-major matrices.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#ifndef BOOST_UBLASX_USE_LAPACK
+# define BOOST_UBLASX_USE_LAPACK
+#endif // BOOST_UBLASX_USE_LAPACK
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/lu.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/detail/lapack.hpp>
+#include <boost/numeric/ublasx/operation/lu.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+static const double TOL(1.0e-8);
+
+
+namespace detail { namespace /*<unnamed>*/ {
+
+/// Fill \a A with a deterministic matrix having no special structure.
+template <typename MatrixT>
+void fill_pseudo_random(MatrixT& A, unsigned long seed)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::size_type size_type;
+    typedef typename ublas::matrix_traits<MatrixT>::value_type value_type;
+
+    const size_type nr = ublasx::num_rows(A);
+    const size_type nc = ublasx::num_columns(A);
+    for (size_type i = 0; i < nr; ++i)
+    {
+        for (size_type j = 0; j < nc; ++j)
+        {
+            seed = (1103515245UL*seed + 12345UL) % 2147483648UL;
+            A(i,j) = static_cast<value_type>(static_cast<double>(seed)/2147483648.0 - 0.5);
+        }
+    }
+}
+
+}} // Namespace detail::<unnamed>
+
+
+BOOST_UBLASX_TEST_DEF( lapack_enabled )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LAPACK enabled" );
+
+    typedef ublas::matrix<double,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<double,ublas::row_major> row_major_matrix_type;
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::detail::lapack::enabled );
+    BOOST_UBLASX_TEST_CHECK( ublasx::detail::lapack::is_supported_matrix<column_major_matrix_type>::value );
+    BOOST_UBLASX_TEST_CHECK( !ublasx::detail::lapack::is_supported_matrix<row_major_matrix_type>::value );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lapack_decompose )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - LAPACK vs. Recursive" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<value_type,ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+    typedef ublas::permutation_matrix<size_type> permutation_matrix_type;
+
+    const size_type sizes[][2] = {{60,60}, {45,23}, {23,45}, {1,1}};
+
+    for (size_type t = 0; t < sizeof(sizes)/sizeof(sizes[0]); ++t)
+    {
+        const size_type nr = sizes[t][0];
+        const size_type nc = sizes[t][1];
+
+        BOOST_UBLASX_DEBUG_TRACE( "Size: " << nr << "x" << nc );
+
+        row_major_matrix_type A(nr,nc);
+        detail::fill_pseudo_random(A, 12345UL);
+
+        // LAPACK path
+        column_major_matrix_type LU_cm(A);
+        permutation_matrix_type P_cm(nr);
+        size_type info_cm = ublasx::lu_decompose_inplace(LU_cm, P_cm);
+
+        // Blocked recursive path
+        row_major_matrix_type LU_rm(A);
+        permutation_matrix_type P_rm(nr);
+        size_type info_rm = ublasx::lu_decompose_inplace(LU_rm, P_rm);
+
+        BOOST_UBLASX_DEBUG_TRACE( "info (LAPACK) = " << info_cm << " ==> " << info_rm );
+        BOOST_UBLASX_TEST_CHECK( info_cm == 0 );
+        BOOST_UBLASX_TEST_CHECK( info_cm == info_rm );
+        for (size_type i = 0; i < nr; ++i)
+        {
+            BOOST_UBLASX_TEST_CHECK( P_cm(i) == P_rm(i) );
+        }
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( LU_cm, LU_rm, nr, nc, TOL );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( lapack_solve )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU solve - LAPACK vs. Recursive" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<value_type,ublas::row_major> row_major_matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+    typedef ublas::permutation_matrix<size_type> permutation_matrix_type;
+
+    const size_type n(50);
+    const size_type nrhs(3);
+
+    row_major_matrix_type A(n,n);
+    detail::fill_pseudo_random(A, 12345UL);
+    row_major_matrix_type B(n,nrhs);
+    detail::fill_pseudo_random(B, 54321UL);
+    vector_type b(ublas::column(B, 0));
+
+    column_major_matrix_type LU_cm(A);
+    permutation_matrix_type P_cm(n);
+    ublasx::lu_decompose_inplace(LU_cm, P_cm);
+
+    row_major_matrix_type LU_rm(A);
+    permutation_matrix_type P_rm(n);
+    ublasx::lu_decompose_inplace(LU_rm, P_rm);
+
+    // Vector right-hand side (getrs vs. substitution)
+    vector_type x_cm(b);
+    ublasx::lu_apply_inplace(LU_cm, P_cm, x_cm);
+    vector_type x_rm(b);
+    ublasx::lu_apply_inplace(LU_rm, P_rm, x_rm);
+
+    BOOST_UBLASX_DEBUG_TRACE( "x (LAPACK) = " << x_cm << " ==> " << x_rm );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x_cm, x_rm, n, TOL );
+    vector_type Ax(ublas::prod(A, x_cm));
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( Ax, b, n, TOL );
+
+    // Matrix right-hand side
+    column_major_matrix_type X_cm(B);
+    ublasx::lu_apply_inplace(LU_cm, P_cm, X_cm);
+    row_major_matrix_type X_rm(B);
+    ublasx::lu_apply_inplace(LU_rm, P_rm, X_rm);
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X_cm, X_rm, n, nrhs, TOL );
+    row_major_matrix_type AX(ublas::prod(A, X_cm));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( AX, B, n, nrhs, TOL );
+
+    // Whole solvers
+    column_major_matrix_type A_cm(A);
+    vector_type y_cm;
+    vector_type y_rm;
+    BOOST_UBLASX_TEST_CHECK( ublasx::lu_solve(A_cm, b, y_cm) == 0 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::lu_solve(A, b, y_rm) == 0 );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( y_cm, y_rm, n, TOL );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lapack_singular )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: LU decomposition - Singular Matrix - LAPACK vs. Recursive" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> column_major_matrix_type;
+    typedef ublas::matrix<value_type,ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+    typedef ublas::permutation_matrix<size_type> permutation_matrix_type;
+
+    const size_type n(40);
+
+    // A zero k-th column makes the k-th pivot exactly zero, so that the
+    // decomposition returns 1 + k
+    const size_type zero_columns[] = {0, 20, 39};
+
+    for (size_type t = 0; t < sizeof(zero_columns)/sizeof(zero_columns[0]); ++t)
+    {
+        const size_type k = zero_columns[t];
+
+        row_major_matrix_type A(n,n);
+        detail::fill_pseudo_random(A, 12345UL);
+        ublas::column(A, k) = ublas::zero_vector<value_type>(n);
+
+        column_major_matrix_type LU_cm(A);
+        permutation_matrix_type P_cm(n);
+        size_type info_cm = ublasx::lu_decompose_inplace(LU_cm, P_cm);
+
+        row_major_matrix_type LU_rm(A);
+        permutation_matrix_type P_rm(n);
+        size_type info_rm = ublasx::lu_decompose_inplace(LU_rm, P_rm);
+
+        BOOST_UBLASX_DEBUG_TRACE( "Zero column: " << k << ", info (LAPACK) = " << info_cm << " ==> " << info_rm );
+        BOOST_UBLASX_TEST_CHECK( info_cm == k+1 );
+        BOOST_UBLASX_TEST_CHECK( info_rm == k+1 );
+        for (size_type i = 0; i < n; ++i)
+        {
+            BOOST_UBLASX_TEST_CHECK( P_cm(i) == P_rm(i) );
+        }
+    }
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Suite: LAPACK-based LU decomposition" );
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( lapack_enabled );
+    BOOST_UBLASX_TEST_DO( lapack_decompose );
+    BOOST_UBLASX_TEST_DO( lapack_solve );
+    BOOST_UBLASX_TEST_DO( lapack_singular );
+
+    BOOST_UBLASX_TEST_END();
+}
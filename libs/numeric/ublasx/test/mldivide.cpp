@@ -134,12 +134,72 @@ BOOST_UBLASX_TEST_DEF( mldivide_square_row_major )
 }
 
 
+BOOST_UBLASX_TEST_DEF( mldivide_lu_decomposition )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: mldivide - LU Decomposition" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const size_type n(4);
+
+    matrix_type A(n,n);
+
+    A(0,0) = 0.555950; A(0,1) = 0.274690; A(0,2) = 0.540605; A(0,3) = 0.798938;
+    A(1,0) = 0.108929; A(1,1) = 0.830123; A(1,2) = 0.891726; A(1,3) = 0.895283;
+    A(2,0) = 0.948014; A(2,1) = 0.973234; A(2,2) = 0.216504; A(2,3) = 0.883152;
+    A(3,0) = 0.023787; A(3,1) = 0.675382; A(3,2) = 0.231751; A(3,3) = 0.450332;
+
+    vector_type b(n);
+
+    b(0) = 2.0;
+    b(1) = 3.0;
+    b(2) = 1.0;
+    b(3) = 0.5;
+
+    vector_type expect(n);
+
+    expect(0) =  1.339863;
+    expect(1) =  0.198970;
+    expect(2) =  4.699314;
+    expect(3) = -1.677257;
+
+    ublasx::lu_decomposition<value_type> lu(A);
+
+    // The same factorization is used for all the systems
+    vector_type x(n);
+    size_type res;
+
+    res = ublasx::mldivide(lu, b, x);
+    BOOST_UBLASX_DEBUG_TRACE( "Ax = b ==> x = " << x );
+    BOOST_UBLASX_TEST_CHECK( res == 0 );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( x, expect, n, TOL );
+
+    vector_type y(b);
+    res = ublasx::mldivide_inplace(lu, y);
+    BOOST_UBLASX_DEBUG_TRACE( "Ay = b ==> y = " << y );
+    BOOST_UBLASX_TEST_CHECK( res == 0 );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( y, expect, n, TOL );
+
+    matrix_type B(n,1);
+    ublas::column(B, 0) = b;
+    matrix_type X(n,1);
+    res = ublasx::mldivide(lu, B, X);
+    BOOST_UBLASX_DEBUG_TRACE( "AX = B ==> X = " << X );
+    BOOST_UBLASX_TEST_CHECK( res == 0 );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( ublas::column(X, 0), expect, n, TOL );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
 
     BOOST_UBLASX_TEST_DO( mldivide_square_column_major );
     BOOST_UBLASX_TEST_DO( mldivide_square_row_major );
+    BOOST_UBLASX_TEST_DO( mldivide_lu_decomposition );
 
     BOOST_UBLASX_TEST_END();
 }
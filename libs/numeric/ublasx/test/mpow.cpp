@@ -17,6 +17,7 @@
  */
 
 #include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/lu.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublasx/operation/mpow.hpp>
@@ -167,6 +168,278 @@ BOOST_UBLASX_TEST_DEF( test_complex_matrix_positive_exponent )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_matrix_large_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix - Large Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 3;
+
+    // Stochastic matrix of a Markov chain
+    matrix_type A(n,n);
+
+    A(0,0) = 0.50; A(0,1) = 0.25; A(0,2) = 0.25;
+    A(1,0) = 0.20; A(1,1) = 0.60; A(1,2) = 0.20;
+    A(2,0) = 0.10; A(2,1) = 0.30; A(2,2) = 0.60;
+
+    for (int exp = 1; exp <= 21; ++exp)
+    {
+        matrix_type R;
+        matrix_type expect_R;
+
+        R = ublasx::mpow(A, exp);
+
+        BOOST_UBLASX_DEBUG_TRACE( "mpow(A, " << exp << ") = " << R );
+
+        expect_R = A;
+        for (int i = 0; i < (exp-1); ++i)
+        {
+            expect_R = ublas::prod(expect_R, A);
+        }
+
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+    }
+
+    // After many steps, each row converges to the stationary distribution
+    matrix_type R;
+    matrix_type expect_R(n,n);
+
+    R = ublasx::mpow(A, 1000000);
+
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, 1000000) = " << R );
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        expect_R(i,0) = 4.0/17.0; expect_R(i,1) = 7.0/17.0; expect_R(i,2) = 6.0/17.0;
+    }
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_large_negative_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix - Large Negative Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 2;
+    const int exp = -6;
+
+    matrix_type A(n,n);
+
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 4; A(1,1) = 5;
+
+    matrix_type R;
+    matrix_type expect_R;
+
+    R = ublasx::mpow(A, exp);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, " << exp << ") = " << R );
+
+    matrix_type invA(n,n);
+    invA(0,0) = -5.0/3.0; invA(0,1) =  2.0/3.0;
+    invA(1,0) =  4.0/3.0; invA(1,1) = -1.0/3.0;
+
+    expect_R = invA;
+    for (int i = 0; i < (-exp-1); ++i)
+    {
+        expect_R = ublas::prod(expect_R, invA);
+    }
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_3x3_negative_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix 3x3 - Negative Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 3;
+    const int exp = -5;
+
+    matrix_type A(n,n);
+
+    A(0,0) =  4; A(0,1) = -1; A(0,2) =  0.5;
+    A(1,0) =  1; A(1,1) =  3; A(1,2) = -1;
+    A(2,0) = -2; A(2,1) =  1; A(2,2) =  5;
+
+    matrix_type R;
+
+    R = ublasx::mpow(A, exp);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, " << exp << ") = " << R );
+
+    // Reference: the inverse of A (by uBLAS) raised to the power of -exp
+    matrix_type LU(A);
+    ublas::permutation_matrix<size_type> P(n);
+    ublas::lu_factorize(LU, P);
+    matrix_type invA = ublas::identity_matrix<value_type>(n);
+    ublas::lu_substitute(LU, P, invA);
+
+    matrix_type expect_R = invA;
+    for (int i = 0; i < (-exp-1); ++i)
+    {
+        expect_R = ublas::prod(expect_R, invA);
+    }
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_singular_negative_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix - Singular - Negative Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 2;
+
+    matrix_type A(n,n);
+
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 2; A(1,1) = 4;
+
+    matrix_type R;
+
+    R = ublasx::mpow(A, -2);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, -2) = " << R );
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        for (size_type j = 0; j < n; ++j)
+        {
+            BOOST_UBLASX_TEST_CHECK( std::isinf(R(i,j)) );
+        }
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_fractional_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix - Fractional Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 2;
+
+    matrix_type A(n,n);
+
+    A(0,0) = 2; A(0,1) = 1;
+    A(1,0) = 1; A(1,1) = 2;
+
+    matrix_type R;
+    matrix_type expect_R(n,n);
+
+    R = ublasx::mpow(A, 0.5);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, 0.5) = " << R );
+
+    // Eigenvalues of A are 1 and 3
+    expect_R(0,0) = (std::sqrt(3.0)+1)/2; expect_R(0,1) = (std::sqrt(3.0)-1)/2;
+    expect_R(1,0) = (std::sqrt(3.0)-1)/2; expect_R(1,1) = (std::sqrt(3.0)+1)/2;
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+
+    R = ublasx::mpow(A, -1.5);
+
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, -1.5) = " << R );
+
+    // A^p = [1+3^p 3^p-1; 3^p-1 1+3^p]/2
+    const double a = std::pow(3.0, -1.5);
+    expect_R(0,0) = (1+a)/2; expect_R(0,1) = (a-1)/2;
+    expect_R(1,0) = (a-1)/2; expect_R(1,1) = (1+a)/2;
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_matrix_fractional_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Complex Matrix - Fractional Exponent" );
+
+    typedef std::complex<double> value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 2;
+
+    // A has a negative real eigenvalue, hence its square root is complex
+    matrix_type A(n,n);
+
+    A(0,0) = value_type(1,0); A(0,1) = value_type(2,0);
+    A(1,0) = value_type(3,0); A(1,1) = value_type(1,0);
+
+    matrix_type R;
+    matrix_type expect_R;
+
+    R = ublasx::mpow(A, 0.5);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, 0.5) = " << R );
+
+    // A^0.5*A^0.5 = A
+    expect_R = A;
+
+    R = ublas::prod(R, R);
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, n, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_defective_fractional_exponent )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real Matrix - Defective - Fractional Exponent" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const size_type n = 2;
+
+    // A Jordan block is not diagonalizable (its computed eigenvectors are
+    // nearly parallel but not exactly so)
+    matrix_type A(n,n);
+
+    A(0,0) = 1; A(0,1) = 1;
+    A(1,0) = 0; A(1,1) = 1;
+
+    matrix_type R;
+
+    R = ublasx::mpow(A, 0.5);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "mpow(A, 0.5) = " << R );
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        for (size_type j = 0; j < n; ++j)
+        {
+            BOOST_UBLASX_TEST_CHECK( std::isnan(R(i,j)) );
+        }
+    }
+}
+
+
 int main()
 {
 
@@ -178,6 +451,13 @@ int main()
     BOOST_UBLASX_TEST_DO( test_real_matrix_negative_exponent );
     BOOST_UBLASX_TEST_DO( test_real_matrix_zero_exponent );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_positive_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_large_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_large_negative_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_3x3_negative_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_singular_negative_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_fractional_exponent );
+    BOOST_UBLASX_TEST_DO( test_complex_matrix_fractional_exponent );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_defective_fractional_exponent );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -0,0 +1,180 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/null.cpp
+ *
+ * \brief Test suite for the \c null operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublasx/operation/null.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+BOOST_UBLASX_TEST_DEF( real_square_rank_deficient_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Square Rank Deficient Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t n = 3;
+
+    matrix_type A(n,n);
+    A(0,0) = 3; A(0,1) = 1; A(0,2) = 2;
+    A(1,0) = 2; A(1,1) = 0; A(1,2) = 5;
+    A(2,0) = 5; A(2,1) = 1; A(2,2) = 7;
+
+    const ublasx::rank_method methods[] = {ublasx::svd_rank_method, ublasx::qrcp_rank_method};
+
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        matrix_type Z = ublasx::null(A, methods[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("method = " << methods[k] << " => null(A) = " << Z);
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Z) == 1 );
+        // A*Z is negligible and Z has orthonormal columns
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(A, Z)) <= tol );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(Z), Z) - ublas::identity_matrix<value_type>(1)) <= tol );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_recth_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Horizontal Rectangular Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t m = 2;
+    const std::size_t n = 4;
+
+    matrix_type A(m,n);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 3; A(0,3) = 4;
+    A(1,0) = 2; A(1,1) = 4; A(1,2) = 6; A(1,3) = 8;
+
+    const ublasx::rank_method methods[] = {ublasx::svd_rank_method, ublasx::qrcp_rank_method};
+
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        matrix_type Z = ublasx::null(A, methods[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("method = " << methods[k] << " => null(A) = " << Z);
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Z) == 3 );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(A, Z)) <= tol );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(Z), Z) - ublas::identity_matrix<value_type>(3)) <= tol );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_full_rank_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Full Rank Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t m = 4;
+    const std::size_t n = 3;
+
+    matrix_type A(m,n);
+    A(0,0) =  2; A(0,1) = -1; A(0,2) =  0;
+    A(1,0) = -1; A(1,1) =  3; A(1,2) = -1;
+    A(2,0) =  0; A(2,1) = -1; A(2,2) =  2;
+    A(3,0) =  1; A(3,1) =  2; A(3,2) = -1;
+
+    matrix_type Z;
+
+    // The null space is trivial
+    Z = ublasx::null(A);
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("null(A) = " << Z);
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Z) == 0 );
+
+    Z = ublasx::null(A, ublasx::qrcp_rank_method);
+    BOOST_UBLASX_DEBUG_TRACE("null(A, qrcp) = " << Z);
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Z) == 0 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_rank_deficient_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Rank Deficient Matrix");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    // The third column is the first column plus i times the second one
+    matrix_type A(n,n);
+    A(0,0) = value_type(1,1); A(0,1) = value_type(2,0);
+    A(1,0) = value_type(0,2); A(1,1) = value_type(1,1);
+    A(2,0) = value_type(3,0); A(2,1) = value_type(0,-1);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        A(i,2) = A(i,0)+value_type(0,1)*A(i,1);
+    }
+
+    const ublasx::rank_method methods[] = {ublasx::svd_rank_method, ublasx::qrcp_rank_method};
+
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        matrix_type Z = ublasx::null(A, methods[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("method = " << methods[k] << " => null(A) = " << Z);
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Z) == 1 );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(A, Z)) <= tol );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::herm(Z), Z) - ublas::identity_matrix<value_type>(1)) <= tol );
+    }
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'null' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( real_square_rank_deficient_matrix );
+    BOOST_UBLASX_TEST_DO( real_recth_matrix );
+    BOOST_UBLASX_TEST_DO( real_full_rank_matrix );
+    BOOST_UBLASX_TEST_DO( complex_rank_deficient_matrix );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -0,0 +1,148 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/orth.cpp
+ *
+ * \brief Test suite for the \c orth operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/orth.hpp>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+BOOST_UBLASX_TEST_DEF( real_rank_deficient_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Rank Deficient Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    const std::size_t m = 4;
+    const std::size_t n = 3;
+
+    matrix_type A(m,n);
+    A(0,0) =  1; A(0,1) =  2; A(0,2) =  3;
+    A(1,0) =  4; A(1,1) =  5; A(1,2) =  6;
+    A(2,0) =  7; A(2,1) =  8; A(2,2) =  9;
+    A(3,0) = 10; A(3,1) = 11; A(3,2) = 12;
+
+    const ublasx::rank_method methods[] = {ublasx::svd_rank_method, ublasx::qrcp_rank_method};
+
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        matrix_type B = ublasx::orth(A, methods[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("method = " << methods[k] << " => orth(A) = " << B);
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(B) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(B) == 2 );
+        // Orthonormal columns
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(B), B) - ublas::identity_matrix<value_type>(2)) <= tol );
+        // The columns span the range of A
+        matrix_type BBtA = ublas::prod(B, matrix_type(ublas::prod(ublas::trans(B), A)));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( BBtA, A, m, n, tol );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_full_rank_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Full Rank Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    matrix_type A(n,n);
+    A(0,0) = 3; A(0,1) = 1; A(0,2) = 2;
+    A(1,0) = 2; A(1,1) = 0; A(1,2) = 5;
+    A(2,0) = 1; A(2,1) = 2; A(2,2) = 3;
+
+    matrix_type B;
+
+    B = ublasx::orth(A);
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("orth(A) = " << B);
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(B) == n );
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(B), B) - ublas::identity_matrix<value_type>(n)) <= tol );
+
+    B = ublasx::orth(A, ublasx::qrcp_rank_method);
+    BOOST_UBLASX_DEBUG_TRACE("orth(A, qrcp) = " << B);
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(B) == n );
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(B), B) - ublas::identity_matrix<value_type>(n)) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_rank_deficient_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Rank Deficient Matrix");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n = 3;
+
+    // The third row is the first row plus i times the second one
+    matrix_type A(n,n);
+    A(0,0) = value_type(1,1); A(0,1) = value_type(2,0); A(0,2) = value_type(0,-1);
+    A(1,0) = value_type(0,2); A(1,1) = value_type(1,1); A(1,2) = value_type(3, 0);
+    A(2,0) = A(0,0)+value_type(0,1)*A(1,0);
+    A(2,1) = A(0,1)+value_type(0,1)*A(1,1);
+    A(2,2) = A(0,2)+value_type(0,1)*A(1,2);
+
+    const ublasx::rank_method methods[] = {ublasx::svd_rank_method, ublasx::qrcp_rank_method};
+
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        matrix_type B = ublasx::orth(A, methods[k]);
+
+        BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+        BOOST_UBLASX_DEBUG_TRACE("method = " << methods[k] << " => orth(A) = " << B);
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(B) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(B) == 2 );
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::herm(B), B) - ublas::identity_matrix<value_type>(2)) <= tol );
+        matrix_type BBhA = ublas::prod(B, matrix_type(ublas::prod(ublas::herm(B), A)));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( BBhA, A, n, n, tol );
+    }
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'orth' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( real_rank_deficient_matrix );
+    BOOST_UBLASX_TEST_DO( real_full_rank_matrix );
+    BOOST_UBLASX_TEST_DO( complex_rank_deficient_matrix );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -19,6 +19,7 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
 #include <boost/numeric/ublasx/operation/pow.hpp>
 #include <cmath>
 #include <complex>
@@ -334,6 +335,86 @@ BOOST_UBLASX_TEST_DEF( test_complex_matrix_2 )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_vector_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real - Vector - Execution Policy" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const size_type n(4);
+
+    vector_type v(n);
+
+    v(0) = 1;
+    v(1) = 2;
+    v(2) = 3;
+    v(3) = 4;
+
+    vector_type res;
+    vector_type expect_res1(n);
+    vector_type expect_res2(n);
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        expect_res1(i) = std::pow(v(i), 2.5);
+        expect_res2(i) = std::pow(2.5, v(i));
+    }
+
+    res = ublasx::pow(ublasx::execution::seq, v, 2.5);
+    BOOST_UBLASX_DEBUG_TRACE( "pow(seq,v,2.5) = " << res );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect_res1, n, tol );
+
+    res = ublasx::pow(ublasx::execution::par, v, 2.5);
+    BOOST_UBLASX_DEBUG_TRACE( "pow(par,v,2.5) = " << res );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect_res1, n, tol );
+
+    res = ublasx::pow(ublasx::execution::par_unseq, 2.5, v);
+    BOOST_UBLASX_DEBUG_TRACE( "pow(par_unseq,2.5,v) = " << res );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect_res2, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_matrix_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Real - Matrix - Execution Policy" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const size_type nr(3);
+    const size_type nc(2);
+
+    matrix_type A(nr,nc);
+
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 4;
+    A(2,0) = 5; A(2,1) = 6;
+
+    matrix_type R;
+    matrix_type expect_R1(nr,nc);
+    matrix_type expect_R2(nr,nc);
+
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            expect_R1(r,c) = std::pow(A(r,c), 2.5);
+            expect_R2(r,c) = std::pow(2.5, A(r,c));
+        }
+    }
+
+    R = ublasx::pow(ublasx::execution::par, A, 2.5);
+    BOOST_UBLASX_DEBUG_TRACE( "pow(par,A,2.5) = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R1, nr, nc, tol );
+
+    R = ublasx::pow(ublasx::execution::seq, 2.5, A);
+    BOOST_UBLASX_DEBUG_TRACE( "pow(seq,2.5,A) = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R2, nr, nc, tol );
+}
+
 int main()
 {
 
@@ -349,6 +430,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_real_matrix_2 );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_1 );
     BOOST_UBLASX_TEST_DO( test_complex_matrix_2 );
+    BOOST_UBLASX_TEST_DO( test_real_vector_policy );
+    BOOST_UBLASX_TEST_DO( test_real_matrix_policy );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -1049,6 +1049,127 @@ BOOST_UBLASX_TEST_DEF( test_real_matrix_prod_right_trans_column_major )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_rectv_matrix_row_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Rectangular Vertical Matrix - Row Major - Reused Workspace");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    const std::size_t m(6);
+    const std::size_t n(4);
+
+    matrix_type A(m,n);
+
+    A(0,0) = -0.57; A(0,1) = -1.28; A(0,2) = -0.39; A(0,3) =  0.25;
+    A(1,0) = -1.93; A(1,1) =  1.08; A(1,2) = -0.31; A(1,3) = -2.14;
+    A(2,0) =  2.30; A(2,1) =  0.24; A(2,2) =  0.40; A(2,3) = -0.35;
+    A(3,0) = -1.93; A(3,1) =  0.64; A(3,2) = -0.66; A(3,3) =  0.08;
+    A(4,0) =  0.15; A(4,1) =  0.30; A(4,2) =  0.15; A(4,3) = -2.13;
+    A(5,0) = -0.02; A(5,1) =  1.03; A(5,2) = -1.43; A(5,3) =  0.50;
+
+    ublasx::ql_workspace<value_type> ws;
+    matrix_type Q;
+    matrix_type L;
+
+    // Full mode, repeated with the same workspace
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        ublasx::ql_decompose(B, Q, L, true, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "L = " << L );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(L) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(L) == n );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, L), B, m, n, tol );
+    }
+
+    // Economy mode
+    matrix_type Qe;
+    matrix_type Le;
+    ublasx::ql_decompose(A, Qe, Le, false, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "Q (econ) = " << Qe );
+    BOOST_UBLASX_DEBUG_TRACE( "L (econ) = " << Le );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Qe) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Qe) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Le) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Le) == n );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Qe, Le), A, m, n, tol );
+
+    // Different size with the same workspace
+    matrix_type At(ublas::trans(A));
+    matrix_type Qt;
+    matrix_type Lt;
+    ublasx::ql_decompose(At, Qt, Lt, true, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A' = " << At );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Qt );
+    BOOST_UBLASX_DEBUG_TRACE( "L = " << Lt );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Qt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Qt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Lt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Lt) == m );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Qt, Lt), At, n, m, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_square_matrix_column_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Square Matrix - Column Major - Reused Workspace");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(3);
+
+    matrix_type A(n,n);
+
+    A(0,0) = value_type( 12, 1); A(0,1) = value_type(- 51, 0); A(0,2) = value_type(  4, 3);
+    A(1,0) = value_type(  6, 0); A(1,1) = value_type( 167,-2); A(1,2) = value_type(-68, 0);
+    A(2,0) = value_type(- 4,-5); A(2,1) = value_type(  24, 0); A(2,2) = value_type(-41, 7);
+
+    ublasx::ql_workspace<value_type> ws(n, n);
+    matrix_type Q;
+    matrix_type L;
+
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        ublasx::ql_decompose(B, Q, L, true, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "L = " << L );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(L) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(L) == n );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, L), B, n, n, tol );
+    }
+
+    ublasx::ql_decomposition<value_type> ql;
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        ql.decompose(B);
+
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(ql.Q(), ql.L()), B, n, n, tol );
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: QL factorization");
@@ -1083,6 +1204,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_left_trans_column_major );
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_right_notrans_column_major );
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_right_trans_column_major );
+    BOOST_UBLASX_TEST_DO( test_real_rectv_matrix_row_major_workspace );
+    BOOST_UBLASX_TEST_DO( test_complex_square_matrix_column_major_workspace );
 
     BOOST_UBLASX_TEST_END();
 }
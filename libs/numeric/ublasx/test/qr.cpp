@@ -1070,6 +1070,127 @@ BOOST_UBLASX_TEST_DEF( test_real_matrix_prod_right_trans_column_major )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_rectv_matrix_row_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Rectangular Vertical Matrix - Row Major - Reused Workspace");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    const std::size_t m(6);
+    const std::size_t n(4);
+
+    matrix_type A(m,n);
+
+    A(0,0) = -0.57; A(0,1) = -1.28; A(0,2) = -0.39; A(0,3) =  0.25;
+    A(1,0) = -1.93; A(1,1) =  1.08; A(1,2) = -0.31; A(1,3) = -2.14;
+    A(2,0) =  2.30; A(2,1) =  0.24; A(2,2) =  0.40; A(2,3) = -0.35;
+    A(3,0) = -1.93; A(3,1) =  0.64; A(3,2) = -0.66; A(3,3) =  0.08;
+    A(4,0) =  0.15; A(4,1) =  0.30; A(4,2) =  0.15; A(4,3) = -2.13;
+    A(5,0) = -0.02; A(5,1) =  1.03; A(5,2) = -1.43; A(5,3) =  0.50;
+
+    ublasx::qr_workspace<value_type> ws;
+    matrix_type Q;
+    matrix_type R;
+
+    // Full mode, repeated with the same workspace
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        ublasx::qr_decompose(B, Q, R, true, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == m );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == n );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, R), B, m, n, tol );
+    }
+
+    // Economy mode
+    matrix_type Qe;
+    matrix_type Re;
+    ublasx::qr_decompose(A, Qe, Re, false, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "Q (econ) = " << Qe );
+    BOOST_UBLASX_DEBUG_TRACE( "R (econ) = " << Re );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Qe) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Qe) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Re) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Re) == n );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Qe, Re), A, m, n, tol );
+
+    // Different size with the same workspace
+    matrix_type At(ublas::trans(A));
+    matrix_type Qt;
+    matrix_type Rt;
+    ublasx::qr_decompose(At, Qt, Rt, true, ws);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A' = " << At );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Qt );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << Rt );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Qt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Qt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Rt) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Rt) == m );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Qt, Rt), At, n, m, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_square_matrix_column_major_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Square Matrix - Column Major - Reused Workspace");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(3);
+
+    matrix_type A(n,n);
+
+    A(0,0) = value_type( 12, 1); A(0,1) = value_type(- 51, 0); A(0,2) = value_type(  4, 3);
+    A(1,0) = value_type(  6, 0); A(1,1) = value_type( 167,-2); A(1,2) = value_type(-68, 0);
+    A(2,0) = value_type(- 4,-5); A(2,1) = value_type(  24, 0); A(2,2) = value_type(-41, 7);
+
+    ublasx::qr_workspace<value_type> ws(n, n);
+    matrix_type Q;
+    matrix_type R;
+
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        ublasx::qr_decompose(B, Q, R, true, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == n );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, R), B, n, n, tol );
+    }
+
+    ublasx::qr_decomposition<value_type> qr;
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type B(A*value_type(k));
+
+        qr.decompose(B);
+
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(qr.Q(), qr.R()), B, n, n, tol );
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: QR factorization");
@@ -1104,6 +1225,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_left_trans_column_major );
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_right_notrans_column_major );
     BOOST_UBLASX_TEST_DO( test_real_matrix_prod_right_trans_column_major );
+    BOOST_UBLASX_TEST_DO( test_real_rectv_matrix_row_major_workspace );
+    BOOST_UBLASX_TEST_DO( test_complex_square_matrix_column_major_workspace );
 
     BOOST_UBLASX_TEST_END();
 }
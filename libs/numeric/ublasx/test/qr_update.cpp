@@ -0,0 +1,640 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/qr_update.cpp
+ *
+ * \brief Test suite for the update of the QR factorization.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qr_update.hpp>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-10;
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+namespace /*<unnamed>*/ {
+
+/// Return the relative residual ||A-QR||_F/||A||_F.
+template <typename AMatrixT, typename QMatrixT, typename RMatrixT>
+double qr_residual(AMatrixT const& A, QMatrixT const& Q, RMatrixT const& R)
+{
+    return ublas::norm_frobenius(A-ublas::prod(Q, R))/ublas::norm_frobenius(A);
+}
+
+
+/// Return ||Q^H Q - I||_F.
+template <typename QMatrixT>
+double orthogonality_error(QMatrixT const& Q)
+{
+    typedef typename ublas::matrix_traits<QMatrixT>::value_type value_type;
+
+    const std::size_t k = ublasx::num_columns(Q);
+
+    return ublas::norm_frobenius(ublas::prod(ublas::herm(Q), Q)-ublas::identity_matrix<value_type>(k));
+}
+
+
+/// Return the Frobenius norm of the strictly lower triangular part of R.
+template <typename RMatrixT>
+double lower_norm(RMatrixT const& R)
+{
+    double s = 0;
+    for (std::size_t i = 0; i < ublasx::num_rows(R); ++i)
+    {
+        for (std::size_t j = 0; j < i && j < ublasx::num_columns(R); ++j)
+        {
+            s += std::norm(R(i,j));
+        }
+    }
+
+    return std::sqrt(s);
+}
+
+
+/// Build the matrix of the Wikipedia example and its full QR factors.
+template <typename MatrixT>
+void make_qr(MatrixT& A, MatrixT& Q, MatrixT& R)
+{
+    A.resize(3, 3, false);
+    Q.resize(3, 3, false);
+    R.resize(3, 3, false);
+
+    A(0,0) =  12; A(0,1) = - 51; A(0,2) =   4;
+    A(1,0) =   6; A(1,1) =  167; A(1,2) = -68;
+    A(2,0) = - 4; A(2,1) =   24; A(2,2) = -41;
+
+    Q(0,0) =  6.0/7.0; Q(0,1) = - 69.0/175.0; Q(0,2) = -58.0/175.0;
+    Q(1,0) =  3.0/7.0; Q(1,1) =  158.0/175.0; Q(1,2) =   6.0/175.0;
+    Q(2,0) = -2.0/7.0; Q(2,1) =    6.0/ 35.0; Q(2,2) = -33.0/ 35.0;
+
+    R(0,0) = 14; R(0,1) =  21; R(0,2) = -14;
+    R(1,0) =  0; R(1,1) = 175; R(1,2) = -70;
+    R(2,0) =  0; R(2,1) =   0; R(2,2) =  35;
+}
+
+
+/// Append rows to the matrix of the Wikipedia example and to its factors.
+template <typename MatrixT>
+void make_tall_qr(MatrixT& A, MatrixT& Q, MatrixT& R)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::value_type value_type;
+
+    make_qr(A, Q, R);
+
+    const std::size_t m = 6;
+    const std::size_t n = 3;
+
+    A.resize(m, n, true);
+    A(3,0) =  1; A(3,1) = -2; A(3,2) =  5;
+    A(4,0) =  7; A(4,1) =  3; A(4,2) = -1;
+    A(5,0) = -3; A(5,1) =  8; A(5,2) =  2;
+
+    for (std::size_t i = 3; i < m; ++i)
+    {
+        ublas::vector<value_type> x(ublas::row(A, i));
+        ublasx::qr_insert_row(Q, R, i, x);
+    }
+}
+
+} // Namespace <unnamed>
+
+
+BOOST_UBLASX_TEST_DEF( real_rank1_update_full )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Rank-1 Update - Full Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+
+    vector_type u(6);
+    u(0) = 1; u(1) = -2; u(2) = 3; u(3) = 0.5; u(4) = -1; u(5) = 4;
+    vector_type v(3);
+    v(0) = 2; v(1) = 1; v(2) = -3;
+
+    ublasx::qr_update(Q, R, u, v);
+    A += ublas::outer_prod(u, v);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A+uv' = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 6 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(A, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_rank1_update_economy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Rank-1 Update - Economy Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    vector_type u(6);
+    u(0) = 1; u(1) = -2; u(2) = 3; u(3) = 0.5; u(4) = -1; u(5) = 4;
+    vector_type v(3);
+    v(0) = 2; v(1) = 1; v(2) = -3;
+
+    ublasx::qr_update(Q, R, u, v);
+    A += ublas::outer_prod(u, v);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A+uv' = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 3 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 3 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(A, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_insert_row )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Insert Row");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_qr(A, Q, R);
+
+    vector_type x(3);
+    x(0) = -1; x(1) = 9; x(2) = 2;
+
+    ublasx::qr_insert_row(Q, R, 1, x);
+
+    matrix_type B(4, 3);
+    ublas::row(B, 0) = ublas::row(A, 0);
+    ublas::row(B, 1) = x;
+    ublas::subrange(B, 2, 4, 0, 3) = ublas::subrange(A, 1, 3, 0, 3);
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == 4 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 4 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 4 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_delete_row_full )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Delete Row - Full Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+
+    ublasx::qr_delete_row(Q, R, 2);
+
+    matrix_type B(5, 3);
+    ublas::subrange(B, 0, 2, 0, 3) = ublas::subrange(A, 0, 2, 0, 3);
+    ublas::subrange(B, 2, 5, 0, 3) = ublas::subrange(A, 3, 6, 0, 3);
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == 5 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 5 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 5 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_delete_row_economy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Delete Row - Economy Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    ublasx::qr_delete_row(Q, R, 0);
+
+    matrix_type B(ublas::subrange(A, 1, 6, 0, 3));
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == 5 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 3 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 3 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_insert_column_full )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Insert Column - Full Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+
+    vector_type x(6);
+    x(0) = 3; x(1) = -1; x(2) = 2; x(3) = 7; x(4) = 0; x(5) = -5;
+
+    ublasx::qr_insert_column(Q, R, 1, x);
+
+    matrix_type B(6, 4);
+    ublas::column(B, 0) = ublas::column(A, 0);
+    ublas::column(B, 1) = x;
+    ublas::subrange(B, 0, 6, 2, 4) = ublas::subrange(A, 0, 6, 1, 3);
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == 4 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_insert_column_economy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Insert Column - Economy Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    vector_type x(6);
+    x(0) = 3; x(1) = -1; x(2) = 2; x(3) = 7; x(4) = 0; x(5) = -5;
+
+    // Append the new column
+    ublasx::qr_insert_column(Q, R, 3, x);
+
+    matrix_type B(6, 4);
+    ublas::subrange(B, 0, 6, 0, 3) = A;
+    ublas::column(B, 3) = x;
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 4 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 4 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == 4 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_delete_column_full )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Delete Column - Full Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+
+    ublasx::qr_delete_column(Q, R, 0);
+
+    matrix_type B(ublas::subrange(A, 0, 6, 1, 3));
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 6 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == 2 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_delete_column_economy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Delete Column - Economy Factors");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    ublasx::qr_delete_column(Q, R, 1);
+
+    matrix_type B(6, 2);
+    ublas::column(B, 0) = ublas::column(A, 0);
+    ublas::column(B, 1) = ublas::column(A, 2);
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 2 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 2 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == 2 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_sliding_window )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Sliding Window");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    const std::size_t m = ublasx::num_rows(A);
+    const std::size_t n = ublasx::num_columns(A);
+
+    // Each tick appends a new observation and drops the oldest one
+    for (std::size_t t = 0; t < 20; ++t)
+    {
+        vector_type x(n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            x(j) = static_cast<value_type>((7*t+3*j) % 11) - 5;
+        }
+
+        ublasx::qr_insert_row(Q, R, m, x);
+        ublasx::qr_delete_row(Q, R, 0);
+
+        matrix_type B(m, n);
+        ublas::subrange(B, 0, m-1, 0, n) = ublas::subrange(A, 1, m, 0, n);
+        ublas::row(B, m-1) = x;
+        A = B;
+    }
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == n );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(A, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( real_row_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Row Major");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_qr(A, Q, R);
+
+    vector_type u(3);
+    u(0) = 1; u(1) = 2; u(2) = 3;
+    vector_type v(3);
+    v(0) = -1; v(1) = 0; v(2) = 2;
+
+    ublasx::qr_update(Q, R, u, v);
+    A += ublas::outer_prod(u, v);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A+uv' = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( qr_residual(A, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_rank1_update_economy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Rank-1 Update - Economy Factors");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    vector_type u(6);
+    u(0) = value_type(1,2); u(1) = value_type(-2,0); u(2) = value_type(0,3);
+    u(3) = value_type(0.5,-1); u(4) = value_type(-1,1); u(5) = value_type(4,0);
+    vector_type v(3);
+    v(0) = value_type(2,-1); v(1) = value_type(0,1); v(2) = value_type(-3,2);
+
+    ublasx::qr_update(Q, R, u, v);
+    A += ublas::outer_prod(u, ublas::conj(v));
+
+    BOOST_UBLASX_DEBUG_TRACE( "A+uv' = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 3 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(A, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_insert_delete_row )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Insert and Delete Row");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+
+    vector_type x(3);
+    x(0) = value_type(1,-1); x(1) = value_type(0,2); x(2) = value_type(-3,1);
+
+    ublasx::qr_insert_row(Q, R, 6, x);
+    ublasx::qr_delete_row(Q, R, 4);
+
+    matrix_type B(6, 3);
+    ublas::subrange(B, 0, 4, 0, 3) = ublas::subrange(A, 0, 4, 0, 3);
+    ublas::row(B, 4) = ublas::row(A, 5);
+    ublas::row(B, 5) = x;
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 6 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_insert_delete_column )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Insert and Delete Column");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    matrix_type A;
+    matrix_type Q;
+    matrix_type R;
+    make_tall_qr(A, Q, R);
+    Q.resize(6, 3, true);
+    R.resize(3, 3, true);
+
+    vector_type x(6);
+    x(0) = value_type(3,1); x(1) = value_type(-1,0); x(2) = value_type(2,-2);
+    x(3) = value_type(0,7); x(4) = value_type(1,1); x(5) = value_type(-5,0);
+
+    ublasx::qr_insert_column(Q, R, 0, x);
+    ublasx::qr_delete_column(Q, R, 2);
+
+    matrix_type B(6, 3);
+    ublas::column(B, 0) = x;
+    ublas::column(B, 1) = ublas::column(A, 0);
+    ublas::column(B, 2) = ublas::column(A, 2);
+
+    BOOST_UBLASX_DEBUG_TRACE( "B = " << B );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == 3 );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == 3 );
+    BOOST_UBLASX_TEST_CHECK( qr_residual(B, Q, R) <= tol );
+    BOOST_UBLASX_TEST_CHECK( orthogonality_error(Q) <= tol );
+    BOOST_UBLASX_TEST_CHECK( lower_norm(R) <= tol );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: QR Update");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( real_rank1_update_full );
+    BOOST_UBLASX_TEST_DO( real_rank1_update_economy );
+    BOOST_UBLASX_TEST_DO( real_insert_row );
+    BOOST_UBLASX_TEST_DO( real_delete_row_full );
+    BOOST_UBLASX_TEST_DO( real_delete_row_economy );
+    BOOST_UBLASX_TEST_DO( real_insert_column_full );
+    BOOST_UBLASX_TEST_DO( real_insert_column_economy );
+    BOOST_UBLASX_TEST_DO( real_delete_column_full );
+    BOOST_UBLASX_TEST_DO( real_delete_column_economy );
+    BOOST_UBLASX_TEST_DO( real_sliding_window );
+    BOOST_UBLASX_TEST_DO( real_row_major );
+    BOOST_UBLASX_TEST_DO( complex_rank1_update_economy );
+    BOOST_UBLASX_TEST_DO( complex_insert_delete_row );
+    BOOST_UBLASX_TEST_DO( complex_insert_delete_column );
+
+    BOOST_UBLASX_TEST_END();
+}
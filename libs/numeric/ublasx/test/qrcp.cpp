@@ -0,0 +1,205 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/qrcp.cpp
+ *
+ * \brief Test suite for the QR factorization with column pivoting.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/qrcp.hpp>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+/// Return the matrix whose j-th column is the P(j)-th column of A.
+template <typename MatrixT, typename VectorT>
+MatrixT permute_columns(MatrixT const& A, VectorT const& P)
+{
+    MatrixT AP(A.size1(), A.size2());
+
+    for (std::size_t j = 0; j < A.size2(); ++j)
+    {
+        ublas::column(AP, j) = ublas::column(A, P(j));
+    }
+
+    return AP;
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_square_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Square Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(3);
+
+    matrix_type A(n,n);
+    A(0,0) =  12; A(0,1) = - 51; A(0,2) =   4;
+    A(1,0) =   6; A(1,1) =  167; A(1,2) = -68;
+    A(2,0) = - 4; A(2,1) =   24; A(2,2) = -41;
+
+    ublasx::qrcp_decomposition<value_type> qrcp(A);
+
+    matrix_type Q = qrcp.Q();
+    matrix_type R = qrcp.R();
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+    BOOST_UBLASX_DEBUG_TRACE( "P = " << qrcp.P() );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == n );
+    // The column with the largest norm is moved to the front
+    BOOST_UBLASX_TEST_CHECK( qrcp.P()(0) == 1 );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, R), permute_columns(A, qrcp.P()), n, n, tol );
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::trans(Q), Q) - ublas::identity_matrix<value_type>(n)) <= tol );
+    BOOST_UBLASX_TEST_CHECK( std::abs(R(0,0)) >= std::abs(R(1,1)) );
+    BOOST_UBLASX_TEST_CHECK( std::abs(R(1,1)) >= std::abs(R(2,2)) );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank() == n );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_rank_deficient_rectv_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Rank Deficient Rectangular Vertical Matrix");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    const std::size_t m(4);
+    const std::size_t n(3);
+
+    matrix_type A(m,n);
+    A(0,0) =  1; A(0,1) =  2; A(0,2) =  3;
+    A(1,0) =  4; A(1,1) =  5; A(1,2) =  6;
+    A(2,0) =  7; A(2,1) =  8; A(2,2) =  9;
+    A(3,0) = 10; A(3,1) = 11; A(3,2) = 12;
+
+    ublasx::qrcp_decomposition<value_type> qrcp = ublasx::qrcp_decompose(A);
+
+    matrix_type Q = qrcp.Q(false);
+    matrix_type R = qrcp.R(false);
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+    BOOST_UBLASX_DEBUG_TRACE( "P = " << qrcp.P() );
+    BOOST_UBLASX_DEBUG_TRACE( "rank = " << qrcp.rank() );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == n );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, R), permute_columns(A, qrcp.P()), m, n, tol );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank() == 2 );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank(1.0e-5) == 2 );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank(1.0e+5) == 0 );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_recth_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex - Rectangular Horizontal Matrix");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t m(2);
+    const std::size_t n(3);
+
+    matrix_type A(m,n);
+    A(0,0) = value_type(1, 2); A(0,1) = value_type(-3, 1); A(0,2) = value_type(0, 5);
+    A(1,0) = value_type(4,-1); A(1,1) = value_type( 2, 2); A(1,2) = value_type(1,-1);
+
+    ublasx::qrcp_decomposition<value_type> qrcp(A);
+
+    matrix_type Q = qrcp.Q();
+    matrix_type R = qrcp.R();
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+    BOOST_UBLASX_DEBUG_TRACE( "P = " << qrcp.P() );
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(Q) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(R) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(R) == n );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(Q, R), permute_columns(A, qrcp.P()), m, n, tol );
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(ublas::prod(ublas::herm(Q), Q) - ublas::identity_matrix<value_type>(m)) <= tol );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank() == m );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_real_decomposition_reuse )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real - Decomposition Reuse");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t m(4);
+    const std::size_t n(3);
+
+    matrix_type A(m,n);
+    A(0,0) =  1; A(0,1) =  2; A(0,2) =  3;
+    A(1,0) =  4; A(1,1) =  5; A(1,2) =  6;
+    A(2,0) =  7; A(2,1) =  8; A(2,2) =  9;
+    A(3,0) = 10; A(3,1) = 11; A(3,2) = 12;
+
+    ublasx::qrcp_decomposition<value_type> qrcp;
+
+    qrcp.decompose(A);
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank() == 2 );
+
+    // Make the matrix full rank
+    A(0,0) = 2;
+    qrcp.decompose(A);
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "rank = " << qrcp.rank() );
+    BOOST_UBLASX_TEST_CHECK( qrcp.rank() == n );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( ublas::prod(qrcp.Q(), qrcp.R()), permute_columns(A, qrcp.P()), m, n, tol );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: QR Decomposition with Column Pivoting");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( test_real_square_matrix );
+    BOOST_UBLASX_TEST_DO( test_real_rank_deficient_rectv_matrix );
+    BOOST_UBLASX_TEST_DO( test_complex_recth_matrix );
+    BOOST_UBLASX_TEST_DO( test_real_decomposition_reuse );
+
+    BOOST_UBLASX_TEST_END();
+}
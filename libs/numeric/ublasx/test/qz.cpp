@@ -3215,6 +3215,143 @@ BOOST_UBLASX_TEST_DEF( test_complex_row_major_oo_custom_reorder )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_real_row_major_workspace_decomp )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Matrix - Row Major - Decomposition - Reused Workspace");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    const std::size_t n(5);
+
+    matrix_type A(n,n);
+    A(0,0) = -0.180557; A(0,1) =  0.322289; A(0,2) = -0.651789; A(0,3) =  0.793637; A(0,4) = -0.141086;
+    A(1,0) =  0.729781; A(1,1) =  1.665989; A(1,2) =  0.620091; A(1,3) = -1.541503; A(1,4) =  0.146673;
+    A(2,0) = -0.594370; A(2,1) =  0.494804; A(2,2) =  1.004784; A(2,3) = -0.221373; A(2,4) = -2.196082;
+    A(3,0) = -1.106269; A(3,1) =  0.026697; A(3,2) =  2.687083; A(3,3) =  0.763162; A(3,4) =  1.203514;
+    A(4,0) = -0.021184; A(4,1) = -0.882220; A(4,2) = -1.618234; A(4,3) =  1.119524; A(4,4) =  2.588165;
+
+    matrix_type B(n,n);
+    B(0,0) = -1.592710; B(0,1) =  0.057283; B(0,2) = -1.862275; B(0,3) =  0.712471; B(0,4) =  0.463207;
+    B(1,0) =  1.072859; B(1,1) = -1.384371; B(1,2) =  0.777754; B(1,3) =  1.914787; B(1,4) =  0.082774;
+    B(2,0) = -0.451744; B(2,1) = -0.131528; B(2,2) = -0.636187; B(2,3) =  0.984480; B(2,4) =  0.011728;
+    B(3,0) = -0.876629; B(3,1) = -0.083787; B(3,2) =  0.474227; B(3,3) = -0.042328; B(3,4) = -0.529845;
+    B(4,0) = -0.812610; B(4,1) =  0.142456; B(4,2) =  0.033739; B(4,3) = -2.000422; B(4,4) = -0.765401;
+
+    ublasx::qz_workspace<value_type> ws;
+    matrix_type S;
+    matrix_type T;
+    matrix_type Q;
+    matrix_type Z;
+    matrix_type X;
+
+    // Same size, with and without reordering
+    const ublasx::qz_eigenvalues_selection selections[] = { ublasx::all_qz_eigenvalues, ublasx::all_qz_eigenvalues, ublasx::lhp_qz_eigenvalues };
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        matrix_type Ak(A*value_type(k+1));
+
+        ublasx::qz_decompose(Ak, B, S, T, Q, Z, selections[k], ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "A = " << Ak );
+        BOOST_UBLASX_DEBUG_TRACE( "S = " << S );
+        BOOST_UBLASX_DEBUG_TRACE( "T = " << T );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "Z = " << Z );
+
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(S) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_columns(S) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == n );
+        BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == n );
+        X = ublas::prod(Q, S);
+        X = ublas::prod(X, ublas::trans(Z));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, Ak, n, n, tol*(k+1) );
+        X = ublas::prod(Q, T);
+        X = ublas::prod(X, ublas::trans(Z));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, B, n, n, tol );
+    }
+
+    // Different size with the same workspace
+    const std::size_t m(3);
+    matrix_type Am(ublas::subrange(A, 0, m, 0, m));
+    matrix_type Bm(ublas::subrange(B, 0, m, 0, m));
+
+    ublasx::qz_decompose_inplace(Am, Bm, Q, Z, ublasx::all_qz_eigenvalues, ws);
+
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Q) == m );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(Z) == m );
+    X = ublas::prod(Q, Am);
+    X = ublas::prod(X, ublas::trans(Z));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, ublas::subrange(A, 0, m, 0, m), m, m, tol );
+    X = ublas::prod(Q, Bm);
+    X = ublas::prod(X, ublas::trans(Z));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, ublas::subrange(B, 0, m, 0, m), m, m, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_complex_column_major_workspace_decomp )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Matrix - Column Major - Decomposition - Reused Workspace");
+
+    typedef std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t n(3);
+
+    matrix_type A(n,n);
+    A(0,0) = value_type( 1.0,-0.5); A(0,1) = value_type( 2.0, 1.0); A(0,2) = value_type(-1.0, 0.3);
+    A(1,0) = value_type( 0.4, 2.0); A(1,1) = value_type(-3.0, 0.0); A(1,2) = value_type( 0.5,-1.5);
+    A(2,0) = value_type(-2.2, 0.1); A(2,1) = value_type( 0.7, 0.7); A(2,2) = value_type( 1.8, 2.4);
+
+    matrix_type B(n,n);
+    B(0,0) = value_type( 2.0, 0.0); B(0,1) = value_type(-0.3, 0.4); B(0,2) = value_type( 1.1,-0.2);
+    B(1,0) = value_type( 0.6,-1.0); B(1,1) = value_type( 1.5, 0.5); B(1,2) = value_type( 0.0, 0.9);
+    B(2,0) = value_type(-0.8, 0.2); B(2,1) = value_type( 0.3,-1.2); B(2,2) = value_type(-2.5, 0.1);
+
+    ublasx::qz_workspace<value_type> ws(n);
+    matrix_type S;
+    matrix_type T;
+    matrix_type Q;
+    matrix_type Z;
+    matrix_type X;
+
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type Bk(B*value_type(k));
+
+        ublasx::qz_decompose(A, Bk, S, T, Q, Z, ublasx::all_qz_eigenvalues, ws);
+
+        BOOST_UBLASX_DEBUG_TRACE( "B = " << Bk );
+        BOOST_UBLASX_DEBUG_TRACE( "S = " << S );
+        BOOST_UBLASX_DEBUG_TRACE( "T = " << T );
+        BOOST_UBLASX_DEBUG_TRACE( "Q = " << Q );
+        BOOST_UBLASX_DEBUG_TRACE( "Z = " << Z );
+
+        X = ublas::prod(Q, S);
+        X = ublas::prod(X, ublas::herm(Z));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, A, n, n, tol );
+        X = ublas::prod(Q, T);
+        X = ublas::prod(X, ublas::herm(Z));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, Bk, n, n, tol*k );
+    }
+
+    ublasx::qz_decomposition<value_type> qz;
+    for (std::size_t k = 1; k <= 2; ++k)
+    {
+        matrix_type Bk(B*value_type(k));
+
+        qz.decompose(A, Bk);
+
+        X = ublas::prod(qz.Q(), qz.S());
+        X = ublas::prod(X, ublas::herm(qz.Z()));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, A, n, n, tol );
+        X = ublas::prod(qz.Q(), qz.T());
+        X = ublas::prod(X, ublas::herm(qz.Z()));
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, Bk, n, n, tol*k );
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: QZ factorization");
@@ -3269,6 +3406,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_complex_row_major_oo_udo_reorder );
     BOOST_UBLASX_TEST_DO( test_complex_column_major_oo_custom_reorder );
     BOOST_UBLASX_TEST_DO( test_complex_row_major_oo_custom_reorder );
+    BOOST_UBLASX_TEST_DO( test_real_row_major_workspace_decomp );
+    BOOST_UBLASX_TEST_DO( test_complex_column_major_workspace_decomp );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -77,12 +77,100 @@ BOOST_UBLASX_TEST_DEF( full_rank )
 }
 
 
+BOOST_UBLASX_TEST_DEF( rank_deficient_gesdd )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Rank Deficient matrix - Divide-and-Conquer SVD Driver");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const std::size_t m = 3;
+    const std::size_t n = 3;
+
+    matrix_type A(m,n);
+    A(0,0) = 3; A(0,1) = 1; A(0,2) = 2;
+    A(1,0) = 2; A(1,1) = 0; A(1,2) = 5;
+    A(2,0) = 5; A(2,1) = 1; A(2,2) = 7;
+
+    size_type r = ublasx::rank(A, ublasx::gesdd_svd_algorithm);
+    size_type expect_r = n-1;
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("rank = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+
+    r = ublasx::rank(A, 1.0e-5, ublasx::gesdd_svd_algorithm);
+    BOOST_UBLASX_DEBUG_TRACE("rank (tol = 1e-5) = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+}
+
+
+BOOST_UBLASX_TEST_DEF( rank_deficient_qrcp )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Rank Deficient matrix - QR Decomposition with Column Pivoting");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const std::size_t m = 3;
+    const std::size_t n = 3;
+
+    matrix_type A(m,n);
+    A(0,0) = 3; A(0,1) = 1; A(0,2) = 2;
+    A(1,0) = 2; A(1,1) = 0; A(1,2) = 5;
+    A(2,0) = 5; A(2,1) = 1; A(2,2) = 7;
+
+    size_type r = ublasx::rank(A, ublasx::qrcp_rank_method);
+    size_type expect_r = n-1;
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("rank = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+
+    r = ublasx::rank(A, 1.0e-5, ublasx::qrcp_rank_method);
+    BOOST_UBLASX_DEBUG_TRACE("rank (tol = 1e-5) = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+
+    r = ublasx::rank(A, 1.0e-5, ublasx::svd_rank_method);
+    BOOST_UBLASX_DEBUG_TRACE("rank (tol = 1e-5, SVD) = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+}
+
+
+BOOST_UBLASX_TEST_DEF( full_rank_rectangular_qrcp )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Full Rank Rectangular matrix - QR Decomposition with Column Pivoting");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const std::size_t m = 3;
+    const std::size_t n = 4;
+
+    matrix_type A(m,n);
+    A(0,0) = 3; A(0,1) = 1; A(0,2) = 2; A(0,3) = 0;
+    A(1,0) = 2; A(1,1) = 0; A(1,2) = 5; A(1,3) = 1;
+    A(2,0) = 1; A(2,1) = 2; A(2,2) = 3; A(2,3) = 4;
+
+    size_type r = ublasx::rank(A, ublasx::qrcp_rank_method);
+    size_type expect_r = m;
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("rank = " << r);
+    BOOST_UBLASX_TEST_CHECK( r == expect_r );
+    BOOST_UBLASX_TEST_CHECK( r == ublasx::rank(A, ublasx::svd_rank_method) );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
 
     BOOST_UBLASX_TEST_DO( rank_deficient );
     BOOST_UBLASX_TEST_DO( full_rank );
+    BOOST_UBLASX_TEST_DO( rank_deficient_gesdd );
+    BOOST_UBLASX_TEST_DO( rank_deficient_qrcp );
+    BOOST_UBLASX_TEST_DO( full_rank_rectangular_qrcp );
 
     BOOST_UBLASX_TEST_END();
 }
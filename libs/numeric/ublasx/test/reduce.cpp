@@ -0,0 +1,309 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/reduce.cpp
+ *
+ * \brief Test suite for the \c reduce operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/max.hpp>
+#include <boost/numeric/ublasx/operation/min.hpp>
+#include <boost/numeric/ublasx/operation/reduce.hpp>
+#include <boost/numeric/ublasx/operation/sum.hpp>
+#include <boost/numeric/ublasx/tags.hpp>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+
+
+BOOST_UBLASX_TEST_DEF( real_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Real Vector" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+
+    vector_type v(5);
+    v(0) =  2.0;
+    v(1) = -1.0;
+    v(2) =  0.0;
+    v(3) =  4.0;
+    v(4) = -1.0;
+
+    result_type res = ublasx::reduce(v);
+
+    BOOST_UBLASX_DEBUG_TRACE( "reduce(" << v << ") = {sum: " << res.sum << ", min: " << res.min << ", max: " << res.max << ", mean: " << res.mean << ", variance: " << res.variance << "}" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count, size_type(5) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.sum, value_type(4), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.min, value_type(-1), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmin_row, size_type(1) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.max, value_type(4), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmax_row, size_type(3) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.mean, value_type(0.8), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.variance, value_type(4.7), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count_nonzero, size_type(4) );
+    BOOST_UBLASX_TEST_CHECK( res.any );
+    BOOST_UBLASX_TEST_CHECK( !res.all );
+}
+
+
+BOOST_UBLASX_TEST_DEF( complex_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Complex Vector" );
+
+    typedef double real_type;
+    typedef ::std::complex<real_type> value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+
+    vector_type v(3);
+    v(0) = value_type(1, 1);
+    v(1) = value_type(3, 0);
+    v(2) = value_type(-1, 2);
+
+    result_type res = ublasx::reduce(v);
+
+    BOOST_UBLASX_DEBUG_TRACE( "reduce(" << v << ") = {sum: " << res.sum << ", min: " << res.min << ", max: " << res.max << ", mean: " << res.mean << ", variance: " << res.variance << "}" );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.sum, value_type(3, 3), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.min, ublasx::min(v), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.max, ublasx::max(v), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmin_row, size_type(0) );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmax_row, size_type(1) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.mean, value_type(1, 1), tol );
+    // |v-mean|^2 = {0, 5, 5}
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.variance, real_type(5), tol );
+    BOOST_UBLASX_TEST_CHECK( res.all );
+}
+
+
+BOOST_UBLASX_TEST_DEF( selected_statistics )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Selected Statistics" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+
+    vector_type v(4);
+    v(0) = 3.0;
+    v(1) = 1.0;
+    v(2) = 2.0;
+    v(3) = 6.0;
+
+    // The mean needs the sum, and the argmax needs the max
+    result_type res = ublasx::reduce(v, ublasx::reduction::mean | ublasx::reduction::argmax);
+
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.mean, value_type(3), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.sum, value_type(12), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.max, value_type(6), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmax_row, size_type(3) );
+    // Not selected
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.min, value_type(0), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.variance, value_type(0), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count_nonzero, size_type(0) );
+    BOOST_UBLASX_TEST_CHECK( !res.all );
+}
+
+
+BOOST_UBLASX_TEST_DEF( empty_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Empty Vector" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+
+    vector_type v(0);
+
+    result_type res = ublasx::reduce(v);
+
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count, size_type(0) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.sum, value_type(0), tol );
+    BOOST_UBLASX_TEST_CHECK( res.mean != res.mean );
+    BOOST_UBLASX_TEST_CHECK( res.variance != res.variance );
+    BOOST_UBLASX_TEST_CHECK( !res.any );
+    BOOST_UBLASX_TEST_CHECK( res.all );
+}
+
+
+/// Checks shared by the matrix test cases (\a test_fails__ is the failure
+/// counter of the calling test case).
+template <typename MatrixT>
+static void test_matrix_impl(MatrixT const& A, ::std::size_t& test_fails__)
+{
+    typedef typename ublas::matrix_traits<MatrixT>::value_type value_type;
+    typedef typename ublas::matrix_traits<MatrixT>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+    typedef ::std::vector<result_type> result_vector_type;
+
+    size_type nr = ublasx::num_rows(A);
+    size_type nc = ublasx::num_columns(A);
+
+    // reduce_all(A)
+    result_type res = ublasx::reduce_all(A);
+    BOOST_UBLASX_DEBUG_TRACE( "reduce_all(" << A << ") = {sum: " << res.sum << ", min: " << res.min << ", max: " << res.max << ", variance: " << res.variance << "}" );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count, nr*nc );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.sum, ublasx::sum_all(A), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.min, ublasx::min(A), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.max, ublasx::max(A), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( A(res.argmin_row, res.argmin_column), res.min, tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( A(res.argmax_row, res.argmax_column), res.max, tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.mean, ublasx::sum_all(A)/value_type(nr*nc), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.variance, value_type(80.25/11.0), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.count_nonzero, size_type(11) );
+
+    // reduce_rows(A)
+    result_vector_type rres = ublasx::reduce_rows(A);
+    ublas::vector<value_type> expect_sum = ublasx::sum_rows(A);
+    ublas::vector<value_type> expect_min = ublasx::min_columns(A);
+    ublas::vector<value_type> expect_max = ublasx::max_columns(A);
+    BOOST_UBLASX_TEST_CHECK_EQ( rres.size(), nc );
+    for (size_type c = 0; c < nc; ++c)
+    {
+        BOOST_UBLASX_TEST_CHECK_EQ( rres[c].count, nr );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( rres[c].sum, expect_sum(c), tol );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( rres[c].min, expect_min(c), tol );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( rres[c].max, expect_max(c), tol );
+        BOOST_UBLASX_TEST_CHECK_EQ( rres[c].argmin_column, c );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( A(rres[c].argmin_row, c), expect_min(c), tol );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( A(rres[c].argmax_row, c), expect_max(c), tol );
+    }
+    // Column 1 is {1, 1, 1}: the first minimum is taken
+    BOOST_UBLASX_TEST_CHECK_EQ( rres[1].argmin_row, size_type(0) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( rres[1].variance, value_type(0), tol );
+    // Column 3 is {4, 0, 8}
+    BOOST_UBLASX_TEST_CHECK_CLOSE( rres[3].variance, value_type(16), tol );
+    BOOST_UBLASX_TEST_CHECK( !rres[3].all );
+    BOOST_UBLASX_TEST_CHECK( rres[3].any );
+
+    // reduce_columns(A)
+    result_vector_type cres = ublasx::reduce_columns(A);
+    expect_sum = ublasx::sum_columns(A);
+    expect_min = ublasx::min_rows(A);
+    expect_max = ublasx::max_rows(A);
+    BOOST_UBLASX_TEST_CHECK_EQ( cres.size(), nr );
+    for (size_type r = 0; r < nr; ++r)
+    {
+        BOOST_UBLASX_TEST_CHECK_EQ( cres[r].count, nc );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( cres[r].sum, expect_sum(r), tol );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( cres[r].min, expect_min(r), tol );
+        BOOST_UBLASX_TEST_CHECK_CLOSE( cres[r].max, expect_max(r), tol );
+        BOOST_UBLASX_TEST_CHECK_EQ( cres[r].argmax_row, r );
+    }
+
+    // reduce<1>(A) and reduce<2>(A)
+    BOOST_UBLASX_TEST_CHECK_CLOSE( ublasx::reduce<1>(A)[2].sum, rres[2].sum, tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( ublasx::reduce<2>(A)[2].sum, cres[2].sum, tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( ublasx::reduce(A).size(), nc );
+}
+
+
+BOOST_UBLASX_TEST_DEF( row_major_matrix_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major Matrix Container" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+    matrix_type A(3, 4);
+
+    A(0,0) = 1; A(0,1) = 1; A(0,2) = 2; A(0,3) = 4;
+    A(1,0) = 5; A(1,1) = 1; A(1,2) = 6; A(1,3) = 0;
+    A(2,0) = 3; A(2,1) = 1; A(2,2) = 7; A(2,3) = 8;
+
+    test_matrix_impl(A, test_fails__);
+
+    // reduce_by_tag<major>(A) reduces over each column (i.e., along the rows)
+    BOOST_UBLASX_TEST_CHECK_EQ( ublasx::reduce_by_tag<ublasx::tag::major>(A).size(), A.size2() );
+    BOOST_UBLASX_TEST_CHECK_EQ( ublasx::reduce_by_tag<ublasx::tag::minor>(A).size(), A.size1() );
+}
+
+
+BOOST_UBLASX_TEST_DEF( col_major_matrix_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Column-major Matrix Container" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    matrix_type A(3, 4);
+
+    A(0,0) = 1; A(0,1) = 1; A(0,2) = 2; A(0,3) = 4;
+    A(1,0) = 5; A(1,1) = 1; A(1,2) = 6; A(1,3) = 0;
+    A(2,0) = 3; A(2,1) = 1; A(2,2) = 7; A(2,3) = 8;
+
+    test_matrix_impl(A, test_fails__);
+
+    BOOST_UBLASX_TEST_CHECK_EQ( ublasx::reduce_by_tag<ublasx::tag::major>(A).size(), A.size1() );
+    BOOST_UBLASX_TEST_CHECK_EQ( ublasx::reduce_by_tag<ublasx::tag::minor>(A).size(), A.size2() );
+}
+
+
+BOOST_UBLASX_TEST_DEF( matrix_expression )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Expression" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ublasx::reduction_result<value_type,size_type> result_type;
+
+    matrix_type A(2, 2);
+
+    A(0,0) = 1; A(0,1) = -2;
+    A(1,0) = 3; A(1,1) =  4;
+
+    result_type res = ublasx::reduce_all(-A, ublasx::reduction::min | ublasx::reduction::argmax | ublasx::reduction::mean);
+
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.min, value_type(-4), tol );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.max, value_type(2), tol );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmax_row, size_type(0) );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.argmax_column, size_type(1) );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res.mean, value_type(-1.5), tol );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'reduce' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( real_vector );
+    BOOST_UBLASX_TEST_DO( complex_vector );
+    BOOST_UBLASX_TEST_DO( selected_statistics );
+    BOOST_UBLASX_TEST_DO( empty_vector );
+    BOOST_UBLASX_TEST_DO( row_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( col_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( matrix_expression );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -18,8 +18,13 @@
 
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
 #include <boost/numeric/ublasx/operation/relational_ops.hpp>
+#include <complex>
+#include <cstddef>
+#include <limits>
 #include "libs/numeric/ublasx/test/utils.hpp"
 
 
@@ -169,6 +174,285 @@ BOOST_UBLASX_TEST_DEF( not_equal_real_matrix )
 }
 
 
+BOOST_UBLASX_TEST_DEF( equal_integer_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Integer Vector - Equality");
+
+    typedef int value_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t n(100);
+
+    vector_type u(n);
+    vector_type v(n);
+
+    bool res;
+    bool expect;
+
+    for (::std::size_t i = 0; i < n; ++i)
+    {
+        u(i) = v(i) = static_cast<value_type>(i*i);
+    }
+    res = u == v;
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("u=" << u);
+    BOOST_UBLASX_DEBUG_TRACE("v=" << v);
+    BOOST_UBLASX_DEBUG_TRACE("u==v? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    v(n-1) = -1;
+    res = u == v;
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("u=" << u);
+    BOOST_UBLASX_DEBUG_TRACE("v=" << v);
+    BOOST_UBLASX_DEBUG_TRACE("u==v? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    v = u;
+    res = u == (v + ublas::zero_vector<value_type>(n));
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("u=" << u);
+    BOOST_UBLASX_DEBUG_TRACE("v=" << v);
+    BOOST_UBLASX_DEBUG_TRACE("u==v+0? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+}
+
+
+BOOST_UBLASX_TEST_DEF( equal_real_long_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Long Vector - Equality");
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t n(1000);
+    const ::std::size_t pos[] = {0, 63, 64, 700, 999};
+    const ::std::size_t npos(sizeof(pos)/sizeof(pos[0]));
+
+    vector_type u(n, 1);
+    vector_type v(n, 1);
+
+    bool res;
+    bool expect;
+
+    // Signed zeros compare equal
+    u(1) = 0.0;
+    v(1) = -0.0;
+    res = u == v;
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("u==v (with +0 and -0)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    for (::std::size_t k = 0; k < npos; ++k)
+    {
+        value_type old(v(pos[k]));
+
+        v(pos[k]) = 2;
+        res = u == v;
+        expect = false;
+        BOOST_UBLASX_DEBUG_TRACE("u==v (differing at " << pos[k] << ")? " << std::boolalpha << res);
+        BOOST_UBLASX_TEST_CHECK( res == expect );
+        v(pos[k]) = old;
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( equal_mixed_layout_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Matrix with Mixed Layouts - Equality");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+
+    const ::std::size_t nr(3);
+    const ::std::size_t nc(4);
+
+    row_major_matrix_type A(nr, nc);
+    col_major_matrix_type B(nr, nc);
+
+    bool res;
+    bool expect;
+
+    for (::std::size_t r = 0; r < nr; ++r)
+    {
+        for (::std::size_t c = 0; c < nc; ++c)
+        {
+            A(r,c) = B(r,c) = r*nc+c;
+        }
+    }
+    res = A == B;
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("A=" << A);
+    BOOST_UBLASX_DEBUG_TRACE("B=" << B);
+    BOOST_UBLASX_DEBUG_TRACE("A==B? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublas::trans(A) == ublas::trans(B);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("A'==B'? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    B(2,1) = -1;
+    res = A == B;
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("A=" << A);
+    BOOST_UBLASX_DEBUG_TRACE("B=" << B);
+    BOOST_UBLASX_DEBUG_TRACE("A==B? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = A == row_major_matrix_type(nc, nr);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("A==zeros(" << nc << "," << nr << ")? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+}
+
+
+BOOST_UBLASX_TEST_DEF( approx_equal_real_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Vector - Approximate Equality");
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+
+    const ::std::size_t n(4);
+
+    vector_type u(n);
+    vector_type v(n);
+
+    bool res;
+    bool expect;
+
+    u(0) = 1.0; u(1) = 1.0e+3; u(2) = 0.0;     u(3) = ::std::numeric_limits<value_type>::infinity();
+    v(0) = 1.0; v(1) = 1.001e+3; v(2) = 1.0e-9; v(3) = ::std::numeric_limits<value_type>::infinity();
+
+    res = ublasx::approx_equal(u, v, 1.0e-2);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("u=" << u);
+    BOOST_UBLASX_DEBUG_TRACE("v=" << v);
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,v,1e-2)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(u, v, 1.0e-2, 1.0e-8);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,v,1e-2,1e-8)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(u, v, 1.0e-4, 1.0e-8);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,v,1e-4,1e-8)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(u, v + ublas::scalar_vector<value_type>(n, 1.0e-10), 1.0e-2, 1.0e-8);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,v+1e-10,1e-2,1e-8)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    v(0) = ::std::numeric_limits<value_type>::quiet_NaN();
+    res = ublasx::approx_equal(u, v, 1.0, 1.0);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("v=" << v);
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,v,1,1)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(u, vector_type(n+1, 1), 1.0, 1.0);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(u,ones(" << (n+1) << "),1,1)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+}
+
+
+BOOST_UBLASX_TEST_DEF( approx_equal_complex_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Complex Matrix - Approximate Equality");
+
+    typedef ::std::complex<double> value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+
+    row_major_matrix_type A(2,3);
+    col_major_matrix_type B(2,3);
+
+    bool res;
+    bool expect;
+
+    A(0,0) = value_type(1, 2); A(0,1) = value_type(3,  4); A(0,2) = value_type(0, 1);
+    A(1,0) = value_type(5, 6); A(1,1) = value_type(7, -8); A(1,2) = value_type(9, 0);
+
+    B = A;
+    B(1,1) += value_type(0, 1.0e-6);
+
+    res = ublasx::approx_equal(A, B, 1.0e-6);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("A=" << A);
+    BOOST_UBLASX_DEBUG_TRACE("B=" << B);
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,1e-6)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(A, B, 1.0e-9);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,1e-9)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(ublas::trans(A), ublas::trans(B), 1.0e-6);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A',B',1e-6)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(A, row_major_matrix_type(B), 1.0e-9, 1.0e-5);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,1e-9,1e-5)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+}
+
+
+BOOST_UBLASX_TEST_DEF( approx_equal_mixed_tolerance_types )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Real Matrix - Approximate Equality - Tolerances of Different Types");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    matrix_type A(2,2);
+    matrix_type B(2,2);
+
+    bool res;
+    bool expect;
+
+    A(0,0) = 1; A(0,1) = 2;
+    A(1,0) = 3; A(1,1) = 0;
+
+    B = A;
+    B(0,1) += 1.0e-7;
+
+    res = ublasx::approx_equal(A, B, 1.0e-6, 0);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("A=" << A);
+    BOOST_UBLASX_DEBUG_TRACE("B=" << B);
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,1e-6,0)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(A, B, 1.0e-9f, 0);
+    expect = false;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,1e-9f,0)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    B(1,1) = 1.0e-10;
+
+    // The absolute tolerance is not truncated to the type of the relative one
+    res = ublasx::approx_equal(A, B, 0, 1.0e-6);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("B=" << B);
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A,B,0,1e-6)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+    res = ublasx::approx_equal(ublas::row(A, 1), ublas::row(B, 1), 1.0e-6f, 1.0e-9);
+    expect = true;
+    BOOST_UBLASX_DEBUG_TRACE("approx_equal(A(1,:),B(1,:),1e-6f,1e-9)? " << std::boolalpha << res);
+    BOOST_UBLASX_TEST_CHECK( res == expect );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
@@ -177,6 +461,12 @@ int main()
     BOOST_UBLASX_TEST_DO( not_equal_real_vector );
     BOOST_UBLASX_TEST_DO( equal_real_matrix );
     BOOST_UBLASX_TEST_DO( not_equal_real_matrix );
+    BOOST_UBLASX_TEST_DO( equal_integer_vector );
+    BOOST_UBLASX_TEST_DO( equal_real_long_vector );
+    BOOST_UBLASX_TEST_DO( equal_mixed_layout_matrix );
+    BOOST_UBLASX_TEST_DO( approx_equal_real_vector );
+    BOOST_UBLASX_TEST_DO( approx_equal_complex_matrix );
+    BOOST_UBLASX_TEST_DO( approx_equal_mixed_tolerance_types );
 
     BOOST_UBLASX_TEST_END();
 }
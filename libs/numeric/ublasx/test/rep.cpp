@@ -122,6 +122,58 @@ BOOST_UBLASX_TEST_DEF( rep_vector )
 }
 
 
+BOOST_UBLASX_TEST_DEF( lazy_rep_matrix )
+{
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::column_major> matrix_type;
+
+    matrix_type A(2,3);
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 3;
+    A(1,0) = 4; A(1,1) = 5; A(1,2) = 6;
+
+    matrix_type E;
+    E = ublasx::rep(A, 6, 4);
+
+    matrix_type X;
+
+    // Element access
+    X = ublasx::lazy_rep(A, 6, 4);
+    BOOST_UBLASX_DEBUG_TRACE("lazy_rep(A, 6, 4)=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 12, 12, tol );
+
+    // Evaluation of nested views
+    X = ublasx::lazy_rep(ublasx::lazy_rep(A, 3, 2), 2).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_rep(lazy_rep(A, 3, 2), 2).eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 12, 12, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lazy_rep_vector )
+{
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    vector_type v(3);
+    v(0) = 1;
+    v(1) = 2;
+    v(2) = 3;
+
+    matrix_type E;
+    E = ublasx::rep(v, 2, 3);
+
+    matrix_type X;
+
+    X = ublasx::lazy_rep(v, 2, 3);
+    BOOST_UBLASX_DEBUG_TRACE("lazy_rep(v, 2, 3)=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 6, 3, tol );
+
+    X = ublasx::lazy_rep(v, 2, 3).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_rep(v, 2, 3).eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 6, 3, tol );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
@@ -129,6 +181,8 @@ int main()
     BOOST_UBLASX_TEST_DO( rep_matrix_col_major );
     BOOST_UBLASX_TEST_DO( rep_matrix_row_major );
     BOOST_UBLASX_TEST_DO( rep_vector );
+    BOOST_UBLASX_TEST_DO( lazy_rep_matrix );
+    BOOST_UBLASX_TEST_DO( lazy_rep_vector );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -727,6 +727,76 @@ BOOST_UBLASX_TEST_DEF( reshape_vec )
 }
 
 
+BOOST_UBLASX_TEST_DEF( lazy_reshape_matrix )
+{
+    typedef double value_type;
+    typedef ublas::matrix<value_type,ublas::row_major> matrix_type;
+    typedef typename ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    const size_type nr(3);
+    const size_type nc(4);
+    const size_type new_nr(2);
+    const size_type new_nc(6);
+
+    matrix_type A(nr,nc);
+
+    A(0,0) =  1; A(0,1) =  4; A(0,2) =  7; A(0,3) = 10;
+    A(1,0) =  2; A(1,1) =  5; A(1,2) =  8; A(1,3) = 11;
+    A(2,0) =  3; A(2,1) =  6; A(2,2) =  9; A(2,3) = 12;
+
+    matrix_type E;
+    matrix_type X;
+
+    // Column-wise (element access and evaluation)
+    E = ublasx::reshape<1>(A, new_nr, new_nc);
+    X = ublasx::lazy_reshape<1>(A, new_nr, new_nc);
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape<1>(A," << new_nr << "," << new_nc << ")=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, new_nr, new_nc, tol );
+    X = ublasx::lazy_reshape(A, new_nr, new_nc).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape(A," << new_nr << "," << new_nc << ").eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, new_nr, new_nc, tol );
+
+    // Row-wise (element access and evaluation)
+    E = ublasx::reshape<2>(A, new_nr, new_nc);
+    X = ublasx::lazy_reshape<2>(A, new_nr, new_nc);
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape<2>(A," << new_nr << "," << new_nc << ")=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, new_nr, new_nc, tol );
+    X = ublasx::lazy_reshape<2>(A, new_nr, new_nc).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape<2>(A," << new_nr << "," << new_nc << ").eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, new_nr, new_nc, tol );
+
+    // Nested views
+    X = ublasx::lazy_reshape(ublasx::lazy_reshape(A, new_nr, new_nc), nr, nc).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape(lazy_reshape(A," << new_nr << "," << new_nc << ")," << nr << "," << nc << ").eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, A, nr, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( lazy_reshape_vec )
+{
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix<value_type> matrix_type;
+
+    vector_type v(6);
+    v(0) = 1; v(1) = 2; v(2) = 3; v(3) = 4; v(4) = 5; v(5) = 6;
+
+    matrix_type E(2,3);
+    E(0,0) = 1; E(0,1) = 3; E(0,2) = 5;
+    E(1,0) = 2; E(1,1) = 4; E(1,2) = 6;
+
+    matrix_type X;
+
+    X = ublasx::lazy_reshape(v, 2, 3);
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape(v,2,3)=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 2, 3, tol );
+
+    X = ublasx::lazy_reshape(v, 2, 3).eval();
+    BOOST_UBLASX_DEBUG_TRACE("lazy_reshape(v,2,3).eval()=" << X);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, E, 2, 3, tol );
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
@@ -755,6 +825,8 @@ int main()
     BOOST_UBLASX_TEST_DO( inplace_reshape_row_major );
 
     BOOST_UBLASX_TEST_DO( reshape_vec );
+    BOOST_UBLASX_TEST_DO( lazy_reshape_matrix );
+    BOOST_UBLASX_TEST_DO( lazy_reshape_vec );
 
     BOOST_UBLASX_TEST_END();
 }
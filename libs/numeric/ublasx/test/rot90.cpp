@@ -164,6 +164,49 @@ BOOST_UBLASX_TEST_DEF( test_real_matrix )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_lazy_real_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "Test Case: Lazy - Real - Matrix" );
+
+    typedef double value_type;
+    typedef std::size_t size_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const size_type nr(2);
+    const size_type nc(3);
+
+    matrix_type A(nr,nc);
+
+    A(0,0) = 1; A(0,1) = 2; A(0,2) = 3;
+    A(1,0) = 4; A(1,1) = 5; A(1,2) = 6;
+
+    matrix_type R;
+    matrix_type expect_R;
+
+    for (int k = -1; k <= 4; ++k)
+    {
+        expect_R = ublasx::rot90(A, k);
+
+        // Element access
+        R = ublasx::lazy_rot90(A, k);
+        BOOST_UBLASX_DEBUG_TRACE( "lazy_rot90(A," << k << ") = " << R );
+        BOOST_UBLASX_TEST_CHECK( R.size1() == expect_R.size1() );
+        BOOST_UBLASX_TEST_CHECK( R.size2() == expect_R.size2() );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, expect_R.size1(), expect_R.size2(), tol );
+
+        // Evaluation
+        R = ublasx::lazy_rot90(A, k).eval();
+        BOOST_UBLASX_DEBUG_TRACE( "lazy_rot90(A," << k << ").eval() = " << R );
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, expect_R, expect_R.size1(), expect_R.size2(), tol );
+    }
+
+    // Nested views
+    R = ublasx::lazy_rot90(ublasx::lazy_rot90(A), 3).eval();
+    BOOST_UBLASX_DEBUG_TRACE( "lazy_rot90(lazy_rot90(A),3).eval() = " << R );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( R, A, nr, nc, tol );
+}
+
+
 int main()
 {
 
@@ -174,6 +217,7 @@ int main()
     BOOST_UBLASX_TEST_DO( test_real_vector );
 //  BOOST_UBLASX_TEST_DO( test_complex_vector );
     BOOST_UBLASX_TEST_DO( test_real_matrix );
+    BOOST_UBLASX_TEST_DO( test_lazy_real_matrix );
 //  BOOST_UBLASX_TEST_DO( test_complex_matrix );
 
     BOOST_UBLASX_TEST_END();
@@ -0,0 +1,214 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/scan.cpp
+ *
+ * \brief Test suite for the \c scan operation.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ * 
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
+#include <algorithm>
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/traits.hpp>
+#include <boost/numeric/ublas/vector.hpp>
+#include <boost/numeric/ublasx/operation/scan.hpp>
+#include <cstddef>
+#include <iostream>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+static const double tol = 1.0e-5;
+
+
+namespace ublas = ::boost::numeric::ublas;
+namespace ublasx = ::boost::numeric::ublasx;
+
+
+namespace /*<unnamed>*/ {
+
+/// Associative and commutative operation: the cumulative maximum.
+struct maximum
+{
+    double operator()(double a, double b) const
+    {
+        return ::std::max(a, b);
+    }
+};
+
+/// Associative but not commutative operation: the first operand.
+struct first_operand
+{
+    double operator()(double a, double) const
+    {
+        return a;
+    }
+};
+
+} // Namespace <unnamed>
+
+
+BOOST_UBLASX_TEST_DEF( test_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Vector" );
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n(6);
+
+    vector_type v(n);
+    v(0) = 2; v(1) = 1; v(2) = 4; v(3) = 3; v(4) = 5; v(5) = 0;
+
+    vector_type expect(n);
+    expect(0) = 2; expect(1) = 2; expect(2) = 4; expect(3) = 4; expect(4) = 5; expect(5) = 5;
+
+    vector_type res;
+
+
+    // scan(v, max)
+    res = ublasx::scan(v, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan(" << v << ", max) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+
+    // scan(2*v, max)
+    res = ublasx::scan(2*v, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan(" << 2*v << ", max) = " << res << " ==> " << 2*expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, 2*expect, n, tol );
+
+    // scan_inplace(v, max)
+    res = v;
+    ublasx::scan_inplace(res, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan_inplace(" << v << ", max) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+
+    // scan(v, first)
+    res = ublasx::scan(v, first_operand());
+    expect = vector_type(n, v(0));
+    BOOST_UBLASX_DEBUG_TRACE( "scan(" << v << ", first) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( res, expect, n, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    size_type nr = 3;
+    size_type nc = 3;
+
+    matrix_type A(nr, nc);
+    A(0,0) = 1; A(0,1) = 7; A(0,2) = 2;
+    A(1,0) = 4; A(1,1) = 3; A(1,2) = 9;
+    A(2,0) = 2; A(2,1) = 8; A(2,2) = 5;
+
+    matrix_type scan_rows(nr, nc);
+    scan_rows(0,0) = 1; scan_rows(0,1) = 7; scan_rows(0,2) = 2;
+    scan_rows(1,0) = 4; scan_rows(1,1) = 7; scan_rows(1,2) = 9;
+    scan_rows(2,0) = 4; scan_rows(2,1) = 8; scan_rows(2,2) = 9;
+
+    matrix_type scan_cols(nr, nc);
+    scan_cols(0,0) = 1; scan_cols(0,1) = 7; scan_cols(0,2) = 7;
+    scan_cols(1,0) = 4; scan_cols(1,1) = 4; scan_cols(1,2) = 9;
+    scan_cols(2,0) = 2; scan_cols(2,1) = 8; scan_cols(2,2) = 8;
+
+    matrix_type res;
+
+
+    // scan(A, max)
+    res = ublasx::scan(A, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan(" << A << ", max) = " << res << " ==> " << scan_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, scan_rows, nr, nc, tol );
+
+    // scan_rows(A, max)
+    res = ublasx::scan_rows(A, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan_rows(" << A << ", max) = " << res << " ==> " << scan_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, scan_rows, nr, nc, tol );
+
+    // scan_columns(A, max)
+    res = ublasx::scan_columns(A, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan_columns(" << A << ", max) = " << res << " ==> " << scan_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( res, scan_cols, nr, nc, tol );
+
+    // scan_rows_inplace(col-major A, max)
+    col_major_matrix_type X(A);
+    ublasx::scan_rows_inplace(X, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan_rows_inplace(" << A << ", max) = " << X << " ==> " << scan_rows );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, scan_rows, nr, nc, tol );
+
+    // scan_columns_inplace(col-major A, max)
+    X = A;
+    ublasx::scan_columns_inplace(X, maximum());
+    BOOST_UBLASX_DEBUG_TRACE( "scan_columns_inplace(" << A << ", max) = " << X << " ==> " << scan_cols );
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE( X, scan_cols, nr, nc, tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Vector" );
+
+    // Long enough to be split among several threads; the operations must be
+    // applied in order even when they are not commutative.
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    size_type n = 300007;
+
+    vector_type v(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = static_cast<value_type>((i*7919) % 100003);
+    }
+
+    vector_type expect(v);
+    for (size_type i = 1; i < n; ++i)
+    {
+        expect(i) = ::std::max(expect(i-1), expect(i));
+    }
+
+    // scan(v, max)
+    vector_type res = ublasx::scan(v, maximum());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
+
+    // scan(v, first)
+    res = ublasx::scan(v, first_operand());
+    expect = vector_type(n, v(0));
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
+}
+
+
+int main()
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'scan' operation");
+
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( test_vector );
+    BOOST_UBLASX_TEST_DO( test_matrix );
+    BOOST_UBLASX_TEST_DO( test_long_vector );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -20,6 +20,7 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
@@ -426,6 +427,147 @@ BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_col_major_matrix_range )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Column-major Matrix Range" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix_range<matrix_type> matrix_range_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    size_type nr = 5;
+    size_type nc = 4;
+
+    matrix_type A(nr, nc);
+
+    A(0,0) = 0.0;      A(0,1) = 0.274690; A(0,2) = 0.0;      A(0,3) = 0.798938;
+    A(1,0) = 0.108929; A(1,1) = 0.0;      A(1,2) = 0.891726; A(1,3) = 0.0;
+    A(2,0) = 0.0;      A(2,1) = 0.0;      A(2,2) = 0.0;      A(2,3) = 0.0;
+    A(3,0) = 0.0;      A(3,1) = 0.675382; A(3,2) = 0.0;      A(3,3) = 0.450332;
+    A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
+
+    // The range selects rows 1-3 and columns 1-2.
+    matrix_range_type R(A, ublas::range(1, 4), ublas::range(1, 3));
+
+    value_type sum_all =   A(1,1)+A(1,2)
+                         + A(2,1)+A(2,2)
+                         + A(3,1)+A(3,2);
+
+    vector_type sum_rows(2);
+    sum_rows(0) = A(1,1)+A(2,1)+A(3,1);
+    sum_rows(1) = A(1,2)+A(2,2)+A(3,2);
+
+    vector_type sum_cols(3);
+    sum_cols(0) = A(1,1)+A(1,2);
+    sum_cols(1) = A(2,1)+A(2,2);
+    sum_cols(2) = A(3,1)+A(3,2);
+
+    value_type expect(0);
+    value_type res(0);
+    vector_type vexpect(0);
+    vector_type vres(0);
+
+
+    // sum_all(R)
+    expect = value_type(sum_all);
+    res = ublasx::sum_all(R);
+    BOOST_UBLASX_DEBUG_TRACE( "sum_all(" << R << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect, tol );
+
+    // sum_rows(R)
+    vexpect = sum_rows;
+    vres = ublasx::sum_rows(R);
+    BOOST_UBLASX_DEBUG_TRACE( "sum_rows(" << R << ") = " << vres << " ==> " << vexpect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+
+    // sum_columns(R)
+    vexpect = sum_cols;
+    vres = ublasx::sum_columns(R);
+    BOOST_UBLASX_DEBUG_TRACE( "sum_columns(" << R << ") = " << vres << " ==> " << vexpect );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_long_matrix_container )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Long Matrix Container" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+
+    // Long enough to be split in several blocks, with a remainder
+    size_type nr = 301;
+    size_type nc = 203;
+
+    row_major_matrix_type A(nr, nc);
+    col_major_matrix_type B(nr, nc);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            A(r,c) = B(r,c) = r+2*c;
+        }
+    }
+
+    value_type sum_all = value_type(nc*nr*(nr-1)/2 + nr*nc*(nc-1));
+
+    vector_type sum_rows(nc);
+    for (size_type c = 0; c < nc; ++c)
+    {
+        sum_rows(c) = value_type(nr*(nr-1)/2 + 2*c*nr);
+    }
+
+    vector_type sum_cols(nr);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        sum_cols(r) = value_type(r*nc + nc*(nc-1));
+    }
+
+    value_type expect(0);
+    value_type res(0);
+    vector_type vexpect(0);
+    vector_type vres(0);
+
+
+    // sum_all(A)
+    expect = sum_all;
+    res = ublasx::sum_all(A);
+    BOOST_UBLASX_DEBUG_TRACE( "sum_all(A) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect, tol );
+
+    // sum_all(B)
+    expect = sum_all;
+    res = ublasx::sum_all(B);
+    BOOST_UBLASX_DEBUG_TRACE( "sum_all(B) = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_CLOSE( res, expect, tol );
+
+    // sum_rows(A)
+    vexpect = sum_rows;
+    vres = ublasx::sum_rows(A);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+
+    // sum_rows(B)
+    vexpect = sum_rows;
+    vres = ublasx::sum_rows(B);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+
+    // sum_columns(A)
+    vexpect = sum_cols;
+    vres = ublasx::sum_columns(A);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+
+    // sum_columns(B)
+    vexpect = sum_cols;
+    vres = ublasx::sum_columns(B);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( vres, vexpect, vexpect.size(), tol );
+}
+
+
 BOOST_UBLASX_TEST_DEF( test_matrix_expression )
 {
     BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Expression" );
@@ -640,6 +782,8 @@ int main()
     BOOST_UBLASX_TEST_DO( test_vector_reference );
     BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
     BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_col_major_matrix_range );
+    BOOST_UBLASX_TEST_DO( test_long_matrix_container );
     BOOST_UBLASX_TEST_DO( test_matrix_expression );
     BOOST_UBLASX_TEST_DO( test_matrix_reference );
 
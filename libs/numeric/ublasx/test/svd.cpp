@@ -21,7 +21,10 @@
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
 #include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
 #include <boost/numeric/ublasx/operation/svd.hpp>
+#include <cmath>
 #include <complex>
 #include <cstddef>
 #include <iostream>
@@ -451,6 +454,231 @@ BOOST_UBLASX_TEST_DEF( svd_oo_complex_row_major_matrix_eco_mode )
 }
 
 
+BOOST_UBLASX_TEST_DEF( singular_values_workspace )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Singular Values - Reusable Workspace");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+
+    const std::size_t n(4);
+    const std::size_t m(3);
+
+    matrix_type A(n,m);
+    A(0,0) = value_type( 5.91,-5.69); A(0,1) = value_type( 7.09, 2.72); A(0,2) = value_type( 7.78,-4.06);
+    A(1,0) = value_type(-3.15,-4.08); A(1,1) = value_type(-1.89, 3.27); A(1,2) = value_type( 4.10,-6.70);
+    A(2,0) = value_type(-4.89, 4.20); A(2,1) = value_type( 4.10,-6.70); A(2,2) = value_type( 3.28,-3.84);
+    A(3,0) = value_type( 7.09, 2.72); A(3,1) = value_type(-3.15,-4.08); A(3,2) = value_type(-1.89, 3.27);
+
+    ublasx::svd_workspace<value_type> ws;
+    vector_type s;
+
+    // First use: the workspace is sized for A
+    ublasx::svd_values(A, s, ws);
+    vector_type expect_s = ublasx::svd_values(A);
+    BOOST_UBLASX_DEBUG_TRACE("s = " << s);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(s, expect_s, m, tol);
+
+    // Same size: the workspace is reused as-is
+    matrix_type B(2.0*A);
+    ublasx::svd_values(B, s, ws);
+    BOOST_UBLASX_DEBUG_TRACE("s = " << s);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(s, 2.0*expect_s, m, tol);
+
+    // Different size: the workspace is resized
+    matrix_type C(ublas::trans(A));
+    ublasx::svd_values(C, s, ws);
+    BOOST_UBLASX_DEBUG_TRACE("s = " << s);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(s, expect_s, m, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( svd_oo_decompose_reuse )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: SVD decomposition class - Repeated Decompositions");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+
+    const std::size_t n(6);
+    const std::size_t m(4);
+
+    matrix_type A(n,m);
+    A(0,0) =  2.27; A(0,1) = -1.54; A(0,2) =  1.15; A(0,3) = -1.94;
+    A(1,0) =  0.28; A(1,1) = -1.67; A(1,2) =  0.94; A(1,3) = -0.78;
+    A(2,0) = -0.48; A(2,1) = -3.09; A(2,2) =  0.99; A(2,3) = -0.21;
+    A(3,0) =  1.07; A(3,1) =  1.22; A(3,2) =  0.79; A(3,3) =  0.63;
+    A(4,0) = -2.35; A(4,1) =  2.93; A(4,2) = -1.45; A(4,3) =  2.30;
+    A(5,0) =  0.62; A(5,1) = -7.39; A(5,2) =  1.03; A(5,3) = -2.57;
+
+    ublasx::svd_decomposition<value_type> expect_full_svd(A, true);
+    ublasx::svd_decomposition<value_type> expect_eco_svd(A, false);
+
+    ublasx::svd_decomposition<value_type> svd;
+
+    svd.decompose(A, true);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.U(), expect_full_svd.U(), n, n, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.S(), expect_full_svd.S(), n, m, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.VH(), expect_full_svd.VH(), m, m, tol);
+
+    svd.decompose(A, false);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.U(), expect_eco_svd.U(), n, m, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.S(), expect_eco_svd.S(), m, m, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.VH(), expect_eco_svd.VH(), m, m, tol);
+
+    svd.decompose(A, true);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.U(), expect_full_svd.U(), n, n, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.S(), expect_full_svd.S(), n, m, tol);
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(svd.VH(), expect_full_svd.VH(), m, m, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( singular_values_gesdd )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Singular Values - Divide-and-Conquer Driver");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+
+    const std::size_t n(6);
+    const std::size_t m(4);
+
+    matrix_type A(n,m);
+    A(0,0) =  2.27; A(0,1) = -1.54; A(0,2) =  1.15; A(0,3) = -1.94;
+    A(1,0) =  0.28; A(1,1) = -1.67; A(1,2) =  0.94; A(1,3) = -0.78;
+    A(2,0) = -0.48; A(2,1) = -3.09; A(2,2) =  0.99; A(2,3) = -0.21;
+    A(3,0) =  1.07; A(3,1) =  1.22; A(3,2) =  0.79; A(3,3) =  0.63;
+    A(4,0) = -2.35; A(4,1) =  2.93; A(4,2) = -1.45; A(4,3) =  2.30;
+    A(5,0) =  0.62; A(5,1) = -7.39; A(5,2) =  1.03; A(5,3) = -2.57;
+
+    vector_type expect_s = ublasx::svd_values(A, ublasx::gesvd_svd_algorithm);
+    vector_type s = ublasx::svd_values(A, ublasx::gesdd_svd_algorithm);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("s = " << s);
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(s, expect_s, m, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( svd_oo_gesdd_real_row_major_matrix_full_mode )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: SVD decomposition class - Divide-and-Conquer Driver - Real Matrix - Row Major - Full Mode");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+
+
+    const std::size_t n(6);
+    const std::size_t m(4);
+
+    matrix_type A(n,m);
+    A(0,0) =  2.27; A(0,1) = -1.54; A(0,2) =  1.15; A(0,3) = -1.94;
+    A(1,0) =  0.28; A(1,1) = -1.67; A(1,2) =  0.94; A(1,3) = -0.78;
+    A(2,0) = -0.48; A(2,1) = -3.09; A(2,2) =  0.99; A(2,3) = -0.21;
+    A(3,0) =  1.07; A(3,1) =  1.22; A(3,2) =  0.79; A(3,3) =  0.63;
+    A(4,0) = -2.35; A(4,1) =  2.93; A(4,2) = -1.45; A(4,3) =  2.30;
+    A(5,0) =  0.62; A(5,1) = -7.39; A(5,2) =  1.03; A(5,3) = -2.57;
+
+    ublasx::svd_decomposition<value_type> expect_svd(A, true, ublasx::gesvd_svd_algorithm);
+    ublasx::svd_decomposition<value_type> svd(A, true, ublasx::gesdd_svd_algorithm);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("U = " << svd.U());
+    BOOST_UBLASX_DEBUG_TRACE("S = " << svd.S());
+    BOOST_UBLASX_DEBUG_TRACE("V^T = " << svd.VH());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(svd.s(), expect_svd.s(), m, tol);
+    matrix_type X;
+    X = ublas::prod(svd.U(), svd.S());
+    X = ublas::prod(X, svd.VH());
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(A, X, n, m, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( svd_oo_gesdd_complex_column_major_matrix_eco_mode )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: SVD decomposition class - Divide-and-Conquer Driver - Complex Matrix - Column Major - Economy Mode");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+
+    const std::size_t n(4);
+    const std::size_t m(6);
+
+    matrix_type A(n,m);
+    A(0,0) = value_type( 0.96, 0.81); A(0,1) = value_type(-0.98,-1.98); A(0,2) = value_type( 0.62, 0.46); A(0,3) = value_type(-0.37,-0.38); A(0,4) = value_type( 0.83,-0.51); A(0,5) = value_type( 1.08, 0.28);
+    A(1,0) = value_type(-0.03,-0.96); A(1,1) = value_type(-1.20,-0.19); A(1,2) = value_type( 1.01,-0.02); A(1,3) = value_type( 0.19, 0.54); A(1,4) = value_type( 0.20,-0.01); A(1,5) = value_type( 0.20, 0.12);
+    A(2,0) = value_type(-0.91,-2.06); A(2,1) = value_type(-0.66,-0.42); A(2,2) = value_type( 0.63, 0.17); A(2,3) = value_type(-0.98, 0.36); A(2,4) = value_type(-0.17, 0.46); A(2,5) = value_type(-0.07,-1.23);
+    A(3,0) = value_type(-0.05,-0.41); A(3,1) = value_type(-0.81,-0.56); A(3,2) = value_type(-1.11,-0.60); A(3,3) = value_type( 0.22, 0.20); A(3,4) = value_type( 1.47,-1.59); A(3,5) = value_type( 0.26,-0.26);
+
+    ublasx::svd_decomposition<value_type> expect_svd(A, false, ublasx::gesvd_svd_algorithm);
+    ublasx::svd_decomposition<value_type> svd(A, false, ublasx::gesdd_svd_algorithm);
+
+    BOOST_UBLASX_DEBUG_TRACE("A = " << A);
+    BOOST_UBLASX_DEBUG_TRACE("U = " << svd.U());
+    BOOST_UBLASX_DEBUG_TRACE("S = " << svd.S());
+    BOOST_UBLASX_DEBUG_TRACE("V^H = " << svd.VH());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(svd.s(), expect_svd.s(), n, tol);
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(svd.U()) == n && ublasx::num_columns(svd.U()) == n );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(svd.VH()) == n && ublasx::num_columns(svd.VH()) == m );
+    matrix_type X;
+    X = ublas::prod(svd.U(), svd.S());
+    X = ublas::prod(X, svd.VH());
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(A, X, n, m, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( svd_oo_auto_algorithm )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: SVD decomposition class - Automatic Driver Selection");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+
+    // Large enough to make the automatic selection choose gesdd
+    const std::size_t n(48);
+    const std::size_t m(40);
+
+    matrix_type A(n,m);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            A(i,j) = std::sin(static_cast<real_type>(7*i+3*j+1)) + ((i == j) ? 2 : 0);
+        }
+    }
+
+    ublasx::svd_decomposition<value_type> expect_svd(A, true, ublasx::gesvd_svd_algorithm);
+
+    ublasx::svd_decomposition<value_type> svd;
+    for (std::size_t k = 0; k < 2; ++k)
+    {
+        // The second time the full mode is disabled
+        const bool full = (k == 0);
+
+        svd.decompose(A, full);
+
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(svd.s(), expect_svd.s(), m, tol);
+        matrix_type X;
+        X = ublas::prod(svd.U(), svd.S());
+        X = ublas::prod(X, svd.VH());
+        BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(A, X, n, m, tol);
+    }
+}
+
+
 int main()
 {
     BOOST_UBLASX_TEST_BEGIN();
@@ -467,6 +695,12 @@ int main()
     BOOST_UBLASX_TEST_DO( svd_oo_real_row_major_matrix_eco_mode );
     BOOST_UBLASX_TEST_DO( svd_oo_complex_column_major_matrix_eco_mode );
     BOOST_UBLASX_TEST_DO( svd_oo_complex_row_major_matrix_eco_mode );
+    BOOST_UBLASX_TEST_DO( singular_values_workspace );
+    BOOST_UBLASX_TEST_DO( svd_oo_decompose_reuse );
+    BOOST_UBLASX_TEST_DO( singular_values_gesdd );
+    BOOST_UBLASX_TEST_DO( svd_oo_gesdd_real_row_major_matrix_full_mode );
+    BOOST_UBLASX_TEST_DO( svd_oo_gesdd_complex_column_major_matrix_eco_mode );
+    BOOST_UBLASX_TEST_DO( svd_oo_auto_algorithm );
 
     BOOST_UBLASX_TEST_END();
 }
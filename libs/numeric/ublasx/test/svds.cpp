@@ -0,0 +1,278 @@
+/* vim: set tabstop=4 expandtab shiftwidth=4 softtabstop=4: */
+
+/**
+ * \file libs/numeric/ublasx/test/svds.cpp
+ *
+ * \brief Test suite for the truncated SVD.
+ *
+ * \author Marco Guazzone (marco.guazzone@gmail.com)
+ *
+ * <hr/>
+ *
+ * Copyright (c) 2010, Marco Guazzone
+ *
+ * Distributed under the Boost Software License, Version 1.0. (See
+ * accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include <boost/numeric/ublas/io.hpp>
+#include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
+#include <boost/numeric/ublasx/detail/debug.hpp>
+#include <boost/numeric/ublasx/operation/eye.hpp>
+#include <boost/numeric/ublasx/operation/num_columns.hpp>
+#include <boost/numeric/ublasx/operation/num_rows.hpp>
+#include <boost/numeric/ublasx/operation/size.hpp>
+#include <boost/numeric/ublasx/operation/svd.hpp>
+#include <boost/numeric/ublasx/operation/svds.hpp>
+#include <complex>
+#include <cstddef>
+#include <iostream>
+#include "libs/numeric/ublasx/test/utils.hpp"
+
+
+namespace ublas = boost::numeric::ublas;
+namespace ublasx = boost::numeric::ublasx;
+
+
+const double tol = 1.0e-8;
+
+
+BOOST_UBLASX_TEST_DEF( svds_real_column_major_randomized )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Truncated SVD - Real Matrix - Column Major - Randomized Method");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t m(60);
+    const std::size_t n(40);
+    const std::size_t k(4);
+
+    matrix_type A(m,n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            A(i,j) = value_type(1)/(i+j+1);
+        }
+    }
+
+    vector_type expect_s = ublasx::svd_values(A);
+
+    ublasx::svds_decomposition<value_type> svds(A, k, ublasx::randomized_svds_method);
+
+    BOOST_UBLASX_DEBUG_TRACE("s = " << svds.s());
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(svds.s()) == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(svds.U()) == m && ublasx::num_columns(svds.U()) == k );
+    BOOST_UBLASX_TEST_CHECK( ublasx::num_rows(svds.VH()) == k && ublasx::num_columns(svds.VH()) == n );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( svds.s(), expect_s, k, tol );
+
+    matrix_type I = ublasx::eye<value_type>(k);
+    matrix_type X;
+    X = ublas::prod(ublas::trans(svds.U()), svds.U());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+    X = ublas::prod(svds.VH(), svds.V());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+    // A v_i = s_i u_i
+    X = ublas::prod(A, svds.V());
+    matrix_type Y;
+    Y = ublas::prod(svds.U(), svds.S());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-Y) <= tol*ublas::norm_frobenius(Y) );
+}
+
+
+BOOST_UBLASX_TEST_DEF( svds_real_row_major_lanczos )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Truncated SVD - Real Matrix - Row Major - Lanczos Method");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t m(40);
+    const std::size_t n(60);
+    const std::size_t k(4);
+
+    matrix_type A(m,n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            A(i,j) = value_type(1)/(i+j+1);
+        }
+    }
+
+    vector_type expect_s = ublasx::svd_values(A);
+    vector_type s = ublasx::svds_values(A, k, ublasx::lanczos_svds_method);
+
+    BOOST_UBLASX_DEBUG_TRACE("s = " << s);
+    BOOST_UBLASX_TEST_CHECK( ublasx::size(s) == k );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( s, expect_s, k, tol );
+
+    ublasx::svds_decomposition<value_type> svds = ublasx::svds_decompose(A, k, ublasx::lanczos_svds_method);
+
+    matrix_type I = ublasx::eye<value_type>(k);
+    matrix_type X;
+    X = ublas::prod(ublas::trans(svds.U()), svds.U());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+    X = ublas::prod(svds.VH(), svds.V());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+    X = ublas::prod(A, svds.V());
+    matrix_type Y;
+    Y = ublas::prod(svds.U(), svds.S());
+    BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-Y) <= tol*ublas::norm_frobenius(Y) );
+}
+
+
+BOOST_UBLASX_TEST_DEF( svds_complex_row_major )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Truncated SVD - Complex Matrix - Row Major");
+
+    typedef double real_type;
+    typedef std::complex<real_type> value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t m(30);
+    const std::size_t n(20);
+    const std::size_t k(3);
+
+    matrix_type A(m,n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            A(i,j) = value_type(1, 0.1*(real_type(i)-real_type(j)))/real_type(i+j+1);
+        }
+    }
+
+    vector_type expect_s = ublasx::svd_values(A);
+
+    ublasx::svds_decomposition<value_type> svds;
+    for (std::size_t t = 0; t < 2; ++t)
+    {
+        const ublasx::svds_method method = (t == 0) ? ublasx::randomized_svds_method : ublasx::lanczos_svds_method;
+
+        svds.decompose(A, k, method);
+
+        BOOST_UBLASX_DEBUG_TRACE("s = " << svds.s());
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( svds.s(), expect_s, k, tol );
+
+        matrix_type I = ublasx::eye<value_type>(k);
+        matrix_type X;
+        X = ublas::prod(ublas::herm(svds.U()), svds.U());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+        X = ublas::prod(A, svds.V());
+        matrix_type Y;
+        Y = ublas::prod(svds.U(), svds.S());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-Y) <= tol*ublas::norm_frobenius(Y) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( svds_sparse )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Truncated SVD - Sparse Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> sparse_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::vector<real_type> vector_type;
+
+    const std::size_t m(50);
+    const std::size_t n(30);
+    const std::size_t k(3);
+
+    sparse_matrix_type A(m,n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        A(i, i % n) = value_type(n)/(i+1);
+        A(i, (3*i+1) % n) = 1;
+    }
+
+    vector_type expect_s = ublasx::svd_values(matrix_type(A));
+
+    for (std::size_t t = 0; t < 2; ++t)
+    {
+        const ublasx::svds_method method = (t == 0) ? ublasx::randomized_svds_method : ublasx::lanczos_svds_method;
+
+        ublasx::svds_decomposition<value_type> svds;
+        svds.oversampling(n);
+        svds.decompose(A, k, method);
+
+        BOOST_UBLASX_DEBUG_TRACE("s = " << svds.s());
+        BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE( svds.s(), expect_s, k, tol );
+
+        matrix_type X;
+        X = ublas::prod(A, svds.V());
+        matrix_type Y;
+        Y = ublas::prod(svds.U(), svds.S());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-Y) <= tol*ublas::norm_frobenius(Y) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( svds_rank_deficient )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Truncated SVD - Rank Deficient Matrix");
+
+    typedef double real_type;
+    typedef real_type value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+
+    const std::size_t m(10);
+    const std::size_t n(7);
+    const std::size_t k(5);
+
+    // Rank 3 matrix
+    matrix_type A(m,n);
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            A(i,j) = value_type(i+1)*(j+2) + ((i+j) % 2);
+        }
+    }
+
+    for (std::size_t t = 0; t < 2; ++t)
+    {
+        const ublasx::svds_method method = (t == 0) ? ublasx::randomized_svds_method : ublasx::lanczos_svds_method;
+
+        ublasx::svds_decomposition<value_type> svds(A, k, method);
+
+        BOOST_UBLASX_DEBUG_TRACE("s = " << svds.s());
+        BOOST_UBLASX_TEST_CHECK( ublasx::size(svds.s()) == k );
+        BOOST_UBLASX_TEST_CHECK( svds.s()(3) <= tol*svds.s()(0) );
+        BOOST_UBLASX_TEST_CHECK( svds.s()(4) <= tol*svds.s()(0) );
+
+        matrix_type I = ublasx::eye<value_type>(k);
+        matrix_type X;
+        X = ublas::prod(ublas::trans(svds.U()), svds.U());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+        X = ublas::prod(svds.VH(), svds.V());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-I) <= tol );
+        X = ublas::prod(svds.U(), svds.S());
+        X = ublas::prod(X, svds.VH());
+        BOOST_UBLASX_TEST_CHECK( ublas::norm_frobenius(X-A) <= tol*ublas::norm_frobenius(A) );
+    }
+}
+
+
+int main()
+{
+    BOOST_UBLASX_TEST_BEGIN();
+
+    BOOST_UBLASX_TEST_DO( svds_real_column_major_randomized );
+    BOOST_UBLASX_TEST_DO( svds_real_row_major_lanczos );
+    BOOST_UBLASX_TEST_DO( svds_complex_row_major );
+    BOOST_UBLASX_TEST_DO( svds_sparse );
+    BOOST_UBLASX_TEST_DO( svds_rank_deficient );
+
+    BOOST_UBLASX_TEST_END();
+}
@@ -16,10 +16,18 @@
  * http://www.boost.org/LICENSE_1_0.txt)
  */
 
+// Split long containers among several threads even on single-core machines
+#ifndef BOOST_UBLASX_NUM_THREADS
+# define BOOST_UBLASX_NUM_THREADS 4
+#endif // BOOST_UBLASX_NUM_THREADS
+
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
+#include <boost/numeric/ublasx/execution.hpp>
 #include <boost/numeric/ublasx/operation/transform.hpp>
 #include <boost/numeric/ublas/traits.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <cmath>
 #include "libs/numeric/ublasx/test/utils.hpp"
 
@@ -48,6 +56,26 @@ struct my_functor: public std::unary_function<AT, RT>
 };
 
 
+template <typename T>
+struct my_stateful_functor
+{
+    typedef T argument_type;
+    typedef T result_type;
+
+    explicit my_stateful_functor(T const& offset)
+    : offset_(offset)
+    {
+    }
+
+    T operator()(T const& x) const
+    {
+        return x + offset_;
+    }
+
+    T offset_;
+};
+
+
 BOOST_UBLASX_TEST_DEF( test_vector_function )
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Case: Vector - Unary Function");
@@ -186,6 +214,159 @@ BOOST_UBLASX_TEST_DEF( test_matrix_functor )
 }
 
 
+BOOST_UBLASX_TEST_DEF( test_vector_stateful_functor )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Vector - Stateful Unary Functor");
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef my_stateful_functor<value_type> functor_type;
+
+    // The functor must be stored as-is, without any type-erasure
+    BOOST_STATIC_ASSERT((::boost::is_same<
+                            ublasx::vector_unary_functor_traits<vector_type,functor_type>::expression_type::functor_type,
+                            functor_type
+                        >::value));
+
+    const std::size_t n(4);
+
+    vector_type v(n);
+    v(0) = -1;
+    v(1) =  2;
+    v(2) =  3;
+    v(3) = -4;
+
+    vector_type res;
+    vector_type expect_res(n);
+
+    res = ublasx::transform(v, functor_type(0.5));
+
+    BOOST_UBLASX_DEBUG_TRACE( "v = " << v );
+    BOOST_UBLASX_DEBUG_TRACE( "res = " << res );
+
+    for (size_type i = 0; i < n; ++i)
+    {
+        expect_res(i) = v(i)+0.5;
+    }
+
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(res, expect_res, n, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_matrix_stateful_functor )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Matrix - Stateful Unary Functor");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef my_stateful_functor<value_type> functor_type;
+
+    // The functor must be stored as-is, without any type-erasure
+    BOOST_STATIC_ASSERT((::boost::is_same<
+                            ublasx::matrix_unary_functor_traits<matrix_type,functor_type>::expression_type::functor_type,
+                            functor_type
+                        >::value));
+
+    const std::size_t nr(3);
+    const std::size_t nc(2);
+
+    matrix_type A(nr,nc);
+    A(0,0) = -1; A(0,1) =  2;
+    A(1,0) =  3; A(1,1) = -4;
+    A(2,0) = -5; A(2,1) = -6;
+
+    matrix_type R;
+    matrix_type expect_R(nr,nc);
+
+    R = ublasx::transform(A, functor_type(-2));
+
+    BOOST_UBLASX_DEBUG_TRACE( "A = " << A );
+    BOOST_UBLASX_DEBUG_TRACE( "R = " << R );
+
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            expect_R(r,c) = A(r,c)-2;
+        }
+    }
+
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(R, expect_R, nr, nc, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_vector_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Vector - Execution Policy");
+
+    typedef double value_type;
+    typedef ublas::vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+
+    // Long enough to be split among several threads
+    const size_type n(300007);
+
+    vector_type v(n);
+    vector_type expect_w(n);
+    for (size_type i = 0; i < n; ++i)
+    {
+        v(i) = (i % 2) ? -value_type(i) : value_type(i);
+        expect_w(i) = value_type(i);
+    }
+
+    vector_type w;
+
+    w = ublasx::transform(ublasx::execution::seq, v, my_functor<value_type,value_type>());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(w, expect_w, n, tol);
+
+    w = ublasx::transform(ublasx::execution::par, v, my_functor<value_type,value_type>());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(w, expect_w, n, tol);
+
+    w = ublasx::transform(ublasx::execution::par_unseq, v, my_functor<value_type,value_type>());
+    BOOST_UBLASX_TEST_CHECK_VECTOR_CLOSE(w, expect_w, n, tol);
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_matrix_policy )
+{
+    BOOST_UBLASX_DEBUG_TRACE("Test Case: Matrix - Execution Policy");
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+
+    // Long enough to be split among several threads
+    const size_type nr(701);
+    const size_type nc(503);
+
+    matrix_type A(nr,nc);
+    matrix_type expect_R(nr,nc);
+    for (size_type r = 0; r < nr; ++r)
+    {
+        for (size_type c = 0; c < nc; ++c)
+        {
+            A(r,c) = (r % 2) ? -value_type(r+c) : value_type(r*c);
+            expect_R(r,c) = my_stateful_functor<value_type>(1)(A(r,c));
+        }
+    }
+
+    matrix_type R;
+
+    R = ublasx::transform(ublasx::execution::seq, A, my_stateful_functor<value_type>(1));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(R, expect_R, nr, nc, tol);
+
+    // Storage order
+    R = ublasx::transform(ublasx::execution::par, A, my_stateful_functor<value_type>(1));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(R, expect_R, nr, nc, tol);
+
+    // Blocks of columns
+    R = ublas::trans(ublasx::transform(ublasx::execution::par_unseq, ublas::trans(A), my_stateful_functor<value_type>(1)));
+    BOOST_UBLASX_TEST_CHECK_MATRIX_CLOSE(R, expect_R, nr, nc, tol);
+}
+
+
 int main()
 {
     BOOST_UBLASX_DEBUG_TRACE("Test Suite: 'transform' operation");
@@ -196,6 +377,10 @@ int main()
     BOOST_UBLASX_TEST_DO( test_vector_functor );
     BOOST_UBLASX_TEST_DO( test_matrix_function );
     BOOST_UBLASX_TEST_DO( test_matrix_functor );
+    BOOST_UBLASX_TEST_DO( test_vector_stateful_functor );
+    BOOST_UBLASX_TEST_DO( test_matrix_stateful_functor );
+    BOOST_UBLASX_TEST_DO( test_vector_policy );
+    BOOST_UBLASX_TEST_DO( test_matrix_policy );
 
     BOOST_UBLASX_TEST_END();
 }
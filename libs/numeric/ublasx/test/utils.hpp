@@ -90,6 +90,11 @@ bool close_to(T1 x, T2 y, T3 tol)
         // According to IEEE, NaN is different even by itself
         return false;
     }
+    if (x == y)
+    {
+        // Also handles infinities of the same sign (whose difference is NaN)
+        return true;
+    }
     return ::std::abs(x-y) <= (::std::max(static_cast<real_type>(::std::abs(x)), static_cast<real_type>(::std::abs(y)))*tol);
 }
 
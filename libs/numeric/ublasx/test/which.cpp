@@ -20,13 +20,18 @@
 #include <boost/numeric/ublas/io.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 #include <boost/numeric/ublas/matrix_expression.hpp>
+#include <boost/numeric/ublas/matrix_proxy.hpp>
+#include <boost/numeric/ublas/matrix_sparse.hpp>
 #include <boost/numeric/ublas/traits.hpp>
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/vector_expression.hpp>
+#include <boost/numeric/ublas/vector_sparse.hpp>
 #include <boost/numeric/ublasx/operation/which.hpp>
 #include <boost/numeric/ublasx/tags.hpp>
 #include <functional>
+#include <algorithm>
 #include <iostream>
+#include <utility>
 #include "libs/numeric/ublasx/test/utils.hpp"
 
 
@@ -81,7 +86,7 @@ BOOST_UBLASX_TEST_DEF( test_vector_container )
     val = 0.5;
     expect = out_vector_type(1);
     expect(0) = 4;
-    res = ublasx::which(v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 1 );
 
@@ -93,7 +98,7 @@ BOOST_UBLASX_TEST_DEF( test_vector_container )
     expect(2) = 2;
     expect(3) = 3;
     expect(4) = 4;
-    res = ublasx::which(v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
@@ -137,7 +142,7 @@ BOOST_UBLASX_TEST_DEF( test_vector_expression )
     expect(1) = 1;
     expect(2) = 2;
     expect(3) = 3;
-    res = ublasx::which(-v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(-v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << -v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 4 );
 
@@ -149,7 +154,7 @@ BOOST_UBLASX_TEST_DEF( test_vector_expression )
     expect(2) = 2;
     expect(3) = 3;
     expect(4) = 4;
-    res = ublasx::which(-v, ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(-v, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << -v << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
@@ -191,7 +196,7 @@ BOOST_UBLASX_TEST_DEF( test_vector_reference )
     val = 0.5;
     expect = out_vector_type(1);
     expect(0) = 4;
-    res = ublasx::which(vector_reference_type(v), ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(vector_reference_type(v), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << vector_reference_type(v) << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 1 );
 
@@ -203,20 +208,21 @@ BOOST_UBLASX_TEST_DEF( test_vector_reference )
     expect(2) = 2;
     expect(3) = 3;
     expect(4) = 4;
-    res = ublasx::which(vector_reference_type(v), ::std::bind2nd(::std::greater<value_type>(), val));
+    res = ublasx::which(vector_reference_type(v), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
     BOOST_UBLASX_DEBUG_TRACE( "which(" << vector_reference_type(v) << ", > " << val << ") = " << res << " ==> " << expect );
     BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, n );
 }
 
 
-/*
 BOOST_UBLASX_TEST_DEF( test_row_major_matrix_container )
 {
     BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major Matrix Container" );
 
     typedef double value_type;
     typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
-    typedef ublas::zero_matrix<value_type> zero_matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -226,38 +232,48 @@ BOOST_UBLASX_TEST_DEF( test_row_major_matrix_container )
     A(3,0) = 0.0;      A(3,1) = 0.675382; A(3,2) = 0.0;      A(3,3) = 0.450332;
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
-    zero_matrix_type Z(5, 4);
-
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
-
-    // all(Z)
-    expect = false;
-    res = ublasx::all(Z);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << Z << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A)
-    expect = false;
-    res = ublasx::all(A);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > .5)
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(A)
+    expect = out_vector_type(10);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(4,0);
+    expect(2) = position_type(0,1);
+    expect(3) = position_type(3,1);
+    expect(4) = position_type(4,1);
+    expect(5) = position_type(1,2);
+    expect(6) = position_type(4,2);
+    expect(7) = position_type(0,3);
+    expect(8) = position_type(3,3);
+    expect(9) = position_type(4,3);
+    res = ublasx::which(A);
+    BOOST_UBLASX_DEBUG_TRACE( "which(A) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(A, > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > -.1)
-    val = -0.1;
-    expect = true;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = position_type(4,0);
+    expect(1) = position_type(3,1);
+    expect(2) = position_type(4,1);
+    expect(3) = position_type(1,2);
+    expect(4) = position_type(4,2);
+    expect(5) = position_type(0,3);
+    expect(6) = position_type(4,3);
+    res = ublasx::which(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(A, > " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
 }
 
 
@@ -267,6 +283,9 @@ BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
 
     typedef double value_type;
     typedef ublas::matrix<value_type, ublas::column_major> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -277,29 +296,47 @@ BOOST_UBLASX_TEST_DEF( test_col_major_matrix_container )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
-
-    // all(A)
-    expect = false;
-    res = ublasx::all(A);
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > .5)
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(A)
+    expect = out_vector_type(10);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(4,0);
+    expect(2) = position_type(0,1);
+    expect(3) = position_type(3,1);
+    expect(4) = position_type(4,1);
+    expect(5) = position_type(1,2);
+    expect(6) = position_type(4,2);
+    expect(7) = position_type(0,3);
+    expect(8) = position_type(3,3);
+    expect(9) = position_type(4,3);
+    res = ublasx::which(A);
+    BOOST_UBLASX_DEBUG_TRACE( "which(A) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(A, > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A, > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(A, ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << ", > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = position_type(4,0);
+    expect(1) = position_type(3,1);
+    expect(2) = position_type(4,1);
+    expect(3) = position_type(1,2);
+    expect(4) = position_type(4,2);
+    expect(5) = position_type(0,3);
+    expect(6) = position_type(4,3);
+    res = ublasx::which(A, ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(A, > " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
 }
 
 
@@ -308,7 +345,10 @@ BOOST_UBLASX_TEST_DEF( test_matrix_expression )
     BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Expression" );
 
     typedef double value_type;
-    typedef ublas::matrix<value_type> matrix_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -319,29 +359,47 @@ BOOST_UBLASX_TEST_DEF( test_matrix_expression )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
-
-
-    // all(A')
-    expect = false;
-    res = ublasx::all(ublas::trans(A));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "') = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A', > .5)
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(A')
+    expect = out_vector_type(10);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(3,0);
+    expect(2) = position_type(0,1);
+    expect(3) = position_type(2,1);
+    expect(4) = position_type(1,3);
+    expect(5) = position_type(3,3);
+    expect(6) = position_type(0,4);
+    expect(7) = position_type(1,4);
+    expect(8) = position_type(2,4);
+    expect(9) = position_type(3,4);
+    res = ublasx::which(ublas::trans(A));
+    BOOST_UBLASX_DEBUG_TRACE( "which(A') = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(A', > .5)
     val = 0.5;
-    expect = false;
-    res = ublasx::all(ublas::trans(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "', > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
-
-    // all(A', > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(ublas::trans(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(" << A << "', > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(7);
+    expect(0) = position_type(3,0);
+    expect(1) = position_type(2,1);
+    expect(2) = position_type(1,3);
+    expect(3) = position_type(0,4);
+    expect(4) = position_type(1,4);
+    expect(5) = position_type(2,4);
+    expect(6) = position_type(3,4);
+    res = ublasx::which(ublas::trans(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(A', > " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
 }
 
 
@@ -350,8 +408,10 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
     BOOST_UBLASX_DEBUG_TRACE( "TEST Matrix Reference" );
 
     typedef double value_type;
-    typedef ublas::matrix<value_type> matrix_type;
-    typedef ublas::matrix_reference<matrix_type> matrix_reference_type;
+    typedef ublas::matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
 
     matrix_type A(5,4);
 
@@ -362,31 +422,220 @@ BOOST_UBLASX_TEST_DEF( test_matrix_reference )
     A(4,0) = 1.023787; A(4,1) = 1.0;      A(4,2) = 1.231751; A(4,3) = 1.0;
 
     value_type val(0);
-    bool expect(false);
-    bool res(false);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(ref(A))
+    expect = out_vector_type(10);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(4,0);
+    expect(2) = position_type(0,1);
+    expect(3) = position_type(3,1);
+    expect(4) = position_type(4,1);
+    expect(5) = position_type(1,2);
+    expect(6) = position_type(4,2);
+    expect(7) = position_type(0,3);
+    expect(8) = position_type(3,3);
+    expect(9) = position_type(4,3);
+    res = ublasx::which(ublas::matrix_reference<matrix_type>(A));
+    BOOST_UBLASX_DEBUG_TRACE( "which(ref(A)) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(ref(A), > .5)
+    val = 0.5;
+    expect = out_vector_type(7);
+    expect(0) = position_type(4,0);
+    expect(1) = position_type(3,1);
+    expect(2) = position_type(4,1);
+    expect(3) = position_type(1,2);
+    expect(4) = position_type(4,2);
+    expect(5) = position_type(0,3);
+    expect(6) = position_type(4,3);
+    res = ublasx::which(ublas::matrix_reference<matrix_type>(A), ::std::bind(::std::greater<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(ref(A), > " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+}
 
 
-    // all(ref(A))
-    expect = false;
-    res = ublasx::all(matrix_reference_type(A));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << ")) = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+BOOST_UBLASX_TEST_DEF( test_sparse_vector )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Sparse Vector" );
+
+    typedef double value_type;
+    typedef ublas::mapped_vector<value_type> vector_type;
+    typedef ublas::vector_traits<vector_type>::size_type size_type;
+    typedef ublas::vector<size_type> out_vector_type;
 
-    // all(ref(A), > .5)
+    vector_type v(6);
+
+    v(1) = 0.108929;
+    v(3) = -0.5;
+    v(4) = 1.023787;
+
+    value_type val(0);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(v)
+    expect = out_vector_type(3);
+    expect(0) = 1;
+    expect(1) = 3;
+    expect(2) = 4;
+    res = ublasx::which(v);
+    BOOST_UBLASX_DEBUG_TRACE( "which(" << v << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 3 );
+
+    // which(v, < .5): elements which are not stored satisfy the predicate
     val = 0.5;
-    expect = false;
-    res = ublasx::all(matrix_reference_type(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << "), > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+    expect = out_vector_type(5);
+    expect(0) = 0;
+    expect(1) = 1;
+    expect(2) = 2;
+    expect(3) = 3;
+    expect(4) = 5;
+    res = ublasx::which(v, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(" << v << ", < " << val << ") = " << res << " ==> " << expect );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    BOOST_UBLASX_TEST_CHECK_VECTOR_EQ( res, expect, 5 );
+}
 
-    // all(ref(A), > -.5)
-    val = -0.5;
-    expect = true;
-    res = ublasx::all(matrix_reference_type(A), ::std::bind2nd(::std::greater<value_type>(), val));
-    BOOST_UBLASX_DEBUG_TRACE( "all(reference(" << A << "), > " << val << ") = " << ::std::boolalpha << res << " ==> " << expect );
-    BOOST_UBLASX_TEST_CHECK( res == expect );
+
+BOOST_UBLASX_TEST_DEF( test_sparse_matrix )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Sparse Matrix" );
+
+    typedef double value_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::matrix_traits<matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
+
+    matrix_type A(3,3);
+
+    A(0,1) = 0.274690;
+    A(1,0) = 0.108929;
+    A(1,2) = 0.891726;
+    A(2,1) = 1.0;
+
+    col_major_matrix_type B(A);
+
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(A)
+    expect = out_vector_type(4);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(0,1);
+    expect(2) = position_type(2,1);
+    expect(3) = position_type(1,2);
+    res = ublasx::which(A);
+    BOOST_UBLASX_DEBUG_TRACE( "which(" << A << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(col-major A)
+    expect = out_vector_type(4);
+    expect(0) = position_type(1,0);
+    expect(1) = position_type(0,1);
+    expect(2) = position_type(2,1);
+    expect(3) = position_type(1,2);
+    res = ublasx::which(B);
+    BOOST_UBLASX_DEBUG_TRACE( "which(" << B << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+}
+
+
+BOOST_UBLASX_TEST_DEF( test_storage_layout )
+{
+    BOOST_UBLASX_DEBUG_TRACE( "TEST Row-major and Column-major Storage Layouts" );
+
+    typedef double value_type;
+    typedef ublas::matrix<value_type, ublas::row_major> row_major_matrix_type;
+    typedef ublas::matrix<value_type, ublas::column_major> col_major_matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::row_major> row_major_sparse_matrix_type;
+    typedef ublas::compressed_matrix<value_type, ublas::column_major> col_major_sparse_matrix_type;
+    typedef ublas::matrix_traits<row_major_matrix_type>::size_type size_type;
+    typedef ::std::pair<size_type,size_type> position_type;
+    typedef ublas::vector<position_type> out_vector_type;
+
+    row_major_matrix_type A(3,4);
+
+    A(0,0) = 0.0;      A(0,1) = 0.274690; A(0,2) = 0.0;      A(0,3) = 0.798938;
+    A(1,0) = 0.108929; A(1,1) = 0.0;      A(1,2) = 0.891726; A(1,3) = 0.0;
+    A(2,0) = 0.0;      A(2,1) = 0.675382; A(2,2) = 1.231751; A(2,3) = 0.0;
+
+    col_major_matrix_type B(A);
+    row_major_sparse_matrix_type C(A);
+    col_major_sparse_matrix_type D(A);
+
+    value_type val(0.5);
+    out_vector_type expect;
+    out_vector_type res;
+
+
+    // which(A) is the same for every storage layout
+    expect = ublasx::which(B);
+    BOOST_UBLASX_DEBUG_TRACE( "which(col-major A) = " << expect.size() << " positions" );
+    res = ublasx::which(A);
+    BOOST_UBLASX_DEBUG_TRACE( "which(row-major A) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+    res = ublasx::which(C);
+    BOOST_UBLASX_DEBUG_TRACE( "which(row-major sparse A) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+    res = ublasx::which(D);
+    BOOST_UBLASX_DEBUG_TRACE( "which(col-major sparse A) = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+
+    // which(A, < .5), which is satisfied by the elements which are not stored
+    expect = ublasx::which(B, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(col-major A, < " << val << ") = " << expect.size() << " positions" );
+    res = ublasx::which(A, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(row-major A, < " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
+    res = ublasx::which(C, ::std::bind(::std::less<value_type>(), ::std::placeholders::_1, val));
+    BOOST_UBLASX_DEBUG_TRACE( "which(row-major sparse A, < " << val << ") = " << res.size() << " positions ==> " << expect.size() );
+    BOOST_UBLASX_TEST_CHECK_EQ( res.size(), expect.size() );
+    for (size_type i = 0; i < ::std::min(res.size(), expect.size()); ++i)
+    {
+        BOOST_UBLASX_TEST_CHECK( res(i) == expect(i) );
+    }
 }
-*/
 
 
 int main()
@@ -398,10 +647,13 @@ int main()
     BOOST_UBLASX_TEST_DO( test_vector_container );
     BOOST_UBLASX_TEST_DO( test_vector_expression );
     BOOST_UBLASX_TEST_DO( test_vector_reference );
-//  BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
-//  BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
-//  BOOST_UBLASX_TEST_DO( test_matrix_expression );
-//  BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_row_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_col_major_matrix_container );
+    BOOST_UBLASX_TEST_DO( test_matrix_expression );
+    BOOST_UBLASX_TEST_DO( test_matrix_reference );
+    BOOST_UBLASX_TEST_DO( test_sparse_vector );
+    BOOST_UBLASX_TEST_DO( test_sparse_matrix );
+    BOOST_UBLASX_TEST_DO( test_storage_layout );
 
     BOOST_UBLASX_TEST_END();
 }
@@ -0,0 +1,23 @@
+#!/bin/sh
+#
+# Run every benchmark binary and collect its measures (one JSON object per
+# line) on the standard output.
+# Any argument is forwarded to the benchmarks as the problem sizes to use.
+#
+
+base_path=.
+bench_path="$base_path/libs/numeric/ublasx/bench"
+
+bench_files=$(ls $bench_path/*.cpp)
+
+for f in $bench_files; do
+	f=$(basename $f .cpp)
+
+	b="$bench_path/$f"
+
+	if [ -x $b ]; then
+		echo "--- $f" >&2
+
+		$b "$@"
+	fi
+done